@@ -4,6 +4,7 @@ export ASAN_SYMBOLIZER_PATH=/usr/lib/llvm-6.0/bin/llvm-symbolizer
 cd /slang
 make -C build -j 8
 build/bin/unittests
+(cd build && ctest --output-on-failure)
 bash <(curl -s https://codecov.io/bash) -x 'llvm-cov-6.0 gcov' -X gcovout || echo 'Codecov failed to upload'
 FILES=$(find source -type f -name '*.cpp')
 for f in $FILES; do
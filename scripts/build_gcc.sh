@@ -3,4 +3,5 @@ set -ev
 cd /slang
 make -C build -j 8
 build/bin/unittests
+(cd build && ctest --output-on-failure)
 /tmp/cppcheck/cppcheck source -I. -Iexternal -Isource -q --enable=warning,performance,portability --inconclusive --suppressions-list=scripts/cppcheck_suppressions.txt
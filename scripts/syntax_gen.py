@@ -5,14 +5,27 @@ import os
 
 class TypeInfo:
 	def __init__(self, processedMembers, members, pointerMembers, final,
-				 constructorArgs, base, memberCount):
+				 constructorArgs, base, children):
 		self.processedMembers = processedMembers
 		self.members = members
 		self.pointerMembers = pointerMembers
 		self.final = final
 		self.constructorArgs = constructorArgs
 		self.base = base
-		self.memberCount = memberCount
+		self.children = children
+
+def readSyntaxKinds(path):
+	# Pull the list of kinds out of the SyntaxKind enum so that the child
+	# table can be laid out in the same order and indexed directly.
+	text = open(path).read()
+	start = text.index('enum class SyntaxKind')
+	body = text[text.index('{', start) + 1:text.index('};', start)]
+	kinds = []
+	for line in body.split('\n'):
+		line = line.split('//')[0].strip().rstrip(',')
+		if line:
+			kinds.append(line)
+	return kinds
 
 def main():
 	ourdir = os.path.dirname(os.path.realpath(__file__))
@@ -47,6 +60,8 @@ namespace slang {
 //------------------------------------------------------------------------------
 #include "AllSyntax.h"
 
+#include <cstddef>
+
 // This file contains all parse tree syntax node generated definitions.
 // It is auto-generated by the syntax_gen.py script under the tools/ directory.
 
@@ -61,7 +76,7 @@ namespace slang {
 	alltypes = {}
 	kindmap = {}
 
-	alltypes['SyntaxNode'] = TypeInfo(None, None, None, '', None, None, 0)
+	alltypes['SyntaxNode'] = TypeInfo(None, None, None, '', None, None, [])
 
 	for line in [x.strip('\n') for x in inf]:
 		if line.startswith('//'):
@@ -95,19 +110,73 @@ namespace slang {
 	if currtype:
 		generate(outf, currtype_name, tags, currtype, alltypes, kindmap)
 
-	cppf.write('uint32_t SyntaxNode::getChildCount() const {\n')
-	cppf.write('    switch (kind) {\n')
-	cppf.write('        case SyntaxKind::Unknown: return 0;\n')
-	cppf.write('        case SyntaxKind::List: return ((const SyntaxListBase*)this)->getChildCount();\n')
-
-	for k,v in sorted(kindmap.items()):
-		count = alltypes[v].memberCount
-		cppf.write('        case SyntaxKind::{}: return {};\n'.format(k, count))
+	syntaxKinds = readSyntaxKinds(os.path.join(ourdir, "../source/parsing/SyntaxNode.h"))
+	for k in kindmap:
+		if k not in syntaxKinds:
+			raise Exception("Unknown syntax kind '{}'".format(k))
+
+	# Write out tables describing where each child lives within its node.
+	# The syntax node types aren't standard layout, but every compiler we
+	# support lays out their data members predictably and offsetof works fine.
+	# References are another story, since offsetof can't be applied to them.
+	# Every ABI stores a reference exactly like a pointer though, so offsets
+	# are taken from a twin of each type that has pointers in their place;
+	# static_asserts check that the twin really does match the real layout.
+	cppf.write('#if defined(__GNUC__)\n')
+	cppf.write('#    pragma GCC diagnostic push\n')
+	cppf.write('#    pragma GCC diagnostic ignored "-Winvalid-offsetof"\n')
+	cppf.write('#endif\n\n')
+	cppf.write('namespace {\n\n')
+
+	tabletypes = sorted(set(v for v in kindmap.values() if alltypes[v].children))
+
+	layouts = []
+	def addLayout(t):
+		if t == 'SyntaxNode' or t in layouts:
+			return
+		addLayout(alltypes[t].base)
+		layouts.append(t)
+
+	for t in tabletypes:
+		addLayout(t)
+
+	for t in layouts:
+		v = alltypes[t]
+		base = 'SyntaxNode' if v.base == 'SyntaxNode' else v.base + 'Layout'
+		inherited = 0 if v.base == 'SyntaxNode' else len(alltypes[v.base].processedMembers)
+		cppf.write('struct {}Layout : public {} {{\n'.format(t, base))
+		for m in v.processedMembers[inherited:]:
+			cppf.write('    {};\n'.format(m.replace('&', '*')))
+		cppf.write('};\n\n')
+
+	for t in tabletypes:
+		cppf.write('static_assert(sizeof({0}Layout) == sizeof({0}));\n'.format(t))
+		for name, childKind in alltypes[t].children:
+			if childKind != 'NodeReference':
+				cppf.write('static_assert(offsetof({0}Layout, {1}) == offsetof({0}, {1}));\n'.format(t, name))
+	cppf.write('\n')
+
+	for t in tabletypes:
+		cppf.write('constexpr SyntaxChildInfo {}Children[] = {{\n'.format(t))
+		for name, childKind in alltypes[t].children:
+			cppf.write('    {{ offsetof({}Layout, {}), SyntaxChildKind::{} }},\n'.format(t, name, childKind))
+		cppf.write('};\n\n')
 
-	cppf.write('    }\n')
-	cppf.write('    THROW_UNREACHABLE;\n')
 	cppf.write('}\n\n')
 
+	cppf.write('const SyntaxChildTable SyntaxChildTables[] = {\n')
+	for k in syntaxKinds:
+		if k in kindmap and alltypes[kindmap[k]].children:
+			t = kindmap[k]
+			cppf.write('    {{ {}Children, {} }}, // {}\n'.format(t, len(alltypes[t].children), k))
+		else:
+			cppf.write('    {{ nullptr, 0 }}, // {}\n'.format(k))
+	cppf.write('};\n\n')
+
+	cppf.write('#if defined(__GNUC__)\n')
+	cppf.write('#    pragma GCC diagnostic pop\n')
+	cppf.write('#endif\n\n')
+
 	reverseKindmap = {}
 	for k,v in kindmap.items():
 		if v in reverseKindmap:
@@ -214,32 +283,39 @@ def generate(outf, name, tags, members, alltypes, kindmap):
 	optionalMembers = set()
 	processed_members = []
 	baseInitializers = ''
-	combined = members
 	if base != 'SyntaxNode':
 		processed_members.extend(alltypes[base].processedMembers)
 		pointerMembers = pointerMembers.union(alltypes[base].pointerMembers)
 		baseInitializers = ', '.join([x[1] for x in alltypes[base].members])
 		if baseInitializers:
 			baseInitializers = ', ' + baseInitializers
-		combined = alltypes[base].members + members
+
+	children = []
+	if base != 'SyntaxNode':
+		children.extend(alltypes[base].children)
 
 	for m in members:
 		if m[0] == 'token':
 			typename = 'Token'
+			children.append((m[1], 'Token'))
 		elif m[0] == 'tokenlist':
 			typename = 'TokenList'
 			pointerMembers.add(m[1])
+			children.append((m[1], 'List'))
 		elif m[0].startswith('list<'):
 			typename = 'SyntaxList<' + m[0][5:]
 			pointerMembers.add(m[1])
+			children.append((m[1], 'List'))
 		elif m[0].startswith('separated_list<'):
 			typename = 'SeparatedSyntaxList<' + m[0][15:]
 			pointerMembers.add(m[1])
+			children.append((m[1], 'List'))
 		else:
 			optional = False
 			if m[0].endswith('?'):
 				optional = True
 				m[0] = m[0][:-1]
+			children.append((m[1], 'Node' if optional else 'NodeReference'))
 
 			if m[0] not in alltypes:
 				raise Exception("Unknown type '{}'".format(m[0]))
@@ -277,12 +353,20 @@ def generate(outf, name, tags, members, alltypes, kindmap):
 
 	constructorArgs = '{}{}'.format(kindArg, ', '.join(processed_members))
 	alltypes[name] = TypeInfo(processed_members, members, pointerMembers, final,
-							  constructorArgs, base, len(combined))
+							  constructorArgs, base, children)
 
 	outf.write('\n')
 	outf.write('    {}({}) :\n'.format(name, constructorArgs))
 	outf.write('        {}({}{}){}\n'.format(base, kindValue, baseInitializers, initializers))
-	outf.write('    {}\n\n')
+
+	# Only concrete types compute their source range; base class constructors
+	# run before the derived members they would need have been set.
+	if final:
+		outf.write('    {\n')
+		outf.write('        computeSourceRange();\n')
+		outf.write('    }\n\n')
+	else:
+		outf.write('    {}\n\n')
 
 	if len(members) == 0 and final == '':
 		outf.write('    static bool isKind(SyntaxKind kind);\n')
@@ -290,27 +374,7 @@ def generate(outf, name, tags, members, alltypes, kindmap):
 		outf.write('    {}(const {}&) = delete;\n'.format(name, name))
 		outf.write('    {}& operator=(const {}&) = delete;\n\n'.format(name, name))
 
-		outf.write('    static bool isKind(SyntaxKind kind);\n\n')
-
-		outf.write('protected:\n')
-		outf.write('    TokenOrSyntax getChild(uint32_t index) const override{} {{\n'.format(final))
-
-		if len(combined) > 0:
-			outf.write('        switch (index) {\n')
-
-			index = 0
-			for m in combined:
-				addr = '&' if m[1] in pointerMembers else ''
-				outf.write('            case {}: return {}{};\n'.format(index, addr, m[1]))
-				index += 1
-
-			outf.write('            default: return nullptr;\n')
-			outf.write('        }\n')
-		else:
-			outf.write('        (void)index;\n')
-			outf.write('        return nullptr;\n')
-
-		outf.write('    }\n')
+		outf.write('    static bool isKind(SyntaxKind kind);\n')
 
 	outf.write('};\n\n')
 
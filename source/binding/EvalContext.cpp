@@ -8,13 +8,14 @@
 
 #include <fmt/format.h>
 
+#include "binding/Statements.h"
 #include "symbols/MemberSymbols.h"
 #include "symbols/TypeSymbols.h"
 
 namespace slang {
 
-EvalContext::EvalContext(bool isScriptEval) :
-    isScriptEval_(isScriptEval)
+EvalContext::EvalContext(const EvalOptions& options, bool isScriptEval) :
+    options(options), isScriptEval_(isScriptEval)
 {
     stack.emplace_back(Frame{});
 }
@@ -41,13 +42,24 @@ ConstantValue* EvalContext::findLocal(const ValueSymbol* symbol) {
     return &it->second;
 }
 
-void EvalContext::pushFrame(const SubroutineSymbol& subroutine, SourceLocation callLocation,
+bool EvalContext::pushFrame(const SubroutineSymbol& subroutine, SourceLocation callLocation,
                             LookupLocation lookupLocation) {
+    if (exceededLimits)
+        return false;
+
+    // The bottom frame is the global one, which doesn't count as a call.
+    if (stack.size() > options.maxCallDepth) {
+        exceededLimits = true;
+        addDiag(DiagCode::NoteExceededMaxCallDepth, callLocation) << options.maxCallDepth;
+        return false;
+    }
+
     Frame frame;
     frame.subroutine = &subroutine;
     frame.callLocation = callLocation;
     frame.lookupLocation = lookupLocation;
     stack.emplace_back(std::move(frame));
+    return true;
 }
 
 ConstantValue EvalContext::popFrame() {
@@ -89,15 +101,29 @@ std::string EvalContext::dumpStack() const {
 }
 
 Diagnostic& EvalContext::addDiag(DiagCode code, SourceLocation location) {
-    Diagnostic& diag = diags.add(code, location);
+    // Reporting the stack can add more diagnostics, so don't hold on to
+    // a reference across it.
+    size_t index = diags.size();
+    diags.add(code, location);
     reportStack();
-    return diag;
+    return diags[index];
 }
 
 Diagnostic& EvalContext::addDiag(DiagCode code, SourceRange range) {
-    Diagnostic& diag = diags.add(code, range);
+    size_t index = diags.size();
+    diags.add(code, range);
     reportStack();
-    return diag;
+    return diags[index];
+}
+
+bool EvalContext::reportStepsExceeded(const Statement& stmt) {
+    // Only report the first limit that gets hit; once evaluation has been
+    // abandoned, callers unwinding from deeper in it keep ending up here.
+    if (!std::exchange(exceededLimits, true)) {
+        SourceLocation location = stmt.syntax ? stmt.syntax->getFirstToken().location() : SourceLocation();
+        addDiag(DiagCode::NoteExceededMaxEvalSteps, location) << options.maxSteps;
+    }
+    return false;
 }
 
 void EvalContext::reportStack() {
@@ -106,11 +132,24 @@ void EvalContext::reportStack() {
     if (std::exchange(reportedCallstack, true))
         return;
 
-    fmt::memory_buffer buffer;;
+    // Deep stacks (such as from runaway recursion) only show the innermost and
+    // outermost calls, which is where the interesting bits usually are.
+    const size_t maxFrames = 10;
+    size_t numFrames = stack.size() - 1;
+    size_t index = 0;
+
+    fmt::memory_buffer buffer;
     for (const Frame& frame : make_reverse_range(stack)) {
         if (!frame.subroutine)
             break;
 
+        size_t current = index++;
+        if (numFrames > maxFrames && current >= maxFrames / 2 && current < numFrames - maxFrames / 2) {
+            if (current == maxFrames / 2)
+                diags.add(DiagCode::NoteSkippedCallFrames, frame.callLocation) << numFrames - maxFrames;
+            continue;
+        }
+
         buffer.clear();
         format_to(buffer, "{}(", frame.subroutine->name);
 
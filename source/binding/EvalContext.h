@@ -16,8 +16,23 @@
 
 namespace slang {
 
+class Statement;
 class SubroutineSymbol;
 
+/// Contains various options that can control constant evaluation behavior.
+/// The limits keep a runaway evaluation from hanging the compilation; once one
+/// is exceeded, the evaluation is abandoned and a diagnostic is reported.
+struct EvalOptions {
+    /// The maximum number of statements a single evaluation can execute.
+    uint32_t maxSteps = 1 << 20;
+
+    /// The maximum depth of nested function calls.
+    uint32_t maxCallDepth = 256;
+
+    /// The maximum number of iterations of a single generate loop.
+    uint32_t maxGenerateIterations = 1 << 16;
+};
+
 /// A container for all context required to evaluate an expression.
 /// Mostly this involves tracking the callstack and maintaining
 /// storage for local variables.
@@ -42,7 +57,7 @@ public:
         bool hasReturned = false;
     };
 
-    explicit EvalContext(bool isScriptEval = false);
+    explicit EvalContext(const EvalOptions& options = {}, bool isScriptEval = false);
 
     /// Creates storage for a local variable in the current frame.
     ConstantValue* createLocal(const ValueSymbol* symbol, ConstantValue value = nullptr);
@@ -51,13 +66,28 @@ public:
     /// Returns nullptr if the symbol cannot be found.
     ConstantValue* findLocal(const ValueSymbol* symbol);
 
-    /// Push a new frame onto the call stack.
-    void pushFrame(const SubroutineSymbol& subroutine, SourceLocation callLocation,
+    /// Push a new frame onto the call stack. If that would exceed the maximum
+    /// call depth, or some other limit has already been exceeded, false is
+    /// returned instead.
+    bool pushFrame(const SubroutineSymbol& subroutine, SourceLocation callLocation,
                    LookupLocation lookupLocation);
 
     /// Pop the active frame from the call stack and returns its value, if any.
     ConstantValue popFrame();
 
+    /// Counts a statement about to be executed against the step budget. If the budget
+    /// has run out, or any other limit has already been exceeded, false is returned
+    /// to indicate that evaluation should stop. Only the first limit that gets
+    /// exceeded is reported.
+    bool step(const Statement& stmt) {
+        if (++steps <= options.maxSteps && !exceededLimits)
+            return true;
+        return reportStepsExceeded(stmt);
+    }
+
+    /// Gets the options used to limit evaluation.
+    const EvalOptions& getOptions() const { return options; }
+
     /// Indicates whether this evaluation context is for a script session
     /// (not used during normal compilation flow).
     bool isScriptEval() const { return isScriptEval_; }
@@ -81,10 +111,14 @@ public:
 
 private:
     void reportStack();
+    bool reportStepsExceeded(const Statement& stmt);
 
     std::deque<Frame> stack;
     Diagnostics diags;
+    EvalOptions options;
+    uint64_t steps = 0;
     bool reportedCallstack = false;
+    bool exceededLimits = false;
     bool isScriptEval_ = false;
 };
 
@@ -104,7 +104,7 @@ const Expression& Expression::bind(Compilation& compilation, const Type& lhs, co
 
 void Expression::checkBindFlags(Compilation& compilation, const BindContext& context) const {
     if (context.isConstant()) {
-        EvalContext evalContext;
+        EvalContext evalContext(compilation.getEvalOptions());
         eval(evalContext);
 
         const Diagnostics& diags = evalContext.getDiagnostics();
@@ -813,12 +813,37 @@ Expression& RangeSelectExpression::fromSyntax(Compilation& compilation, Expressi
     else
         elementType = &compilation.getBitType();
 
+    // Evaluation can fail (for example by running into one of the EvalOptions limits),
+    // in which case the reasons get reported the same way as in checkBindFlags.
+    EvalContext evalContext(compilation.getEvalOptions());
+    auto evalBound = [&](const Expression& expr) {
+        ConstantValue value = expr.eval(evalContext);
+        if (!value.isInteger()) {
+            Diagnostic& diag = compilation.addError(DiagCode::ExpressionNotConstant, expr.sourceRange);
+            for (const Diagnostic& note : evalContext.getDiagnostics())
+                diag.addNote(note);
+        }
+        return value;
+    };
+
     if (selectionKind == RangeSelectionKind::Simple) {
-        ConstantRange range { *left.eval().integer().as<int32_t>(), *right.eval().integer().as<int32_t>() };
+        ConstantValue leftValue = evalBound(left);
+        if (!leftValue.isInteger())
+            return badExpr(compilation, result);
+
+        ConstantValue rightValue = evalBound(right);
+        if (!rightValue.isInteger())
+            return badExpr(compilation, result);
+
+        ConstantRange range { *leftValue.integer().as<int32_t>(), *rightValue.integer().as<int32_t>() };
         result->type = compilation.emplace<PackedArrayType>(*elementType, ConstantRange { (int32_t)range.width() - 1, 0 });
     }
     else {
-        int32_t width = *right.eval().integer().as<int32_t>();
+        ConstantValue widthValue = evalBound(right);
+        if (!widthValue.isInteger())
+            return badExpr(compilation, result);
+
+        int32_t width = *widthValue.integer().as<int32_t>();
         result->type = compilation.emplace<PackedArrayType>(*elementType, ConstantRange { width - 1, 0 });
     }
     return *result;
@@ -135,9 +135,6 @@ public:
     /// Indicates whether the expression evaluates to an lvalue.
     bool isLValue() const;
 
-    /// Evaluates the expression as a constant value.
-    ConstantValue eval() const;
-
     /// Evaluates the expression under the given evaluation context. Any errors that occur
     /// will be stored in the evaluation context instead of issued to the compilation.
     ConstantValue eval(EvalContext& context) const;
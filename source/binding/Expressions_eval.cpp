@@ -117,11 +117,6 @@ ConstantValue Expression::eval(EvalContext& context) const {
     return visit(visitor, context);
 }
 
-ConstantValue Expression::eval() const {
-    EvalContext context;
-    return eval(context);
-}
-
 LValue Expression::evalLValue(EvalContext& context) const {
     LValueVisitor visitor;
     return visit(visitor, context);
@@ -542,7 +537,9 @@ ConstantValue CallExpression::evalImpl(EvalContext& context) const {
 
     // Push a new stack frame, push argument values as locals.
     const SubroutineSymbol& symbol = *std::get<0>(subroutine);
-    context.pushFrame(symbol, sourceRange.start(), lookupLocation);
+    if (!context.pushFrame(symbol, sourceRange.start(), lookupLocation))
+        return nullptr;
+
     span<const FormalArgumentSymbol* const> formals = symbol.arguments;
     for (uint32_t i = 0; i < formals.size(); i++)
         context.createLocal(formals[i], args[i]);
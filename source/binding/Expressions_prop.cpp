@@ -33,7 +33,7 @@ struct Expression::PropagationVisitor {
 
         // Try to fold any constant values.
         ASSERT(!result.constant);
-        EvalContext context;
+        EvalContext context(compilation.getEvalOptions());
         ConstantValue value = result.eval(context);
         if (value)
             result.constant = compilation.createConstant(std::move(value));
@@ -7,6 +7,7 @@
 #include "Statements.h"
 
 #include "Expressions.h"
+#include "util/PerfCounters.h"
 
 namespace slang {
 
@@ -14,6 +15,10 @@ const InvalidStatement InvalidStatement::Instance(nullptr);
 const StatementList StatementList::Empty({});
 
 bool Statement::eval(EvalContext& context) const {
+    PerfCounters::increment(PerfCounter::ConstantEvalSteps);
+    if (!context.step(*this))
+        return false;
+
     switch (kind) {
         case StatementKind::Invalid: return false;
         case StatementKind::List: return as<StatementList>().eval(context);
@@ -7,7 +7,9 @@
 #include "Compilation.h"
 
 #include "parsing/SyntaxTree.h"
+#include "parsing/SyntaxVisitor.h"
 #include "symbols/ASTVisitor.h"
+#include "util/TimeTrace.h"
 
 #include "BuiltInSubroutines.h"
 
@@ -25,11 +27,78 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor> {
     void handle(const VariableSymbol& symbol) { symbol.type.get(); symbol.initializer.get(); }
 };
 
+// Counts the instances of each definition in the design as it currently stands.
+struct InstanceCounter : public ASTVisitor<InstanceCounter> {
+    flat_hash_map<const Definition*, size_t> counts;
+
+    VisitAction preVisit(const InstanceSymbol& instance) {
+        counts[instance.definition]++;
+        return VisitAction::Continue;
+    }
+
+    // Instances can't appear inside of subroutines or statements.
+    VisitAction preVisit(const SubroutineSymbol&) { return VisitAction::SkipChildren; }
+    VisitAction preVisit(const Statement&) { return VisitAction::SkipChildren; }
+};
+
+// Collects the names of design elements and packages that a piece of syntax refers to.
+// This errs on the side of including too much; scoped names can also refer to classes.
+struct ReferenceCollector : public SyntaxVisitor<ReferenceCollector> {
+    flat_hash_set<string_view>& names;
+
+    explicit ReferenceCollector(flat_hash_set<string_view>& names) : names(names) {}
+
+    VisitAction preVisit(const HierarchyInstantiationSyntax& syntax) { return add(syntax.type); }
+    VisitAction preVisit(const InterfacePortHeaderSyntax& syntax) { return add(syntax.nameOrKeyword); }
+    VisitAction preVisit(const PackageImportItemSyntax& syntax) { return add(syntax.package); }
+
+    VisitAction preVisit(const ScopedNameSyntax& syntax) {
+        if (syntax.left.kind == SyntaxKind::IdentifierName)
+            add(syntax.left.as<IdentifierNameSyntax>().identifier);
+        else if (syntax.left.kind == SyntaxKind::ClassName)
+            add(syntax.left.as<ClassNameSyntax>().identifier);
+        return VisitAction::Continue;
+    }
+
+    VisitAction add(Token name) {
+        if (!name.valueText().empty())
+            names.insert(name.valueText());
+        return VisitAction::Continue;
+    }
+};
+
+bool isDesignElement(SyntaxKind kind) {
+    switch (kind) {
+        case SyntaxKind::ModuleDeclaration:
+        case SyntaxKind::InterfaceDeclaration:
+        case SyntaxKind::ProgramDeclaration:
+        case SyntaxKind::PackageDeclaration:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Invokes the given function for each module, interface, program, and package
+// declared at the top level of a syntax tree.
+template<typename TFunc>
+void forEachDesignElement(const SyntaxNode& root, TFunc&& func) {
+    if (root.kind == SyntaxKind::CompilationUnit) {
+        for (auto member : root.as<CompilationUnitSyntax>().members) {
+            if (isDesignElement(member->kind))
+                func(member->as<ModuleDeclarationSyntax>());
+        }
+    }
+    else if (isDesignElement(root.kind)) {
+        func(root.as<ModuleDeclarationSyntax>());
+    }
+}
+
 }
 
 namespace slang {
 
-Compilation::Compilation() :
+Compilation::Compilation(const Bag& options) :
     bitType(ScalarType::Bit),
     logicType(ScalarType::Logic),
     regType(ScalarType::Reg),
@@ -46,6 +115,10 @@ Compilation::Compilation() :
     realTimeType(FloatingType::RealTime),
     shortRealType(FloatingType::ShortReal)
 {
+    counterBaseline = PerfCounters::getTotals();
+    compilationOptions = options.getOrDefault<CompilationOptions>();
+    evalOptions = options.getOrDefault<EvalOptions>();
+
     // Register built-in types for lookup by syntax kind.
     knownTypes[SyntaxKind::ShortIntType] = &shortIntType;
     knownTypes[SyntaxKind::IntType] = &intType;
@@ -116,41 +189,175 @@ void Compilation::addSyntaxTree(std::shared_ptr<SyntaxTree> tree) {
             throw std::logic_error("All syntax trees added to the compilation must use the same source manager");
     }
 
-    auto unit = emplace<CompilationUnitSymbol>(*this);
-    const SyntaxNode& node = tree->root();
+    TIME_SCOPE("Add syntax tree", sourceManager->getRawFileName(tree->bufferID()));
+    CompilationUnitSymbol& unit = createCompilationUnit(tree->root());
+
+    // Because of the requirement that we look at uninstantiated branches of generate blocks,
+    // we need to look at the syntax nodes instead of any bound symbols.
     NameSet instances;
+    findInstantiations(tree->root(), instances);
 
-    if (node.kind == SyntaxKind::CompilationUnit) {
-        for (auto member : node.as<CompilationUnitSyntax>().members) {
-            unit->addMembers(*member);
+    // Merge found instantiations into the global list. This is done separately instead of
+    // just passing instantiatedNames into findInstantiations to make it easy in the future
+    // to make this method thread safe by throwing a lock around this stuff.
+    for (auto entry : instances)
+        instantiatedNames.emplace(entry);
+
+    root->addMember(unit);
+    compilationUnits.push_back(&unit);
+    syntaxTrees.emplace_back(std::move(tree));
+    forcedDiagnostics = false;
+}
+
+bool Compilation::replaceSyntaxTree(const std::shared_ptr<SyntaxTree>& oldTree,
+                                    std::shared_ptr<SyntaxTree> newTree) {
+    auto treeIt = std::find(syntaxTrees.begin(), syntaxTrees.end(), oldTree);
+    if (treeIt == syntaxTrees.end())
+        throw std::logic_error("The syntax tree being replaced is not part of the compilation");
+    if (&newTree->sourceManager() != sourceManager)
+        throw std::logic_error("All syntax trees added to the compilation must use the same source manager");
+    if (replacedTrees.size() >= compilationOptions.maxSyntaxTreeReplacements)
+        return false;
 
-            // Because of the requirement that we look at uninstantiated branches of generate blocks,
-            // we need to look at the syntax nodes instead of any bound symbols.
-            if (member->kind == SyntaxKind::ModuleDeclaration) {
-                SmallVectorSized<NameSet, 2> scopeStack;
-                findInstantiations(member->as<MemberSyntax>(), scopeStack, instances);
+    // Every name declared by either version of the tree counts as changed. The names
+    // declared by trees that get rebuilt are also tracked separately, since their
+    // declarations are removed from the definition and package maps.
+    NameSet changedNames;
+    NameSet removedNames;
+    auto addDeclaredNames = [&changedNames, &removedNames](const SyntaxNode& node) {
+        forEachDesignElement(node, [&](const ModuleDeclarationSyntax& syntax) {
+            changedNames.insert(syntax.header.name.valueText());
+            removedNames.insert(syntax.header.name.valueText());
+        });
+    };
+    addDeclaredNames(oldTree->root());
+    addDeclaredNames(newTree->root());
+
+    size_t replacedIndex = size_t(treeIt - syntaxTrees.begin());
+    removeTreeSymbols(replacedIndex);
+
+    referenceCache.erase(&oldTree->root());
+    forEachDesignElement(oldTree->root(), [this](const ModuleDeclarationSyntax& syntax) {
+        referenceCache.erase(&syntax);
+    });
+
+    replacedTrees.push_back(oldTree);
+    *treeIt = std::move(newTree);
+
+    // Spread the change to everything that can see it. A design element that refers to a
+    // changed name is itself changed. Packages and compilation units can't be rebuilt on their
+    // own, so a tree that declares a changed package or whose compilation unit refers to a
+    // changed name is rebuilt in its entirety, which in turn changes everything it declares.
+    // Any other tree that declares one of the removed names gets rebuilt as well; its
+    // declaration might have lost out to the removed one and needs another chance to be
+    // added, in the same order as a fresh compilation would add them.
+    auto refersToChanged = [&changedNames](const NameSet& names) {
+        for (auto name : names) {
+            if (changedNames.count(name))
+                return true;
+        }
+        return false;
+    };
+
+    std::vector<bool> rebuildTree(syntaxTrees.size());
+    rebuildTree[replacedIndex] = true;
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t i = 0; i < syntaxTrees.size(); i++) {
+            if (rebuildTree[i])
+                continue;
+
+            const SyntaxNode& node = syntaxTrees[i]->root();
+            bool rebuild = node.kind == SyntaxKind::CompilationUnit && refersToChanged(getReferencedNames(node));
+            forEachDesignElement(node, [&](const ModuleDeclarationSyntax& syntax) {
+                string_view name = syntax.header.name.valueText();
+                if (removedNames.count(name))
+                    rebuild = true;
+                else if (!changedNames.count(name) && refersToChanged(getReferencedNames(syntax))) {
+                    changedNames.insert(name);
+                    changed = true;
+                    if (syntax.kind == SyntaxKind::PackageDeclaration)
+                        rebuild = true;
+                }
+            });
+
+            if (rebuild) {
+                addDeclaredNames(node);
+                removeTreeSymbols(i);
+                rebuildTree[i] = true;
+                changed = true;
             }
         }
     }
-    else {
-        unit->addMembers(node);
 
-        if (node.kind == SyntaxKind::ModuleDeclaration) {
-            SmallVectorSized<NameSet, 2> scopeStack;
-            findInstantiations(node.as<MemberSyntax>(), scopeStack, instances);
+    flat_hash_map<const Symbol*, const Symbol*> replacedUnits;
+    for (size_t i = 0; i < syntaxTrees.size(); i++) {
+        if (rebuildTree[i]) {
+            CompilationUnitSymbol& unit = createCompilationUnit(syntaxTrees[i]->root());
+            replacedUnits.emplace(compilationUnits[i], &unit);
+            compilationUnits[i] = &unit;
         }
     }
 
-    // Merge found instantiations into the global list. This is done separately instead of
-    // just passing instantiatedNames into findInstantiations to make it easy in the future
-    // to make this method thread safe by throwing a lock around this stuff.
-    for (auto entry : instances)
-        instantiatedNames.emplace(entry);
+    instantiatedNames.clear();
+    for (auto& tree : syntaxTrees)
+        findInstantiations(tree->root(), instantiatedNames);
 
-    root->addMember(*unit);
-    compilationUnits.push_back(unit);
-    syntaxTrees.emplace_back(std::move(tree));
+    // Rebuild the list of root members, swapping in the new compilation units. Top level
+    // instances get added back below, since the set of them might have changed.
+    SmallVectorSized<const Symbol*, 16> rootMembers;
+    for (auto& member : root->members()) {
+        if (member.kind == SymbolKind::ModuleInstance)
+            continue;
+
+        auto it = replacedUnits.find(&member);
+        rootMembers.append(it == replacedUnits.end() ? &member : it->second);
+    }
+
+    root->clearMembers();
+    for (auto member : rootMembers)
+        root->addMember(*member);
+    root->compilationUnits = compilationUnits;
+
+    if (finalized) {
+        forcePackages();
+
+        flat_hash_map<string_view, const ModuleInstanceSymbol*> oldTopInstances;
+        for (auto instance : root->topInstances)
+            oldTopInstances.emplace(instance->name, instance);
+
+        SmallVectorSized<const Definition*, 4> topDefinitions;
+        findTopDefinitions(topDefinitions);
+
+        SmallVectorSized<const ModuleInstanceSymbol*, 4> topList;
+        for (auto definition : topDefinitions) {
+            auto it = oldTopInstances.find(definition->name);
+            if (it != oldTopInstances.end() && !changedNames.count(definition->name)) {
+                root->addMember(*it->second);
+                topList.append(it->second);
+                oldTopInstances.erase(it);
+            }
+            else {
+                topList.append(&instantiateTop(*definition));
+            }
+        }
+
+        for (auto& [name, instance] : oldTopInstances) {
+            (void)name;
+            symbolDiags.erase(instance);
+            forcedSymbols.erase(instance);
+        }
+        root->topInstances = topList.copy(*this);
+    }
+
+    // Diagnostics can't be compared by count anymore, since some have been removed.
     forcedDiagnostics = false;
+    cachedParseDiags.parseCount = SIZE_MAX;
+    cachedSemanticDiags.semanticCount = SIZE_MAX;
+    cachedAllDiags.parseCount = SIZE_MAX;
+    return true;
 }
 
 span<const std::shared_ptr<SyntaxTree>> Compilation::getSyntaxTrees() const {
@@ -159,24 +366,19 @@ span<const std::shared_ptr<SyntaxTree>> Compilation::getSyntaxTrees() const {
 
 const RootSymbol& Compilation::getRoot() {
     if (!finalized) {
+        TIME_SCOPE("Elaborate", "");
+
+        // Packages get forced first so that any diagnostics in them are attributed to the package
+        // instead of to whichever instance happens to use it first.
+        forcePackages();
+
         // Find modules that have no instantiations.
-        SmallVectorSized<const ModuleInstanceSymbol*, 4> topList;
-        for (auto& [key, definition] : definitionMap) {
-            (void)key;
-            const auto& syntax = definition->syntax;
-
-            if (syntax.kind == SyntaxKind::ModuleDeclaration && instantiatedNames.count(definition->name) == 0) {
-                // TODO: check for no parameters here
-                const auto& instance = ModuleInstanceSymbol::instantiate(*this, definition->name,
-                                                                         syntax.header.name.location(), *definition);
-                root->addMember(instance);
-                topList.append(&instance);
-            }
-        }
+        SmallVectorSized<const Definition*, 4> topDefinitions;
+        findTopDefinitions(topDefinitions);
 
-        // Sort the list of instances so that we get deterministic ordering of instances;
-        // the order is otherwise dependent on iterating over a hash table.
-        std::sort(topList.begin(), topList.end(), [](auto a, auto b) { return a->name < b->name; });
+        SmallVectorSized<const ModuleInstanceSymbol*, 4> topList;
+        for (auto definition : topDefinitions)
+            topList.append(&instantiateTop(*definition));
 
         root->topInstances = topList.copy(*this);
         root->compilationUnits = compilationUnits;
@@ -293,45 +495,183 @@ CompilationUnitSymbol& Compilation::createScriptScope() {
     return *unit;
 }
 
-Diagnostics Compilation::getParseDiagnostics() {
-    Diagnostics results;
+const Diagnostics& Compilation::getParseDiagnostics() {
+    // Syntax trees can't have diagnostics removed, so comparing counts is enough
+    // to know whether the cache is still valid.
+    size_t count = countParseDiagnostics();
+    if (cachedParseDiags.parseCount == count)
+        return cachedParseDiags.diags;
+
+    Diagnostics& results = cachedParseDiags.diags;
+    results.clear();
+    results.reserve((uint32_t)count);
     for (const auto& tree : syntaxTrees)
         results.appendRange(tree->diagnostics());
 
-    if (sourceManager)
+    if (sourceManager) {
+        TIME_SCOPE("Sort diagnostics", "parse");
         results.sort(*sourceManager);
+    }
+
+    cachedParseDiags.parseCount = count;
     return results;
 }
 
-Diagnostics Compilation::getSemanticDiagnostics() {
+const Diagnostics& Compilation::getSemanticDiagnostics() {
     // If we haven't already done so, touch every symbol, scope, statement,
     // and expression tree so that we can be sure we have all the diagnostics.
     if (!forcedDiagnostics) {
         forcedDiagnostics = true;
-        DiagnosticVisitor visitor;
-        getRoot().visit(visitor);
+        const RootSymbol& design = getRoot();
+
+        TIME_SCOPE("Force diagnostics", "");
+        for (auto& member : design.members())
+            forceDiagnostics(member);
     }
 
-    Diagnostics results;
+    size_t count = diags.size();
+    for (auto& [symbol, list] : symbolDiags) {
+        (void)symbol;
+        count += list.size();
+    }
+
+    if (cachedSemanticDiags.semanticCount == count)
+        return cachedSemanticDiags.diags;
+
+    Diagnostics& results = cachedSemanticDiags.diags;
+    results.clear();
+    results.reserve((uint32_t)count);
     results.appendRange(diags);
 
-    if (sourceManager)
+    // Gather the owned lists in a fixed order so that diagnostics at the same position
+    // always come out the same way.
+    auto appendOwned = [&](const Symbol& symbol) {
+        if (auto it = symbolDiags.find(&symbol); it != symbolDiags.end())
+            results.appendRange(it->second);
+    };
+
+    SmallVectorSized<const PackageSymbol*, 16> packages;
+    for (auto& [name, package] : packageMap) {
+        (void)name;
+        packages.append(package);
+    }
+    std::sort(packages.begin(), packages.end(), [](auto a, auto b) { return a->name < b->name; });
+
+    for (auto package : packages)
+        appendOwned(*package);
+    for (auto& member : root->members())
+        appendOwned(member);
+
+    if (sourceManager) {
+        TIME_SCOPE("Sort diagnostics", "semantic");
         results.sort(*sourceManager);
+    }
 
+    cachedSemanticDiags.semanticCount = count;
     return results;
 }
 
-Diagnostics Compilation::getAllDiagnostics() {
-    Diagnostics results = getParseDiagnostics();
-    results.appendRange(getSemanticDiagnostics());
+const Diagnostics& Compilation::getAllDiagnostics() {
+    const Diagnostics& semantic = getSemanticDiagnostics();
+    const Diagnostics& parse = getParseDiagnostics();
+    if (cachedAllDiags.parseCount == parse.size() && cachedAllDiags.semanticCount == semantic.size())
+        return cachedAllDiags.diags;
+
+    // Both halves are already sorted, so a single merge pass is all that's needed.
+    // Parse diagnostics go first when positions are equal, same as a stable sort would do.
+    Diagnostics& results = cachedAllDiags.diags;
+    results.clear();
+    results.reserve(parse.size() + semantic.size());
+    if (!sourceManager) {
+        results.appendRange(parse);
+        results.appendRange(semantic);
+    }
+    else {
+        auto p = parse.begin();
+        auto s = semantic.begin();
+        uint64_t parsePos = p != parse.end() ? sourceManager->getCompilationUnitPosition(p->location) : 0;
+        uint64_t semanticPos = s != semantic.end() ? sourceManager->getCompilationUnitPosition(s->location) : 0;
+
+        while (p != parse.end() && s != semantic.end()) {
+            if (semanticPos < parsePos) {
+                results.append(*s);
+                if (++s != semantic.end())
+                    semanticPos = sourceManager->getCompilationUnitPosition(s->location);
+            }
+            else {
+                results.append(*p);
+                if (++p != parse.end())
+                    parsePos = sourceManager->getCompilationUnitPosition(p->location);
+            }
+        }
 
-    if (sourceManager)
-        results.sort(*sourceManager);
+        results.appendRange(p, parse.end());
+        results.appendRange(s, semantic.end());
+    }
+
+    cachedAllDiags.parseCount = parse.size();
+    cachedAllDiags.semanticCount = semantic.size();
     return results;
 }
 
+size_t Compilation::countParseDiagnostics() const {
+    size_t count = 0;
+    for (const auto& tree : syntaxTrees)
+        count += tree->diagnostics().size();
+    return count;
+}
+
+AllocatorStats Compilation::MemoryStats::total() const {
+    AllocatorStats result = syntaxTrees;
+    result += symbols;
+    result += symbolMaps;
+    result += constants;
+    return result;
+}
+
+Compilation::MemoryStats Compilation::getMemoryStats() const {
+    MemoryStats stats;
+    for (auto& list : { &syntaxTrees, &replacedTrees }) {
+        for (auto& tree : *list)
+            stats.syntaxTrees += tree->getMemoryStats();
+    }
+
+    stats.symbols = getStats();
+    stats.symbolMaps = symbolMapAllocator.getStats();
+    stats.constants = constantAllocator.getStats();
+    return stats;
+}
+
+Compilation::Statistics Compilation::getStatistics() const {
+    Statistics stats;
+    PerfCounterValues totals = PerfCounters::getTotals();
+    for (size_t i = 0; i < PerfCounterCount; i++)
+        stats.counters[i] = totals[i] - counterBaseline[i];
+
+    // Count by walking the design rather than as instances get created; replacing
+    // a syntax tree throws away some instances and creates new ones in their place.
+    InstanceCounter counter;
+    if (root)
+        counter.traverse(*root);
+
+    for (auto& [key, definition] : definitionMap) {
+        (void)key;
+        auto it = counter.counts.find(definition.get());
+        stats.instancesPerDefinition.emplace_back(definition->name,
+                                                  it == counter.counts.end() ? 0 : it->second);
+    }
+
+    std::sort(stats.instancesPerDefinition.begin(), stats.instancesPerDefinition.end(),
+              [](auto& a, auto& b) { return a.second != b.second ? a.second > b.second : a.first < b.first; });
+    return stats;
+}
+
 void Compilation::addDiagnostics(const Diagnostics& diagnostics) {
-    diags.appendRange(diagnostics);
+    DiagnosticFilter* filter = diags.getFilter();
+    for (auto& diag : diagnostics) {
+        if (!filter || !filter->isSuppressed(diag.code, diag.location))
+            diags.append(diag);
+    }
 }
 
 const Type& Compilation::getType(SyntaxKind typeKind) const {
@@ -415,6 +755,174 @@ optional<bitwidth_t> Compilation::checkValidBitWidth(const SVInt& value, SourceR
     return result;
 }
 
+CompilationUnitSymbol& Compilation::createCompilationUnit(const SyntaxNode& node) {
+    size_t start = diags.size();
+    auto unit = emplace<CompilationUnitSymbol>(*this);
+    if (node.kind == SyntaxKind::CompilationUnit) {
+        for (auto member : node.as<CompilationUnitSyntax>().members)
+            unit->addMembers(*member);
+    }
+    else {
+        unit->addMembers(node);
+    }
+
+    claimDiagnostics(*unit, start);
+    return *unit;
+}
+
+void Compilation::removeTreeSymbols(size_t treeIndex) {
+    forEachDesignElement(syntaxTrees[treeIndex]->root(), [this](const ModuleDeclarationSyntax& syntax) {
+        // A declaration that lost out to an earlier one with the same name never made it
+        // into the maps, so check that the entry actually came from this syntax.
+        string_view name = syntax.header.name.valueText();
+        if (syntax.kind == SyntaxKind::PackageDeclaration) {
+            auto it = packageMap.find(name);
+            if (it != packageMap.end() && it->second->location == syntax.header.name.location()) {
+                symbolDiags.erase(it->second);
+                forcedSymbols.erase(it->second);
+                packageMap.erase(it);
+            }
+        }
+        else {
+            auto it = definitionMap.find(std::make_tuple(name, root.get()));
+            if (it != definitionMap.end() && &it->second->syntax == &syntax)
+                definitionMap.erase(it);
+        }
+    });
+
+    const CompilationUnitSymbol* unit = compilationUnits[treeIndex];
+    symbolDiags.erase(unit);
+    forcedSymbols.erase(unit);
+}
+
+void Compilation::findTopDefinitions(SmallVector<const Definition*>& results) const {
+    for (auto& [key, definition] : definitionMap) {
+        // Definitions nested inside other scopes can't be top level.
+        if (std::get<1>(key) != root.get())
+            continue;
+
+        if (definition->syntax.kind == SyntaxKind::ModuleDeclaration &&
+            instantiatedNames.count(definition->name) == 0) {
+            results.append(definition.get());
+        }
+    }
+
+    // Sort the list of definitions so that we get deterministic ordering of instances;
+    // the order is otherwise dependent on iterating over a hash table.
+    std::sort(results.begin(), results.end(), [](auto a, auto b) { return a->name < b->name; });
+}
+
+const ModuleInstanceSymbol& Compilation::instantiateTop(const Definition& definition) {
+    // TODO: check for no parameters here
+    size_t start = diags.size();
+    const auto& instance = ModuleInstanceSymbol::instantiate(*this, definition.name,
+                                                             definition.syntax.header.name.location(), definition);
+    root->addMember(instance);
+    claimDiagnostics(instance, start);
+    return instance;
+}
+
+const Compilation::NameSet& Compilation::getReferencedNames(const SyntaxNode& node) {
+    auto [it, inserted] = referenceCache.emplace(&node, NameSet());
+    if (inserted) {
+        // For a compilation unit, only look at the members that aren't design elements
+        // themselves; the design elements are tracked separately.
+        ReferenceCollector collector(it->second);
+        if (node.kind == SyntaxKind::CompilationUnit) {
+            for (auto member : node.as<CompilationUnitSyntax>().members) {
+                if (!isDesignElement(member->kind))
+                    collector.traverse(*member);
+            }
+        }
+        else {
+            collector.traverse(node);
+        }
+    }
+    return it->second;
+}
+
+void Compilation::claimDiagnostics(const Symbol& owner, size_t start) {
+    if (diags.size() == start)
+        return;
+
+    auto& owned = symbolDiags[&owner];
+    owned.appendRange(diags.begin() + start, diags.end());
+    while (diags.size() > start)
+        diags.pop();
+}
+
+void Compilation::forceDiagnostics(const Symbol& symbol) {
+    if (!forcedSymbols.insert(&symbol).second)
+        return;
+
+    size_t start = diags.size();
+    DiagnosticVisitor visitor;
+    symbol.visit(visitor);
+    claimDiagnostics(symbol, start);
+}
+
+void Compilation::forcePackages() {
+    // Packages can import each other, so visit them in dependency order. Otherwise a package's
+    // diagnostics could end up attributed to another package that uses it.
+    flat_hash_map<string_view, const ModuleDeclarationSyntax*> packageSyntax;
+    for (auto& tree : syntaxTrees) {
+        forEachDesignElement(tree->root(), [&](const ModuleDeclarationSyntax& syntax) {
+            auto it = packageMap.find(syntax.header.name.valueText());
+            if (syntax.kind == SyntaxKind::PackageDeclaration && it != packageMap.end() &&
+                it->second->location == syntax.header.name.location()) {
+                packageSyntax.emplace(it->first, &syntax);
+            }
+        });
+    }
+
+    flat_hash_set<const PackageSymbol*> expanded;
+    SmallVectorSized<std::pair<const PackageSymbol*, bool>, 16> stack;
+    for (auto& [name, package] : packageMap) {
+        (void)name;
+        stack.emplace(package, false);
+    }
+
+    while (!stack.empty()) {
+        auto [package, dependenciesDone] = stack.back();
+        stack.pop();
+
+        if (forcedSymbols.count(package))
+            continue;
+
+        if (dependenciesDone) {
+            forceDiagnostics(*package);
+            continue;
+        }
+
+        // A package that's already been expanded is further down the stack, waiting on its
+        // dependencies; seeing it again means there's an import cycle.
+        if (!expanded.insert(package).second)
+            continue;
+
+        stack.emplace(package, true);
+        if (auto it = packageSyntax.find(package->name); it != packageSyntax.end()) {
+            for (auto name : getReferencedNames(*it->second)) {
+                auto dependency = getPackage(name);
+                if (dependency && !forcedSymbols.count(dependency))
+                    stack.emplace(dependency, false);
+            }
+        }
+    }
+}
+
+void Compilation::findInstantiations(const SyntaxNode& node, NameSet& found) {
+    SmallVectorSized<NameSet, 2> scopeStack;
+    if (node.kind == SyntaxKind::CompilationUnit) {
+        for (auto member : node.as<CompilationUnitSyntax>().members) {
+            if (member->kind == SyntaxKind::ModuleDeclaration)
+                findInstantiations(member->as<MemberSyntax>(), scopeStack, found);
+        }
+    }
+    else if (node.kind == SyntaxKind::ModuleDeclaration) {
+        findInstantiations(node.as<MemberSyntax>(), scopeStack, found);
+    }
+}
+
 void Compilation::findInstantiations(const ModuleDeclarationSyntax& module, SmallVector<NameSet>& scopeStack,
                                      NameSet& found) {
     // If there are nested modules that shadow global module names, we need to
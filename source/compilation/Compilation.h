@@ -12,7 +12,9 @@
 #include "diagnostics/Diagnostics.h"
 #include "symbols/HierarchySymbols.h"
 #include "symbols/TypeSymbols.h"
+#include "util/Bag.h"
 #include "util/BumpAllocator.h"
+#include "util/PerfCounters.h"
 #include "util/SafeIndexedVector.h"
 #include "util/SmallVector.h"
 
@@ -21,24 +23,57 @@ namespace slang {
 class SyntaxTree;
 class SystemSubroutine;
 
+/// Contains various options that control how a compilation is managed.
+struct CompilationOptions {
+    /// The maximum number of times syntax trees can be replaced via
+    /// Compilation::replaceSyntaxTree. Memory used by the symbols built from replaced
+    /// trees can't be reclaimed, so this bounds how much a long lived compilation
+    /// can accumulate before it has to be recreated from scratch.
+    uint32_t maxSyntaxTreeReplacements = 64;
+};
+
 /// A centralized location for creating and caching symbols. This includes
 /// creating symbols from syntax nodes as well as fabricating them synthetically.
 /// Common symbols such as built in types are exposed here as well.
 class Compilation : public BumpAllocator {
 public:
-    Compilation();
+    /// Creates a new compilation. Settings are taken from the CompilationOptions and
+    /// evaluation limits from the EvalOptions in @a options, if any.
+    explicit Compilation(const Bag& options = {});
 
     /// Adds a syntax tree to the compilation. If the compilation has already been finalized
     /// by calling @a getRoot this call will throw an exception.
     void addSyntaxTree(std::shared_ptr<SyntaxTree> tree);
 
+    /// Replaces a syntax tree that was previously added to the compilation with a new version
+    /// of it, such as after the file it was parsed from has been edited. Unlike @a addSyntaxTree
+    /// this can be called after the compilation has been finalized.
+    ///
+    /// Only the parts of the design that can see the change get rebuilt: the definitions and
+    /// packages declared by either version of the tree, everything that instantiates or imports
+    /// them (directly or indirectly), and any other compilation unit that refers to them. Top
+    /// level instances outside of that set are kept as-is, along with the semantic diagnostics
+    /// already collected for them.
+    ///
+    /// Hierarchical references between top level instances are not tracked, so an instance that
+    /// reaches into a rebuilt one by hierarchical path can be left referring to stale symbols.
+    /// Diagnostics that were issued by lazily evaluating symbols outside of
+    /// @a getSemanticDiagnostics can't be attributed to any part of the design and are kept.
+    /// Symbols built from the old tree remain allocated in the compilation, so the old tree
+    /// is kept alive as well. To keep that from growing without bound, only
+    /// CompilationOptions::maxSyntaxTreeReplacements replacements are allowed; after that
+    /// this returns false without changing anything, and the caller should create a fresh
+    /// compilation from the current set of syntax trees instead.
+    bool replaceSyntaxTree(const std::shared_ptr<SyntaxTree>& oldTree, std::shared_ptr<SyntaxTree> newTree);
+
     /// Gets the set of syntax trees that have been added to the compilation.
     span<const std::shared_ptr<SyntaxTree>> getSyntaxTrees() const;
 
     /// Gets the root of the design. The first time you call this method all top-level
     /// instances will be elaborated and the compilation finalized. After that you can
-    /// no longer make any modifications to the compilation object; any attempts to do
-    /// so will result in an exception.
+    /// no longer make any modifications to the compilation object, other than replacing
+    /// syntax trees via @a replaceSyntaxTree; any other attempts to do so will result in
+    /// an exception.
     const RootSymbol& getRoot();
 
     /// Indicates whether the design has been compiled and can no longer accept modifications.
@@ -78,15 +113,53 @@ public:
     const SourceManager* getSourceManager() const { return sourceManager; }
 
     /// Gets the diagnostics produced during lexing, preprocessing, and syntax parsing.
-    Diagnostics getParseDiagnostics();
+    /// The results are sorted and cached; the returned collection is owned by the
+    /// compilation and gets updated in place if more diagnostics are produced later.
+    const Diagnostics& getParseDiagnostics();
 
     /// Gets the diagnostics produced during semantic analysis, including the binding of
     /// symbols, type checking, and name lookup. Note that this will force evaluation of
     /// any symbols or expressions that were still waiting for lazy evaluation.
-    Diagnostics getSemanticDiagnostics();
+    const Diagnostics& getSemanticDiagnostics();
 
     /// Gets all of the diagnostics produced during compilation.
-    Diagnostics getAllDiagnostics();
+    const Diagnostics& getAllDiagnostics();
+
+    /// A breakdown of the arena memory used by a compilation.
+    struct MemoryStats {
+        AllocatorStats syntaxTrees;     ///< Parse trees of all syntax trees added to the compilation.
+        AllocatorStats symbols;         ///< Symbols, types, expressions, and statements.
+        AllocatorStats symbolMaps;      ///< Name lookup tables for scopes.
+        AllocatorStats constants;       ///< Constant values produced during elaboration.
+
+        AllocatorStats total() const;
+    };
+
+    /// Gets statistics about the memory held in the compilation's allocators. Memory
+    /// that hash tables and other containers get from the heap is not included, nor
+    /// is the source text held by the source manager. Syntax trees shared with other
+    /// compilations are counted in full.
+    MemoryStats getMemoryStats() const;
+
+    /// Counts of events and objects, for reasoning about how the cost of a
+    /// compilation scales with the size of the design.
+    struct Statistics {
+        /// Events counted since the compilation was created. The underlying counters
+        /// are process wide, so this includes anything else the process did in the
+        /// meantime, such as parsing syntax trees for the compilation.
+        PerfCounterValues counters{};
+
+        /// The number of instances of each definition in the design as it currently
+        /// stands, most instantiated first. Counts are all zero until @a getRoot has
+        /// elaborated the design.
+        std::vector<std::pair<string_view, size_t>> instancesPerDefinition;
+    };
+
+    /// Gets counts of the work done so far by the compilation.
+    Statistics getStatistics() const;
+
+    /// Gets the limits that constant evaluation within the compilation is subject to.
+    const EvalOptions& getEvalOptions() const { return evalOptions; }
 
     /// Report an error at the specified location.
     Diagnostic& addError(DiagCode code, SourceLocation location) { return diags.add(code, location); }
@@ -95,6 +168,10 @@ public:
     /// Adds a set of diagnostics to the compilation's list of semantic diagnostics.
     void addDiagnostics(const Diagnostics& diagnostics);
 
+    /// Sets a filter that semantic diagnostics are checked against as they are issued.
+    /// Parse diagnostics are filtered by passing DiagnosticOptions to each syntax tree.
+    void setDiagnosticFilter(DiagnosticFilter* filter) { diags.setFilter(filter); }
+
     const Type& getType(SyntaxKind kind) const;
     const Type& getType(const DataTypeSyntax& node, LookupLocation location, const Scope& parent,
                         bool allowNetType = false);
@@ -149,8 +226,36 @@ private:
     static void findInstantiations(const ModuleDeclarationSyntax& module,
                                    SmallVector<NameSet>& scopeStack, NameSet& found);
     static void findInstantiations(const MemberSyntax& node, SmallVector<NameSet>& scopeStack, NameSet& found);
+    static void findInstantiations(const SyntaxNode& node, NameSet& found);
+
+    // These functions are used for building the root-level pieces of the design and for
+    // rebuilding them when a syntax tree is replaced.
+    CompilationUnitSymbol& createCompilationUnit(const SyntaxNode& node);
+    void removeTreeSymbols(size_t treeIndex);
+    void findTopDefinitions(SmallVector<const Definition*>& results) const;
+    const ModuleInstanceSymbol& instantiateTop(const Definition& definition);
+    const NameSet& getReferencedNames(const SyntaxNode& node);
+
+    // Moves all semantic diagnostics issued since the given count into the list owned by
+    // the given symbol.
+    void claimDiagnostics(const Symbol& owner, size_t start);
+    void forceDiagnostics(const Symbol& symbol);
+    void forcePackages();
+
+    // Sorted copies of the diagnostics handed out to callers. Each one remembers how
+    // many source diagnostics it was built from so that it can be rebuilt if more show up.
+    struct DiagnosticCache {
+        Diagnostics diags;
+        size_t parseCount = SIZE_MAX;
+        size_t semanticCount = SIZE_MAX;
+    };
+
+    size_t countParseDiagnostics() const;
 
     Diagnostics diags;
+    DiagnosticCache cachedParseDiags;
+    DiagnosticCache cachedSemanticDiags;
+    DiagnosticCache cachedAllDiags;
     std::unique_ptr<RootSymbol> root;
     const SourceManager* sourceManager = nullptr;
     bool finalized = false;
@@ -166,6 +271,27 @@ private:
     // Storage for syntax trees that have been added to the compilation.
     std::vector<std::shared_ptr<SyntaxTree>> syntaxTrees;
 
+    // Syntax trees that have been replaced. Symbols built from them can still point into them.
+    std::vector<std::shared_ptr<SyntaxTree>> replacedTrees;
+
+    // Semantic diagnostics issued while building or forcing each root-level piece of the design
+    // (compilation units, packages, and top level instances). Keeping them separate from the
+    // main list lets a replaced syntax tree throw away only the ones that get rebuilt.
+    flat_hash_map<const Symbol*, Diagnostics> symbolDiags;
+
+    // The root-level symbols that have already been visited to force their diagnostics.
+    flat_hash_set<const Symbol*> forcedSymbols;
+
+    // A cache of the design element and package names referenced by top-level syntax nodes,
+    // used to figure out what depends on a replaced syntax tree.
+    flat_hash_map<const SyntaxNode*, NameSet> referenceCache;
+
+    // Counter values at the time the compilation was created.
+    PerfCounterValues counterBaseline;
+
+    CompilationOptions compilationOptions;
+    EvalOptions evalOptions;
+
     // Specialized allocators for types that are not trivially destructible.
     TypedBumpAllocator<SymbolMap> symbolMapAllocator;
     TypedBumpAllocator<ConstantValue> constantAllocator;
@@ -6,8 +6,13 @@
 //------------------------------------------------------------------------------
 #include "Diagnostics.h"
 
+#include <algorithm>
+#include <exception>
 #include <fmt/format.h>
 #include <fmt/ostream.h>
+#include <nlohmann/json.hpp>
+#include <system_error>
+#include <thread>
 
 #include "symbols/TypePrinter.h"
 #include "text/SourceManager.h"
@@ -20,9 +25,64 @@ static const char* severityToString[] = {
     "error"
 };
 
+string_view toString(DiagCode code) {
+    static constexpr string_view names[] = {
+#define DIAG_NAME(name) #name,
+        DIAG_CODES(DIAG_NAME)
+#undef DIAG_NAME
+    };
+    static_assert(std::size(names) == (size_t)DiagCode::MaxValue);
+
+    ASSERT(code < DiagCode::MaxValue);
+    return names[(size_t)code];
+}
+
+optional<DiagCode> diagCodeFromString(string_view name) {
+    for (int i = 0; i < (int)DiagCode::MaxValue; i++) {
+        if (toString(DiagCode(i)) == name)
+            return DiagCode(i);
+    }
+    return std::nullopt;
+}
+
 Diagnostic::Diagnostic(DiagCode code, SourceLocation location) :
     code(code), location(location) {}
 
+Diagnostic::Diagnostic(const Diagnostic& other) :
+    notes(other.notes), code(other.code), location(other.location)
+{
+    args.appendRange(other.args);
+    ranges.appendRange(other.ranges);
+}
+
+Diagnostic::Diagnostic(Diagnostic&& other) noexcept :
+    args(std::move(other.args)), ranges(std::move(other.ranges)), notes(std::move(other.notes)),
+    code(other.code), location(other.location) {}
+
+Diagnostic& Diagnostic::operator=(const Diagnostic& other) {
+    if (this != &other) {
+        args.clear();
+        args.appendRange(other.args);
+        ranges.clear();
+        ranges.appendRange(other.ranges);
+        notes = other.notes;
+        code = other.code;
+        location = other.location;
+    }
+    return *this;
+}
+
+Diagnostic& Diagnostic::operator=(Diagnostic&& other) noexcept {
+    if (this != &other) {
+        args = std::move(other.args);
+        ranges = std::move(other.ranges);
+        notes = std::move(other.notes);
+        code = other.code;
+        location = other.location;
+    }
+    return *this;
+}
+
 Diagnostic& Diagnostic::addNote(DiagCode noteCode, SourceLocation noteLocation) {
     notes.emplace_back(noteCode, noteLocation);
     return notes.back();
@@ -34,22 +94,22 @@ Diagnostic& Diagnostic::addNote(const Diagnostic& diag) {
 }
 
 Diagnostic& operator<<(Diagnostic& diag, string_view arg) {
-    diag.args.emplace_back(std::string(arg));
+    diag.args.emplace(std::string(arg));
     return diag;
 }
 
 Diagnostic& operator<<(Diagnostic& diag, const Type& arg) {
-    diag.args.emplace_back(&arg);
+    diag.args.emplace(&arg);
     return diag;
 }
 
 Diagnostic& operator<<(Diagnostic& diag, SourceRange range) {
-    diag.ranges.push_back(range);
+    diag.ranges.append(range);
     return diag;
 }
 
 Diagnostic& operator<<(Diagnostic& diag, const ConstantValue& arg) {
-    diag.args.emplace_back(arg);
+    diag.args.emplace(arg);
     return diag;
 }
 
@@ -67,6 +127,20 @@ std::ostream& operator<<(std::ostream& os, const Diagnostic::Arg& arg) {
 }
 
 Diagnostic& Diagnostics::add(DiagCode code, SourceLocation location) {
+    if (filter && filter->isSuppressed(code, location)) {
+        // Callers still want something to stream arguments into, so hand back
+        // a scratch diagnostic. Clearing it keeps its storage around for reuse.
+        if (!discarded)
+            discarded = std::make_unique<Diagnostic>(code, location);
+
+        discarded->code = code;
+        discarded->location = location;
+        discarded->args.clear();
+        discarded->ranges.clear();
+        discarded->notes.clear();
+        return *discarded;
+    }
+
     emplace(code, location);
     return back();
 }
@@ -76,13 +150,89 @@ Diagnostic& Diagnostics::add(DiagCode code, SourceRange range) {
 }
 
 void Diagnostics::sort(const SourceManager& sourceManager) {
-    auto compare = [&sourceManager](auto& x, auto& y) {
-        SourceLocation xl = sourceManager.getFullyExpandedLoc(x.location);
-        SourceLocation yl = sourceManager.getFullyExpandedLoc(y.location);
-        return xl < yl;
-    };
+    // Look up each diagnostic's position in the compilation unit once up front
+    // so that the sort itself only has to compare integers.
+    std::vector<std::pair<uint64_t, uint32_t>> keys;
+    keys.reserve(size());
+    for (uint32_t i = 0; i < size(); i++)
+        keys.emplace_back(sourceManager.getCompilationUnitPosition((*this)[i].location), i);
+
+    std::stable_sort(keys.begin(), keys.end(),
+                     [](auto& x, auto& y) { return x.first < y.first; });
+
+    std::vector<Diagnostic> sorted;
+    sorted.reserve(size());
+    for (auto& key : keys)
+        sorted.emplace_back(std::move((*this)[key.second]));
+
+    for (uint32_t i = 0; i < size(); i++)
+        (*this)[i] = std::move(sorted[i]);
+}
+
+DiagnosticFilter::DiagnosticFilter(const SourceManager& sourceManager) :
+    sourceManager(sourceManager), codeStates((size_t)DiagCode::MaxValue)
+{
+}
+
+void DiagnosticFilter::setEnabled(DiagCode code, bool enabled) {
+    codeStates[(size_t)code] = enabled;
+}
+
+void DiagnosticFilter::suppressFile(string_view fileName) {
+    suppressedFiles.emplace(fileName);
+}
 
-    std::stable_sort(begin(), end(), compare);
+void DiagnosticFilter::setPragmaState(DiagCode code, SourceLocation location, bool enabled) {
+    SourceLocation fileLoc = sourceManager.getFullyExpandedLoc(location);
+    pragmaStates[fileLoc.buffer()].push_back({ fileLoc.offset(), code, enabled });
+}
+
+bool DiagnosticFilter::isSuppressed(DiagCode code, SourceLocation location) const {
+    uint32_t level = getWarningLevel(code);
+    if (!level)
+        return false;
+
+    if (!pragmaStates.empty() || !suppressedFiles.empty()) {
+        SourceLocation fileLoc = sourceManager.getFullyExpandedLoc(location);
+        auto it = pragmaStates.find(fileLoc.buffer());
+        if (it != pragmaStates.end()) {
+            // Pragmas are recorded in file order, so the most recent one
+            // before the location is the one that applies.
+            auto& states = it->second;
+            for (auto state = states.rbegin(); state != states.rend(); state++) {
+                if (state->code == code && state->offset <= fileLoc.offset())
+                    return !state->enabled;
+            }
+        }
+
+        if (suppressedFiles.find(sourceManager.getRawFileName(fileLoc.buffer())) != suppressedFiles.end())
+            return true;
+    }
+
+    const optional<bool>& state = codeStates[(size_t)code];
+    if (state)
+        return !*state;
+
+    return level > warningLevel;
+}
+
+DiagnosticSeverity DiagnosticFilter::getSeverity(DiagnosticSeverity severity) const {
+    if (severity == DiagnosticSeverity::Warning && warningsAsErrors)
+        return DiagnosticSeverity::Error;
+    return severity;
+}
+
+uint32_t DiagnosticFilter::getWarningLevel(DiagCode code) {
+    switch (code) {
+        case DiagCode::VectorLiteralOverflow:
+        case DiagCode::DuplicateAttribute:
+        case DiagCode::UnknownDiagnosticName:
+            return 1;
+        case DiagCode::IgnoredMacroPaste:
+            return 2;
+        default:
+            return 0;
+    }
 }
 
 DiagnosticWriter::DiagnosticWriter(const SourceManager& sourceManager) :
@@ -129,6 +279,9 @@ DiagnosticWriter::DiagnosticWriter(const SourceManager& sourceManager) :
     // preprocessor
     descriptors[DiagCode::CouldNotOpenIncludeFile] = { "could not find or open include file", DiagnosticSeverity::Error };
     descriptors[DiagCode::ExceededMaxIncludeDepth] = { "exceeded max include depth", DiagnosticSeverity::Error };
+    descriptors[DiagCode::ExceededMaxMacroExpansionDepth] = { "exceeded max macro expansion depth of {}", DiagnosticSeverity::Error };
+    descriptors[DiagCode::ExceededMaxExpandedTokens] = { "exceeded max of {} tokens produced by macro expansions", DiagnosticSeverity::Error };
+    descriptors[DiagCode::ExceededMaxExpansionEntries] = { "exceeded max of {} macro expansion entries", DiagnosticSeverity::Error };
     descriptors[DiagCode::UnknownDirective] = { "unknown macro or compiler directive '{}'", DiagnosticSeverity::Error };
     descriptors[DiagCode::ExpectedEndOfDirective] = { "expected end of directive (missing newline?)", DiagnosticSeverity::Error };
     descriptors[DiagCode::UnexpectedConditionalDirective] = { "unexpected conditional directive", DiagnosticSeverity::Error };
@@ -145,6 +298,7 @@ DiagnosticWriter::DiagnosticWriter(const SourceManager& sourceManager) :
     descriptors[DiagCode::InvalidTimescaleSpecifier] = { "timescale specifiers must be powers of ten with precision more precise than unit", DiagnosticSeverity::Error };
     descriptors[DiagCode::IgnoredMacroPaste] = { "paste token is pointless because it is adjacent to whitespace", DiagnosticSeverity::Warning };
     descriptors[DiagCode::SpuriousMacroToken] = { "spurious macro token", DiagnosticSeverity::Error };
+    descriptors[DiagCode::UnknownDiagnosticName] = { "unknown diagnostic '{}'", DiagnosticSeverity::Warning };
 
     // parser
     descriptors[DiagCode::ExpectedIdentifier] = { "expected identifier", DiagnosticSeverity::Error };
@@ -269,9 +423,19 @@ DiagnosticWriter::DiagnosticWriter(const SourceManager& sourceManager) :
     descriptors[DiagCode::NoteHierarchicalNameInCE] = { "reference to '{}' by hierarchical name is not allowed in a constant expression", DiagnosticSeverity::Note };
     descriptors[DiagCode::NoteFunctionIdentifiersMustBeLocal] = { "all identifiers that are not parameters must be declared locally to a constant function", DiagnosticSeverity::Note };
     descriptors[DiagCode::NoteParamUsedInCEBeforeDecl] = { "parameter '{}' is declared after the invocation of the current constant function", DiagnosticSeverity::Note };
+    descriptors[DiagCode::NoteExceededMaxEvalSteps] = { "constant evaluation exceeded the maximum of {} steps", DiagnosticSeverity::Note };
+    descriptors[DiagCode::NoteExceededMaxCallDepth] = { "constant evaluation exceeded the maximum call depth of {}", DiagnosticSeverity::Note };
+    descriptors[DiagCode::NoteSkippedCallFrames] = { "(skipping {} calls in the call stack)", DiagnosticSeverity::Note };
+    descriptors[DiagCode::ExceededMaxGenerateIterations] = { "generate loop exceeded the maximum of {} iterations", DiagnosticSeverity::Error };
 
     // if this assert fails, you added a new diagnostic without adding a descriptor for it
     ASSERT((int)DiagCode::MaxValue == descriptors.size());
+
+    // if this one fails, you added a warning without giving it a warning level
+    for (auto& [code, desc] : descriptors) {
+        ASSERT((desc.severity == DiagnosticSeverity::Warning) ==
+               (DiagnosticFilter::getWarningLevel(code) != 0));
+    }
 }
 
 void DiagnosticWriter::setMessage(DiagCode code, std::string format) {
@@ -286,54 +450,31 @@ DiagnosticSeverity DiagnosticWriter::getSeverity(DiagCode code) const {
     auto it = descriptors.find(code);
     if (it == descriptors.end())
         throw std::logic_error("Invalid diagnostic code");
+
+    if (filter)
+        return filter->getSeverity(it->second.severity);
     return it->second.severity;
 }
 
 std::string DiagnosticWriter::report(const Diagnostic& diagnostic) {
-    // walk out until we find a location for this diagnostic that isn't inside a macro
-    SmallVectorSized<SourceLocation, 8> expansionLocs;
-    SourceLocation location = diagnostic.location;
-    while (sourceManager.isMacroLoc(location)) {
-        expansionLocs.append(location);
-        location = sourceManager.getExpansionLoc(location);
-    }
+    std::vector<PendingEntry> entries;
+    prepareDiag(diagnostic, entries);
 
-    // build the error message from arguments, if we have any
     fmt::memory_buffer buffer;
-    Descriptor& desc = descriptors[diagnostic.code];
-    if (diagnostic.args.empty())
-        formatDiag(buffer, location, diagnostic.ranges, severityToString[(int)desc.severity], desc.format);
-    else {
-        // The fmtlib API for arg lists isn't very pretty, but it gets the job done
-        using ctx = fmt::format_context;
-        std::vector<fmt::basic_format_arg<ctx>> args;
-        for (auto& arg : diagnostic.args)
-            args.push_back(fmt::internal::make_arg<ctx>(arg));
-
-        std::string msg = fmt::vformat(desc.format, fmt::basic_format_args<ctx>(args.data(), (unsigned)args.size()));
-        formatDiag(buffer, location, diagnostic.ranges, severityToString[(int)desc.severity], msg);
-    }
-
-    // write out macro expansions, if we have any
-    while (!expansionLocs.empty()) {
-        location = expansionLocs.back();
-        expansionLocs.pop();
-        formatDiag(buffer, sourceManager.getOriginalLoc(location), std::vector<SourceRange>(),
-                   "note", "expanded from here");
-    }
-
-    for (const Diagnostic& note : diagnostic.notes)
-        buffer << report(note);
-
+    for (auto& entry : entries)
+        formatEntry(buffer, entry);
     return to_string(buffer);
 }
 
 std::string DiagnosticWriter::report(const Diagnostics& diagnostics) {
-    std::deque<SourceLocation> includeStack;
+    // First walk all of the diagnostics in order and resolve their locations.
+    std::vector<PendingEntry> entries;
+    std::vector<PendingDiag> pending;
+    SmallVectorSized<SourceLocation, 8> includeStack;
     BufferID lastBuffer;
-    fmt::memory_buffer buffer;
 
     for (auto& diag : diagnostics) {
+        PendingDiag& pd = pending.emplace_back();
         SourceLocation loc = sourceManager.getFullyExpandedLoc(diag.location);
         if (loc.buffer() != lastBuffer) {
             // We're looking at diagnostics from another file now. See if we should print
@@ -342,18 +483,236 @@ std::string DiagnosticWriter::report(const Diagnostics& diagnostics) {
             getIncludeStack(lastBuffer, includeStack);
 
             for (auto& includeLoc : includeStack) {
-                format_to(buffer, "In file included from {}:{}:\n",
+                pd.header += fmt::format("In file included from {}:{}:\n",
                     sourceManager.getFileName(includeLoc),
                     sourceManager.getLineNumber(includeLoc)
                 );
             }
         }
-        buffer << report(diag);
+
+        pd.firstEntry = (uint32_t)entries.size();
+        prepareDiag(diag, entries);
+        pd.entryCount = (uint32_t)entries.size() - pd.firstEntry;
+    }
+
+    // Now format contiguous batches of diagnostics, in parallel if there are enough of them.
+    auto formatBatch = [&](size_t begin, size_t end, fmt::memory_buffer& buffer) {
+        for (size_t i = begin; i < end; i++) {
+            buffer << pending[i].header;
+            for (uint32_t j = 0; j < pending[i].entryCount; j++)
+                formatEntry(buffer, entries[pending[i].firstEntry + j]);
+        }
+    };
+
+    static constexpr size_t MinBatchSize = 512;
+    size_t numThreads = threadCount ? threadCount : std::max(1u, std::thread::hardware_concurrency());
+    numThreads = std::min(numThreads, std::max(size_t(1), pending.size() / MinBatchSize));
+
+    // Exceptions can't be allowed to escape a thread, so each batch holds on to its
+    // own and the first one gets rethrown once every thread has been joined.
+    std::vector<fmt::memory_buffer> buffers(numThreads);
+    std::vector<std::exception_ptr> errors(numThreads);
+    size_t batchSize = (pending.size() + numThreads - 1) / numThreads;
+    auto runBatch = [&](size_t index) {
+        try {
+            size_t begin = std::min(pending.size(), index * batchSize);
+            size_t end = std::min(pending.size(), begin + batchSize);
+            formatBatch(begin, end, buffers[index]);
+        }
+        catch (...) {
+            errors[index] = std::current_exception();
+        }
+    };
+
+    // If a thread can't be started, the caller picks up the remaining batches itself.
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+    size_t started = 1;
+    try {
+        for (; started < numThreads; started++)
+            threads.emplace_back(runBatch, started);
+    }
+    catch (const std::system_error&) {
+    }
+
+    runBatch(0);
+    for (size_t i = started; i < numThreads; i++)
+        runBatch(i);
+
+    for (auto& thread : threads)
+        thread.join();
+
+    for (auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    std::string result;
+    size_t totalSize = 0;
+    for (auto& buffer : buffers)
+        totalSize += buffer.size();
+
+    result.reserve(totalSize);
+    for (auto& buffer : buffers)
+        result.append(buffer.data(), buffer.size());
+    return result;
+}
+
+std::string DiagnosticWriter::getMessage(const Diagnostic& diagnostic) const {
+    auto it = descriptors.find(diagnostic.code);
+    ASSERT(it != descriptors.end());
+    if (diagnostic.args.empty())
+        return it->second.format;
+
+    // The fmtlib API for arg lists isn't very pretty, but it gets the job done
+    using ctx = fmt::format_context;
+    SmallVectorSized<fmt::basic_format_arg<ctx>, 8> args;
+    for (auto& arg : diagnostic.args)
+        args.append(fmt::internal::make_arg<ctx>(arg));
+
+    return fmt::vformat(it->second.format, fmt::basic_format_args<ctx>(args.data(), (unsigned)args.size()));
+}
+
+void DiagnosticWriter::toJson(json& j, const Diagnostic& diagnostic) {
+    // walk out until we find a location for this diagnostic that isn't inside a macro
+    SmallVectorSized<SourceLocation, 8> expansionLocs;
+    SourceLocation location = diagnostic.location;
+    while (sourceManager.isMacroLoc(location)) {
+        expansionLocs.append(location);
+        location = sourceManager.getExpansionLoc(location);
+    }
+
+    j["code"] = std::string(toString(diagnostic.code));
+    j["severity"] = severityToString[(int)getSeverity(diagnostic.code)];
+    j["message"] = getMessage(diagnostic);
+    j["location"] = locationToJson(location);
+
+    SmallVectorSized<SourceLocation, 8> includeStack;
+    getIncludeStack(location.buffer(), includeStack);
+    if (!includeStack.empty()) {
+        json& stack = j["includeStack"];
+        for (auto loc : includeStack)
+            stack.push_back(locationToJson(loc));
+    }
+
+    if (!expansionLocs.empty()) {
+        json& expansions = j["expansions"];
+        while (!expansionLocs.empty()) {
+            expansions.push_back(locationToJson(sourceManager.getOriginalLoc(expansionLocs.back())));
+            expansionLocs.pop();
+        }
+    }
+
+    if (!diagnostic.ranges.empty()) {
+        json& ranges = j["ranges"];
+        for (SourceRange range : diagnostic.ranges) {
+            ranges.push_back({
+                { "start", locationToJson(sourceManager.getFullyExpandedLoc(range.start())) },
+                { "end", locationToJson(sourceManager.getFullyExpandedLoc(range.end())) }
+            });
+        }
+    }
+
+    if (!diagnostic.args.empty()) {
+        json& args = j["args"];
+        for (auto& arg : diagnostic.args) {
+            std::visit([&](auto&& t) {
+                if constexpr (std::is_same_v<std::decay_t<decltype(t)>, const Type*>) {
+                    TypePrinter printer;
+                    printer.append(*t);
+                    args.push_back(printer.toString());
+                }
+                else {
+                    args.push_back(t);
+                }
+            }, static_cast<const Diagnostic::ArgVariantType&>(arg));
+        }
+    }
+
+    if (!diagnostic.notes.empty()) {
+        json& notes = j["notes"];
+        for (const Diagnostic& note : diagnostic.notes) {
+            json noteJson;
+            toJson(noteJson, note);
+            notes.push_back(std::move(noteJson));
+        }
     }
-    return to_string(buffer);
 }
 
-string_view DiagnosticWriter::getBufferLine(SourceLocation location, uint32_t col) {
+void DiagnosticWriter::reportJson(const Diagnostic& diagnostic, std::ostream& os) {
+    json j;
+    toJson(j, diagnostic);
+    os << j.dump() << std::endl;
+}
+
+void DiagnosticWriter::reportJson(const Diagnostics& diagnostics, std::ostream& os) {
+    for (auto& diag : diagnostics)
+        reportJson(diag, os);
+}
+
+json DiagnosticWriter::locationToJson(SourceLocation location) const {
+    return {
+        { "file", std::string(sourceManager.getFileName(location)) },
+        { "line", sourceManager.getLineNumber(location) },
+        { "column", sourceManager.getColumnNumber(location) }
+    };
+}
+
+void DiagnosticWriter::prepareDiag(const Diagnostic& diagnostic, std::vector<PendingEntry>& entries) {
+    // walk out until we find a location for this diagnostic that isn't inside a macro
+    SmallVectorSized<SourceLocation, 8> expansionLocs;
+    SourceLocation location = diagnostic.location;
+    while (sourceManager.isMacroLoc(location)) {
+        expansionLocs.append(location);
+        location = sourceManager.getExpansionLoc(location);
+    }
+
+    prepareEntry(location, &diagnostic, entries);
+
+    // Printing a type can require resolving it, which isn't safe to do from
+    // multiple threads, so build the message now if there are any.
+    bool hasTypes = std::any_of(diagnostic.args.begin(), diagnostic.args.end(),
+                                [](auto& arg) { return std::holds_alternative<const Type*>(arg); });
+    if (hasTypes)
+        entries.back().message = getMessage(diagnostic);
+
+    // add notes for macro expansions, if we have any; really long chains (such as
+    // from a runaway recursive macro) only show the expansions at either end
+    const size_t maxExpansionNotes = 10;
+    size_t numExpansions = expansionLocs.size();
+    for (size_t i = 0; i < numExpansions; i++) {
+        location = expansionLocs.back();
+        expansionLocs.pop();
+
+        if (numExpansions > maxExpansionNotes && i >= maxExpansionNotes / 2 &&
+            i < numExpansions - maxExpansionNotes / 2) {
+            if (i == maxExpansionNotes / 2) {
+                prepareEntry(sourceManager.getOriginalLoc(location), nullptr, entries);
+                entries.back().message = fmt::format("(skipping {} expansions)",
+                                                     numExpansions - maxExpansionNotes);
+            }
+            continue;
+        }
+
+        prepareEntry(sourceManager.getOriginalLoc(location), nullptr, entries);
+    }
+
+    for (const Diagnostic& note : diagnostic.notes)
+        prepareDiag(note, entries);
+}
+
+void DiagnosticWriter::prepareEntry(SourceLocation location, const Diagnostic* diagnostic,
+                                    std::vector<PendingEntry>& entries) {
+    PendingEntry& entry = entries.emplace_back();
+    entry.diag = diagnostic;
+    entry.location = location;
+    entry.fileName = sourceManager.getFileName(location);
+    entry.line = sourceManager.getLineNumber(location);
+    entry.col = sourceManager.getColumnNumber(location);
+    entry.sourceLine = getBufferLine(location, entry.col);
+}
+
+string_view DiagnosticWriter::getBufferLine(SourceLocation location, uint32_t col) const {
     string_view text = sourceManager.getSourceText(location.buffer());
     if (text.empty())
         return "";
@@ -366,20 +725,21 @@ string_view DiagnosticWriter::getBufferLine(SourceLocation location, uint32_t co
     return string_view(start, (uint32_t)(curr - start));
 }
 
-void DiagnosticWriter::getIncludeStack(BufferID buffer, std::deque<SourceLocation>& stack) {
+void DiagnosticWriter::getIncludeStack(BufferID buffer, SmallVector<SourceLocation>& stack) const {
     stack.clear();
     while (buffer) {
         SourceLocation loc = sourceManager.getIncludedFrom(buffer);
         if (!loc.buffer())
             break;
 
-        stack.push_front(loc);
+        stack.append(loc);
         buffer = loc.buffer();
     }
+    std::reverse(stack.begin(), stack.end());
 }
 
 void DiagnosticWriter::highlightRange(SourceRange range, SourceLocation caretLoc, uint32_t col,
-                                      string_view sourceLine, std::string& buffer) {
+                                      string_view sourceLine, std::string& buffer) const {
     // If the end location is within a macro, we want to push it out to the
     // end of the expanded location so that it encompasses the entire macro usage
     SourceLocation startLoc = sourceManager.getFullyExpandedLoc(range.start());
@@ -429,18 +789,28 @@ void DiagnosticWriter::highlightRange(SourceRange range, SourceLocation caretLoc
 }
 
 template<typename T>
-void DiagnosticWriter::formatDiag(T& buffer, SourceLocation loc, const std::vector<SourceRange>& ranges,
-                                  const char* severity, const std::string& msg) {
-    uint32_t col = sourceManager.getColumnNumber(loc);
+void DiagnosticWriter::formatEntry(T& buffer, const PendingEntry& entry) const {
+    const char* severity = "note";
+    const SmallVector<SourceRange>* ranges = nullptr;
+    std::string msg = entry.message.empty() ? "expanded from here" : entry.message;
+
+    if (entry.diag) {
+        severity = severityToString[(int)getSeverity(entry.diag->code)];
+        ranges = &entry.diag->ranges;
+
+        msg = entry.message.empty() ? getMessage(*entry.diag) : entry.message;
+    }
+
+    uint32_t col = entry.col;
     format_to(buffer, "{}:{}:{}: {}: {}",
-        sourceManager.getFileName(loc),
-        sourceManager.getLineNumber(loc),
+        entry.fileName,
+        entry.line,
         col,
         severity,
         msg
     );
 
-    string_view line = getBufferLine(loc, col);
+    string_view line = entry.sourceLine;
     if (!line.empty()) {
         format_to(buffer, "\n{}\n", line);
 
@@ -453,8 +823,10 @@ void DiagnosticWriter::formatDiag(T& buffer, SourceLocation loc, const std::vect
                 highlight[i] = '\t';
         }
 
-        for (SourceRange range : ranges)
-            highlightRange(range, loc, col, line, highlight);
+        if (ranges) {
+            for (SourceRange range : *ranges)
+                highlightRange(range, entry.location, col, line, highlight);
+        }
 
         highlight[col - 1] = '^';
         highlight.erase(highlight.find_last_not_of(' ') + 1);
@@ -6,11 +6,14 @@
 //------------------------------------------------------------------------------
 #pragma once
 
-#include <deque>
+#include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include <flat_hash_map.hpp>
+
 #include "binding/ConstantValue.h"
 #include "text/SourceLocation.h"
 #include "util/SmallVector.h"
@@ -20,192 +23,203 @@ namespace slang {
 class SourceManager;
 class Type;
 
+/// The complete list of diagnostic codes, grouped by the part of the compiler that
+/// issues them. Both the DiagCode enum and the code names come from this list.
+#define DIAG_CODES(x) \
+    /* lexer */                            \
+    x(NonPrintableChar)                    \
+    x(UTF8Char)                            \
+    x(UnicodeBOM)                          \
+    x(EmbeddedNull)                        \
+    x(MisplacedDirectiveChar)              \
+    x(EscapedWhitespace)                   \
+    x(ExpectedClosingQuote)                \
+    x(UnterminatedBlockComment)            \
+    x(NestedBlockComment)                  \
+    x(SplitBlockCommentInDirective)        \
+    x(ExpectedIntegerBaseAfterSigned)      \
+    x(MissingFractionalDigits)             \
+    x(OctalEscapeCodeTooBig)               \
+    x(InvalidHexEscapeCode)                \
+    x(UnknownEscapeCode)                   \
+    x(ExpectedIncludeFileName)             \
+    x(MissingExponentDigits)               \
+    x(VectorDigitsLeadingUnderscore)       \
+    x(DecimalDigitMultipleUnknown)         \
+    x(BadBinaryDigit)                      \
+    x(BadOctalDigit)                       \
+    x(BadDecimalDigit)                     \
+    x(BadHexDigit)                         \
+    x(IncludeNotFirstOnLine)               \
+    x(TooManyLexerErrors)                  \
+    /* numeric */                          \
+    x(LiteralSizeIsZero)                   \
+    x(LiteralSizeTooLarge)                 \
+    x(RealExponentOverflow)                \
+    x(SignedIntegerOverflow)               \
+    x(DecimalLiteralOverflow)              \
+    x(VectorLiteralOverflow)               \
+    x(ValueMustNotBeUnknown)               \
+    x(ValueMustBePositive)                 \
+    x(ValueExceedsMaxBitWidth)             \
+    /* preprocessor */                     \
+    x(CouldNotOpenIncludeFile)             \
+    x(ExceededMaxIncludeDepth)             \
+    x(ExceededMaxMacroExpansionDepth)      \
+    x(ExceededMaxExpandedTokens)           \
+    x(ExceededMaxExpansionEntries)         \
+    x(UnknownDirective)                    \
+    x(ExpectedEndOfDirective)              \
+    x(UnexpectedConditionalDirective)      \
+    x(UnbalancedMacroArgDims)              \
+    x(ExpectedMacroArgs)                   \
+    x(ExpectedNetType)                     \
+    x(InvalidMacroName)                    \
+    x(TooManyActualMacroArgs)              \
+    x(NotEnoughMacroArgs)                  \
+    x(InvalidLineDirectiveLevel)           \
+    x(UndefineBuiltinDirective)            \
+    x(UnrecognizedKeywordVersion)          \
+    x(MismatchedEndKeywordsDirective)      \
+    x(InvalidTimescaleSpecifier)           \
+    x(IgnoredMacroPaste)                   \
+    x(SpuriousMacroToken)                  \
+    x(UnknownDiagnosticName)               \
+    /* parser */                           \
+    x(ExpectedIdentifier)                  \
+    x(ExpectedToken)                       \
+    x(MisplacedTrailingSeparator)          \
+    x(ImplicitNotAllowed)                  \
+    x(MultipleTypesInDeclaration)          \
+    x(ColonShouldBeDot)                    \
+    x(ExpectedMember)                      \
+    x(ExpectedStatement)                   \
+    x(ExpectedParameterPort)               \
+    x(ExpectedNonAnsiPort)                 \
+    x(ExpectedAnsiPort)                    \
+    x(ExpectedModportPort)                 \
+    x(ExpectedFunctionPort)                \
+    x(ExpectedAssertionItemPort)           \
+    x(ExpectedForInitializer)              \
+    x(ExpectedExpression)                  \
+    x(ExpectedOpenRangeElement)            \
+    x(ExpectedStreamExpression)            \
+    x(ExpectedArgument)                    \
+    x(ExpectedVariableDeclarator)          \
+    x(ExpectedConditionalPattern)          \
+    x(ExpectedAttribute)                   \
+    x(ExpectedPackageImport)               \
+    x(ExpectedHierarchicalInstantiation)   \
+    x(ExpectedPortConnection)              \
+    x(ExpectedVectorDigits)                \
+    x(ExpectedVariableAssignment)          \
+    x(ExpectedInterfaceClassName)          \
+    x(ExpectedAssignmentKey)               \
+    x(ExpectedDistItem)                    \
+    x(ExpectedIfOrCase)                    \
+    x(ExpectedClassScope)                  \
+    x(NoLabelOnSemicolon)                  \
+    x(DeferredDelayMustBeZero)             \
+    x(InvalidGenvarIterExpression)         \
+    x(ExpectedGenvarIterVar)               \
+    x(ConstFunctionPortRequiresRef)        \
+    x(ExpectedClockingSkew)                \
+    x(ExpectedDPISpecString)               \
+    x(AttributesOnEmpty)                   \
+    x(AttributesOnClassParam)              \
+    x(AttributesOnGenerateRegion)          \
+    x(AttributesOnTimeDecl)                \
+    /* declarations */                     \
+    x(DuplicateDefinition)                 \
+    x(NotePreviousDefinition)              \
+    x(UnknownModule)                       \
+    x(LocalParamNoInitializer)             \
+    x(BodyParamNoInitializer)              \
+    x(UnpackedDimensionRequired)           \
+    x(UnpackedDimensionRequiresConstRange) \
+    x(PackedDimRequiresConstantRange)      \
+    x(PackedDimsOnPredefinedType)          \
+    x(DimensionOutOfRange)                 \
+    x(MixingOrderedAndNamedParams)         \
+    x(DuplicateParamAssignment)            \
+    x(NotePreviousUsage)                   \
+    x(ParamHasNoValue)                     \
+    x(ModuleUnreferenced)                  \
+    x(NoteDeclarationHere)                 \
+    x(TooManyParamAssignments)             \
+    x(AssignedToLocalPortParam)            \
+    x(AssignedToLocalBodyParam)            \
+    x(ParameterDoesNotExist)               \
+    x(DuplicateAttribute)                  \
+    x(PackedMemberNotIntegral)             \
+    x(PackedMemberHasInitializer)          \
+    x(Redefinition)                        \
+    x(RedefinitionDifferentType)           \
+    x(RedefinitionDifferentSymbolKind)     \
+    x(UnresolvedForwardTypedef)            \
+    x(ForwardTypedefDoesNotMatch)          \
+    /* expressions */                      \
+    x(BadUnaryExpression)                  \
+    x(BadBinaryExpression)                 \
+    x(BadIndexExpression)                  \
+    x(BadConcatExpression)                 \
+    x(CannotIndexScalar)                   \
+    x(IndexMustBeIntegral)                 \
+    x(ArgMustBeIntegral)                   \
+    x(BadAssignment)                       \
+    x(NoImplicitConversion)                \
+    x(TooManyArguments)                    \
+    x(ExpressionNotAssignable)             \
+    x(ReplicationZeroOutsideConcat)        \
+    x(MemberAccessNotStructUnion)          \
+    x(ExpressionNotCallable)               \
+    /* statements */                       \
+    x(ReturnNotInSubroutine)               \
+    /* types */                            \
+    x(InvalidEnumBase)                     \
+    x(NetTypeNotAllowed)                   \
+    /* lookups */                          \
+    x(AmbiguousWildcardImport)             \
+    x(NoteImportedFrom)                    \
+    x(ImportNameCollision)                 \
+    x(UndeclaredIdentifier)                \
+    x(UnknownClassOrPackage)               \
+    x(UsedBeforeDeclared)                  \
+    x(NotAType)                            \
+    x(NotAValue)                           \
+    x(NotASubroutine)                      \
+    x(NotAHierarchicalScope)               \
+    x(HierarchicalNotAllowedInConstant)    \
+    x(UnknownMember)                       \
+    x(RecursiveDefinition)                 \
+    /* constant evaluation */              \
+    x(ExpressionNotConstant)               \
+    x(NoteInCallTo)                        \
+    x(NoteNonConstVariable)                \
+    x(NoteArrayIndexInvalid)               \
+    x(NotePartSelectInvalid)               \
+    x(NoteHierarchicalNameInCE)            \
+    x(NoteFunctionIdentifiersMustBeLocal)  \
+    x(NoteParamUsedInCEBeforeDecl)         \
+    x(NoteExceededMaxEvalSteps)            \
+    x(NoteExceededMaxCallDepth)            \
+    x(NoteSkippedCallFrames)               \
+    x(ExceededMaxGenerateIterations)
+
 /// Complete set of diagnostic codes.
 enum class DiagCode : uint8_t {
-    // lexer
-    NonPrintableChar,
-    UTF8Char,
-    UnicodeBOM,
-    EmbeddedNull,
-    MisplacedDirectiveChar,
-    EscapedWhitespace,
-    ExpectedClosingQuote,
-    UnterminatedBlockComment,
-    NestedBlockComment,
-    SplitBlockCommentInDirective,
-    ExpectedIntegerBaseAfterSigned,
-    MissingFractionalDigits,
-    OctalEscapeCodeTooBig,
-    InvalidHexEscapeCode,
-    UnknownEscapeCode,
-    ExpectedIncludeFileName,
-    MissingExponentDigits,
-    VectorDigitsLeadingUnderscore,
-    DecimalDigitMultipleUnknown,
-    BadBinaryDigit,
-    BadOctalDigit,
-    BadDecimalDigit,
-    BadHexDigit,
-    IncludeNotFirstOnLine,
-    TooManyLexerErrors,
-
-    // numeric
-    LiteralSizeIsZero,
-    LiteralSizeTooLarge,
-    RealExponentOverflow,
-    SignedIntegerOverflow,
-    DecimalLiteralOverflow,
-    VectorLiteralOverflow,
-    ValueMustNotBeUnknown,
-    ValueMustBePositive,
-    ValueExceedsMaxBitWidth,
-
-    // preprocessor
-    CouldNotOpenIncludeFile,
-    ExceededMaxIncludeDepth,
-    UnknownDirective,
-    ExpectedEndOfDirective,
-    UnexpectedConditionalDirective,
-    UnbalancedMacroArgDims,
-    ExpectedMacroArgs,
-    ExpectedNetType,
-    InvalidMacroName,
-    TooManyActualMacroArgs,
-    NotEnoughMacroArgs,
-    InvalidLineDirectiveLevel,
-    UndefineBuiltinDirective,
-    UnrecognizedKeywordVersion,
-    MismatchedEndKeywordsDirective,
-    InvalidTimescaleSpecifier,
-    IgnoredMacroPaste,
-    SpuriousMacroToken,
-
-    // parser
-    ExpectedIdentifier,
-    ExpectedToken,
-    MisplacedTrailingSeparator,
-    ImplicitNotAllowed,
-    MultipleTypesInDeclaration,
-    ColonShouldBeDot,
-    ExpectedMember,
-    ExpectedStatement,
-    ExpectedParameterPort,
-    ExpectedNonAnsiPort,
-    ExpectedAnsiPort,
-    ExpectedModportPort,
-    ExpectedFunctionPort,
-    ExpectedAssertionItemPort,
-    ExpectedForInitializer,
-    ExpectedExpression,
-    ExpectedOpenRangeElement,
-    ExpectedStreamExpression,
-    ExpectedArgument,
-    ExpectedVariableDeclarator,
-    ExpectedConditionalPattern,
-    ExpectedAttribute,
-    ExpectedPackageImport,
-    ExpectedHierarchicalInstantiation,
-    ExpectedPortConnection,
-    ExpectedVectorDigits,
-    ExpectedVariableAssignment,
-    ExpectedInterfaceClassName,
-    ExpectedAssignmentKey,
-    ExpectedDistItem,
-    ExpectedIfOrCase,
-    ExpectedClassScope,
-    NoLabelOnSemicolon,
-    DeferredDelayMustBeZero,
-    InvalidGenvarIterExpression,
-    ExpectedGenvarIterVar,
-    ConstFunctionPortRequiresRef,
-    ExpectedClockingSkew,
-    ExpectedDPISpecString,
-    AttributesOnEmpty,
-    AttributesOnClassParam,
-    AttributesOnGenerateRegion,
-    AttributesOnTimeDecl,
-
-    // declarations
-    DuplicateDefinition,
-    NotePreviousDefinition,
-    UnknownModule,
-    LocalParamNoInitializer,
-    BodyParamNoInitializer,
-    UnpackedDimensionRequired,
-    UnpackedDimensionRequiresConstRange,
-    PackedDimRequiresConstantRange,
-    PackedDimsOnPredefinedType,
-    DimensionOutOfRange,
-    MixingOrderedAndNamedParams,
-    DuplicateParamAssignment,
-    NotePreviousUsage,
-    ParamHasNoValue,
-    ModuleUnreferenced,
-    NoteDeclarationHere,
-    TooManyParamAssignments,
-    AssignedToLocalPortParam,
-    AssignedToLocalBodyParam,
-    ParameterDoesNotExist,
-    DuplicateAttribute,
-    PackedMemberNotIntegral,
-    PackedMemberHasInitializer,
-    Redefinition,
-    RedefinitionDifferentType,
-    RedefinitionDifferentSymbolKind,
-    UnresolvedForwardTypedef,
-    ForwardTypedefDoesNotMatch,
-
-    // expressions
-    BadUnaryExpression,
-    BadBinaryExpression,
-    BadIndexExpression,
-    BadConcatExpression,
-    CannotIndexScalar,
-    IndexMustBeIntegral,
-    ArgMustBeIntegral,
-    BadAssignment,
-    NoImplicitConversion,
-    TooManyArguments,
-    ExpressionNotAssignable,
-    ReplicationZeroOutsideConcat,
-    MemberAccessNotStructUnion,
-    ExpressionNotCallable,
-
-    // statements
-    ReturnNotInSubroutine,
-
-    // types
-    InvalidEnumBase,
-    NetTypeNotAllowed,
-
-    // lookups
-    AmbiguousWildcardImport,
-    NoteImportedFrom,
-    ImportNameCollision,
-    UndeclaredIdentifier,
-    UnknownClassOrPackage,
-    UsedBeforeDeclared,
-    NotAType,
-    NotAValue,
-    NotASubroutine,
-    NotAHierarchicalScope,
-    HierarchicalNotAllowedInConstant,
-    UnknownMember,
-    RecursiveDefinition,
-
-    // constant evaluation
-    ExpressionNotConstant,
-    NoteInCallTo,
-    NoteNonConstVariable,
-    NoteArrayIndexInvalid,
-    NotePartSelectInvalid,
-    NoteHierarchicalNameInCE,
-    NoteFunctionIdentifiersMustBeLocal,
-    NoteParamUsedInCEBeforeDecl,
-
+#define DIAG_CODE(name) name,
+    DIAG_CODES(DIAG_CODE)
+#undef DIAG_CODE
     MaxValue
 };
 
+/// Gets the name of the given diagnostic code.
+string_view toString(DiagCode code);
+
+/// Looks up a diagnostic code by its name, as returned by toString.
+optional<DiagCode> diagCodeFromString(string_view name);
+
 /// The severity of a given diagnostic. This is not tied to the diagnostic itself;
 /// it can be configured on a per-diagnostic basis at runtime.
 enum class DiagnosticSeverity {
@@ -223,8 +237,12 @@ public:
         using ArgVariantType::variant;
         friend std::ostream& operator<<(std::ostream& os, const Arg& arg);
     };
-    std::vector<Arg> args;
-    std::vector<SourceRange> ranges;
+
+    // Nearly all diagnostics have at most a couple of arguments and ranges, so they
+    // are stored inline to avoid heap allocations. Notes are rare enough that they
+    // can live in a regular vector, which doesn't allocate until one is added.
+    SmallVectorSized<Arg, 2> args;
+    SmallVectorSized<SourceRange, 2> ranges;
     std::vector<Diagnostic> notes;
 
     /// The specific kind of diagnostic that was issued.
@@ -236,6 +254,11 @@ public:
     /// Constructs a new Diagnostic entry with the given code and location.
     Diagnostic(DiagCode code, SourceLocation location);
 
+    Diagnostic(const Diagnostic& other);
+    Diagnostic(Diagnostic&& other) noexcept;
+    Diagnostic& operator=(const Diagnostic& other);
+    Diagnostic& operator=(Diagnostic&& other) noexcept;
+
     /// Adds a new note to the diagnostic at the given source location.
     Diagnostic& addNote(DiagCode code, SourceLocation location);
     Diagnostic& addNote(const Diagnostic& diag);
@@ -248,34 +271,109 @@ public:
 
     template<typename T, typename = std::enable_if_t<std::is_integral_v<T> && std::is_signed_v<T>>>
     inline friend Diagnostic& operator<<(Diagnostic& diag, T arg) {
-        diag.args.emplace_back((int64_t)arg);
+        diag.args.emplace((int64_t)arg);
         return diag;
     }
 
     template<typename T, typename = void, typename = std::enable_if_t<std::is_integral_v<T> && std::is_unsigned_v<T>>>
     inline friend Diagnostic& operator<<(Diagnostic& diag, T arg) {
-        diag.args.emplace_back((uint64_t)arg);
+        diag.args.emplace((uint64_t)arg);
         return diag;
     }
 };
 
+/// Decides which diagnostics actually get issued. When attached to a Diagnostics
+/// collection the filter is consulted as each diagnostic is added, so suppressed
+/// diagnostics never have their arguments built up or get formatted.
+///
+/// Only warnings can be suppressed; errors and notes are always issued.
+class DiagnosticFilter {
+public:
+    explicit DiagnosticFilter(const SourceManager& sourceManager);
+
+    /// Sets the warning level. Each warning is enabled starting at a particular level,
+    /// with level 1 (the default) being the standard set and higher levels being more
+    /// pedantic. Level 0 disables all warnings.
+    void setWarningLevel(uint32_t level) { warningLevel = level; }
+
+    /// Explicitly enables or disables the given warning, regardless of warning level.
+    void setEnabled(DiagCode code, bool enabled);
+
+    /// Suppresses all warnings in the file with the given name, as reported by
+    /// SourceManager::getRawFileName.
+    void suppressFile(string_view fileName);
+
+    /// Enables or disables the given warning from @a location until the end of its
+    /// file, or until the next state change for that warning. This takes precedence
+    /// over any other settings and is how `pragma diagnostic directives are applied.
+    void setPragmaState(DiagCode code, SourceLocation location, bool enabled);
+
+    /// Sets whether warnings should be reported as errors.
+    void setWarningsAsErrors(bool value) { warningsAsErrors = value; }
+
+    /// Determines whether a diagnostic with the given code and location should be dropped.
+    bool isSuppressed(DiagCode code, SourceLocation location) const;
+
+    /// Gets the severity to report for a diagnostic that would otherwise have
+    /// the given severity.
+    DiagnosticSeverity getSeverity(DiagnosticSeverity severity) const;
+
+    /// Gets the warning level at which the given diagnostic is enabled,
+    /// or zero if it isn't a warning.
+    static uint32_t getWarningLevel(DiagCode code);
+
+private:
+    struct PragmaState {
+        uint32_t offset;
+        DiagCode code;
+        bool enabled;
+    };
+
+    const SourceManager& sourceManager;
+    std::vector<optional<bool>> codeStates;
+    std::set<std::string, std::less<>> suppressedFiles;
+    flat_hash_map<BufferID, std::vector<PragmaState>> pragmaStates;
+    uint32_t warningLevel = 1;
+    bool warningsAsErrors = false;
+};
+
+/// Contains options that control how diagnostics are collected.
+struct DiagnosticOptions {
+    /// If set, diagnostics are checked against this filter as they are added.
+    DiagnosticFilter* filter = nullptr;
+};
+
 /// A collection of diagnostics.
-class Diagnostics : public SmallVectorSized<Diagnostic, 8> {
+class Diagnostics : public SmallVectorSized<Diagnostic, 4> {
 public:
     Diagnostics() = default;
 
     Diagnostics(Diagnostics&& other) noexcept :
-        SmallVectorSized<Diagnostic, 8>(std::move(other)) {}
+        SmallVectorSized<Diagnostic, 4>(std::move(other)),
+        filter(other.filter), discarded(std::move(other.discarded)) {}
     Diagnostics& operator=(Diagnostics&& other) = default;
 
+    /// Sets a filter to check whenever a diagnostic is added. Suppressed diagnostics
+    /// are not added to the collection; the add methods instead return a scratch
+    /// diagnostic that gets reused for each one.
+    void setFilter(DiagnosticFilter* newFilter) { filter = newFilter; }
+
+    /// Gets the filter attached to the collection, if any.
+    DiagnosticFilter* getFilter() const { return filter; }
+
     /// Adds a new diagnostic to the collection, pointing to the given source location.
     Diagnostic& add(DiagCode code, SourceLocation location);
 
     /// Adds a new diagnostic to the collection, highlighting the given source range.
     Diagnostic& add(DiagCode code, SourceRange range);
 
-    /// Sorts the diagnostics in the collection based on source file and line number.
+    /// Sorts the diagnostics in the collection based on where they occur in their
+    /// compilation unit, with included files appearing at their point of inclusion.
     void sort(const SourceManager& sourceManager);
+
+private:
+    DiagnosticFilter* filter = nullptr;
+    std::unique_ptr<Diagnostic> discarded;
 };
 
 class DiagnosticWriter {
@@ -288,26 +386,80 @@ public:
     /// Sets the severity to use for the given diagnostic.
     void setSeverity(DiagCode code, DiagnosticSeverity severity);
 
-    /// Gets the current severity of the given diagnostic.
+    /// Gets the current severity of the given diagnostic, taking into account
+    /// any filter that has been set.
     DiagnosticSeverity getSeverity(DiagCode code) const;
 
+    /// Sets a filter used to adjust reported severities (e.g. to turn warnings into errors).
+    void setFilter(const DiagnosticFilter* newFilter) { filter = newFilter; }
+
     /// Writes a report for the given diagnostic.
     std::string report(const Diagnostic& diagnostic);
 
-    /// Writes a report for all of the diagnostics in the given collection.
-    /// Note that this modifies the collection by sorting it.
+    /// Writes a report for all of the diagnostics in the given collection, which
+    /// should already be sorted. Source locations for the whole batch are looked up
+    /// in one pass, after which large batches can be formatted on multiple threads
+    /// (see setThreadCount).
     std::string report(const Diagnostics& diagnostics);
 
+    /// Serializes the given diagnostic into a JSON object, including its code, severity,
+    /// message, resolved location, ranges, arguments, include stack, macro expansion
+    /// chain, and any notes.
+    void toJson(json& j, const Diagnostic& diagnostic);
+
+    /// Writes the diagnostic to @a os as a single line of JSON (see toJson), flushing
+    /// afterward so that consumers see it right away.
+    void reportJson(const Diagnostic& diagnostic, std::ostream& os);
+
+    /// Writes each diagnostic in the collection to @a os as a single line of JSON.
+    void reportJson(const Diagnostics& diagnostics, std::ostream& os);
+
+    /// Sets the maximum number of threads used to format large batches of diagnostics.
+    /// The default is one, which formats everything on the calling thread; zero means
+    /// to use the number of hardware threads available.
+    void setThreadCount(uint32_t count) { threadCount = count; }
+
 private:
-    string_view getBufferLine(SourceLocation location, uint32_t col);
-    void getIncludeStack(BufferID buffer, std::deque<SourceLocation>& stack);
-    void highlightRange(SourceRange range, SourceLocation caretLoc, uint32_t col, string_view sourceLine, std::string& buffer);
+    // A single entry of output (a diagnostic, one of its notes, or a note pointing
+    // at a macro expansion) with its location already resolved. Resolving touches
+    // caches in the source manager, and printing types can trigger lazy binding,
+    // so both happen up front on one thread. Everything else can run in parallel.
+    struct PendingEntry {
+        const Diagnostic* diag = nullptr;   // null for macro expansion notes
+        std::string message;                // preformatted if the args contain types, or
+                                            // for notes that stand in for skipped expansions
+        string_view fileName;
+        string_view sourceLine;
+        SourceLocation location;
+        uint32_t line = 0;
+        uint32_t col = 0;
+    };
+
+    // A top-level diagnostic, along with any include stack info that should be
+    // printed before it and the range of entries that make it up.
+    struct PendingDiag {
+        std::string header;
+        uint32_t firstEntry = 0;
+        uint32_t entryCount = 0;
+    };
+
+    std::string getMessage(const Diagnostic& diagnostic) const;
+    json locationToJson(SourceLocation location) const;
+
+    void prepareDiag(const Diagnostic& diagnostic, std::vector<PendingEntry>& entries);
+    void prepareEntry(SourceLocation location, const Diagnostic* diagnostic, std::vector<PendingEntry>& entries);
 
     template<typename T>
-    void formatDiag(T& buffer, SourceLocation loc, const std::vector<SourceRange>& ranges,
-                    const char* severity, const std::string& msg);
+    void formatEntry(T& buffer, const PendingEntry& entry) const;
+
+    string_view getBufferLine(SourceLocation location, uint32_t col) const;
+    void getIncludeStack(BufferID buffer, SmallVector<SourceLocation>& stack) const;
+    void highlightRange(SourceRange range, SourceLocation caretLoc, uint32_t col,
+                        string_view sourceLine, std::string& buffer) const;
 
     const SourceManager& sourceManager;
+    const DiagnosticFilter* filter = nullptr;
+    uint32_t threadCount = 1;
 
     // Little structure to hold a diagnostic's format and severity.
     struct Descriptor {
@@ -13,6 +13,7 @@
 #include "text/CharInfo.h"
 #include "text/SourceManager.h"
 #include "util/BumpAllocator.h"
+#include "util/PerfCounters.h"
 
 namespace slang {
 
@@ -195,15 +196,16 @@ Token Lexer::lex(LexerMode mode, KeywordVersion keywordVersion) {
         return lexIncludeFileName();
 
     auto info = alloc.emplace<Token::Info>();
-    SmallVectorSized<Trivia, 32> triviaBuffer;
+    ArenaBuilder<Trivia> triviaBuffer(alloc);
     bool directiveMode = mode == LexerMode::Directive;
 
     // Lex any leading trivia; if we're in directive mode this might require
-    // us to return an EndOfDirective token right away.
-    if (lexTrivia(triviaBuffer, directiveMode)) {
-        info->trivia = triviaBuffer.copy(alloc);
+    // us to return an EndOfDirective token right away. Nothing else gets allocated
+    // while scanning trivia, so the list is built in place at the end of the arena.
+    bool endOfDirective = lexTrivia(triviaBuffer, directiveMode);
+    info->trivia = triviaBuffer.finish();
+    if (endOfDirective)
         return Token(TokenKind::EndOfDirective, info);
-    }
 
     // lex the next token
     mark();
@@ -215,10 +217,13 @@ Token Lexer::lex(LexerMode mode, KeywordVersion keywordVersion) {
         // Stop any further lexing by claiming to be at the end of the buffer.
         addError(DiagCode::TooManyLexerErrors, currentOffset());
         sourceBuffer = sourceEnd - 1;
+        triviaBuffer.appendRange(info->trivia);
         triviaBuffer.append(Trivia(TriviaKind::DisabledText, lexeme()));
+        info->trivia = triviaBuffer.finish();
         kind = TokenKind::EndOfFile;
     }
-    info->trivia = triviaBuffer.copy(alloc);
+
+    PerfCounters::increment(PerfCounter::TokensLexed);
     return Token(kind, info);
 }
 
@@ -665,13 +670,13 @@ TokenKind Lexer::lexDirective(Token::Info* info) {
 
 Token Lexer::lexIncludeFileName() {
     // leading whitespace should lex into trivia
-    SmallVectorSized<Trivia, 8> triviaBuffer;
+    ArenaBuilder<Trivia> triviaBuffer(alloc);
     if (isHorizontalWhitespace(peek())) {
         mark();
         scanWhitespace(triviaBuffer);
     }
 
-    span<Trivia const> trivia = triviaBuffer.copy(alloc);
+    span<Trivia const> trivia = triviaBuffer.finish();
     uint32_t offset = currentOffset();
     auto location = SourceLocation(getBufferID(), offset);
 
@@ -882,7 +887,7 @@ bool Lexer::lexTimeLiteral(Token::Info* info) {
     return false;
 }
 
-bool Lexer::lexTrivia(SmallVector<Trivia>& triviaBuffer, bool directiveMode) {
+bool Lexer::lexTrivia(ArenaBuilder<Trivia>& triviaBuffer, bool directiveMode) {
     while (true) {
         mark();
 
@@ -976,7 +981,7 @@ void Lexer::scanUnsignedNumber(uint64_t& value, int& digits) {
     }
 }
 
-void Lexer::scanWhitespace(SmallVector<Trivia>& triviaBuffer) {
+void Lexer::scanWhitespace(ArenaBuilder<Trivia>& triviaBuffer) {
     bool done = false;
     while (!done) {
         switch (peek()) {
@@ -994,7 +999,7 @@ void Lexer::scanWhitespace(SmallVector<Trivia>& triviaBuffer) {
     addTrivia(TriviaKind::Whitespace, triviaBuffer);
 }
 
-void Lexer::scanLineComment(SmallVector<Trivia>& triviaBuffer, bool directiveMode) {
+void Lexer::scanLineComment(ArenaBuilder<Trivia>& triviaBuffer, bool directiveMode) {
     while (true) {
         char c = peek();
         if (isNewline(c))
@@ -1019,7 +1024,7 @@ void Lexer::scanLineComment(SmallVector<Trivia>& triviaBuffer, bool directiveMod
     addTrivia(TriviaKind::LineComment, triviaBuffer);
 }
 
-bool Lexer::scanBlockComment(SmallVector<Trivia>& triviaBuffer, bool directiveMode) {
+bool Lexer::scanBlockComment(ArenaBuilder<Trivia>& triviaBuffer, bool directiveMode) {
     bool eod = false;
     while (true) {
         char c = peek();
@@ -1057,7 +1062,7 @@ bool Lexer::scanBlockComment(SmallVector<Trivia>& triviaBuffer, bool directiveMo
     return eod;
 }
 
-void Lexer::addTrivia(TriviaKind kind, SmallVector<Trivia>& triviaBuffer) {
+void Lexer::addTrivia(TriviaKind kind, ArenaBuilder<Trivia>& triviaBuffer) {
     triviaBuffer.emplace(kind, lexeme());
 }
 
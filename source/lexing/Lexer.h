@@ -8,6 +8,7 @@
 
 #include "diagnostics/Diagnostics.h"
 #include "text/SourceLocation.h"
+#include "util/ArenaBuilder.h"
 #include "util/SmallVector.h"
 #include "util/Util.h"
 #include "Token.h"
@@ -90,16 +91,16 @@ private:
     bool lexIntegerBase(Token::Info* info, bool isSigned);
     bool lexTimeLiteral(Token::Info* info);
 
-    bool lexTrivia(SmallVector<Trivia>& triviaBuffer, bool directiveMode);
+    bool lexTrivia(ArenaBuilder<Trivia>& triviaBuffer, bool directiveMode);
 
-    bool scanBlockComment(SmallVector<Trivia>& triviaBuffer, bool directiveMode);
-    void scanLineComment(SmallVector<Trivia>& triviaBuffer, bool directiveMode);
-    void scanWhitespace(SmallVector<Trivia>& triviaBuffer);
+    bool scanBlockComment(ArenaBuilder<Trivia>& triviaBuffer, bool directiveMode);
+    void scanLineComment(ArenaBuilder<Trivia>& triviaBuffer, bool directiveMode);
+    void scanWhitespace(ArenaBuilder<Trivia>& triviaBuffer);
     void scanIdentifier();
     void scanUnsignedNumber(uint64_t& value, int& digits);
     bool scanExponent(uint64_t& value, bool& negative);
 
-    void addTrivia(TriviaKind kind, SmallVector<Trivia>& triviaBuffer);
+    void addTrivia(TriviaKind kind, ArenaBuilder<Trivia>& triviaBuffer);
     void addError(DiagCode code, uint32_t offset);
 
     // source pointer manipulation
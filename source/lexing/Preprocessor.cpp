@@ -9,6 +9,7 @@
 #include "parsing/AllSyntax.h"
 #include "text/SourceManager.h"
 #include "util/BumpAllocator.h"
+#include "util/PerfCounters.h"
 
 namespace {
 
@@ -189,7 +190,7 @@ Token Preprocessor::handleDirectives(LexerMode mode, Token token) {
             case SyntaxKind::UndefineAllDirective: trivia.append(handleUndefineAllDirective(token)); break;
             case SyntaxKind::BeginKeywordsDirective: trivia.append(handleBeginKeywordsDirective(token)); break;
             case SyntaxKind::EndKeywordsDirective: trivia.append(handleEndKeywordsDirective(token)); break;
-            case SyntaxKind::PragmaDirective: // TODO, support pragmas
+            case SyntaxKind::PragmaDirective: trivia.append(handlePragmaDirective(token)); break;
             case SyntaxKind::UnconnectedDriveDirective: // Nothing to do for the rest of these
             case SyntaxKind::NoUnconnectedDriveDirective:
             case SyntaxKind::CellDefineDirective:
@@ -372,8 +373,10 @@ Trivia Preprocessor::handleIncludeDirective(Token directive) {
             addError(DiagCode::CouldNotOpenIncludeFile, fileName.location());
         else if (lexerStack.size() >= options.maxIncludeDepth)
             addError(DiagCode::ExceededMaxIncludeDepth, fileName.location());
-        else
+        else {
+            includedFiles.push_back(buffer.id);
             pushSource(buffer);
+        }
     }
 
     auto syntax = alloc.emplace<IncludeDirectiveSyntax>(directive, fileName, end);
@@ -772,6 +775,42 @@ Trivia Preprocessor::handleEndKeywordsDirective(Token directive) {
     return createSimpleDirective(directive);
 }
 
+Trivia Preprocessor::handlePragmaDirective(Token directive) {
+    // The only pragmas we act on are diagnostic controls, of the form:
+    //   `pragma diagnostic ignore="CodeName"
+    //   `pragma diagnostic warn="CodeName"
+    // Anything else is an implementation-specific pragma and is just skipped over.
+    Token name = peek();
+    auto syntax = alloc.emplace<SimpleDirectiveSyntax>(directive.directiveKind(), directive,
+                                                       parseEndOfDirective(true));
+    if (name.kind != TokenKind::Identifier || name.valueText() != "diagnostic")
+        return Trivia(TriviaKind::Directive, syntax);
+
+    span<Token const> tokens;
+    for (const Trivia& trivia : syntax->endOfDirective.trivia()) {
+        if (trivia.kind == TriviaKind::SkippedTokens)
+            tokens = trivia.getSkippedTokens();
+    }
+
+    DiagnosticFilter* filter = diagnostics.getFilter();
+    if (tokens.size() == 4 && tokens[1].kind == TokenKind::Identifier &&
+        tokens[2].kind == TokenKind::Equals && tokens[3].kind == TokenKind::StringLiteral) {
+
+        string_view action = tokens[1].valueText();
+        if (action == "ignore" || action == "warn") {
+            auto code = diagCodeFromString(tokens[3].valueText());
+            if (!code)
+                addError(DiagCode::UnknownDiagnosticName, tokens[3].location()) << tokens[3].valueText();
+            else if (filter)
+                filter->setPragmaState(*code, directive.location(), action == "warn");
+            return Trivia(TriviaKind::Directive, syntax);
+        }
+    }
+
+    addError(DiagCode::ExpectedEndOfDirective, name.location());
+    return Trivia(TriviaKind::Directive, syntax);
+}
+
 Token Preprocessor::parseEndOfDirective(bool suppressError) {
     // consume all extraneous tokens as SkippedToken trivia
     SmallVectorSized<Token, 32> skipped;
@@ -803,9 +842,14 @@ Trivia Preprocessor::createSimpleDirective(Token directive, bool suppressError)
 }
 
 Preprocessor::MacroDef Preprocessor::findMacro(Token directive) {
-    auto it = macros.find(directive.valueText().substr(1));
-    if (it == macros.end())
+    string_view name = directive.valueText().substr(1);
+    auto it = macros.find(name);
+    if (it == macros.end()) {
+        recordedDependencies.append({ name, nullptr });
         return nullptr;
+    }
+
+    recordedDependencies.append({ name, it->second.syntax });
     return it->second;
 }
 
@@ -832,10 +876,62 @@ MacroActualArgumentListSyntax* Preprocessor::handleTopLevelMacro(Token directive
             return nullptr;
     }
 
+    // The usage site's trivia gets attached to the first expanded token once we're
+    // done; keeping it out of the expansion itself means the result doesn't depend
+    // on it and can be replayed for later usages of the same macro.
+    span<Trivia const> usageTrivia = directive.trivia();
+    if (!usageTrivia.empty())
+        directive = directive.withTrivia(alloc, {});
+
+    if (!checkExpansionLimits(directive))
+        return actualArgs;
+
+    ExpansionCacheKey key = getExpansionCacheKey(macro, actualArgs);
+    auto it = expansionCache.find(key);
+    if (it != expansionCache.end() && replayExpansion(it->second, directive, actualArgs)) {
+        PerfCounters::increment(PerfCounter::MacroExpansionsReplayed);
+    }
+    else {
+        size_t diagCount = diagnostics.size();
+        recordedBuffers.clear();
+        recordedDependencies.clear();
+        expansionCacheable = macro.syntax != nullptr;
+
+        if (!expandFully(macro, directive, actualArgs)) {
+            expandedTokens.clear();
+            return actualArgs;
+        }
+
+        if (expansionCacheable && diagCount == diagnostics.size() && admitExpansion(key))
+            cacheExpansion(std::move(key), directive, actualArgs);
+    }
+
+    if (!expandedTokens.empty()) {
+        if (!usageTrivia.empty()) {
+            Token& first = expandedTokens[0];
+            if (first.trivia().empty())
+                first = first.withTrivia(alloc, usageTrivia);
+            else {
+                SmallVectorSized<Trivia, 8> trivia;
+                trivia.appendRange(usageTrivia);
+                trivia.appendRange(first.trivia());
+                first = first.withTrivia(alloc, trivia.copy(alloc));
+            }
+        }
+
+        // if the macro expanded into any tokens at all, set the pointer
+        // so that we'll pull from them next
+        currentMacroToken = expandedTokens.begin();
+    }
+
+    return actualArgs;
+}
+
+bool Preprocessor::expandFully(MacroDef macro, Token usageSite, MacroActualArgumentListSyntax* actualArgs) {
     // Expand out the macro
     SmallVectorSized<Token, 32> buffer;
-    if (!expandMacro(macro, directive, actualArgs, buffer))
-        return actualArgs;
+    if (!expandMacro(macro, usageSite, actualArgs, buffer))
+        return false;
 
     // The macro is now expanded out into tokens, but some of those tokens might
     // be more macros that need to be expanded, or special characters that
@@ -846,7 +942,7 @@ MacroActualArgumentListSyntax* Preprocessor::handleTopLevelMacro(Token directive
     while (true) {
         // Start by recursively expanding out all valid macro usages.
         if (!expandReplacementList(tokens))
-            return actualArgs;
+            return false;
 
         // Now that all macros have been expanded, handle token concatenation and stringification.
         SmallVectorSized<Trivia, 16> emptyArgTrivia;
@@ -938,25 +1034,150 @@ MacroActualArgumentListSyntax* Preprocessor::handleTopLevelMacro(Token directive
         tokens = expandedTokens;
     }
 
-    if (!expandedTokens.empty()) {
-        // Verify that we haven't failed to expand any nested macros.
-        for (Token token : expandedTokens) {
-            if (token.kind == TokenKind::Directive && token.directiveKind() == SyntaxKind::MacroUsage) {
-                addError(DiagCode::UnknownDirective, token.location()) << token.valueText();
-                return actualArgs;
-            }
+    // Verify that we haven't failed to expand any nested macros.
+    for (Token token : expandedTokens) {
+        if (token.kind == TokenKind::Directive && token.directiveKind() == SyntaxKind::MacroUsage) {
+            addError(DiagCode::UnknownDirective, token.location()) << token.valueText();
+            return false;
         }
+    }
 
-        // if the macro expanded into any tokens at all, set the pointer
-        // so that we'll pull from them next
-        currentMacroToken = expandedTokens.begin();
+    return true;
+}
+
+Preprocessor::ExpansionCacheKey Preprocessor::getExpansionCacheKey(MacroDef macro,
+                                                                   MacroActualArgumentListSyntax* actualArgs) const {
+    // Arguments are compared by their text (including trivia, since that affects
+    // things like stringification). The keyword version is included since it
+    // determines how the argument text was lexed.
+    std::string argText;
+    if (actualArgs)
+        argText = actualArgs->toString(SyntaxToStringFlags::IncludeTrivia);
+
+    return { macro.syntax, keywordVersionStack.back(), std::move(argText) };
+}
+
+bool Preprocessor::admitExpansion(const ExpansionCacheKey& key) {
+    // Only cache usages the second time they're seen. Macros whose arguments differ
+    // at every usage (such as logging macros that get passed a message) would otherwise
+    // fill the cache with entries that never get replayed. The first sighting is only
+    // remembered by hash, and those get forgotten en masse every so often to keep the
+    // set bounded; a collision just means caching an expansion a bit early.
+    const size_t MaxSeenExpansions = 1 << 16;
+
+    size_t hash = std::hash<ExpansionCacheKey>()(key);
+    if (seenExpansions.erase(hash))
+        return true;
+
+    if (seenExpansions.size() >= MaxSeenExpansions)
+        seenExpansions.clear();
+    seenExpansions.insert(hash);
+    return false;
+}
+
+bool Preprocessor::replayExpansion(const CachedExpansion& cached, Token usageSite,
+                                   MacroActualArgumentListSyntax* actualArgs) {
+    // Make sure every macro the original expansion looked at still means the same thing.
+    for (auto& dep : cached.dependencies) {
+        auto it = macros.find(dep.name);
+        const DefineDirectiveSyntax* syntax = it == macros.end() ? nullptr : it->second.syntax;
+        if (syntax != dep.syntax)
+            return false;
     }
 
-    return actualArgs;
+    SmallVectorSized<SourceLocation, 16> argLocations;
+    if (actualArgs) {
+        for (auto arg : actualArgs->args) {
+            for (Token token : arg->tokens)
+                argLocations.append(token.location());
+        }
+    }
+
+    if (argLocations.size() != (size_t)cached.argLocations.size())
+        return false;
+
+    // Maps a location from the original expansion to the equivalent location in this one.
+    // Expansion buffers get remapped to their replayed copies, argument tokens get
+    // mapped to the tokens passed at this usage site, and everything else (such as
+    // locations inside of macro definitions) stays as it was.
+    SmallVectorSized<BufferID, 8> newBuffers;
+    uint32_t usageLength = (uint32_t)usageSite.rawText().length();
+    auto remap = [&](SourceLocation loc) {
+        SourceLocation oldUsage = cached.usageLoc;
+        if (loc.buffer() == oldUsage.buffer() && loc.offset() >= oldUsage.offset() &&
+            loc.offset() <= oldUsage.offset() + usageLength) {
+            return usageSite.location() + size_t(loc.offset() - oldUsage.offset());
+        }
+
+        auto bufferIt = std::lower_bound(cached.buffers.begin(), cached.buffers.end(), loc.buffer());
+        if (bufferIt != cached.buffers.end() && *bufferIt == loc.buffer()) {
+            ptrdiff_t index = bufferIt - cached.buffers.begin();
+            if ((size_t)index < newBuffers.size())
+                return SourceLocation(newBuffers[(size_t)index], loc.offset());
+        }
+
+        auto argIt = std::lower_bound(cached.argLocations.begin(), cached.argLocations.end(), loc);
+        if (argIt != cached.argLocations.end() && *argIt == loc)
+            return argLocations[(size_t)(argIt - cached.argLocations.begin())];
+
+        return loc;
+    };
+
+    // Expansion entries only ever refer to entries created before them,
+    // so recreating them in order lets each one be remapped as we go.
+    for (BufferID buffer : cached.buffers) {
+        SourceLocation loc(buffer, 0);
+        SourceRange range = sourceManager.getExpansionRange(loc);
+        SourceLocation newLoc = sourceManager.createExpansionLoc(remap(sourceManager.getOriginalLoc(loc)),
+                                                                 remap(range.start()), remap(range.end()));
+        newBuffers.append(newLoc.buffer());
+    }
+
+    expansionEntryCount += (uint32_t)cached.buffers.size();
+    expandedTokenCount += cached.tokens.size();
+
+    expandedTokens.clear();
+    for (Token token : cached.tokens) {
+        SourceLocation loc = remap(token.location());
+        if (loc == token.location())
+            expandedTokens.append(token);
+        else
+            expandedTokens.append(token.withLocation(alloc, loc));
+    }
+
+    return true;
+}
+
+void Preprocessor::cacheExpansion(ExpansionCacheKey&& key, Token usageSite,
+                                  MacroActualArgumentListSyntax* actualArgs) {
+    // Replaying relies on being able to find the usage site and arguments in
+    // a single file buffer, so skip anything more exotic than that.
+    if (!sourceManager.isFileLoc(usageSite.location()))
+        return;
+
+    SmallVectorSized<SourceLocation, 16> argLocations;
+    if (actualArgs) {
+        for (auto arg : actualArgs->args) {
+            for (Token token : arg->tokens)
+                argLocations.append(token.location());
+        }
+    }
+
+    if (!std::is_sorted(argLocations.begin(), argLocations.end()))
+        return;
+
+    CachedExpansion cached;
+    cached.tokens = expandedTokens.copy(alloc);
+    cached.buffers = recordedBuffers.copy(alloc);
+    cached.argLocations = argLocations.copy(alloc);
+    cached.dependencies = recordedDependencies.copy(alloc);
+    cached.usageLoc = usageSite.location();
+    expansionCache[std::move(key)] = cached;
 }
 
 bool Preprocessor::expandMacro(MacroDef macro, Token usageSite, MacroActualArgumentListSyntax* actualArgs,
                                SmallVector<Token>& dest) {
+    PerfCounters::increment(PerfCounter::MacroExpansions);
     if (macro.isIntrinsic()) {
         // for now, no intrisics can have arguments
         ASSERT(!actualArgs);
@@ -974,12 +1195,7 @@ bool Preprocessor::expandMacro(MacroDef macro, Token usageSite, MacroActualArgum
     if (!directive->formalArguments) {
         // each macro expansion gets its own location entry
         SourceLocation start = body[0].location();
-        SourceLocation usageLoc = usageSite.location();
-        SourceLocation expansionLoc = sourceManager.createExpansionLoc(
-            start,
-            usageLoc,
-            usageLoc + usageSite.rawText().length()
-        );
+        SourceLocation expansionLoc = createExpansionLoc(start, usageSite);
 
         // simple macro; just take body tokens
         bool isFirst = true;
@@ -1028,12 +1244,7 @@ bool Preprocessor::expandMacro(MacroDef macro, Token usageSite, MacroActualArgum
 
     // TODO: the expansion range for a function-like macro should include the parenthesis and arguments
     SourceLocation start = body[0].location();
-    SourceLocation usageLoc = usageSite.location();
-    SourceLocation expansionLoc = sourceManager.createExpansionLoc(
-        start,
-        usageLoc,
-        usageLoc + usageSite.rawText().length()
-    );
+    SourceLocation expansionLoc = createExpansionLoc(start, usageSite);
 
     // now add each body token, substituting arguments as necessary
     bool isFirst = true;
@@ -1105,11 +1316,43 @@ void Preprocessor::appendBodyToken(SmallVector<Token>& dest, Token token, Source
             }
         }
     }
+    expandedTokenCount++;
+
     // TODO: make sure locations are valid, I've seen unsigned overflow here
     int delta = int(token.location().offset()) - int(startLoc.offset());
     dest.append(token.withLocation(alloc, expansionLoc + delta));
 }
 
+SourceLocation Preprocessor::createExpansionLoc(SourceLocation startLoc, Token usageSite) {
+    SourceLocation usageLoc = usageSite.location();
+    SourceLocation expansionLoc = sourceManager.createExpansionLoc(
+        startLoc,
+        usageLoc,
+        usageLoc + usageSite.rawText().length()
+    );
+
+    recordedBuffers.append(expansionLoc.buffer());
+    expansionEntryCount++;
+    return expansionLoc;
+}
+
+bool Preprocessor::checkExpansionLimits(Token usageSite) {
+    // Once any limit has been hit, stop expanding macros altogether; reporting each
+    // of the remaining usages as well would just bury the original error.
+    if (exceededExpansionLimits)
+        return false;
+
+    if (expansionEntryCount >= options.maxExpansionEntries)
+        addError(DiagCode::ExceededMaxExpansionEntries, usageSite.location()) << options.maxExpansionEntries;
+    else if (expandedTokenCount >= options.maxExpandedTokens)
+        addError(DiagCode::ExceededMaxExpandedTokens, usageSite.location()) << options.maxExpandedTokens;
+    else
+        return true;
+
+    exceededExpansionLimits = true;
+    return false;
+}
+
 bool Preprocessor::expandReplacementList(span<Token const>& tokens) {
     // keep expanding macros in the replacement list until we've got them all
     // use two alternating buffers to hold the tokens
@@ -1151,7 +1394,15 @@ bool Preprocessor::expandReplacementList(span<Token const>& tokens) {
                         return false;
                 }
 
-                if (!expandMacro(macro, token, actualArgs, *currentBuffer))
+                // The usage lives in the expansion of the macro it was nested in, so the
+                // depth of that expansion tells how deep this one would be. That also means
+                // the error gets reported along with the whole chain of macros that led here.
+                if (sourceManager.getExpansionDepth(token.location()) >= options.maxMacroExpansionDepth) {
+                    addError(DiagCode::ExceededMaxMacroExpansionDepth, token.location()) << options.maxMacroExpansionDepth;
+                    return false;
+                }
+
+                if (!checkExpansionLimits(token) || !expandMacro(macro, token, actualArgs, *currentBuffer))
                     return false;
 
                 expandedSomething = true;
@@ -1171,6 +1422,10 @@ bool Preprocessor::expandReplacementList(span<Token const>& tokens) {
 }
 
 bool Preprocessor::expandIntrinsic(MacroIntrinsic intrinsic, Token usageSite, SmallVector<Token>& dest) {
+    // Intrinsics depend on where they're used, so expansions that include
+    // them can't be replayed elsewhere.
+    expansionCacheable = false;
+
     // Take the location and trivia from the usage site; the source text we're
     // going to make up here doesn't actually exist and shouldn't be shown to the
     // user as an "expanded from here" note.
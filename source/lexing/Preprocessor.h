@@ -9,6 +9,8 @@
 #include <deque>
 #include <unordered_map>
 
+#include <flat_hash_map.hpp>
+
 #include "diagnostics/Diagnostics.h"
 #include "parsing/SyntaxNode.h"
 #include "text/SourceLocation.h"
@@ -34,6 +36,19 @@ struct PreprocessorOptions {
     /// a file will result in an error.
     uint32_t maxIncludeDepth = 1024;
 
+    /// The maximum depth of nested macro expansions within a single macro usage.
+    /// A macro that refers to itself, directly or indirectly, runs into this limit.
+    uint32_t maxMacroExpansionDepth = 256;
+
+    /// The maximum number of tokens that macro expansions can produce, in total,
+    /// over the course of preprocessing. Guards against nested macros that blow
+    /// up exponentially.
+    uint64_t maxExpandedTokens = 1 << 23;
+
+    /// The maximum number of macro expansion entries that can be created in the
+    /// source manager over the course of preprocessing.
+    uint32_t maxExpansionEntries = 1 << 22;
+
     /// The name to associate with errors produced by macros specified
     /// via the @a predefines option.
     std::string predefineSource = "<api>";
@@ -96,6 +111,11 @@ public:
     /// will return TokenKind::Unknown.
     TokenKind getDefaultNetType() const { return defaultNetType; }
 
+    /// Gets the files that have been included so far, in the order in which
+    /// their `include directives were encountered. Files that could not be
+    /// opened are not in the list.
+    span<const BufferID> getIncludedFiles() const { return includedFiles; }
+
     /// Gets the next token in the stream, after applying preprocessor rules.
     Token next();
 
@@ -126,6 +146,7 @@ private:
     Trivia handleUndefineAllDirective(Token directive);
     Trivia handleBeginKeywordsDirective(Token directive);
     Trivia handleEndKeywordsDirective(Token directive);
+    Trivia handlePragmaDirective(Token directive);
 
     // Shared method to consume up to the end of a directive line
     Token parseEndOfDirective(bool suppressError = false);
@@ -165,12 +186,41 @@ private:
     // Macro handling methods
     MacroDef findMacro(Token directive);
     MacroActualArgumentListSyntax* handleTopLevelMacro(Token directive);
+    bool expandFully(MacroDef macro, Token usageSite, MacroActualArgumentListSyntax* actualArgs);
     bool expandMacro(MacroDef macro, Token usageSite, MacroActualArgumentListSyntax* actualArgs,
                      SmallVector<Token>& dest);
     bool expandIntrinsic(MacroIntrinsic intrinsic, Token usageSite, SmallVector<Token>& dest);
     bool expandReplacementList(span<Token const>& tokens);
     void appendBodyToken(SmallVector<Token>& dest, Token token, SourceLocation startLoc,
                          SourceLocation expansionLoc, Token usageSite, bool& isFirst);
+    SourceLocation createExpansionLoc(SourceLocation startLoc, Token usageSite);
+    bool checkExpansionLimits(Token usageSite);
+
+    // A macro that was looked up while fully expanding a top-level macro usage,
+    // along with the definition that was found (or null if it wasn't defined).
+    struct MacroDependency {
+        string_view name;
+        const DefineDirectiveSyntax* syntax;
+    };
+
+    // The result of fully expanding a top-level macro usage. Later usages of the same
+    // macro with identical arguments can replay these tokens instead of redoing all of
+    // the expansion work, as long as none of the macros it depended on have changed.
+    struct CachedExpansion {
+        span<Token const> tokens;
+        span<BufferID const> buffers;
+        span<SourceLocation const> argLocations;
+        span<MacroDependency const> dependencies;
+        SourceLocation usageLoc;
+    };
+
+    using ExpansionCacheKey = std::tuple<const DefineDirectiveSyntax*, KeywordVersion, std::string>;
+
+    // Expansion cache handling methods
+    ExpansionCacheKey getExpansionCacheKey(MacroDef macro, MacroActualArgumentListSyntax* actualArgs) const;
+    bool admitExpansion(const ExpansionCacheKey& key);
+    bool replayExpansion(const CachedExpansion& cached, Token usageSite, MacroActualArgumentListSyntax* actualArgs);
+    void cacheExpansion(ExpansionCacheKey&& key, Token usageSite, MacroActualArgumentListSyntax* actualArgs);
 
     // functions to advance the underlying token stream
     Token peek(LexerMode mode = LexerMode::Directive);
@@ -248,6 +298,9 @@ private:
     // stack of active lexers; each `include pushes a new lexer
     std::deque<Lexer*> lexerStack;
 
+    // every file successfully pushed via an `include directive
+    std::vector<BufferID> includedFiles;
+
     // keep track of nested processor branches (ifdef, ifndef, else, elsif, endif)
     std::deque<BranchEntry> branchStack;
 
@@ -278,6 +331,23 @@ private:
     // A buffer used to hold tokens while we're busy consuming them for directives.
     SmallVectorSized<Token, 16> scratchTokenBuffer;
 
+    // cache of fully expanded top-level macro usages
+    std::unordered_map<ExpansionCacheKey, CachedExpansion> expansionCache;
+
+    // hashes of expansion cache keys that have been seen once but not cached yet
+    flat_hash_set<size_t> seenExpansions;
+
+    // State recorded while fully expanding a top-level macro usage, which is
+    // used to decide whether (and how) the result can be cached.
+    SmallVectorSized<BufferID, 8> recordedBuffers;
+    SmallVectorSized<MacroDependency, 8> recordedDependencies;
+    bool expansionCacheable = false;
+
+    // Running totals checked against the expansion limits in the options.
+    uint64_t expandedTokenCount = 0;
+    uint32_t expansionEntryCount = 0;
+    bool exceededExpansionLimits = false;
+
     /// Various state set by preprocessor directives.
     std::vector<KeywordVersion> keywordVersionStack;
     optional<Timescale> activeTimescale;
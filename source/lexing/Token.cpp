@@ -26,6 +26,11 @@ SyntaxNode* Trivia::syntax() const {
     return syntaxNode;
 }
 
+span<Token const> Trivia::getSkippedTokens() const {
+    ASSERT(kind == TriviaKind::SkippedTokens);
+    return tokens;
+}
+
 void Trivia::writeTo(SmallVector<char>& buffer, bitmask<SyntaxToStringFlags> flags) const {
     switch (kind) {
         case TriviaKind::Directive:
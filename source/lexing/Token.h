@@ -97,6 +97,9 @@ public:
     /// has raw text.
     string_view getRawText() const;
 
+    /// If this trivia is tracking a list of skipped tokens, return them.
+    span<Token const> getSkippedTokens() const;
+
 private:
     union {
         string_view rawText;
@@ -6,425 +6,4811 @@
 //------------------------------------------------------------------------------
 #include "AllSyntax.h"
 
+#include <cstddef>
+
 // This file contains all parse tree syntax node generated definitions.
 // It is auto-generated by the syntax_gen.py script under the tools/ directory.
 
 namespace slang {
 
-uint32_t SyntaxNode::getChildCount() const {
-    switch (kind) {
-        case SyntaxKind::Unknown: return 0;
-        case SyntaxKind::List: return ((const SyntaxListBase*)this)->getChildCount();
-        case SyntaxKind::AcceptOnPropertyExpression: return 3;
-        case SyntaxKind::ActionBlock: return 2;
-        case SyntaxKind::AddAssignmentExpression: return 4;
-        case SyntaxKind::AddExpression: return 4;
-        case SyntaxKind::AlwaysBlock: return 3;
-        case SyntaxKind::AlwaysCombBlock: return 3;
-        case SyntaxKind::AlwaysFFBlock: return 3;
-        case SyntaxKind::AlwaysLatchBlock: return 3;
-        case SyntaxKind::AlwaysPropertyExpression: return 3;
-        case SyntaxKind::AndAssignmentExpression: return 4;
-        case SyntaxKind::AndSequenceExpression: return 4;
-        case SyntaxKind::AnsiPortList: return 3;
-        case SyntaxKind::ArgumentList: return 3;
-        case SyntaxKind::ArithmeticLeftShiftAssignmentExpression: return 4;
-        case SyntaxKind::ArithmeticRightShiftAssignmentExpression: return 4;
-        case SyntaxKind::ArithmeticShiftLeftExpression: return 4;
-        case SyntaxKind::ArithmeticShiftRightExpression: return 4;
-        case SyntaxKind::ArrayAndMethod: return 1;
-        case SyntaxKind::ArrayOrMethod: return 1;
-        case SyntaxKind::ArrayUniqueMethod: return 1;
-        case SyntaxKind::ArrayXorMethod: return 1;
-        case SyntaxKind::AscendingRangeSelect: return 3;
-        case SyntaxKind::AssertPropertyStatement: return 8;
-        case SyntaxKind::AssertionItemPort: return 5;
-        case SyntaxKind::AssertionItemPortList: return 3;
-        case SyntaxKind::AssignmentExpression: return 4;
-        case SyntaxKind::AssignmentPatternExpression: return 2;
-        case SyntaxKind::AssignmentPatternItem: return 3;
-        case SyntaxKind::AssumePropertyStatement: return 8;
-        case SyntaxKind::AttributeInstance: return 3;
-        case SyntaxKind::AttributeSpec: return 2;
-        case SyntaxKind::BadExpression: return 1;
-        case SyntaxKind::BeginKeywordsDirective: return 3;
-        case SyntaxKind::BinaryAndExpression: return 4;
-        case SyntaxKind::BinaryBlockEventExpression: return 3;
-        case SyntaxKind::BinaryEventExpression: return 3;
-        case SyntaxKind::BinaryOrExpression: return 4;
-        case SyntaxKind::BinarySequenceDelayExpression: return 4;
-        case SyntaxKind::BinaryXnorExpression: return 4;
-        case SyntaxKind::BinaryXorExpression: return 4;
-        case SyntaxKind::BitSelect: return 1;
-        case SyntaxKind::BitType: return 3;
-        case SyntaxKind::BlockCoverageEvent: return 4;
-        case SyntaxKind::BlockingEventTriggerStatement: return 5;
-        case SyntaxKind::ByteType: return 3;
-        case SyntaxKind::CHandleType: return 1;
-        case SyntaxKind::CaseEqualityExpression: return 4;
-        case SyntaxKind::CaseGenerate: return 7;
-        case SyntaxKind::CaseInequalityExpression: return 4;
-        case SyntaxKind::CaseStatement: return 10;
-        case SyntaxKind::CastExpression: return 3;
-        case SyntaxKind::CellDefineDirective: return 2;
-        case SyntaxKind::ChargeStrength: return 3;
-        case SyntaxKind::ClassDeclaration: return 12;
-        case SyntaxKind::ClassMethodDeclaration: return 3;
-        case SyntaxKind::ClassMethodPrototype: return 4;
-        case SyntaxKind::ClassName: return 2;
-        case SyntaxKind::ClassPropertyDeclaration: return 3;
-        case SyntaxKind::ClassScope: return 2;
-        case SyntaxKind::ClockingDeclaration: return 11;
-        case SyntaxKind::ClockingDirection: return 5;
-        case SyntaxKind::ClockingItem: return 5;
-        case SyntaxKind::ClockingSkew: return 3;
-        case SyntaxKind::ColonExpressionClause: return 2;
-        case SyntaxKind::CompilationUnit: return 2;
-        case SyntaxKind::ConcatenationExpression: return 3;
-        case SyntaxKind::ConcurrentAssertionMember: return 2;
-        case SyntaxKind::ConditionalConstraint: return 6;
-        case SyntaxKind::ConditionalExpression: return 6;
-        case SyntaxKind::ConditionalPattern: return 2;
-        case SyntaxKind::ConditionalPredicate: return 1;
-        case SyntaxKind::ConditionalStatement: return 9;
-        case SyntaxKind::ConstraintBlock: return 3;
-        case SyntaxKind::ConstraintDeclaration: return 5;
-        case SyntaxKind::ConstraintPrototype: return 5;
-        case SyntaxKind::ConstructorName: return 1;
-        case SyntaxKind::ContinuousAssign: return 4;
-        case SyntaxKind::CoverPropertyStatement: return 8;
-        case SyntaxKind::CoverSequenceStatement: return 8;
-        case SyntaxKind::CoverageBins: return 9;
-        case SyntaxKind::CoverageOption: return 7;
-        case SyntaxKind::CovergroupDeclaration: return 9;
-        case SyntaxKind::Coverpoint: return 9;
-        case SyntaxKind::CycleDelay: return 2;
-        case SyntaxKind::DPIImportExport: return 8;
-        case SyntaxKind::DataDeclaration: return 5;
-        case SyntaxKind::DataTypeDimensionSpecifier: return 1;
-        case SyntaxKind::DefParam: return 4;
-        case SyntaxKind::DefParamAssignment: return 2;
-        case SyntaxKind::DefaultCaseItem: return 3;
-        case SyntaxKind::DefaultCoverageBinInitializer: return 2;
-        case SyntaxKind::DefaultNetTypeDirective: return 3;
-        case SyntaxKind::DefaultPatternKeyExpression: return 1;
-        case SyntaxKind::DeferredAssertion: return 3;
-        case SyntaxKind::DefineDirective: return 5;
-        case SyntaxKind::DelayControl: return 2;
-        case SyntaxKind::DescendingRangeSelect: return 3;
-        case SyntaxKind::DisableConstraint: return 4;
-        case SyntaxKind::DisableForkStatement: return 5;
-        case SyntaxKind::DisableIff: return 5;
-        case SyntaxKind::DisableStatement: return 5;
-        case SyntaxKind::DistConstraintList: return 4;
-        case SyntaxKind::DistItem: return 2;
-        case SyntaxKind::DistWeight: return 2;
-        case SyntaxKind::DivideAssignmentExpression: return 4;
-        case SyntaxKind::DivideExpression: return 4;
-        case SyntaxKind::DividerClause: return 2;
-        case SyntaxKind::DoWhileStatement: return 9;
-        case SyntaxKind::DotMemberClause: return 2;
-        case SyntaxKind::DriveStrength: return 5;
-        case SyntaxKind::ElementSelect: return 3;
-        case SyntaxKind::ElementSelectExpression: return 2;
-        case SyntaxKind::ElsIfDirective: return 4;
-        case SyntaxKind::ElseClause: return 2;
-        case SyntaxKind::ElseConstraintClause: return 2;
-        case SyntaxKind::ElseDirective: return 3;
-        case SyntaxKind::EmptyArgument: return 0;
-        case SyntaxKind::EmptyIdentifierName: return 0;
-        case SyntaxKind::EmptyMember: return 3;
-        case SyntaxKind::EmptyQueueExpression: return 2;
-        case SyntaxKind::EmptyStatement: return 3;
-        case SyntaxKind::EndCellDefineDirective: return 2;
-        case SyntaxKind::EndIfDirective: return 3;
-        case SyntaxKind::EndKeywordsDirective: return 2;
-        case SyntaxKind::EnumType: return 6;
-        case SyntaxKind::EqualityExpression: return 4;
-        case SyntaxKind::EqualsValueClause: return 2;
-        case SyntaxKind::EventControl: return 2;
-        case SyntaxKind::EventControlWithExpression: return 2;
-        case SyntaxKind::EventType: return 1;
-        case SyntaxKind::EventuallyPropertyExpression: return 3;
-        case SyntaxKind::ExpectPropertyStatement: return 8;
-        case SyntaxKind::ExplicitAnsiPort: return 7;
-        case SyntaxKind::ExplicitNonAnsiPort: return 5;
-        case SyntaxKind::ExpressionConstraint: return 3;
-        case SyntaxKind::ExpressionCoverageBinInitializer: return 2;
-        case SyntaxKind::ExpressionOrDist: return 2;
-        case SyntaxKind::ExpressionPattern: return 1;
-        case SyntaxKind::ExpressionStatement: return 4;
-        case SyntaxKind::ExtendsClause: return 3;
-        case SyntaxKind::ExternModule: return 2;
-        case SyntaxKind::FinalBlock: return 3;
-        case SyntaxKind::ForLoopStatement: return 11;
-        case SyntaxKind::ForVariableDeclaration: return 3;
-        case SyntaxKind::ForeachLoopList: return 6;
-        case SyntaxKind::ForeachLoopStatement: return 5;
-        case SyntaxKind::ForeverStatement: return 4;
-        case SyntaxKind::ForwardInterfaceClassTypedefDeclaration: return 6;
-        case SyntaxKind::ForwardTypedefDeclaration: return 5;
-        case SyntaxKind::FunctionDeclaration: return 6;
-        case SyntaxKind::FunctionPort: return 6;
-        case SyntaxKind::FunctionPortList: return 3;
-        case SyntaxKind::FunctionPrototype: return 5;
-        case SyntaxKind::GenerateBlock: return 7;
-        case SyntaxKind::GenerateRegion: return 4;
-        case SyntaxKind::GenvarDeclaration: return 4;
-        case SyntaxKind::GreaterThanEqualExpression: return 4;
-        case SyntaxKind::GreaterThanExpression: return 4;
-        case SyntaxKind::HierarchicalInstance: return 5;
-        case SyntaxKind::HierarchyInstantiation: return 5;
-        case SyntaxKind::IdentifierList: return 3;
-        case SyntaxKind::IdentifierName: return 1;
-        case SyntaxKind::IdentifierSelectName: return 2;
-        case SyntaxKind::IfDefDirective: return 4;
-        case SyntaxKind::IfGenerate: return 7;
-        case SyntaxKind::IfNDefDirective: return 4;
-        case SyntaxKind::IffClause: return 4;
-        case SyntaxKind::IffPropertyExpression: return 4;
-        case SyntaxKind::ImmediateAssertStatement: return 6;
-        case SyntaxKind::ImmediateAssertionMember: return 2;
-        case SyntaxKind::ImmediateAssumeStatement: return 6;
-        case SyntaxKind::ImmediateCoverStatement: return 6;
-        case SyntaxKind::ImplementsClause: return 2;
-        case SyntaxKind::ImplicationConstraint: return 3;
-        case SyntaxKind::ImplicitAnsiPort: return 3;
-        case SyntaxKind::ImplicitEventControl: return 1;
-        case SyntaxKind::ImplicitNonAnsiPort: return 1;
-        case SyntaxKind::ImplicitType: return 2;
-        case SyntaxKind::ImpliesPropertyExpression: return 4;
-        case SyntaxKind::IncludeDirective: return 3;
-        case SyntaxKind::InequalityExpression: return 4;
-        case SyntaxKind::InitialBlock: return 3;
-        case SyntaxKind::InsideExpression: return 3;
-        case SyntaxKind::IntType: return 3;
-        case SyntaxKind::IntegerLiteralExpression: return 1;
-        case SyntaxKind::IntegerType: return 3;
-        case SyntaxKind::IntegerVectorExpression: return 3;
-        case SyntaxKind::InterconnectPortHeader: return 3;
-        case SyntaxKind::InterfaceDeclaration: return 5;
-        case SyntaxKind::InterfaceHeader: return 7;
-        case SyntaxKind::InterfacePortHeader: return 2;
-        case SyntaxKind::IntersectSequenceExpression: return 4;
-        case SyntaxKind::InvocationExpression: return 3;
-        case SyntaxKind::JumpStatement: return 4;
-        case SyntaxKind::LessThanEqualExpression: return 4;
-        case SyntaxKind::LessThanExpression: return 4;
-        case SyntaxKind::LetDeclaration: return 6;
-        case SyntaxKind::LineDirective: return 5;
-        case SyntaxKind::LocalScope: return 1;
-        case SyntaxKind::LogicType: return 3;
-        case SyntaxKind::LogicalAndExpression: return 4;
-        case SyntaxKind::LogicalEquivalenceExpression: return 4;
-        case SyntaxKind::LogicalImplicationExpression: return 4;
-        case SyntaxKind::LogicalLeftShiftAssignmentExpression: return 4;
-        case SyntaxKind::LogicalOrExpression: return 4;
-        case SyntaxKind::LogicalRightShiftAssignmentExpression: return 4;
-        case SyntaxKind::LogicalShiftLeftExpression: return 4;
-        case SyntaxKind::LogicalShiftRightExpression: return 4;
-        case SyntaxKind::LongIntType: return 3;
-        case SyntaxKind::LoopConstraint: return 3;
-        case SyntaxKind::LoopGenerate: return 13;
-        case SyntaxKind::LoopStatement: return 7;
-        case SyntaxKind::MacroActualArgument: return 1;
-        case SyntaxKind::MacroActualArgumentList: return 3;
-        case SyntaxKind::MacroArgumentDefault: return 2;
-        case SyntaxKind::MacroFormalArgument: return 2;
-        case SyntaxKind::MacroFormalArgumentList: return 3;
-        case SyntaxKind::MacroUsage: return 2;
-        case SyntaxKind::MatchesClause: return 2;
-        case SyntaxKind::MemberAccessExpression: return 3;
-        case SyntaxKind::MinTypMaxExpression: return 5;
-        case SyntaxKind::ModAssignmentExpression: return 4;
-        case SyntaxKind::ModExpression: return 4;
-        case SyntaxKind::ModportClockingPort: return 3;
-        case SyntaxKind::ModportDeclaration: return 4;
-        case SyntaxKind::ModportExplicitPort: return 5;
-        case SyntaxKind::ModportItem: return 2;
-        case SyntaxKind::ModportNamedPort: return 1;
-        case SyntaxKind::ModportSimplePortList: return 3;
-        case SyntaxKind::ModportSubroutinePort: return 1;
-        case SyntaxKind::ModportSubroutinePortList: return 3;
-        case SyntaxKind::ModuleDeclaration: return 5;
-        case SyntaxKind::ModuleHeader: return 7;
-        case SyntaxKind::MultipleConcatenationExpression: return 4;
-        case SyntaxKind::MultiplyAssignmentExpression: return 4;
-        case SyntaxKind::MultiplyExpression: return 4;
-        case SyntaxKind::NamedArgument: return 5;
-        case SyntaxKind::NamedBlockClause: return 2;
-        case SyntaxKind::NamedLabel: return 2;
-        case SyntaxKind::NamedPortConnection: return 6;
-        case SyntaxKind::NamedStructurePatternMember: return 3;
-        case SyntaxKind::NamedType: return 1;
-        case SyntaxKind::NetDeclaration: return 7;
-        case SyntaxKind::NetPortHeader: return 3;
-        case SyntaxKind::NewArrayExpression: return 5;
-        case SyntaxKind::NewClassExpression: return 3;
-        case SyntaxKind::NewExpression: return 2;
-        case SyntaxKind::NextTimePropertyExpression: return 3;
-        case SyntaxKind::NoUnconnectedDriveDirective: return 2;
-        case SyntaxKind::NonAnsiPortList: return 3;
-        case SyntaxKind::NonOverlappedFollowedByPropertyExpression: return 4;
-        case SyntaxKind::NonOverlappedImplicationPropertyExpression: return 4;
-        case SyntaxKind::NonblockingAssignmentExpression: return 4;
-        case SyntaxKind::NonblockingEventTriggerStatement: return 5;
-        case SyntaxKind::NullLiteralExpression: return 1;
-        case SyntaxKind::OneStepLiteralExpression: return 1;
-        case SyntaxKind::OpenRangeList: return 3;
-        case SyntaxKind::OrAssignmentExpression: return 4;
-        case SyntaxKind::OrSequenceExpression: return 4;
-        case SyntaxKind::OrderedArgument: return 1;
-        case SyntaxKind::OrderedPortConnection: return 2;
-        case SyntaxKind::OrderedStructurePatternMember: return 1;
-        case SyntaxKind::OverlappedFollowedByPropertyExpression: return 4;
-        case SyntaxKind::OverlappedImplicationPropertyExpression: return 4;
-        case SyntaxKind::PackageDeclaration: return 5;
-        case SyntaxKind::PackageHeader: return 7;
-        case SyntaxKind::PackageImportDeclaration: return 4;
-        case SyntaxKind::PackageImportItem: return 3;
-        case SyntaxKind::ParallelBlockStatement: return 7;
-        case SyntaxKind::ParameterDeclaration: return 3;
-        case SyntaxKind::ParameterDeclarationStatement: return 3;
-        case SyntaxKind::ParameterPortList: return 4;
-        case SyntaxKind::ParameterValueAssignment: return 2;
-        case SyntaxKind::ParenImplicitEventControl: return 2;
-        case SyntaxKind::ParenthesizedEventExpression: return 3;
-        case SyntaxKind::ParenthesizedExpression: return 3;
-        case SyntaxKind::PatternCaseItem: return 5;
-        case SyntaxKind::PortDeclaration: return 4;
-        case SyntaxKind::PostdecrementExpression: return 3;
-        case SyntaxKind::PostincrementExpression: return 3;
-        case SyntaxKind::PowerExpression: return 4;
-        case SyntaxKind::PragmaDirective: return 2;
-        case SyntaxKind::PrimaryBlockEventExpression: return 2;
-        case SyntaxKind::ProceduralAssignStatement: return 7;
-        case SyntaxKind::ProceduralDeassignStatement: return 5;
-        case SyntaxKind::ProceduralForceStatement: return 7;
-        case SyntaxKind::ProceduralReleaseStatement: return 5;
-        case SyntaxKind::ProgramDeclaration: return 5;
-        case SyntaxKind::ProgramHeader: return 7;
-        case SyntaxKind::PropertyDeclaration: return 10;
-        case SyntaxKind::PropertySpec: return 3;
-        case SyntaxKind::PropertyType: return 1;
-        case SyntaxKind::QueueDimensionSpecifier: return 2;
-        case SyntaxKind::RandCaseItem: return 3;
-        case SyntaxKind::RandCaseStatement: return 5;
-        case SyntaxKind::RandomizeMethodWithClause: return 3;
-        case SyntaxKind::RangeCoverageBinInitializer: return 2;
-        case SyntaxKind::RangeDimensionSpecifier: return 1;
-        case SyntaxKind::RealLiteralExpression: return 1;
-        case SyntaxKind::RealTimeType: return 1;
-        case SyntaxKind::RealType: return 1;
-        case SyntaxKind::RegType: return 3;
-        case SyntaxKind::RejectOnPropertyExpression: return 3;
-        case SyntaxKind::RepeatedEventControl: return 5;
-        case SyntaxKind::ReplicatedAssignmentPattern: return 6;
-        case SyntaxKind::ResetAllDirective: return 2;
-        case SyntaxKind::RestrictPropertyStatement: return 8;
-        case SyntaxKind::ReturnStatement: return 5;
-        case SyntaxKind::RootScope: return 1;
-        case SyntaxKind::SAlwaysPropertyExpression: return 3;
-        case SyntaxKind::SEventuallyPropertyExpression: return 3;
-        case SyntaxKind::SNextTimePropertyExpression: return 3;
-        case SyntaxKind::SUntilPropertyExpression: return 4;
-        case SyntaxKind::SUntilWithPropertyExpression: return 4;
-        case SyntaxKind::ScopedName: return 3;
-        case SyntaxKind::SequenceDeclaration: return 10;
-        case SyntaxKind::SequenceType: return 1;
-        case SyntaxKind::SequentialBlockStatement: return 7;
-        case SyntaxKind::ShortIntType: return 3;
-        case SyntaxKind::ShortRealType: return 1;
-        case SyntaxKind::ShortcutCycleDelayRange: return 4;
-        case SyntaxKind::SignalEventExpression: return 2;
-        case SyntaxKind::SignedCastExpression: return 3;
-        case SyntaxKind::SimpleAssignmentPattern: return 3;
-        case SyntaxKind::SimpleRangeSelect: return 3;
-        case SyntaxKind::SolveBeforeConstraint: return 5;
-        case SyntaxKind::StandardCaseItem: return 3;
-        case SyntaxKind::StreamExpression: return 2;
-        case SyntaxKind::StreamExpressionWithRange: return 2;
-        case SyntaxKind::StreamingConcatenationExpression: return 7;
-        case SyntaxKind::StringLiteralExpression: return 1;
-        case SyntaxKind::StringType: return 1;
-        case SyntaxKind::StructType: return 8;
-        case SyntaxKind::StructUnionMember: return 5;
-        case SyntaxKind::StructurePattern: return 3;
-        case SyntaxKind::StructuredAssignmentPattern: return 3;
-        case SyntaxKind::SubtractAssignmentExpression: return 4;
-        case SyntaxKind::SubtractExpression: return 4;
-        case SyntaxKind::SuperHandle: return 1;
-        case SyntaxKind::SyncAcceptOnPropertyExpression: return 3;
-        case SyntaxKind::SyncRejectOnPropertyExpression: return 3;
-        case SyntaxKind::SystemName: return 1;
-        case SyntaxKind::TaggedPattern: return 3;
-        case SyntaxKind::TaggedUnionExpression: return 3;
-        case SyntaxKind::TaskDeclaration: return 6;
-        case SyntaxKind::ThisHandle: return 1;
-        case SyntaxKind::ThroughoutSequenceExpression: return 4;
-        case SyntaxKind::TimeLiteralExpression: return 1;
-        case SyntaxKind::TimeType: return 3;
-        case SyntaxKind::TimeUnitsDeclaration: return 5;
-        case SyntaxKind::TimescaleDirective: return 7;
-        case SyntaxKind::TimingControlExpression: return 2;
-        case SyntaxKind::TimingControlExpressionConcatenation: return 3;
-        case SyntaxKind::TimingControlStatement: return 4;
-        case SyntaxKind::TransListCoverageBinInitializer: return 2;
-        case SyntaxKind::TransRange: return 2;
-        case SyntaxKind::TransRepeatRange: return 4;
-        case SyntaxKind::TransSet: return 3;
-        case SyntaxKind::TypeReference: return 4;
-        case SyntaxKind::TypeType: return 1;
-        case SyntaxKind::TypedefDeclaration: return 6;
-        case SyntaxKind::UnaryBitwiseAndExpression: return 3;
-        case SyntaxKind::UnaryBitwiseNandExpression: return 3;
-        case SyntaxKind::UnaryBitwiseNorExpression: return 3;
-        case SyntaxKind::UnaryBitwiseNotExpression: return 3;
-        case SyntaxKind::UnaryBitwiseOrExpression: return 3;
-        case SyntaxKind::UnaryBitwiseXnorExpression: return 3;
-        case SyntaxKind::UnaryBitwiseXorExpression: return 3;
-        case SyntaxKind::UnaryLogicalNotExpression: return 3;
-        case SyntaxKind::UnaryMinusExpression: return 3;
-        case SyntaxKind::UnaryNotPropertyExpression: return 3;
-        case SyntaxKind::UnaryPlusExpression: return 3;
-        case SyntaxKind::UnaryPredecrementExpression: return 3;
-        case SyntaxKind::UnaryPreincrementExpression: return 3;
-        case SyntaxKind::UnarySequenceDelayExpression: return 3;
-        case SyntaxKind::UnarySequenceEventExpression: return 3;
-        case SyntaxKind::UnbasedUnsizedLiteralExpression: return 1;
-        case SyntaxKind::UnconnectedDriveDirective: return 2;
-        case SyntaxKind::UndefDirective: return 3;
-        case SyntaxKind::UndefineAllDirective: return 2;
-        case SyntaxKind::UnionType: return 8;
-        case SyntaxKind::UniquenessConstraint: return 3;
-        case SyntaxKind::UnitScope: return 1;
-        case SyntaxKind::UntilPropertyExpression: return 4;
-        case SyntaxKind::UntilWithPropertyExpression: return 4;
-        case SyntaxKind::Untyped: return 1;
-        case SyntaxKind::VarDataType: return 2;
-        case SyntaxKind::VariableDeclarator: return 3;
-        case SyntaxKind::VariableDimension: return 3;
-        case SyntaxKind::VariablePattern: return 2;
-        case SyntaxKind::VariablePortHeader: return 3;
-        case SyntaxKind::VirtualInterfaceType: return 5;
-        case SyntaxKind::VoidType: return 1;
-        case SyntaxKind::WaitForkStatement: return 5;
-        case SyntaxKind::WaitOrderStatement: return 7;
-        case SyntaxKind::WaitStatement: return 7;
-        case SyntaxKind::WildcardDimensionSpecifier: return 1;
-        case SyntaxKind::WildcardEqualityExpression: return 4;
-        case SyntaxKind::WildcardInequalityExpression: return 4;
-        case SyntaxKind::WildcardLiteralExpression: return 1;
-        case SyntaxKind::WildcardPattern: return 1;
-        case SyntaxKind::WildcardPortConnection: return 2;
-        case SyntaxKind::WildcardPortList: return 3;
-        case SyntaxKind::WithClause: return 4;
-        case SyntaxKind::WithFunctionSample: return 4;
-        case SyntaxKind::WithinSequenceExpression: return 4;
-        case SyntaxKind::XorAssignmentExpression: return 4;
-    }
-    THROW_UNREACHABLE;
-}
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+namespace {
+
+struct ActionBlockSyntaxLayout : public SyntaxNode {
+    StatementSyntax* statement;
+    ElseClauseSyntax* elseClause;
+};
+
+struct PortListSyntaxLayout : public SyntaxNode {
+};
+
+struct AnsiPortListSyntaxLayout : public PortListSyntaxLayout {
+    Token openParen;
+    SeparatedSyntaxList<MemberSyntax> ports;
+    Token closeParen;
+};
+
+struct ArgumentListSyntaxLayout : public SyntaxNode {
+    Token openParen;
+    SeparatedSyntaxList<ArgumentSyntax> parameters;
+    Token closeParen;
+};
+
+struct AssertionItemPortListSyntaxLayout : public SyntaxNode {
+    Token openParen;
+    SeparatedSyntaxList<AssertionItemPortSyntax> ports;
+    Token closeParen;
+};
+
+struct AssertionItemPortSyntaxLayout : public SyntaxNode {
+    SyntaxList<AttributeInstanceSyntax> attributes;
+    Token local;
+    Token direction;
+    DataTypeSyntax* type;
+    VariableDeclaratorSyntax* declarator;
+};
+
+struct ExpressionSyntaxLayout : public SyntaxNode {
+};
+
+struct PrimaryExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+};
+
+struct AssignmentPatternExpressionSyntaxLayout : public PrimaryExpressionSyntaxLayout {
+    DataTypeSyntax* type;
+    AssignmentPatternSyntax* pattern;
+};
+
+struct AssignmentPatternItemSyntaxLayout : public SyntaxNode {
+    ExpressionSyntax* key;
+    Token colon;
+    ExpressionSyntax* expr;
+};
+
+struct AttributeInstanceSyntaxLayout : public SyntaxNode {
+    Token openParen;
+    SeparatedSyntaxList<AttributeSpecSyntax> specs;
+    Token closeParen;
+};
+
+struct AttributeSpecSyntaxLayout : public SyntaxNode {
+    Token name;
+    EqualsValueClauseSyntax* value;
+};
+
+struct BadExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    ExpressionSyntax* expr;
+};
+
+struct DirectiveSyntaxLayout : public SyntaxNode {
+    Token directive;
+};
+
+struct BeginKeywordsDirectiveSyntaxLayout : public DirectiveSyntaxLayout {
+    Token versionSpecifier;
+    Token endOfDirective;
+};
+
+struct BlockEventExpressionSyntaxLayout : public SyntaxNode {
+};
+
+struct BinaryBlockEventExpressionSyntaxLayout : public BlockEventExpressionSyntaxLayout {
+    BlockEventExpressionSyntax* left;
+    Token orKeyword;
+    BlockEventExpressionSyntax* right;
+};
+
+struct EventExpressionSyntaxLayout : public SyntaxNode {
+};
+
+struct BinaryEventExpressionSyntaxLayout : public EventExpressionSyntaxLayout {
+    EventExpressionSyntax* left;
+    Token operatorToken;
+    EventExpressionSyntax* right;
+};
+
+struct BinaryExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    ExpressionSyntax* left;
+    Token operatorToken;
+    SyntaxList<AttributeInstanceSyntax> attributes;
+    ExpressionSyntax* right;
+};
+
+struct SelectorSyntaxLayout : public SyntaxNode {
+};
+
+struct BitSelectSyntaxLayout : public SelectorSyntaxLayout {
+    ExpressionSyntax* expr;
+};
+
+struct BlockCoverageEventSyntaxLayout : public SyntaxNode {
+    Token atat;
+    Token openParen;
+    BlockEventExpressionSyntax* expr;
+    Token closeParen;
+};
+
+struct StatementSyntaxLayout : public SyntaxNode {
+    NamedLabelSyntax* label;
+    SyntaxList<AttributeInstanceSyntax> attributes;
+};
+
+struct BlockStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token begin;
+    NamedBlockClauseSyntax* blockName;
+    SyntaxList<SyntaxNode> items;
+    Token end;
+    NamedBlockClauseSyntax* endBlockName;
+};
+
+struct MemberSyntaxLayout : public SyntaxNode {
+    SyntaxList<AttributeInstanceSyntax> attributes;
+};
+
+struct CaseGenerateSyntaxLayout : public MemberSyntaxLayout {
+    Token keyword;
+    Token openParen;
+    ExpressionSyntax* condition;
+    Token closeParen;
+    SyntaxList<CaseItemSyntax> items;
+    Token endCase;
+};
+
+struct CaseStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token uniqueOrPriority;
+    Token caseKeyword;
+    Token openParen;
+    ExpressionSyntax* expr;
+    Token closeParen;
+    Token matchesOrInside;
+    SyntaxList<CaseItemSyntax> items;
+    Token endcase;
+};
+
+struct CastExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    ExpressionSyntax* left;
+    Token apostrophe;
+    ParenthesizedExpressionSyntax* right;
+};
+
+struct NetStrengthSyntaxLayout : public SyntaxNode {
+};
+
+struct ChargeStrengthSyntaxLayout : public NetStrengthSyntaxLayout {
+    Token openParen;
+    Token strength;
+    Token closeParen;
+};
+
+struct ClassDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    Token virtualOrInterface;
+    Token classKeyword;
+    Token lifetime;
+    Token name;
+    ParameterPortListSyntax* parameters;
+    ExtendsClauseSyntax* extendsClause;
+    ImplementsClauseSyntax* implementsClause;
+    Token semi;
+    SyntaxList<MemberSyntax> items;
+    Token endClass;
+    NamedBlockClauseSyntax* endBlockName;
+};
+
+struct ClassMethodDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    TokenList qualifiers;
+    FunctionDeclarationSyntax* declaration;
+};
+
+struct ClassMethodPrototypeSyntaxLayout : public MemberSyntaxLayout {
+    TokenList qualifiers;
+    FunctionPrototypeSyntax* prototype;
+    Token semi;
+};
+
+struct NameSyntaxLayout : public ExpressionSyntaxLayout {
+};
+
+struct ClassNameSyntaxLayout : public NameSyntaxLayout {
+    Token identifier;
+    ParameterValueAssignmentSyntax* parameters;
+};
+
+struct ClassPropertyDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    TokenList qualifiers;
+    MemberSyntax* declaration;
+};
+
+struct ClassScopeSyntaxLayout : public NameSyntaxLayout {
+    NameSyntax* left;
+    Token separator;
+};
+
+struct ClockingDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    Token globalOrDefault;
+    Token clocking;
+    Token blockName;
+    Token at;
+    ParenthesizedEventExpressionSyntax* event;
+    Token eventIdentifier;
+    Token semi;
+    SyntaxList<ClockingItemSyntax> items;
+    Token endClocking;
+    NamedBlockClauseSyntax* endBlockName;
+};
+
+struct ClockingDirectionSyntaxLayout : public SyntaxNode {
+    Token input;
+    ClockingSkewSyntax* inputSkew;
+    Token output;
+    ClockingSkewSyntax* ouputSkew;
+    Token inout;
+};
+
+struct ClockingItemSyntaxLayout : public SyntaxNode {
+    Token defaultKeyword;
+    ClockingDirectionSyntax* direction;
+    SeparatedSyntaxList<AttributeSpecSyntax> assignments;
+    Token semi;
+    MemberSyntax* declaration;
+};
+
+struct ClockingSkewSyntaxLayout : public SyntaxNode {
+    Token edge;
+    Token hash;
+    ExpressionSyntax* value;
+};
+
+struct ColonExpressionClauseSyntaxLayout : public SyntaxNode {
+    Token colon;
+    ExpressionSyntax* expr;
+};
+
+struct CompilationUnitSyntaxLayout : public SyntaxNode {
+    SyntaxList<MemberSyntax> members;
+    Token endOfFile;
+};
+
+struct ConcatenationExpressionSyntaxLayout : public PrimaryExpressionSyntaxLayout {
+    Token openBrace;
+    SeparatedSyntaxList<ExpressionSyntax> expressions;
+    Token closeBrace;
+};
+
+struct ConcurrentAssertionMemberSyntaxLayout : public MemberSyntaxLayout {
+    ConcurrentAssertionStatementSyntax* statement;
+};
+
+struct ConcurrentAssertionStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token keyword;
+    Token propertyOrSequence;
+    Token openParen;
+    PropertySpecSyntax* propertySpec;
+    Token closeParen;
+    ActionBlockSyntax* action;
+};
+
+struct ConditionalBranchDirectiveSyntaxLayout : public DirectiveSyntaxLayout {
+    Token name;
+    Token endOfDirective;
+    TokenList disabledTokens;
+};
+
+struct ConstraintItemSyntaxLayout : public SyntaxNode {
+};
+
+struct ConditionalConstraintSyntaxLayout : public ConstraintItemSyntaxLayout {
+    Token ifKeyword;
+    Token openParen;
+    ExpressionSyntax* condition;
+    Token closeParen;
+    ConstraintItemSyntax* constraints;
+    ElseConstraintClauseSyntax* elseClause;
+};
+
+struct ConditionalExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    ConditionalPredicateSyntax* predicate;
+    Token question;
+    SyntaxList<AttributeInstanceSyntax> attributes;
+    ExpressionSyntax* left;
+    Token colon;
+    ExpressionSyntax* right;
+};
+
+struct ConditionalPatternSyntaxLayout : public SyntaxNode {
+    ExpressionSyntax* expr;
+    MatchesClauseSyntax* matchesClause;
+};
+
+struct ConditionalPredicateSyntaxLayout : public SyntaxNode {
+    SeparatedSyntaxList<ConditionalPatternSyntax> conditions;
+};
+
+struct ConditionalStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token uniqueOrPriority;
+    Token ifKeyword;
+    Token openParen;
+    ConditionalPredicateSyntax* predicate;
+    Token closeParen;
+    StatementSyntax* statement;
+    ElseClauseSyntax* elseClause;
+};
+
+struct ConstraintBlockSyntaxLayout : public ConstraintItemSyntaxLayout {
+    Token openBrace;
+    SyntaxList<ConstraintItemSyntax> items;
+    Token closeBrace;
+};
+
+struct ConstraintDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    TokenList qualifiers;
+    Token keyword;
+    Token name;
+    ConstraintBlockSyntax* block;
+};
+
+struct ConstraintPrototypeSyntaxLayout : public MemberSyntaxLayout {
+    TokenList qualifiers;
+    Token keyword;
+    Token name;
+    Token semi;
+};
+
+struct ContinuousAssignSyntaxLayout : public MemberSyntaxLayout {
+    Token assign;
+    SeparatedSyntaxList<ExpressionSyntax> assignments;
+    Token semi;
+};
+
+struct CoverageBinsSyntaxLayout : public MemberSyntaxLayout {
+    Token wildcard;
+    Token keyword;
+    Token name;
+    ElementSelectSyntax* selector;
+    Token equals;
+    CoverageBinInitializerSyntax* initializer;
+    IffClauseSyntax* iff;
+    Token semi;
+};
+
+struct CoverageOptionSyntaxLayout : public MemberSyntaxLayout {
+    Token option;
+    Token dot;
+    Token name;
+    Token equals;
+    ExpressionSyntax* expr;
+    Token semi;
+};
+
+struct CovergroupDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    Token covergroup;
+    Token name;
+    AnsiPortListSyntax* portList;
+    SyntaxNode* event;
+    Token semi;
+    SyntaxList<MemberSyntax> members;
+    Token endgroup;
+    NamedBlockClauseSyntax* endBlockName;
+};
+
+struct CoverpointSyntaxLayout : public MemberSyntaxLayout {
+    DataTypeSyntax* type;
+    NamedLabelSyntax* label;
+    Token coverpoint;
+    ExpressionSyntax* expr;
+    Token openBrace;
+    SyntaxList<MemberSyntax> members;
+    Token closeBrace;
+    Token emptySemi;
+};
+
+struct DPIImportExportSyntaxLayout : public MemberSyntaxLayout {
+    Token keyword;
+    Token stringLiteral;
+    Token property;
+    Token name;
+    Token equals;
+    FunctionPrototypeSyntax* method;
+    Token semi;
+};
+
+struct DataDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    TokenList modifiers;
+    DataTypeSyntax* type;
+    SeparatedSyntaxList<VariableDeclaratorSyntax> declarators;
+    Token semi;
+};
+
+struct DimensionSpecifierSyntaxLayout : public SyntaxNode {
+};
+
+struct DataTypeDimensionSpecifierSyntaxLayout : public DimensionSpecifierSyntaxLayout {
+    DataTypeSyntax* type;
+};
+
+struct DefParamAssignmentSyntaxLayout : public SyntaxNode {
+    NameSyntax* name;
+    EqualsValueClauseSyntax* setter;
+};
+
+struct DefParamSyntaxLayout : public MemberSyntaxLayout {
+    Token defparam;
+    SeparatedSyntaxList<DefParamAssignmentSyntax> assignments;
+    Token semi;
+};
+
+struct CaseItemSyntaxLayout : public SyntaxNode {
+};
+
+struct DefaultCaseItemSyntaxLayout : public CaseItemSyntaxLayout {
+    Token defaultKeyword;
+    Token colon;
+    SyntaxNode* clause;
+};
+
+struct CoverageBinInitializerSyntaxLayout : public SyntaxNode {
+};
+
+struct DefaultCoverageBinInitializerSyntaxLayout : public CoverageBinInitializerSyntaxLayout {
+    Token defaultKeyword;
+    Token sequenceKeyword;
+};
+
+struct DefaultNetTypeDirectiveSyntaxLayout : public DirectiveSyntaxLayout {
+    Token netType;
+    Token endOfDirective;
+};
+
+struct DeferredAssertionSyntaxLayout : public SyntaxNode {
+    Token hash;
+    Token zero;
+    Token finalKeyword;
+};
+
+struct DefineDirectiveSyntaxLayout : public DirectiveSyntaxLayout {
+    Token name;
+    MacroFormalArgumentListSyntax* formalArguments;
+    TokenList body;
+    Token endOfDirective;
+};
+
+struct TimingControlSyntaxLayout : public SyntaxNode {
+};
+
+struct DelaySyntaxLayout : public TimingControlSyntaxLayout {
+    Token hash;
+    ExpressionSyntax* delayValue;
+};
+
+struct DisableConstraintSyntaxLayout : public ConstraintItemSyntaxLayout {
+    Token disable;
+    Token soft;
+    NameSyntax* name;
+    Token semi;
+};
+
+struct DisableForkStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token disable;
+    Token fork;
+    Token semi;
+};
+
+struct DisableIffSyntaxLayout : public SyntaxNode {
+    Token disable;
+    Token iff;
+    Token openParen;
+    ExpressionSyntax* expr;
+    Token closeParen;
+};
+
+struct DisableStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token disable;
+    NameSyntax* name;
+    Token semi;
+};
+
+struct DistConstraintListSyntaxLayout : public SyntaxNode {
+    Token dist;
+    Token openBrace;
+    SeparatedSyntaxList<DistItemSyntax> items;
+    Token closeBrace;
+};
+
+struct DistItemSyntaxLayout : public SyntaxNode {
+    ExpressionSyntax* range;
+    DistWeightSyntax* weight;
+};
+
+struct DistWeightSyntaxLayout : public SyntaxNode {
+    Token op;
+    ExpressionSyntax* expr;
+};
+
+struct DividerClauseSyntaxLayout : public SyntaxNode {
+    Token divide;
+    Token value;
+};
+
+struct DoWhileStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token doKeyword;
+    StatementSyntax* statement;
+    Token whileKeyword;
+    Token openParen;
+    ExpressionSyntax* expr;
+    Token closeParen;
+    Token semi;
+};
+
+struct DotMemberClauseSyntaxLayout : public SyntaxNode {
+    Token dot;
+    Token member;
+};
+
+struct DriveStrengthSyntaxLayout : public NetStrengthSyntaxLayout {
+    Token openParen;
+    Token strength0;
+    Token comma;
+    Token strength1;
+    Token closeParen;
+};
+
+struct ElementSelectExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    ExpressionSyntax* left;
+    ElementSelectSyntax* select;
+};
+
+struct ElementSelectSyntaxLayout : public ExpressionSyntaxLayout {
+    Token openBracket;
+    SelectorSyntax* selector;
+    Token closeBracket;
+};
+
+struct ElseClauseSyntaxLayout : public SyntaxNode {
+    Token elseKeyword;
+    SyntaxNode* clause;
+};
+
+struct ElseConstraintClauseSyntaxLayout : public SyntaxNode {
+    Token elseKeyword;
+    ConstraintItemSyntax* constraints;
+};
+
+struct EmptyMemberSyntaxLayout : public MemberSyntaxLayout {
+    TokenList qualifiers;
+    Token semi;
+};
+
+struct EmptyQueueExpressionSyntaxLayout : public PrimaryExpressionSyntaxLayout {
+    Token openBrace;
+    Token closeBrace;
+};
+
+struct EmptyStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token semicolon;
+};
+
+struct DataTypeSyntaxLayout : public ExpressionSyntaxLayout {
+};
+
+struct EnumTypeSyntaxLayout : public DataTypeSyntaxLayout {
+    Token keyword;
+    DataTypeSyntax* baseType;
+    Token openBrace;
+    SeparatedSyntaxList<VariableDeclaratorSyntax> members;
+    Token closeBrace;
+    SyntaxList<VariableDimensionSyntax> dimensions;
+};
+
+struct EqualsValueClauseSyntaxLayout : public SyntaxNode {
+    Token equals;
+    ExpressionSyntax* expr;
+};
+
+struct EventControlSyntaxLayout : public TimingControlSyntaxLayout {
+    Token at;
+    NameSyntax* eventName;
+};
+
+struct EventControlWithExpressionSyntaxLayout : public TimingControlSyntaxLayout {
+    Token at;
+    EventExpressionSyntax* expr;
+};
+
+struct EventTriggerStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token trigger;
+    TimingControlSyntax* timing;
+    NameSyntax* name;
+};
+
+struct ExplicitAnsiPortSyntaxLayout : public MemberSyntaxLayout {
+    Token direction;
+    Token dot;
+    Token name;
+    Token openParen;
+    ExpressionSyntax* expr;
+    Token closeParen;
+};
+
+struct NonAnsiPortSyntaxLayout : public SyntaxNode {
+};
+
+struct ExplicitNonAnsiPortSyntaxLayout : public NonAnsiPortSyntaxLayout {
+    Token dot;
+    Token name;
+    Token openParen;
+    ExpressionSyntax* expr;
+    Token closeParen;
+};
+
+struct ExpressionConstraintSyntaxLayout : public ConstraintItemSyntaxLayout {
+    Token soft;
+    ExpressionSyntax* expr;
+    Token semi;
+};
+
+struct ExpressionCoverageBinInitializerSyntaxLayout : public CoverageBinInitializerSyntaxLayout {
+    ExpressionSyntax* expr;
+    WithClauseSyntax* withClause;
+};
+
+struct ExpressionOrDistSyntaxLayout : public ExpressionSyntaxLayout {
+    ExpressionSyntax* expr;
+    DistConstraintListSyntax* distribution;
+};
+
+struct PatternSyntaxLayout : public SyntaxNode {
+};
+
+struct ExpressionPatternSyntaxLayout : public PatternSyntaxLayout {
+    ExpressionSyntax* expr;
+};
+
+struct ExpressionStatementSyntaxLayout : public StatementSyntaxLayout {
+    ExpressionSyntax* expr;
+    Token semi;
+};
+
+struct ExtendsClauseSyntaxLayout : public SyntaxNode {
+    Token keyword;
+    NameSyntax* baseName;
+    ArgumentListSyntax* arguments;
+};
+
+struct ExternModuleSyntaxLayout : public SyntaxNode {
+    Token externKeyword;
+    ModuleHeaderSyntax* header;
+};
+
+struct ForLoopStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token forKeyword;
+    Token openParen;
+    SeparatedSyntaxList<SyntaxNode> initializers;
+    Token semi1;
+    ExpressionSyntax* stopExpr;
+    Token semi2;
+    SeparatedSyntaxList<ExpressionSyntax> steps;
+    Token closeParen;
+    StatementSyntax* statement;
+};
+
+struct ForVariableDeclarationSyntaxLayout : public SyntaxNode {
+    Token varKeyword;
+    DataTypeSyntax* type;
+    VariableDeclaratorSyntax* declarator;
+};
+
+struct ForeachLoopListSyntaxLayout : public SyntaxNode {
+    Token openParen;
+    NameSyntax* arrayName;
+    Token openBracket;
+    SeparatedSyntaxList<NameSyntax> loopVariables;
+    Token closeBracket;
+    Token closeParen;
+};
+
+struct ForeachLoopStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token keyword;
+    ForeachLoopListSyntax* loopList;
+    StatementSyntax* statement;
+};
+
+struct ForeverStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token foreverKeyword;
+    StatementSyntax* statement;
+};
+
+struct ForwardInterfaceClassTypedefDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    Token typedefKeyword;
+    Token interfaceKeyword;
+    Token classKeyword;
+    Token name;
+    Token semi;
+};
+
+struct ForwardTypedefDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    Token typedefKeyword;
+    Token keyword;
+    Token name;
+    Token semi;
+};
+
+struct FunctionDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    FunctionPrototypeSyntax* prototype;
+    Token semi;
+    SyntaxList<SyntaxNode> items;
+    Token end;
+    NamedBlockClauseSyntax* endBlockName;
+};
+
+struct FunctionPortListSyntaxLayout : public SyntaxNode {
+    Token openParen;
+    SeparatedSyntaxList<FunctionPortSyntax> ports;
+    Token closeParen;
+};
+
+struct FunctionPortSyntaxLayout : public SyntaxNode {
+    SyntaxList<AttributeInstanceSyntax> attributes;
+    Token constKeyword;
+    Token direction;
+    Token varKeyword;
+    DataTypeSyntax* dataType;
+    VariableDeclaratorSyntax* declarator;
+};
+
+struct FunctionPrototypeSyntaxLayout : public SyntaxNode {
+    Token keyword;
+    Token lifetime;
+    DataTypeSyntax* returnType;
+    NameSyntax* name;
+    FunctionPortListSyntax* portList;
+};
+
+struct GenerateBlockSyntaxLayout : public MemberSyntaxLayout {
+    NamedLabelSyntax* label;
+    Token begin;
+    NamedBlockClauseSyntax* beginName;
+    SyntaxList<MemberSyntax> members;
+    Token end;
+    NamedBlockClauseSyntax* endName;
+};
+
+struct GenerateRegionSyntaxLayout : public MemberSyntaxLayout {
+    Token keyword;
+    SyntaxList<MemberSyntax> members;
+    Token endgenerate;
+};
+
+struct GenvarDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    Token keyword;
+    SeparatedSyntaxList<IdentifierNameSyntax> identifiers;
+    Token semi;
+};
+
+struct HierarchicalInstanceSyntaxLayout : public SyntaxNode {
+    Token name;
+    SyntaxList<VariableDimensionSyntax> dimensions;
+    Token openParen;
+    SeparatedSyntaxList<PortConnectionSyntax> connections;
+    Token closeParen;
+};
+
+struct HierarchyInstantiationSyntaxLayout : public MemberSyntaxLayout {
+    Token type;
+    ParameterValueAssignmentSyntax* parameters;
+    SeparatedSyntaxList<HierarchicalInstanceSyntax> instances;
+    Token semi;
+};
+
+struct IdentifierListSyntaxLayout : public SyntaxNode {
+    Token openParen;
+    SeparatedSyntaxList<IdentifierNameSyntax> identifiers;
+    Token closeParen;
+};
+
+struct IdentifierNameSyntaxLayout : public NameSyntaxLayout {
+    Token identifier;
+};
+
+struct IdentifierSelectNameSyntaxLayout : public NameSyntaxLayout {
+    Token identifier;
+    SyntaxList<ElementSelectSyntax> selectors;
+};
+
+struct IfGenerateSyntaxLayout : public MemberSyntaxLayout {
+    Token keyword;
+    Token openParen;
+    ExpressionSyntax* condition;
+    Token closeParen;
+    MemberSyntax* block;
+    ElseClauseSyntax* elseClause;
+};
+
+struct IffClauseSyntaxLayout : public SyntaxNode {
+    Token iff;
+    Token openParen;
+    ExpressionSyntax* expr;
+    Token closeParen;
+};
+
+struct ImmediateAssertionMemberSyntaxLayout : public MemberSyntaxLayout {
+    ImmediateAssertionStatementSyntax* statement;
+};
+
+struct ImmediateAssertionStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token keyword;
+    DeferredAssertionSyntax* delay;
+    ParenthesizedExpressionSyntax* expr;
+    ActionBlockSyntax* action;
+};
+
+struct ImplementsClauseSyntaxLayout : public SyntaxNode {
+    Token keyword;
+    SeparatedSyntaxList<NameSyntax> interfaces;
+};
+
+struct ImplicationConstraintSyntaxLayout : public ConstraintItemSyntaxLayout {
+    ExpressionSyntax* left;
+    Token arrow;
+    ConstraintItemSyntax* constraints;
+};
+
+struct ImplicitAnsiPortSyntaxLayout : public MemberSyntaxLayout {
+    PortHeaderSyntax* header;
+    VariableDeclaratorSyntax* declarator;
+};
+
+struct ImplicitEventControlSyntaxLayout : public TimingControlSyntaxLayout {
+    Token atStar;
+};
+
+struct ImplicitNonAnsiPortSyntaxLayout : public NonAnsiPortSyntaxLayout {
+    ExpressionSyntax* expr;
+};
+
+struct ImplicitTypeSyntaxLayout : public DataTypeSyntaxLayout {
+    Token signing;
+    SyntaxList<VariableDimensionSyntax> dimensions;
+};
+
+struct IncludeDirectiveSyntaxLayout : public DirectiveSyntaxLayout {
+    Token fileName;
+    Token endOfDirective;
+};
+
+struct InsideExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    ExpressionSyntax* expr;
+    Token inside;
+    OpenRangeListSyntax* ranges;
+};
+
+struct IntegerTypeSyntaxLayout : public DataTypeSyntaxLayout {
+    Token keyword;
+    Token signing;
+    SyntaxList<VariableDimensionSyntax> dimensions;
+};
+
+struct IntegerVectorExpressionSyntaxLayout : public PrimaryExpressionSyntaxLayout {
+    Token size;
+    Token base;
+    Token value;
+};
+
+struct PortHeaderSyntaxLayout : public SyntaxNode {
+};
+
+struct InterconnectPortHeaderSyntaxLayout : public PortHeaderSyntaxLayout {
+    Token direction;
+    Token interconnect;
+    DataTypeSyntax* type;
+};
+
+struct InterfacePortHeaderSyntaxLayout : public PortHeaderSyntaxLayout {
+    Token nameOrKeyword;
+    DotMemberClauseSyntax* modport;
+};
+
+struct InvocationExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    ExpressionSyntax* left;
+    SyntaxList<AttributeInstanceSyntax> attributes;
+    ArgumentListSyntax* arguments;
+};
+
+struct JumpStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token breakOrContinue;
+    Token semi;
+};
+
+struct KeywordNameSyntaxLayout : public NameSyntaxLayout {
+    Token keyword;
+};
+
+struct KeywordTypeSyntaxLayout : public DataTypeSyntaxLayout {
+    Token keyword;
+};
+
+struct LetDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    Token let;
+    Token identifier;
+    AssertionItemPortListSyntax* portList;
+    EqualsValueClauseSyntax* initializer;
+    Token semi;
+};
+
+struct LineDirectiveSyntaxLayout : public DirectiveSyntaxLayout {
+    Token lineNumber;
+    Token fileName;
+    Token level;
+    Token endOfDirective;
+};
+
+struct LiteralExpressionSyntaxLayout : public PrimaryExpressionSyntaxLayout {
+    Token literal;
+};
+
+struct LoopConstraintSyntaxLayout : public ConstraintItemSyntaxLayout {
+    Token foreachKeyword;
+    ForeachLoopListSyntax* loopList;
+    ConstraintItemSyntax* constraints;
+};
+
+struct LoopGenerateSyntaxLayout : public MemberSyntaxLayout {
+    Token keyword;
+    Token openParen;
+    Token genvar;
+    Token identifier;
+    Token equals;
+    ExpressionSyntax* initialExpr;
+    Token semi1;
+    ExpressionSyntax* stopExpr;
+    Token semi2;
+    ExpressionSyntax* iterationExpr;
+    Token closeParen;
+    MemberSyntax* block;
+};
+
+struct LoopStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token repeatOrWhile;
+    Token openParen;
+    ExpressionSyntax* expr;
+    Token closeParen;
+    StatementSyntax* statement;
+};
+
+struct MacroActualArgumentListSyntaxLayout : public SyntaxNode {
+    Token openParen;
+    SeparatedSyntaxList<MacroActualArgumentSyntax> args;
+    Token closeParen;
+};
+
+struct MacroActualArgumentSyntaxLayout : public SyntaxNode {
+    TokenList tokens;
+};
+
+struct MacroArgumentDefaultSyntaxLayout : public SyntaxNode {
+    Token equals;
+    TokenList tokens;
+};
+
+struct MacroFormalArgumentListSyntaxLayout : public SyntaxNode {
+    Token openParen;
+    SeparatedSyntaxList<MacroFormalArgumentSyntax> args;
+    Token closeParen;
+};
+
+struct MacroFormalArgumentSyntaxLayout : public SyntaxNode {
+    Token name;
+    MacroArgumentDefaultSyntax* defaultValue;
+};
+
+struct MacroUsageSyntaxLayout : public DirectiveSyntaxLayout {
+    MacroActualArgumentListSyntax* args;
+};
+
+struct MatchesClauseSyntaxLayout : public SyntaxNode {
+    Token matchesKeyword;
+    PatternSyntax* pattern;
+};
+
+struct MemberAccessExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    ExpressionSyntax* left;
+    Token dot;
+    Token name;
+};
+
+struct MinTypMaxExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    ExpressionSyntax* min;
+    Token colon1;
+    ExpressionSyntax* typ;
+    Token colon2;
+    ExpressionSyntax* max;
+};
+
+struct ModportClockingPortSyntaxLayout : public MemberSyntaxLayout {
+    Token clocking;
+    Token name;
+};
+
+struct ModportDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    Token keyword;
+    SeparatedSyntaxList<ModportItemSyntax> items;
+    Token semi;
+};
+
+struct ModportPortSyntaxLayout : public SyntaxNode {
+};
+
+struct ModportExplicitPortSyntaxLayout : public ModportPortSyntaxLayout {
+    Token dot;
+    Token name;
+    Token openParen;
+    ExpressionSyntax* expr;
+    Token closeParen;
+};
+
+struct ModportItemSyntaxLayout : public SyntaxNode {
+    Token name;
+    AnsiPortListSyntax* ports;
+};
+
+struct ModportNamedPortSyntaxLayout : public ModportPortSyntaxLayout {
+    Token name;
+};
+
+struct ModportSimplePortListSyntaxLayout : public MemberSyntaxLayout {
+    Token direction;
+    SeparatedSyntaxList<ModportPortSyntax> ports;
+};
+
+struct ModportSubroutinePortListSyntaxLayout : public MemberSyntaxLayout {
+    Token importExport;
+    SeparatedSyntaxList<ModportPortSyntax> ports;
+};
+
+struct ModportSubroutinePortSyntaxLayout : public ModportPortSyntaxLayout {
+    FunctionPrototypeSyntax* prototype;
+};
+
+struct ModuleDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    ModuleHeaderSyntax* header;
+    SyntaxList<MemberSyntax> members;
+    Token endmodule;
+    NamedBlockClauseSyntax* blockName;
+};
+
+struct ModuleHeaderSyntaxLayout : public SyntaxNode {
+    Token moduleKeyword;
+    Token lifetime;
+    Token name;
+    SyntaxList<PackageImportDeclarationSyntax> imports;
+    ParameterPortListSyntax* parameters;
+    PortListSyntax* ports;
+    Token semi;
+};
+
+struct MultipleConcatenationExpressionSyntaxLayout : public PrimaryExpressionSyntaxLayout {
+    Token openBrace;
+    ExpressionSyntax* expression;
+    ConcatenationExpressionSyntax* concatenation;
+    Token closeBrace;
+};
+
+struct ArgumentSyntaxLayout : public SyntaxNode {
+};
+
+struct NamedArgumentSyntaxLayout : public ArgumentSyntaxLayout {
+    Token dot;
+    Token name;
+    Token openParen;
+    ExpressionSyntax* expr;
+    Token closeParen;
+};
+
+struct NamedBlockClauseSyntaxLayout : public SyntaxNode {
+    Token colon;
+    Token name;
+};
+
+struct NamedLabelSyntaxLayout : public SyntaxNode {
+    Token name;
+    Token colon;
+};
+
+struct PortConnectionSyntaxLayout : public SyntaxNode {
+    SyntaxList<AttributeInstanceSyntax> attributes;
+};
+
+struct NamedPortConnectionSyntaxLayout : public PortConnectionSyntaxLayout {
+    Token dot;
+    Token name;
+    Token openParen;
+    ExpressionSyntax* expr;
+    Token closeParen;
+};
+
+struct StructurePatternMemberSyntaxLayout : public SyntaxNode {
+};
+
+struct NamedStructurePatternMemberSyntaxLayout : public StructurePatternMemberSyntaxLayout {
+    Token name;
+    Token colon;
+    PatternSyntax* pattern;
+};
+
+struct NamedTypeSyntaxLayout : public DataTypeSyntaxLayout {
+    NameSyntax* name;
+};
+
+struct NetDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    Token netType;
+    NetStrengthSyntax* strength;
+    Token expansionHint;
+    DataTypeSyntax* type;
+    SeparatedSyntaxList<VariableDeclaratorSyntax> declarators;
+    Token semi;
+};
+
+struct NetPortHeaderSyntaxLayout : public PortHeaderSyntaxLayout {
+    Token direction;
+    Token netType;
+    DataTypeSyntax* dataType;
+};
+
+struct NewArrayExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    Token newKeyword;
+    Token openBracket;
+    ExpressionSyntax* sizeExpr;
+    Token closeBracket;
+    ParenthesizedExpressionSyntax* initializer;
+};
+
+struct NewClassExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    ClassScopeSyntax* classScope;
+    Token newKeyword;
+    ArgumentListSyntax* arguments;
+};
+
+struct NewExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    Token newKeyword;
+    ExpressionSyntax* expr;
+};
+
+struct NonAnsiPortListSyntaxLayout : public PortListSyntaxLayout {
+    Token openParen;
+    SeparatedSyntaxList<NonAnsiPortSyntax> ports;
+    Token closeParen;
+};
+
+struct OpenRangeListSyntaxLayout : public SyntaxNode {
+    Token openBrace;
+    SeparatedSyntaxList<ExpressionSyntax> valueRanges;
+    Token closeBrace;
+};
+
+struct OrderedArgumentSyntaxLayout : public ArgumentSyntaxLayout {
+    ExpressionSyntax* expr;
+};
+
+struct OrderedPortConnectionSyntaxLayout : public PortConnectionSyntaxLayout {
+    ExpressionSyntax* expr;
+};
+
+struct OrderedStructurePatternMemberSyntaxLayout : public StructurePatternMemberSyntaxLayout {
+    PatternSyntax* pattern;
+};
+
+struct PackageImportDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    Token keyword;
+    SeparatedSyntaxList<PackageImportItemSyntax> items;
+    Token semi;
+};
+
+struct PackageImportItemSyntaxLayout : public SyntaxNode {
+    Token package;
+    Token doubleColon;
+    Token item;
+};
+
+struct ParameterDeclarationStatementSyntaxLayout : public MemberSyntaxLayout {
+    ParameterDeclarationSyntax* parameter;
+    Token semi;
+};
+
+struct ParameterDeclarationSyntaxLayout : public SyntaxNode {
+    Token keyword;
+    DataTypeSyntax* type;
+    SeparatedSyntaxList<VariableDeclaratorSyntax> declarators;
+};
+
+struct ParameterPortListSyntaxLayout : public SyntaxNode {
+    Token hash;
+    Token openParen;
+    SeparatedSyntaxList<ParameterDeclarationSyntax> declarations;
+    Token closeParen;
+};
+
+struct ParameterValueAssignmentSyntaxLayout : public SyntaxNode {
+    Token hash;
+    ArgumentListSyntax* parameters;
+};
+
+struct ParenImplicitEventControlSyntaxLayout : public TimingControlSyntaxLayout {
+    Token at;
+    Token openParenStarCloseParen;
+};
+
+struct ParenthesizedEventExpressionSyntaxLayout : public EventExpressionSyntaxLayout {
+    Token openParen;
+    EventExpressionSyntax* expr;
+    Token closeParen;
+};
+
+struct ParenthesizedExpressionSyntaxLayout : public PrimaryExpressionSyntaxLayout {
+    Token openParen;
+    ExpressionSyntax* expression;
+    Token closeParen;
+};
+
+struct PatternCaseItemSyntaxLayout : public CaseItemSyntaxLayout {
+    PatternSyntax* pattern;
+    Token tripleAnd;
+    ExpressionSyntax* expr;
+    Token colon;
+    StatementSyntax* statement;
+};
+
+struct PortDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    PortHeaderSyntax* header;
+    SeparatedSyntaxList<VariableDeclaratorSyntax> declarators;
+    Token semi;
+};
+
+struct PostfixUnaryExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    ExpressionSyntax* operand;
+    SyntaxList<AttributeInstanceSyntax> attributes;
+    Token operatorToken;
+};
+
+struct PrefixUnaryExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    Token operatorToken;
+    SyntaxList<AttributeInstanceSyntax> attributes;
+    ExpressionSyntax* operand;
+};
+
+struct PrimaryBlockEventExpressionSyntaxLayout : public BlockEventExpressionSyntaxLayout {
+    Token keyword;
+    NameSyntax* name;
+};
+
+struct ProceduralAssignStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token keyword;
+    ExpressionSyntax* lvalue;
+    Token equals;
+    ExpressionSyntax* value;
+    Token semi;
+};
+
+struct ProceduralBlockSyntaxLayout : public MemberSyntaxLayout {
+    Token keyword;
+    StatementSyntax* statement;
+};
+
+struct ProceduralDeassignStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token keyword;
+    ExpressionSyntax* variable;
+    Token semi;
+};
+
+struct PropertyDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    Token keyword;
+    Token name;
+    AssertionItemPortListSyntax* portList;
+    Token semi;
+    SyntaxList<MemberSyntax> assertionVariables;
+    PropertySpecSyntax* propertySpec;
+    Token optionalSemi;
+    Token end;
+    NamedBlockClauseSyntax* endBlockName;
+};
+
+struct PropertySpecSyntaxLayout : public SyntaxNode {
+    TimingControlSyntax* clocking;
+    DisableIffSyntax* disable;
+    ExpressionSyntax* expr;
+};
+
+struct QueueDimensionSpecifierSyntaxLayout : public DimensionSpecifierSyntaxLayout {
+    Token dollar;
+    ColonExpressionClauseSyntax* maxSizeClause;
+};
+
+struct RandCaseItemSyntaxLayout : public SyntaxNode {
+    ExpressionSyntax* expr;
+    Token colon;
+    StatementSyntax* statement;
+};
+
+struct RandCaseStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token randCase;
+    SyntaxList<RandCaseItemSyntax> items;
+    Token endCase;
+};
+
+struct RandomizeMethodWithClauseSyntaxLayout : public ExpressionSyntaxLayout {
+    Token with;
+    IdentifierListSyntax* names;
+    ConstraintBlockSyntax* constraints;
+};
+
+struct RangeCoverageBinInitializerSyntaxLayout : public CoverageBinInitializerSyntaxLayout {
+    OpenRangeListSyntax* ranges;
+    WithClauseSyntax* withClause;
+};
+
+struct RangeDimensionSpecifierSyntaxLayout : public DimensionSpecifierSyntaxLayout {
+    SelectorSyntax* selector;
+};
+
+struct RangeSelectSyntaxLayout : public SelectorSyntaxLayout {
+    ExpressionSyntax* left;
+    Token range;
+    ExpressionSyntax* right;
+};
+
+struct RepeatedEventControlSyntaxLayout : public TimingControlSyntaxLayout {
+    Token repeat;
+    Token openParen;
+    ExpressionSyntax* expr;
+    Token closeParen;
+    TimingControlSyntax* eventControl;
+};
+
+struct AssignmentPatternSyntaxLayout : public SyntaxNode {
+};
+
+struct ReplicatedAssignmentPatternSyntaxLayout : public AssignmentPatternSyntaxLayout {
+    Token openBrace;
+    ExpressionSyntax* countExpr;
+    Token innerOpenBrace;
+    SeparatedSyntaxList<ExpressionSyntax> items;
+    Token innerCloseBrace;
+    Token closeBrace;
+};
+
+struct ReturnStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token returnKeyword;
+    ExpressionSyntax* returnValue;
+    Token semi;
+};
+
+struct ScopedNameSyntaxLayout : public NameSyntaxLayout {
+    NameSyntax* left;
+    Token separator;
+    NameSyntax* right;
+};
+
+struct SequenceDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    Token keyword;
+    Token name;
+    AssertionItemPortListSyntax* portList;
+    Token semi;
+    SyntaxList<MemberSyntax> assertionVariables;
+    ExpressionSyntax* seqExpr;
+    Token optionalSemi;
+    Token end;
+    NamedBlockClauseSyntax* endBlockName;
+};
+
+struct ShortcutCycleDelayRangeSyntaxLayout : public TimingControlSyntaxLayout {
+    Token doubleHash;
+    Token openBracket;
+    Token op;
+    Token closeBracket;
+};
+
+struct SignalEventExpressionSyntaxLayout : public EventExpressionSyntaxLayout {
+    Token edge;
+    ExpressionSyntax* expr;
+};
+
+struct SignedCastExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    Token signing;
+    Token apostrophe;
+    ParenthesizedExpressionSyntax* inner;
+};
+
+struct SimpleAssignmentPatternSyntaxLayout : public AssignmentPatternSyntaxLayout {
+    Token openBrace;
+    SeparatedSyntaxList<ExpressionSyntax> items;
+    Token closeBrace;
+};
+
+struct SimpleDirectiveSyntaxLayout : public DirectiveSyntaxLayout {
+    Token endOfDirective;
+};
+
+struct SolveBeforeConstraintSyntaxLayout : public ConstraintItemSyntaxLayout {
+    Token solve;
+    SeparatedSyntaxList<ExpressionSyntax> beforeExpr;
+    Token before;
+    SeparatedSyntaxList<ExpressionSyntax> afterExpr;
+    Token semi;
+};
+
+struct StandardCaseItemSyntaxLayout : public CaseItemSyntaxLayout {
+    SeparatedSyntaxList<ExpressionSyntax> expressions;
+    Token colon;
+    SyntaxNode* clause;
+};
+
+struct StreamExpressionSyntaxLayout : public SyntaxNode {
+    ExpressionSyntax* expression;
+    StreamExpressionWithRange* withRange;
+};
+
+struct StreamExpressionWithRangeLayout : public SyntaxNode {
+    Token withKeyword;
+    ElementSelectSyntax* range;
+};
+
+struct StreamingConcatenationExpressionSyntaxLayout : public PrimaryExpressionSyntaxLayout {
+    Token openBrace;
+    Token operatorToken;
+    ExpressionSyntax* sliceSize;
+    Token innerOpenBrace;
+    SeparatedSyntaxList<StreamExpressionSyntax> expressions;
+    Token innerCloseBrace;
+    Token closeBrace;
+};
+
+struct StructUnionMemberSyntaxLayout : public SyntaxNode {
+    SyntaxList<AttributeInstanceSyntax> attributes;
+    Token randomQualifier;
+    DataTypeSyntax* type;
+    SeparatedSyntaxList<VariableDeclaratorSyntax> declarators;
+    Token semi;
+};
+
+struct StructUnionTypeSyntaxLayout : public DataTypeSyntaxLayout {
+    Token keyword;
+    Token tagged;
+    Token packed;
+    Token signing;
+    Token openBrace;
+    SyntaxList<StructUnionMemberSyntax> members;
+    Token closeBrace;
+    SyntaxList<VariableDimensionSyntax> dimensions;
+};
+
+struct StructurePatternSyntaxLayout : public PatternSyntaxLayout {
+    Token openBrace;
+    SeparatedSyntaxList<StructurePatternMemberSyntax> members;
+    Token closeBrace;
+};
+
+struct StructuredAssignmentPatternSyntaxLayout : public AssignmentPatternSyntaxLayout {
+    Token openBrace;
+    SeparatedSyntaxList<AssignmentPatternItemSyntax> items;
+    Token closeBrace;
+};
+
+struct TaggedPatternSyntaxLayout : public PatternSyntaxLayout {
+    Token tagged;
+    Token memberName;
+    PatternSyntax* pattern;
+};
+
+struct TaggedUnionExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    Token tagged;
+    Token member;
+    ExpressionSyntax* expr;
+};
+
+struct TimeUnitsDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    Token keyword;
+    Token time;
+    DividerClauseSyntax* divider;
+    Token semi;
+};
+
+struct TimescaleDirectiveSyntaxLayout : public DirectiveSyntaxLayout {
+    Token timeUnit;
+    Token timeUnitUnit;
+    Token slash;
+    Token timePrecision;
+    Token timePrecisionUnit;
+    Token endOfDirective;
+};
+
+struct TimingControlExpressionConcatenationSyntaxLayout : public ExpressionSyntaxLayout {
+    ExpressionSyntax* left;
+    TimingControlSyntax* timing;
+    ExpressionSyntax* right;
+};
+
+struct TimingControlExpressionSyntaxLayout : public ExpressionSyntaxLayout {
+    TimingControlSyntax* timing;
+    ExpressionSyntax* expr;
+};
+
+struct TimingControlStatementSyntaxLayout : public StatementSyntaxLayout {
+    TimingControlSyntax* timingControl;
+    StatementSyntax* statement;
+};
+
+struct TransListCoverageBinInitializerSyntaxLayout : public CoverageBinInitializerSyntaxLayout {
+    SeparatedSyntaxList<TransSetSyntax> sets;
+    WithClauseSyntax* withClause;
+};
+
+struct TransRangeSyntaxLayout : public SyntaxNode {
+    SeparatedSyntaxList<ExpressionSyntax> items;
+    TransRepeatRangeSyntax* repeat;
+};
+
+struct TransRepeatRangeSyntaxLayout : public SyntaxNode {
+    Token openBracket;
+    Token specifier;
+    SelectorSyntax* selector;
+    Token closeBracket;
+};
+
+struct TransSetSyntaxLayout : public SyntaxNode {
+    Token openParen;
+    SeparatedSyntaxList<TransRangeSyntax> ranges;
+    Token closeParen;
+};
+
+struct TypeReferenceSyntaxLayout : public DataTypeSyntaxLayout {
+    Token typeKeyword;
+    Token openParen;
+    ExpressionSyntax* expr;
+    Token closeParen;
+};
+
+struct TypedefDeclarationSyntaxLayout : public MemberSyntaxLayout {
+    Token typedefKeyword;
+    DataTypeSyntax* type;
+    Token name;
+    SyntaxList<VariableDimensionSyntax> dimensions;
+    Token semi;
+};
+
+struct UnconditionalBranchDirectiveSyntaxLayout : public DirectiveSyntaxLayout {
+    Token endOfDirective;
+    TokenList disabledTokens;
+};
+
+struct UndefDirectiveSyntaxLayout : public DirectiveSyntaxLayout {
+    Token name;
+    Token endOfDirective;
+};
+
+struct UniquenessConstraintSyntaxLayout : public ConstraintItemSyntaxLayout {
+    Token unique;
+    OpenRangeListSyntax* ranges;
+    Token semi;
+};
+
+struct VarDataTypeSyntaxLayout : public DataTypeSyntaxLayout {
+    Token var;
+    DataTypeSyntax* type;
+};
+
+struct VariableDeclaratorSyntaxLayout : public SyntaxNode {
+    Token name;
+    SyntaxList<VariableDimensionSyntax> dimensions;
+    EqualsValueClauseSyntax* initializer;
+};
+
+struct VariableDimensionSyntaxLayout : public SyntaxNode {
+    Token openBracket;
+    DimensionSpecifierSyntax* specifier;
+    Token closeBracket;
+};
+
+struct VariablePatternSyntaxLayout : public PatternSyntaxLayout {
+    Token dot;
+    Token variableName;
+};
+
+struct VariablePortHeaderSyntaxLayout : public PortHeaderSyntaxLayout {
+    Token direction;
+    Token varKeyword;
+    DataTypeSyntax* dataType;
+};
+
+struct VirtualInterfaceTypeSyntaxLayout : public DataTypeSyntaxLayout {
+    Token virtualKeyword;
+    Token interfaceKeyword;
+    Token name;
+    ParameterValueAssignmentSyntax* parameters;
+    DotMemberClauseSyntax* modport;
+};
+
+struct WaitForkStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token wait;
+    Token fork;
+    Token semi;
+};
+
+struct WaitOrderStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token wait_order;
+    Token openParen;
+    SeparatedSyntaxList<NameSyntax> names;
+    Token closeParen;
+    ActionBlockSyntax* action;
+};
+
+struct WaitStatementSyntaxLayout : public StatementSyntaxLayout {
+    Token wait;
+    Token openParen;
+    ExpressionSyntax* expr;
+    Token closeParen;
+    StatementSyntax* statement;
+};
+
+struct WildcardDimensionSpecifierSyntaxLayout : public DimensionSpecifierSyntaxLayout {
+    Token star;
+};
+
+struct WildcardPatternSyntaxLayout : public PatternSyntaxLayout {
+    Token dotStar;
+};
+
+struct WildcardPortConnectionSyntaxLayout : public PortConnectionSyntaxLayout {
+    Token dotStar;
+};
+
+struct WildcardPortListSyntaxLayout : public PortListSyntaxLayout {
+    Token openParen;
+    Token dotStar;
+    Token closeParen;
+};
+
+struct WithClauseSyntaxLayout : public ExpressionSyntaxLayout {
+    Token with;
+    Token openParen;
+    ExpressionSyntax* expr;
+    Token closeParen;
+};
+
+struct WithFunctionSampleSyntaxLayout : public SyntaxNode {
+    Token with;
+    Token function;
+    Token sample;
+    AnsiPortListSyntax* portList;
+};
+
+static_assert(sizeof(ActionBlockSyntaxLayout) == sizeof(ActionBlockSyntax));
+static_assert(offsetof(ActionBlockSyntaxLayout, statement) == offsetof(ActionBlockSyntax, statement));
+static_assert(offsetof(ActionBlockSyntaxLayout, elseClause) == offsetof(ActionBlockSyntax, elseClause));
+static_assert(sizeof(AnsiPortListSyntaxLayout) == sizeof(AnsiPortListSyntax));
+static_assert(offsetof(AnsiPortListSyntaxLayout, openParen) == offsetof(AnsiPortListSyntax, openParen));
+static_assert(offsetof(AnsiPortListSyntaxLayout, ports) == offsetof(AnsiPortListSyntax, ports));
+static_assert(offsetof(AnsiPortListSyntaxLayout, closeParen) == offsetof(AnsiPortListSyntax, closeParen));
+static_assert(sizeof(ArgumentListSyntaxLayout) == sizeof(ArgumentListSyntax));
+static_assert(offsetof(ArgumentListSyntaxLayout, openParen) == offsetof(ArgumentListSyntax, openParen));
+static_assert(offsetof(ArgumentListSyntaxLayout, parameters) == offsetof(ArgumentListSyntax, parameters));
+static_assert(offsetof(ArgumentListSyntaxLayout, closeParen) == offsetof(ArgumentListSyntax, closeParen));
+static_assert(sizeof(AssertionItemPortListSyntaxLayout) == sizeof(AssertionItemPortListSyntax));
+static_assert(offsetof(AssertionItemPortListSyntaxLayout, openParen) == offsetof(AssertionItemPortListSyntax, openParen));
+static_assert(offsetof(AssertionItemPortListSyntaxLayout, ports) == offsetof(AssertionItemPortListSyntax, ports));
+static_assert(offsetof(AssertionItemPortListSyntaxLayout, closeParen) == offsetof(AssertionItemPortListSyntax, closeParen));
+static_assert(sizeof(AssertionItemPortSyntaxLayout) == sizeof(AssertionItemPortSyntax));
+static_assert(offsetof(AssertionItemPortSyntaxLayout, attributes) == offsetof(AssertionItemPortSyntax, attributes));
+static_assert(offsetof(AssertionItemPortSyntaxLayout, local) == offsetof(AssertionItemPortSyntax, local));
+static_assert(offsetof(AssertionItemPortSyntaxLayout, direction) == offsetof(AssertionItemPortSyntax, direction));
+static_assert(sizeof(AssignmentPatternExpressionSyntaxLayout) == sizeof(AssignmentPatternExpressionSyntax));
+static_assert(offsetof(AssignmentPatternExpressionSyntaxLayout, type) == offsetof(AssignmentPatternExpressionSyntax, type));
+static_assert(sizeof(AssignmentPatternItemSyntaxLayout) == sizeof(AssignmentPatternItemSyntax));
+static_assert(offsetof(AssignmentPatternItemSyntaxLayout, colon) == offsetof(AssignmentPatternItemSyntax, colon));
+static_assert(sizeof(AttributeInstanceSyntaxLayout) == sizeof(AttributeInstanceSyntax));
+static_assert(offsetof(AttributeInstanceSyntaxLayout, openParen) == offsetof(AttributeInstanceSyntax, openParen));
+static_assert(offsetof(AttributeInstanceSyntaxLayout, specs) == offsetof(AttributeInstanceSyntax, specs));
+static_assert(offsetof(AttributeInstanceSyntaxLayout, closeParen) == offsetof(AttributeInstanceSyntax, closeParen));
+static_assert(sizeof(AttributeSpecSyntaxLayout) == sizeof(AttributeSpecSyntax));
+static_assert(offsetof(AttributeSpecSyntaxLayout, name) == offsetof(AttributeSpecSyntax, name));
+static_assert(offsetof(AttributeSpecSyntaxLayout, value) == offsetof(AttributeSpecSyntax, value));
+static_assert(sizeof(BadExpressionSyntaxLayout) == sizeof(BadExpressionSyntax));
+static_assert(sizeof(BeginKeywordsDirectiveSyntaxLayout) == sizeof(BeginKeywordsDirectiveSyntax));
+static_assert(offsetof(BeginKeywordsDirectiveSyntaxLayout, directive) == offsetof(BeginKeywordsDirectiveSyntax, directive));
+static_assert(offsetof(BeginKeywordsDirectiveSyntaxLayout, versionSpecifier) == offsetof(BeginKeywordsDirectiveSyntax, versionSpecifier));
+static_assert(offsetof(BeginKeywordsDirectiveSyntaxLayout, endOfDirective) == offsetof(BeginKeywordsDirectiveSyntax, endOfDirective));
+static_assert(sizeof(BinaryBlockEventExpressionSyntaxLayout) == sizeof(BinaryBlockEventExpressionSyntax));
+static_assert(offsetof(BinaryBlockEventExpressionSyntaxLayout, orKeyword) == offsetof(BinaryBlockEventExpressionSyntax, orKeyword));
+static_assert(sizeof(BinaryEventExpressionSyntaxLayout) == sizeof(BinaryEventExpressionSyntax));
+static_assert(offsetof(BinaryEventExpressionSyntaxLayout, operatorToken) == offsetof(BinaryEventExpressionSyntax, operatorToken));
+static_assert(sizeof(BinaryExpressionSyntaxLayout) == sizeof(BinaryExpressionSyntax));
+static_assert(offsetof(BinaryExpressionSyntaxLayout, operatorToken) == offsetof(BinaryExpressionSyntax, operatorToken));
+static_assert(offsetof(BinaryExpressionSyntaxLayout, attributes) == offsetof(BinaryExpressionSyntax, attributes));
+static_assert(sizeof(BitSelectSyntaxLayout) == sizeof(BitSelectSyntax));
+static_assert(sizeof(BlockCoverageEventSyntaxLayout) == sizeof(BlockCoverageEventSyntax));
+static_assert(offsetof(BlockCoverageEventSyntaxLayout, atat) == offsetof(BlockCoverageEventSyntax, atat));
+static_assert(offsetof(BlockCoverageEventSyntaxLayout, openParen) == offsetof(BlockCoverageEventSyntax, openParen));
+static_assert(offsetof(BlockCoverageEventSyntaxLayout, closeParen) == offsetof(BlockCoverageEventSyntax, closeParen));
+static_assert(sizeof(BlockStatementSyntaxLayout) == sizeof(BlockStatementSyntax));
+static_assert(offsetof(BlockStatementSyntaxLayout, label) == offsetof(BlockStatementSyntax, label));
+static_assert(offsetof(BlockStatementSyntaxLayout, attributes) == offsetof(BlockStatementSyntax, attributes));
+static_assert(offsetof(BlockStatementSyntaxLayout, begin) == offsetof(BlockStatementSyntax, begin));
+static_assert(offsetof(BlockStatementSyntaxLayout, blockName) == offsetof(BlockStatementSyntax, blockName));
+static_assert(offsetof(BlockStatementSyntaxLayout, items) == offsetof(BlockStatementSyntax, items));
+static_assert(offsetof(BlockStatementSyntaxLayout, end) == offsetof(BlockStatementSyntax, end));
+static_assert(offsetof(BlockStatementSyntaxLayout, endBlockName) == offsetof(BlockStatementSyntax, endBlockName));
+static_assert(sizeof(CaseGenerateSyntaxLayout) == sizeof(CaseGenerateSyntax));
+static_assert(offsetof(CaseGenerateSyntaxLayout, attributes) == offsetof(CaseGenerateSyntax, attributes));
+static_assert(offsetof(CaseGenerateSyntaxLayout, keyword) == offsetof(CaseGenerateSyntax, keyword));
+static_assert(offsetof(CaseGenerateSyntaxLayout, openParen) == offsetof(CaseGenerateSyntax, openParen));
+static_assert(offsetof(CaseGenerateSyntaxLayout, closeParen) == offsetof(CaseGenerateSyntax, closeParen));
+static_assert(offsetof(CaseGenerateSyntaxLayout, items) == offsetof(CaseGenerateSyntax, items));
+static_assert(offsetof(CaseGenerateSyntaxLayout, endCase) == offsetof(CaseGenerateSyntax, endCase));
+static_assert(sizeof(CaseStatementSyntaxLayout) == sizeof(CaseStatementSyntax));
+static_assert(offsetof(CaseStatementSyntaxLayout, label) == offsetof(CaseStatementSyntax, label));
+static_assert(offsetof(CaseStatementSyntaxLayout, attributes) == offsetof(CaseStatementSyntax, attributes));
+static_assert(offsetof(CaseStatementSyntaxLayout, uniqueOrPriority) == offsetof(CaseStatementSyntax, uniqueOrPriority));
+static_assert(offsetof(CaseStatementSyntaxLayout, caseKeyword) == offsetof(CaseStatementSyntax, caseKeyword));
+static_assert(offsetof(CaseStatementSyntaxLayout, openParen) == offsetof(CaseStatementSyntax, openParen));
+static_assert(offsetof(CaseStatementSyntaxLayout, closeParen) == offsetof(CaseStatementSyntax, closeParen));
+static_assert(offsetof(CaseStatementSyntaxLayout, matchesOrInside) == offsetof(CaseStatementSyntax, matchesOrInside));
+static_assert(offsetof(CaseStatementSyntaxLayout, items) == offsetof(CaseStatementSyntax, items));
+static_assert(offsetof(CaseStatementSyntaxLayout, endcase) == offsetof(CaseStatementSyntax, endcase));
+static_assert(sizeof(CastExpressionSyntaxLayout) == sizeof(CastExpressionSyntax));
+static_assert(offsetof(CastExpressionSyntaxLayout, apostrophe) == offsetof(CastExpressionSyntax, apostrophe));
+static_assert(sizeof(ChargeStrengthSyntaxLayout) == sizeof(ChargeStrengthSyntax));
+static_assert(offsetof(ChargeStrengthSyntaxLayout, openParen) == offsetof(ChargeStrengthSyntax, openParen));
+static_assert(offsetof(ChargeStrengthSyntaxLayout, strength) == offsetof(ChargeStrengthSyntax, strength));
+static_assert(offsetof(ChargeStrengthSyntaxLayout, closeParen) == offsetof(ChargeStrengthSyntax, closeParen));
+static_assert(sizeof(ClassDeclarationSyntaxLayout) == sizeof(ClassDeclarationSyntax));
+static_assert(offsetof(ClassDeclarationSyntaxLayout, attributes) == offsetof(ClassDeclarationSyntax, attributes));
+static_assert(offsetof(ClassDeclarationSyntaxLayout, virtualOrInterface) == offsetof(ClassDeclarationSyntax, virtualOrInterface));
+static_assert(offsetof(ClassDeclarationSyntaxLayout, classKeyword) == offsetof(ClassDeclarationSyntax, classKeyword));
+static_assert(offsetof(ClassDeclarationSyntaxLayout, lifetime) == offsetof(ClassDeclarationSyntax, lifetime));
+static_assert(offsetof(ClassDeclarationSyntaxLayout, name) == offsetof(ClassDeclarationSyntax, name));
+static_assert(offsetof(ClassDeclarationSyntaxLayout, parameters) == offsetof(ClassDeclarationSyntax, parameters));
+static_assert(offsetof(ClassDeclarationSyntaxLayout, extendsClause) == offsetof(ClassDeclarationSyntax, extendsClause));
+static_assert(offsetof(ClassDeclarationSyntaxLayout, implementsClause) == offsetof(ClassDeclarationSyntax, implementsClause));
+static_assert(offsetof(ClassDeclarationSyntaxLayout, semi) == offsetof(ClassDeclarationSyntax, semi));
+static_assert(offsetof(ClassDeclarationSyntaxLayout, items) == offsetof(ClassDeclarationSyntax, items));
+static_assert(offsetof(ClassDeclarationSyntaxLayout, endClass) == offsetof(ClassDeclarationSyntax, endClass));
+static_assert(offsetof(ClassDeclarationSyntaxLayout, endBlockName) == offsetof(ClassDeclarationSyntax, endBlockName));
+static_assert(sizeof(ClassMethodDeclarationSyntaxLayout) == sizeof(ClassMethodDeclarationSyntax));
+static_assert(offsetof(ClassMethodDeclarationSyntaxLayout, attributes) == offsetof(ClassMethodDeclarationSyntax, attributes));
+static_assert(offsetof(ClassMethodDeclarationSyntaxLayout, qualifiers) == offsetof(ClassMethodDeclarationSyntax, qualifiers));
+static_assert(sizeof(ClassMethodPrototypeSyntaxLayout) == sizeof(ClassMethodPrototypeSyntax));
+static_assert(offsetof(ClassMethodPrototypeSyntaxLayout, attributes) == offsetof(ClassMethodPrototypeSyntax, attributes));
+static_assert(offsetof(ClassMethodPrototypeSyntaxLayout, qualifiers) == offsetof(ClassMethodPrototypeSyntax, qualifiers));
+static_assert(offsetof(ClassMethodPrototypeSyntaxLayout, semi) == offsetof(ClassMethodPrototypeSyntax, semi));
+static_assert(sizeof(ClassNameSyntaxLayout) == sizeof(ClassNameSyntax));
+static_assert(offsetof(ClassNameSyntaxLayout, identifier) == offsetof(ClassNameSyntax, identifier));
+static_assert(sizeof(ClassPropertyDeclarationSyntaxLayout) == sizeof(ClassPropertyDeclarationSyntax));
+static_assert(offsetof(ClassPropertyDeclarationSyntaxLayout, attributes) == offsetof(ClassPropertyDeclarationSyntax, attributes));
+static_assert(offsetof(ClassPropertyDeclarationSyntaxLayout, qualifiers) == offsetof(ClassPropertyDeclarationSyntax, qualifiers));
+static_assert(sizeof(ClassScopeSyntaxLayout) == sizeof(ClassScopeSyntax));
+static_assert(offsetof(ClassScopeSyntaxLayout, separator) == offsetof(ClassScopeSyntax, separator));
+static_assert(sizeof(ClockingDeclarationSyntaxLayout) == sizeof(ClockingDeclarationSyntax));
+static_assert(offsetof(ClockingDeclarationSyntaxLayout, attributes) == offsetof(ClockingDeclarationSyntax, attributes));
+static_assert(offsetof(ClockingDeclarationSyntaxLayout, globalOrDefault) == offsetof(ClockingDeclarationSyntax, globalOrDefault));
+static_assert(offsetof(ClockingDeclarationSyntaxLayout, clocking) == offsetof(ClockingDeclarationSyntax, clocking));
+static_assert(offsetof(ClockingDeclarationSyntaxLayout, blockName) == offsetof(ClockingDeclarationSyntax, blockName));
+static_assert(offsetof(ClockingDeclarationSyntaxLayout, at) == offsetof(ClockingDeclarationSyntax, at));
+static_assert(offsetof(ClockingDeclarationSyntaxLayout, event) == offsetof(ClockingDeclarationSyntax, event));
+static_assert(offsetof(ClockingDeclarationSyntaxLayout, eventIdentifier) == offsetof(ClockingDeclarationSyntax, eventIdentifier));
+static_assert(offsetof(ClockingDeclarationSyntaxLayout, semi) == offsetof(ClockingDeclarationSyntax, semi));
+static_assert(offsetof(ClockingDeclarationSyntaxLayout, items) == offsetof(ClockingDeclarationSyntax, items));
+static_assert(offsetof(ClockingDeclarationSyntaxLayout, endClocking) == offsetof(ClockingDeclarationSyntax, endClocking));
+static_assert(offsetof(ClockingDeclarationSyntaxLayout, endBlockName) == offsetof(ClockingDeclarationSyntax, endBlockName));
+static_assert(sizeof(ClockingDirectionSyntaxLayout) == sizeof(ClockingDirectionSyntax));
+static_assert(offsetof(ClockingDirectionSyntaxLayout, input) == offsetof(ClockingDirectionSyntax, input));
+static_assert(offsetof(ClockingDirectionSyntaxLayout, inputSkew) == offsetof(ClockingDirectionSyntax, inputSkew));
+static_assert(offsetof(ClockingDirectionSyntaxLayout, output) == offsetof(ClockingDirectionSyntax, output));
+static_assert(offsetof(ClockingDirectionSyntaxLayout, ouputSkew) == offsetof(ClockingDirectionSyntax, ouputSkew));
+static_assert(offsetof(ClockingDirectionSyntaxLayout, inout) == offsetof(ClockingDirectionSyntax, inout));
+static_assert(sizeof(ClockingItemSyntaxLayout) == sizeof(ClockingItemSyntax));
+static_assert(offsetof(ClockingItemSyntaxLayout, defaultKeyword) == offsetof(ClockingItemSyntax, defaultKeyword));
+static_assert(offsetof(ClockingItemSyntaxLayout, direction) == offsetof(ClockingItemSyntax, direction));
+static_assert(offsetof(ClockingItemSyntaxLayout, assignments) == offsetof(ClockingItemSyntax, assignments));
+static_assert(offsetof(ClockingItemSyntaxLayout, semi) == offsetof(ClockingItemSyntax, semi));
+static_assert(offsetof(ClockingItemSyntaxLayout, declaration) == offsetof(ClockingItemSyntax, declaration));
+static_assert(sizeof(ClockingSkewSyntaxLayout) == sizeof(ClockingSkewSyntax));
+static_assert(offsetof(ClockingSkewSyntaxLayout, edge) == offsetof(ClockingSkewSyntax, edge));
+static_assert(offsetof(ClockingSkewSyntaxLayout, hash) == offsetof(ClockingSkewSyntax, hash));
+static_assert(offsetof(ClockingSkewSyntaxLayout, value) == offsetof(ClockingSkewSyntax, value));
+static_assert(sizeof(ColonExpressionClauseSyntaxLayout) == sizeof(ColonExpressionClauseSyntax));
+static_assert(offsetof(ColonExpressionClauseSyntaxLayout, colon) == offsetof(ColonExpressionClauseSyntax, colon));
+static_assert(sizeof(CompilationUnitSyntaxLayout) == sizeof(CompilationUnitSyntax));
+static_assert(offsetof(CompilationUnitSyntaxLayout, members) == offsetof(CompilationUnitSyntax, members));
+static_assert(offsetof(CompilationUnitSyntaxLayout, endOfFile) == offsetof(CompilationUnitSyntax, endOfFile));
+static_assert(sizeof(ConcatenationExpressionSyntaxLayout) == sizeof(ConcatenationExpressionSyntax));
+static_assert(offsetof(ConcatenationExpressionSyntaxLayout, openBrace) == offsetof(ConcatenationExpressionSyntax, openBrace));
+static_assert(offsetof(ConcatenationExpressionSyntaxLayout, expressions) == offsetof(ConcatenationExpressionSyntax, expressions));
+static_assert(offsetof(ConcatenationExpressionSyntaxLayout, closeBrace) == offsetof(ConcatenationExpressionSyntax, closeBrace));
+static_assert(sizeof(ConcurrentAssertionMemberSyntaxLayout) == sizeof(ConcurrentAssertionMemberSyntax));
+static_assert(offsetof(ConcurrentAssertionMemberSyntaxLayout, attributes) == offsetof(ConcurrentAssertionMemberSyntax, attributes));
+static_assert(sizeof(ConcurrentAssertionStatementSyntaxLayout) == sizeof(ConcurrentAssertionStatementSyntax));
+static_assert(offsetof(ConcurrentAssertionStatementSyntaxLayout, label) == offsetof(ConcurrentAssertionStatementSyntax, label));
+static_assert(offsetof(ConcurrentAssertionStatementSyntaxLayout, attributes) == offsetof(ConcurrentAssertionStatementSyntax, attributes));
+static_assert(offsetof(ConcurrentAssertionStatementSyntaxLayout, keyword) == offsetof(ConcurrentAssertionStatementSyntax, keyword));
+static_assert(offsetof(ConcurrentAssertionStatementSyntaxLayout, propertyOrSequence) == offsetof(ConcurrentAssertionStatementSyntax, propertyOrSequence));
+static_assert(offsetof(ConcurrentAssertionStatementSyntaxLayout, openParen) == offsetof(ConcurrentAssertionStatementSyntax, openParen));
+static_assert(offsetof(ConcurrentAssertionStatementSyntaxLayout, closeParen) == offsetof(ConcurrentAssertionStatementSyntax, closeParen));
+static_assert(sizeof(ConditionalBranchDirectiveSyntaxLayout) == sizeof(ConditionalBranchDirectiveSyntax));
+static_assert(offsetof(ConditionalBranchDirectiveSyntaxLayout, directive) == offsetof(ConditionalBranchDirectiveSyntax, directive));
+static_assert(offsetof(ConditionalBranchDirectiveSyntaxLayout, name) == offsetof(ConditionalBranchDirectiveSyntax, name));
+static_assert(offsetof(ConditionalBranchDirectiveSyntaxLayout, endOfDirective) == offsetof(ConditionalBranchDirectiveSyntax, endOfDirective));
+static_assert(offsetof(ConditionalBranchDirectiveSyntaxLayout, disabledTokens) == offsetof(ConditionalBranchDirectiveSyntax, disabledTokens));
+static_assert(sizeof(ConditionalConstraintSyntaxLayout) == sizeof(ConditionalConstraintSyntax));
+static_assert(offsetof(ConditionalConstraintSyntaxLayout, ifKeyword) == offsetof(ConditionalConstraintSyntax, ifKeyword));
+static_assert(offsetof(ConditionalConstraintSyntaxLayout, openParen) == offsetof(ConditionalConstraintSyntax, openParen));
+static_assert(offsetof(ConditionalConstraintSyntaxLayout, closeParen) == offsetof(ConditionalConstraintSyntax, closeParen));
+static_assert(offsetof(ConditionalConstraintSyntaxLayout, elseClause) == offsetof(ConditionalConstraintSyntax, elseClause));
+static_assert(sizeof(ConditionalExpressionSyntaxLayout) == sizeof(ConditionalExpressionSyntax));
+static_assert(offsetof(ConditionalExpressionSyntaxLayout, question) == offsetof(ConditionalExpressionSyntax, question));
+static_assert(offsetof(ConditionalExpressionSyntaxLayout, attributes) == offsetof(ConditionalExpressionSyntax, attributes));
+static_assert(offsetof(ConditionalExpressionSyntaxLayout, colon) == offsetof(ConditionalExpressionSyntax, colon));
+static_assert(sizeof(ConditionalPatternSyntaxLayout) == sizeof(ConditionalPatternSyntax));
+static_assert(offsetof(ConditionalPatternSyntaxLayout, matchesClause) == offsetof(ConditionalPatternSyntax, matchesClause));
+static_assert(sizeof(ConditionalPredicateSyntaxLayout) == sizeof(ConditionalPredicateSyntax));
+static_assert(offsetof(ConditionalPredicateSyntaxLayout, conditions) == offsetof(ConditionalPredicateSyntax, conditions));
+static_assert(sizeof(ConditionalStatementSyntaxLayout) == sizeof(ConditionalStatementSyntax));
+static_assert(offsetof(ConditionalStatementSyntaxLayout, label) == offsetof(ConditionalStatementSyntax, label));
+static_assert(offsetof(ConditionalStatementSyntaxLayout, attributes) == offsetof(ConditionalStatementSyntax, attributes));
+static_assert(offsetof(ConditionalStatementSyntaxLayout, uniqueOrPriority) == offsetof(ConditionalStatementSyntax, uniqueOrPriority));
+static_assert(offsetof(ConditionalStatementSyntaxLayout, ifKeyword) == offsetof(ConditionalStatementSyntax, ifKeyword));
+static_assert(offsetof(ConditionalStatementSyntaxLayout, openParen) == offsetof(ConditionalStatementSyntax, openParen));
+static_assert(offsetof(ConditionalStatementSyntaxLayout, closeParen) == offsetof(ConditionalStatementSyntax, closeParen));
+static_assert(offsetof(ConditionalStatementSyntaxLayout, elseClause) == offsetof(ConditionalStatementSyntax, elseClause));
+static_assert(sizeof(ConstraintBlockSyntaxLayout) == sizeof(ConstraintBlockSyntax));
+static_assert(offsetof(ConstraintBlockSyntaxLayout, openBrace) == offsetof(ConstraintBlockSyntax, openBrace));
+static_assert(offsetof(ConstraintBlockSyntaxLayout, items) == offsetof(ConstraintBlockSyntax, items));
+static_assert(offsetof(ConstraintBlockSyntaxLayout, closeBrace) == offsetof(ConstraintBlockSyntax, closeBrace));
+static_assert(sizeof(ConstraintDeclarationSyntaxLayout) == sizeof(ConstraintDeclarationSyntax));
+static_assert(offsetof(ConstraintDeclarationSyntaxLayout, attributes) == offsetof(ConstraintDeclarationSyntax, attributes));
+static_assert(offsetof(ConstraintDeclarationSyntaxLayout, qualifiers) == offsetof(ConstraintDeclarationSyntax, qualifiers));
+static_assert(offsetof(ConstraintDeclarationSyntaxLayout, keyword) == offsetof(ConstraintDeclarationSyntax, keyword));
+static_assert(offsetof(ConstraintDeclarationSyntaxLayout, name) == offsetof(ConstraintDeclarationSyntax, name));
+static_assert(sizeof(ConstraintPrototypeSyntaxLayout) == sizeof(ConstraintPrototypeSyntax));
+static_assert(offsetof(ConstraintPrototypeSyntaxLayout, attributes) == offsetof(ConstraintPrototypeSyntax, attributes));
+static_assert(offsetof(ConstraintPrototypeSyntaxLayout, qualifiers) == offsetof(ConstraintPrototypeSyntax, qualifiers));
+static_assert(offsetof(ConstraintPrototypeSyntaxLayout, keyword) == offsetof(ConstraintPrototypeSyntax, keyword));
+static_assert(offsetof(ConstraintPrototypeSyntaxLayout, name) == offsetof(ConstraintPrototypeSyntax, name));
+static_assert(offsetof(ConstraintPrototypeSyntaxLayout, semi) == offsetof(ConstraintPrototypeSyntax, semi));
+static_assert(sizeof(ContinuousAssignSyntaxLayout) == sizeof(ContinuousAssignSyntax));
+static_assert(offsetof(ContinuousAssignSyntaxLayout, attributes) == offsetof(ContinuousAssignSyntax, attributes));
+static_assert(offsetof(ContinuousAssignSyntaxLayout, assign) == offsetof(ContinuousAssignSyntax, assign));
+static_assert(offsetof(ContinuousAssignSyntaxLayout, assignments) == offsetof(ContinuousAssignSyntax, assignments));
+static_assert(offsetof(ContinuousAssignSyntaxLayout, semi) == offsetof(ContinuousAssignSyntax, semi));
+static_assert(sizeof(CoverageBinsSyntaxLayout) == sizeof(CoverageBinsSyntax));
+static_assert(offsetof(CoverageBinsSyntaxLayout, attributes) == offsetof(CoverageBinsSyntax, attributes));
+static_assert(offsetof(CoverageBinsSyntaxLayout, wildcard) == offsetof(CoverageBinsSyntax, wildcard));
+static_assert(offsetof(CoverageBinsSyntaxLayout, keyword) == offsetof(CoverageBinsSyntax, keyword));
+static_assert(offsetof(CoverageBinsSyntaxLayout, name) == offsetof(CoverageBinsSyntax, name));
+static_assert(offsetof(CoverageBinsSyntaxLayout, selector) == offsetof(CoverageBinsSyntax, selector));
+static_assert(offsetof(CoverageBinsSyntaxLayout, equals) == offsetof(CoverageBinsSyntax, equals));
+static_assert(offsetof(CoverageBinsSyntaxLayout, iff) == offsetof(CoverageBinsSyntax, iff));
+static_assert(offsetof(CoverageBinsSyntaxLayout, semi) == offsetof(CoverageBinsSyntax, semi));
+static_assert(sizeof(CoverageOptionSyntaxLayout) == sizeof(CoverageOptionSyntax));
+static_assert(offsetof(CoverageOptionSyntaxLayout, attributes) == offsetof(CoverageOptionSyntax, attributes));
+static_assert(offsetof(CoverageOptionSyntaxLayout, option) == offsetof(CoverageOptionSyntax, option));
+static_assert(offsetof(CoverageOptionSyntaxLayout, dot) == offsetof(CoverageOptionSyntax, dot));
+static_assert(offsetof(CoverageOptionSyntaxLayout, name) == offsetof(CoverageOptionSyntax, name));
+static_assert(offsetof(CoverageOptionSyntaxLayout, equals) == offsetof(CoverageOptionSyntax, equals));
+static_assert(offsetof(CoverageOptionSyntaxLayout, semi) == offsetof(CoverageOptionSyntax, semi));
+static_assert(sizeof(CovergroupDeclarationSyntaxLayout) == sizeof(CovergroupDeclarationSyntax));
+static_assert(offsetof(CovergroupDeclarationSyntaxLayout, attributes) == offsetof(CovergroupDeclarationSyntax, attributes));
+static_assert(offsetof(CovergroupDeclarationSyntaxLayout, covergroup) == offsetof(CovergroupDeclarationSyntax, covergroup));
+static_assert(offsetof(CovergroupDeclarationSyntaxLayout, name) == offsetof(CovergroupDeclarationSyntax, name));
+static_assert(offsetof(CovergroupDeclarationSyntaxLayout, portList) == offsetof(CovergroupDeclarationSyntax, portList));
+static_assert(offsetof(CovergroupDeclarationSyntaxLayout, event) == offsetof(CovergroupDeclarationSyntax, event));
+static_assert(offsetof(CovergroupDeclarationSyntaxLayout, semi) == offsetof(CovergroupDeclarationSyntax, semi));
+static_assert(offsetof(CovergroupDeclarationSyntaxLayout, members) == offsetof(CovergroupDeclarationSyntax, members));
+static_assert(offsetof(CovergroupDeclarationSyntaxLayout, endgroup) == offsetof(CovergroupDeclarationSyntax, endgroup));
+static_assert(offsetof(CovergroupDeclarationSyntaxLayout, endBlockName) == offsetof(CovergroupDeclarationSyntax, endBlockName));
+static_assert(sizeof(CoverpointSyntaxLayout) == sizeof(CoverpointSyntax));
+static_assert(offsetof(CoverpointSyntaxLayout, attributes) == offsetof(CoverpointSyntax, attributes));
+static_assert(offsetof(CoverpointSyntaxLayout, type) == offsetof(CoverpointSyntax, type));
+static_assert(offsetof(CoverpointSyntaxLayout, label) == offsetof(CoverpointSyntax, label));
+static_assert(offsetof(CoverpointSyntaxLayout, coverpoint) == offsetof(CoverpointSyntax, coverpoint));
+static_assert(offsetof(CoverpointSyntaxLayout, openBrace) == offsetof(CoverpointSyntax, openBrace));
+static_assert(offsetof(CoverpointSyntaxLayout, members) == offsetof(CoverpointSyntax, members));
+static_assert(offsetof(CoverpointSyntaxLayout, closeBrace) == offsetof(CoverpointSyntax, closeBrace));
+static_assert(offsetof(CoverpointSyntaxLayout, emptySemi) == offsetof(CoverpointSyntax, emptySemi));
+static_assert(sizeof(DPIImportExportSyntaxLayout) == sizeof(DPIImportExportSyntax));
+static_assert(offsetof(DPIImportExportSyntaxLayout, attributes) == offsetof(DPIImportExportSyntax, attributes));
+static_assert(offsetof(DPIImportExportSyntaxLayout, keyword) == offsetof(DPIImportExportSyntax, keyword));
+static_assert(offsetof(DPIImportExportSyntaxLayout, stringLiteral) == offsetof(DPIImportExportSyntax, stringLiteral));
+static_assert(offsetof(DPIImportExportSyntaxLayout, property) == offsetof(DPIImportExportSyntax, property));
+static_assert(offsetof(DPIImportExportSyntaxLayout, name) == offsetof(DPIImportExportSyntax, name));
+static_assert(offsetof(DPIImportExportSyntaxLayout, equals) == offsetof(DPIImportExportSyntax, equals));
+static_assert(offsetof(DPIImportExportSyntaxLayout, semi) == offsetof(DPIImportExportSyntax, semi));
+static_assert(sizeof(DataDeclarationSyntaxLayout) == sizeof(DataDeclarationSyntax));
+static_assert(offsetof(DataDeclarationSyntaxLayout, attributes) == offsetof(DataDeclarationSyntax, attributes));
+static_assert(offsetof(DataDeclarationSyntaxLayout, modifiers) == offsetof(DataDeclarationSyntax, modifiers));
+static_assert(offsetof(DataDeclarationSyntaxLayout, declarators) == offsetof(DataDeclarationSyntax, declarators));
+static_assert(offsetof(DataDeclarationSyntaxLayout, semi) == offsetof(DataDeclarationSyntax, semi));
+static_assert(sizeof(DataTypeDimensionSpecifierSyntaxLayout) == sizeof(DataTypeDimensionSpecifierSyntax));
+static_assert(sizeof(DefParamAssignmentSyntaxLayout) == sizeof(DefParamAssignmentSyntax));
+static_assert(offsetof(DefParamAssignmentSyntaxLayout, setter) == offsetof(DefParamAssignmentSyntax, setter));
+static_assert(sizeof(DefParamSyntaxLayout) == sizeof(DefParamSyntax));
+static_assert(offsetof(DefParamSyntaxLayout, attributes) == offsetof(DefParamSyntax, attributes));
+static_assert(offsetof(DefParamSyntaxLayout, defparam) == offsetof(DefParamSyntax, defparam));
+static_assert(offsetof(DefParamSyntaxLayout, assignments) == offsetof(DefParamSyntax, assignments));
+static_assert(offsetof(DefParamSyntaxLayout, semi) == offsetof(DefParamSyntax, semi));
+static_assert(sizeof(DefaultCaseItemSyntaxLayout) == sizeof(DefaultCaseItemSyntax));
+static_assert(offsetof(DefaultCaseItemSyntaxLayout, defaultKeyword) == offsetof(DefaultCaseItemSyntax, defaultKeyword));
+static_assert(offsetof(DefaultCaseItemSyntaxLayout, colon) == offsetof(DefaultCaseItemSyntax, colon));
+static_assert(sizeof(DefaultCoverageBinInitializerSyntaxLayout) == sizeof(DefaultCoverageBinInitializerSyntax));
+static_assert(offsetof(DefaultCoverageBinInitializerSyntaxLayout, defaultKeyword) == offsetof(DefaultCoverageBinInitializerSyntax, defaultKeyword));
+static_assert(offsetof(DefaultCoverageBinInitializerSyntaxLayout, sequenceKeyword) == offsetof(DefaultCoverageBinInitializerSyntax, sequenceKeyword));
+static_assert(sizeof(DefaultNetTypeDirectiveSyntaxLayout) == sizeof(DefaultNetTypeDirectiveSyntax));
+static_assert(offsetof(DefaultNetTypeDirectiveSyntaxLayout, directive) == offsetof(DefaultNetTypeDirectiveSyntax, directive));
+static_assert(offsetof(DefaultNetTypeDirectiveSyntaxLayout, netType) == offsetof(DefaultNetTypeDirectiveSyntax, netType));
+static_assert(offsetof(DefaultNetTypeDirectiveSyntaxLayout, endOfDirective) == offsetof(DefaultNetTypeDirectiveSyntax, endOfDirective));
+static_assert(sizeof(DeferredAssertionSyntaxLayout) == sizeof(DeferredAssertionSyntax));
+static_assert(offsetof(DeferredAssertionSyntaxLayout, hash) == offsetof(DeferredAssertionSyntax, hash));
+static_assert(offsetof(DeferredAssertionSyntaxLayout, zero) == offsetof(DeferredAssertionSyntax, zero));
+static_assert(offsetof(DeferredAssertionSyntaxLayout, finalKeyword) == offsetof(DeferredAssertionSyntax, finalKeyword));
+static_assert(sizeof(DefineDirectiveSyntaxLayout) == sizeof(DefineDirectiveSyntax));
+static_assert(offsetof(DefineDirectiveSyntaxLayout, directive) == offsetof(DefineDirectiveSyntax, directive));
+static_assert(offsetof(DefineDirectiveSyntaxLayout, name) == offsetof(DefineDirectiveSyntax, name));
+static_assert(offsetof(DefineDirectiveSyntaxLayout, formalArguments) == offsetof(DefineDirectiveSyntax, formalArguments));
+static_assert(offsetof(DefineDirectiveSyntaxLayout, body) == offsetof(DefineDirectiveSyntax, body));
+static_assert(offsetof(DefineDirectiveSyntaxLayout, endOfDirective) == offsetof(DefineDirectiveSyntax, endOfDirective));
+static_assert(sizeof(DelaySyntaxLayout) == sizeof(DelaySyntax));
+static_assert(offsetof(DelaySyntaxLayout, hash) == offsetof(DelaySyntax, hash));
+static_assert(sizeof(DisableConstraintSyntaxLayout) == sizeof(DisableConstraintSyntax));
+static_assert(offsetof(DisableConstraintSyntaxLayout, disable) == offsetof(DisableConstraintSyntax, disable));
+static_assert(offsetof(DisableConstraintSyntaxLayout, soft) == offsetof(DisableConstraintSyntax, soft));
+static_assert(offsetof(DisableConstraintSyntaxLayout, semi) == offsetof(DisableConstraintSyntax, semi));
+static_assert(sizeof(DisableForkStatementSyntaxLayout) == sizeof(DisableForkStatementSyntax));
+static_assert(offsetof(DisableForkStatementSyntaxLayout, label) == offsetof(DisableForkStatementSyntax, label));
+static_assert(offsetof(DisableForkStatementSyntaxLayout, attributes) == offsetof(DisableForkStatementSyntax, attributes));
+static_assert(offsetof(DisableForkStatementSyntaxLayout, disable) == offsetof(DisableForkStatementSyntax, disable));
+static_assert(offsetof(DisableForkStatementSyntaxLayout, fork) == offsetof(DisableForkStatementSyntax, fork));
+static_assert(offsetof(DisableForkStatementSyntaxLayout, semi) == offsetof(DisableForkStatementSyntax, semi));
+static_assert(sizeof(DisableIffSyntaxLayout) == sizeof(DisableIffSyntax));
+static_assert(offsetof(DisableIffSyntaxLayout, disable) == offsetof(DisableIffSyntax, disable));
+static_assert(offsetof(DisableIffSyntaxLayout, iff) == offsetof(DisableIffSyntax, iff));
+static_assert(offsetof(DisableIffSyntaxLayout, openParen) == offsetof(DisableIffSyntax, openParen));
+static_assert(offsetof(DisableIffSyntaxLayout, closeParen) == offsetof(DisableIffSyntax, closeParen));
+static_assert(sizeof(DisableStatementSyntaxLayout) == sizeof(DisableStatementSyntax));
+static_assert(offsetof(DisableStatementSyntaxLayout, label) == offsetof(DisableStatementSyntax, label));
+static_assert(offsetof(DisableStatementSyntaxLayout, attributes) == offsetof(DisableStatementSyntax, attributes));
+static_assert(offsetof(DisableStatementSyntaxLayout, disable) == offsetof(DisableStatementSyntax, disable));
+static_assert(offsetof(DisableStatementSyntaxLayout, semi) == offsetof(DisableStatementSyntax, semi));
+static_assert(sizeof(DistConstraintListSyntaxLayout) == sizeof(DistConstraintListSyntax));
+static_assert(offsetof(DistConstraintListSyntaxLayout, dist) == offsetof(DistConstraintListSyntax, dist));
+static_assert(offsetof(DistConstraintListSyntaxLayout, openBrace) == offsetof(DistConstraintListSyntax, openBrace));
+static_assert(offsetof(DistConstraintListSyntaxLayout, items) == offsetof(DistConstraintListSyntax, items));
+static_assert(offsetof(DistConstraintListSyntaxLayout, closeBrace) == offsetof(DistConstraintListSyntax, closeBrace));
+static_assert(sizeof(DistItemSyntaxLayout) == sizeof(DistItemSyntax));
+static_assert(offsetof(DistItemSyntaxLayout, weight) == offsetof(DistItemSyntax, weight));
+static_assert(sizeof(DistWeightSyntaxLayout) == sizeof(DistWeightSyntax));
+static_assert(offsetof(DistWeightSyntaxLayout, op) == offsetof(DistWeightSyntax, op));
+static_assert(sizeof(DividerClauseSyntaxLayout) == sizeof(DividerClauseSyntax));
+static_assert(offsetof(DividerClauseSyntaxLayout, divide) == offsetof(DividerClauseSyntax, divide));
+static_assert(offsetof(DividerClauseSyntaxLayout, value) == offsetof(DividerClauseSyntax, value));
+static_assert(sizeof(DoWhileStatementSyntaxLayout) == sizeof(DoWhileStatementSyntax));
+static_assert(offsetof(DoWhileStatementSyntaxLayout, label) == offsetof(DoWhileStatementSyntax, label));
+static_assert(offsetof(DoWhileStatementSyntaxLayout, attributes) == offsetof(DoWhileStatementSyntax, attributes));
+static_assert(offsetof(DoWhileStatementSyntaxLayout, doKeyword) == offsetof(DoWhileStatementSyntax, doKeyword));
+static_assert(offsetof(DoWhileStatementSyntaxLayout, whileKeyword) == offsetof(DoWhileStatementSyntax, whileKeyword));
+static_assert(offsetof(DoWhileStatementSyntaxLayout, openParen) == offsetof(DoWhileStatementSyntax, openParen));
+static_assert(offsetof(DoWhileStatementSyntaxLayout, closeParen) == offsetof(DoWhileStatementSyntax, closeParen));
+static_assert(offsetof(DoWhileStatementSyntaxLayout, semi) == offsetof(DoWhileStatementSyntax, semi));
+static_assert(sizeof(DotMemberClauseSyntaxLayout) == sizeof(DotMemberClauseSyntax));
+static_assert(offsetof(DotMemberClauseSyntaxLayout, dot) == offsetof(DotMemberClauseSyntax, dot));
+static_assert(offsetof(DotMemberClauseSyntaxLayout, member) == offsetof(DotMemberClauseSyntax, member));
+static_assert(sizeof(DriveStrengthSyntaxLayout) == sizeof(DriveStrengthSyntax));
+static_assert(offsetof(DriveStrengthSyntaxLayout, openParen) == offsetof(DriveStrengthSyntax, openParen));
+static_assert(offsetof(DriveStrengthSyntaxLayout, strength0) == offsetof(DriveStrengthSyntax, strength0));
+static_assert(offsetof(DriveStrengthSyntaxLayout, comma) == offsetof(DriveStrengthSyntax, comma));
+static_assert(offsetof(DriveStrengthSyntaxLayout, strength1) == offsetof(DriveStrengthSyntax, strength1));
+static_assert(offsetof(DriveStrengthSyntaxLayout, closeParen) == offsetof(DriveStrengthSyntax, closeParen));
+static_assert(sizeof(ElementSelectExpressionSyntaxLayout) == sizeof(ElementSelectExpressionSyntax));
+static_assert(sizeof(ElementSelectSyntaxLayout) == sizeof(ElementSelectSyntax));
+static_assert(offsetof(ElementSelectSyntaxLayout, openBracket) == offsetof(ElementSelectSyntax, openBracket));
+static_assert(offsetof(ElementSelectSyntaxLayout, selector) == offsetof(ElementSelectSyntax, selector));
+static_assert(offsetof(ElementSelectSyntaxLayout, closeBracket) == offsetof(ElementSelectSyntax, closeBracket));
+static_assert(sizeof(ElseClauseSyntaxLayout) == sizeof(ElseClauseSyntax));
+static_assert(offsetof(ElseClauseSyntaxLayout, elseKeyword) == offsetof(ElseClauseSyntax, elseKeyword));
+static_assert(sizeof(ElseConstraintClauseSyntaxLayout) == sizeof(ElseConstraintClauseSyntax));
+static_assert(offsetof(ElseConstraintClauseSyntaxLayout, elseKeyword) == offsetof(ElseConstraintClauseSyntax, elseKeyword));
+static_assert(sizeof(EmptyMemberSyntaxLayout) == sizeof(EmptyMemberSyntax));
+static_assert(offsetof(EmptyMemberSyntaxLayout, attributes) == offsetof(EmptyMemberSyntax, attributes));
+static_assert(offsetof(EmptyMemberSyntaxLayout, qualifiers) == offsetof(EmptyMemberSyntax, qualifiers));
+static_assert(offsetof(EmptyMemberSyntaxLayout, semi) == offsetof(EmptyMemberSyntax, semi));
+static_assert(sizeof(EmptyQueueExpressionSyntaxLayout) == sizeof(EmptyQueueExpressionSyntax));
+static_assert(offsetof(EmptyQueueExpressionSyntaxLayout, openBrace) == offsetof(EmptyQueueExpressionSyntax, openBrace));
+static_assert(offsetof(EmptyQueueExpressionSyntaxLayout, closeBrace) == offsetof(EmptyQueueExpressionSyntax, closeBrace));
+static_assert(sizeof(EmptyStatementSyntaxLayout) == sizeof(EmptyStatementSyntax));
+static_assert(offsetof(EmptyStatementSyntaxLayout, label) == offsetof(EmptyStatementSyntax, label));
+static_assert(offsetof(EmptyStatementSyntaxLayout, attributes) == offsetof(EmptyStatementSyntax, attributes));
+static_assert(offsetof(EmptyStatementSyntaxLayout, semicolon) == offsetof(EmptyStatementSyntax, semicolon));
+static_assert(sizeof(EnumTypeSyntaxLayout) == sizeof(EnumTypeSyntax));
+static_assert(offsetof(EnumTypeSyntaxLayout, keyword) == offsetof(EnumTypeSyntax, keyword));
+static_assert(offsetof(EnumTypeSyntaxLayout, baseType) == offsetof(EnumTypeSyntax, baseType));
+static_assert(offsetof(EnumTypeSyntaxLayout, openBrace) == offsetof(EnumTypeSyntax, openBrace));
+static_assert(offsetof(EnumTypeSyntaxLayout, members) == offsetof(EnumTypeSyntax, members));
+static_assert(offsetof(EnumTypeSyntaxLayout, closeBrace) == offsetof(EnumTypeSyntax, closeBrace));
+static_assert(offsetof(EnumTypeSyntaxLayout, dimensions) == offsetof(EnumTypeSyntax, dimensions));
+static_assert(sizeof(EqualsValueClauseSyntaxLayout) == sizeof(EqualsValueClauseSyntax));
+static_assert(offsetof(EqualsValueClauseSyntaxLayout, equals) == offsetof(EqualsValueClauseSyntax, equals));
+static_assert(sizeof(EventControlSyntaxLayout) == sizeof(EventControlSyntax));
+static_assert(offsetof(EventControlSyntaxLayout, at) == offsetof(EventControlSyntax, at));
+static_assert(sizeof(EventControlWithExpressionSyntaxLayout) == sizeof(EventControlWithExpressionSyntax));
+static_assert(offsetof(EventControlWithExpressionSyntaxLayout, at) == offsetof(EventControlWithExpressionSyntax, at));
+static_assert(sizeof(EventTriggerStatementSyntaxLayout) == sizeof(EventTriggerStatementSyntax));
+static_assert(offsetof(EventTriggerStatementSyntaxLayout, label) == offsetof(EventTriggerStatementSyntax, label));
+static_assert(offsetof(EventTriggerStatementSyntaxLayout, attributes) == offsetof(EventTriggerStatementSyntax, attributes));
+static_assert(offsetof(EventTriggerStatementSyntaxLayout, trigger) == offsetof(EventTriggerStatementSyntax, trigger));
+static_assert(offsetof(EventTriggerStatementSyntaxLayout, timing) == offsetof(EventTriggerStatementSyntax, timing));
+static_assert(sizeof(ExplicitAnsiPortSyntaxLayout) == sizeof(ExplicitAnsiPortSyntax));
+static_assert(offsetof(ExplicitAnsiPortSyntaxLayout, attributes) == offsetof(ExplicitAnsiPortSyntax, attributes));
+static_assert(offsetof(ExplicitAnsiPortSyntaxLayout, direction) == offsetof(ExplicitAnsiPortSyntax, direction));
+static_assert(offsetof(ExplicitAnsiPortSyntaxLayout, dot) == offsetof(ExplicitAnsiPortSyntax, dot));
+static_assert(offsetof(ExplicitAnsiPortSyntaxLayout, name) == offsetof(ExplicitAnsiPortSyntax, name));
+static_assert(offsetof(ExplicitAnsiPortSyntaxLayout, openParen) == offsetof(ExplicitAnsiPortSyntax, openParen));
+static_assert(offsetof(ExplicitAnsiPortSyntaxLayout, expr) == offsetof(ExplicitAnsiPortSyntax, expr));
+static_assert(offsetof(ExplicitAnsiPortSyntaxLayout, closeParen) == offsetof(ExplicitAnsiPortSyntax, closeParen));
+static_assert(sizeof(ExplicitNonAnsiPortSyntaxLayout) == sizeof(ExplicitNonAnsiPortSyntax));
+static_assert(offsetof(ExplicitNonAnsiPortSyntaxLayout, dot) == offsetof(ExplicitNonAnsiPortSyntax, dot));
+static_assert(offsetof(ExplicitNonAnsiPortSyntaxLayout, name) == offsetof(ExplicitNonAnsiPortSyntax, name));
+static_assert(offsetof(ExplicitNonAnsiPortSyntaxLayout, openParen) == offsetof(ExplicitNonAnsiPortSyntax, openParen));
+static_assert(offsetof(ExplicitNonAnsiPortSyntaxLayout, expr) == offsetof(ExplicitNonAnsiPortSyntax, expr));
+static_assert(offsetof(ExplicitNonAnsiPortSyntaxLayout, closeParen) == offsetof(ExplicitNonAnsiPortSyntax, closeParen));
+static_assert(sizeof(ExpressionConstraintSyntaxLayout) == sizeof(ExpressionConstraintSyntax));
+static_assert(offsetof(ExpressionConstraintSyntaxLayout, soft) == offsetof(ExpressionConstraintSyntax, soft));
+static_assert(offsetof(ExpressionConstraintSyntaxLayout, semi) == offsetof(ExpressionConstraintSyntax, semi));
+static_assert(sizeof(ExpressionCoverageBinInitializerSyntaxLayout) == sizeof(ExpressionCoverageBinInitializerSyntax));
+static_assert(offsetof(ExpressionCoverageBinInitializerSyntaxLayout, withClause) == offsetof(ExpressionCoverageBinInitializerSyntax, withClause));
+static_assert(sizeof(ExpressionOrDistSyntaxLayout) == sizeof(ExpressionOrDistSyntax));
+static_assert(sizeof(ExpressionPatternSyntaxLayout) == sizeof(ExpressionPatternSyntax));
+static_assert(sizeof(ExpressionStatementSyntaxLayout) == sizeof(ExpressionStatementSyntax));
+static_assert(offsetof(ExpressionStatementSyntaxLayout, label) == offsetof(ExpressionStatementSyntax, label));
+static_assert(offsetof(ExpressionStatementSyntaxLayout, attributes) == offsetof(ExpressionStatementSyntax, attributes));
+static_assert(offsetof(ExpressionStatementSyntaxLayout, semi) == offsetof(ExpressionStatementSyntax, semi));
+static_assert(sizeof(ExtendsClauseSyntaxLayout) == sizeof(ExtendsClauseSyntax));
+static_assert(offsetof(ExtendsClauseSyntaxLayout, keyword) == offsetof(ExtendsClauseSyntax, keyword));
+static_assert(offsetof(ExtendsClauseSyntaxLayout, arguments) == offsetof(ExtendsClauseSyntax, arguments));
+static_assert(sizeof(ExternModuleSyntaxLayout) == sizeof(ExternModuleSyntax));
+static_assert(offsetof(ExternModuleSyntaxLayout, externKeyword) == offsetof(ExternModuleSyntax, externKeyword));
+static_assert(sizeof(ForLoopStatementSyntaxLayout) == sizeof(ForLoopStatementSyntax));
+static_assert(offsetof(ForLoopStatementSyntaxLayout, label) == offsetof(ForLoopStatementSyntax, label));
+static_assert(offsetof(ForLoopStatementSyntaxLayout, attributes) == offsetof(ForLoopStatementSyntax, attributes));
+static_assert(offsetof(ForLoopStatementSyntaxLayout, forKeyword) == offsetof(ForLoopStatementSyntax, forKeyword));
+static_assert(offsetof(ForLoopStatementSyntaxLayout, openParen) == offsetof(ForLoopStatementSyntax, openParen));
+static_assert(offsetof(ForLoopStatementSyntaxLayout, initializers) == offsetof(ForLoopStatementSyntax, initializers));
+static_assert(offsetof(ForLoopStatementSyntaxLayout, semi1) == offsetof(ForLoopStatementSyntax, semi1));
+static_assert(offsetof(ForLoopStatementSyntaxLayout, semi2) == offsetof(ForLoopStatementSyntax, semi2));
+static_assert(offsetof(ForLoopStatementSyntaxLayout, steps) == offsetof(ForLoopStatementSyntax, steps));
+static_assert(offsetof(ForLoopStatementSyntaxLayout, closeParen) == offsetof(ForLoopStatementSyntax, closeParen));
+static_assert(sizeof(ForVariableDeclarationSyntaxLayout) == sizeof(ForVariableDeclarationSyntax));
+static_assert(offsetof(ForVariableDeclarationSyntaxLayout, varKeyword) == offsetof(ForVariableDeclarationSyntax, varKeyword));
+static_assert(sizeof(ForeachLoopListSyntaxLayout) == sizeof(ForeachLoopListSyntax));
+static_assert(offsetof(ForeachLoopListSyntaxLayout, openParen) == offsetof(ForeachLoopListSyntax, openParen));
+static_assert(offsetof(ForeachLoopListSyntaxLayout, openBracket) == offsetof(ForeachLoopListSyntax, openBracket));
+static_assert(offsetof(ForeachLoopListSyntaxLayout, loopVariables) == offsetof(ForeachLoopListSyntax, loopVariables));
+static_assert(offsetof(ForeachLoopListSyntaxLayout, closeBracket) == offsetof(ForeachLoopListSyntax, closeBracket));
+static_assert(offsetof(ForeachLoopListSyntaxLayout, closeParen) == offsetof(ForeachLoopListSyntax, closeParen));
+static_assert(sizeof(ForeachLoopStatementSyntaxLayout) == sizeof(ForeachLoopStatementSyntax));
+static_assert(offsetof(ForeachLoopStatementSyntaxLayout, label) == offsetof(ForeachLoopStatementSyntax, label));
+static_assert(offsetof(ForeachLoopStatementSyntaxLayout, attributes) == offsetof(ForeachLoopStatementSyntax, attributes));
+static_assert(offsetof(ForeachLoopStatementSyntaxLayout, keyword) == offsetof(ForeachLoopStatementSyntax, keyword));
+static_assert(sizeof(ForeverStatementSyntaxLayout) == sizeof(ForeverStatementSyntax));
+static_assert(offsetof(ForeverStatementSyntaxLayout, label) == offsetof(ForeverStatementSyntax, label));
+static_assert(offsetof(ForeverStatementSyntaxLayout, attributes) == offsetof(ForeverStatementSyntax, attributes));
+static_assert(offsetof(ForeverStatementSyntaxLayout, foreverKeyword) == offsetof(ForeverStatementSyntax, foreverKeyword));
+static_assert(sizeof(ForwardInterfaceClassTypedefDeclarationSyntaxLayout) == sizeof(ForwardInterfaceClassTypedefDeclarationSyntax));
+static_assert(offsetof(ForwardInterfaceClassTypedefDeclarationSyntaxLayout, attributes) == offsetof(ForwardInterfaceClassTypedefDeclarationSyntax, attributes));
+static_assert(offsetof(ForwardInterfaceClassTypedefDeclarationSyntaxLayout, typedefKeyword) == offsetof(ForwardInterfaceClassTypedefDeclarationSyntax, typedefKeyword));
+static_assert(offsetof(ForwardInterfaceClassTypedefDeclarationSyntaxLayout, interfaceKeyword) == offsetof(ForwardInterfaceClassTypedefDeclarationSyntax, interfaceKeyword));
+static_assert(offsetof(ForwardInterfaceClassTypedefDeclarationSyntaxLayout, classKeyword) == offsetof(ForwardInterfaceClassTypedefDeclarationSyntax, classKeyword));
+static_assert(offsetof(ForwardInterfaceClassTypedefDeclarationSyntaxLayout, name) == offsetof(ForwardInterfaceClassTypedefDeclarationSyntax, name));
+static_assert(offsetof(ForwardInterfaceClassTypedefDeclarationSyntaxLayout, semi) == offsetof(ForwardInterfaceClassTypedefDeclarationSyntax, semi));
+static_assert(sizeof(ForwardTypedefDeclarationSyntaxLayout) == sizeof(ForwardTypedefDeclarationSyntax));
+static_assert(offsetof(ForwardTypedefDeclarationSyntaxLayout, attributes) == offsetof(ForwardTypedefDeclarationSyntax, attributes));
+static_assert(offsetof(ForwardTypedefDeclarationSyntaxLayout, typedefKeyword) == offsetof(ForwardTypedefDeclarationSyntax, typedefKeyword));
+static_assert(offsetof(ForwardTypedefDeclarationSyntaxLayout, keyword) == offsetof(ForwardTypedefDeclarationSyntax, keyword));
+static_assert(offsetof(ForwardTypedefDeclarationSyntaxLayout, name) == offsetof(ForwardTypedefDeclarationSyntax, name));
+static_assert(offsetof(ForwardTypedefDeclarationSyntaxLayout, semi) == offsetof(ForwardTypedefDeclarationSyntax, semi));
+static_assert(sizeof(FunctionDeclarationSyntaxLayout) == sizeof(FunctionDeclarationSyntax));
+static_assert(offsetof(FunctionDeclarationSyntaxLayout, attributes) == offsetof(FunctionDeclarationSyntax, attributes));
+static_assert(offsetof(FunctionDeclarationSyntaxLayout, semi) == offsetof(FunctionDeclarationSyntax, semi));
+static_assert(offsetof(FunctionDeclarationSyntaxLayout, items) == offsetof(FunctionDeclarationSyntax, items));
+static_assert(offsetof(FunctionDeclarationSyntaxLayout, end) == offsetof(FunctionDeclarationSyntax, end));
+static_assert(offsetof(FunctionDeclarationSyntaxLayout, endBlockName) == offsetof(FunctionDeclarationSyntax, endBlockName));
+static_assert(sizeof(FunctionPortListSyntaxLayout) == sizeof(FunctionPortListSyntax));
+static_assert(offsetof(FunctionPortListSyntaxLayout, openParen) == offsetof(FunctionPortListSyntax, openParen));
+static_assert(offsetof(FunctionPortListSyntaxLayout, ports) == offsetof(FunctionPortListSyntax, ports));
+static_assert(offsetof(FunctionPortListSyntaxLayout, closeParen) == offsetof(FunctionPortListSyntax, closeParen));
+static_assert(sizeof(FunctionPortSyntaxLayout) == sizeof(FunctionPortSyntax));
+static_assert(offsetof(FunctionPortSyntaxLayout, attributes) == offsetof(FunctionPortSyntax, attributes));
+static_assert(offsetof(FunctionPortSyntaxLayout, constKeyword) == offsetof(FunctionPortSyntax, constKeyword));
+static_assert(offsetof(FunctionPortSyntaxLayout, direction) == offsetof(FunctionPortSyntax, direction));
+static_assert(offsetof(FunctionPortSyntaxLayout, varKeyword) == offsetof(FunctionPortSyntax, varKeyword));
+static_assert(offsetof(FunctionPortSyntaxLayout, dataType) == offsetof(FunctionPortSyntax, dataType));
+static_assert(sizeof(FunctionPrototypeSyntaxLayout) == sizeof(FunctionPrototypeSyntax));
+static_assert(offsetof(FunctionPrototypeSyntaxLayout, keyword) == offsetof(FunctionPrototypeSyntax, keyword));
+static_assert(offsetof(FunctionPrototypeSyntaxLayout, lifetime) == offsetof(FunctionPrototypeSyntax, lifetime));
+static_assert(offsetof(FunctionPrototypeSyntaxLayout, returnType) == offsetof(FunctionPrototypeSyntax, returnType));
+static_assert(offsetof(FunctionPrototypeSyntaxLayout, portList) == offsetof(FunctionPrototypeSyntax, portList));
+static_assert(sizeof(GenerateBlockSyntaxLayout) == sizeof(GenerateBlockSyntax));
+static_assert(offsetof(GenerateBlockSyntaxLayout, attributes) == offsetof(GenerateBlockSyntax, attributes));
+static_assert(offsetof(GenerateBlockSyntaxLayout, label) == offsetof(GenerateBlockSyntax, label));
+static_assert(offsetof(GenerateBlockSyntaxLayout, begin) == offsetof(GenerateBlockSyntax, begin));
+static_assert(offsetof(GenerateBlockSyntaxLayout, beginName) == offsetof(GenerateBlockSyntax, beginName));
+static_assert(offsetof(GenerateBlockSyntaxLayout, members) == offsetof(GenerateBlockSyntax, members));
+static_assert(offsetof(GenerateBlockSyntaxLayout, end) == offsetof(GenerateBlockSyntax, end));
+static_assert(offsetof(GenerateBlockSyntaxLayout, endName) == offsetof(GenerateBlockSyntax, endName));
+static_assert(sizeof(GenerateRegionSyntaxLayout) == sizeof(GenerateRegionSyntax));
+static_assert(offsetof(GenerateRegionSyntaxLayout, attributes) == offsetof(GenerateRegionSyntax, attributes));
+static_assert(offsetof(GenerateRegionSyntaxLayout, keyword) == offsetof(GenerateRegionSyntax, keyword));
+static_assert(offsetof(GenerateRegionSyntaxLayout, members) == offsetof(GenerateRegionSyntax, members));
+static_assert(offsetof(GenerateRegionSyntaxLayout, endgenerate) == offsetof(GenerateRegionSyntax, endgenerate));
+static_assert(sizeof(GenvarDeclarationSyntaxLayout) == sizeof(GenvarDeclarationSyntax));
+static_assert(offsetof(GenvarDeclarationSyntaxLayout, attributes) == offsetof(GenvarDeclarationSyntax, attributes));
+static_assert(offsetof(GenvarDeclarationSyntaxLayout, keyword) == offsetof(GenvarDeclarationSyntax, keyword));
+static_assert(offsetof(GenvarDeclarationSyntaxLayout, identifiers) == offsetof(GenvarDeclarationSyntax, identifiers));
+static_assert(offsetof(GenvarDeclarationSyntaxLayout, semi) == offsetof(GenvarDeclarationSyntax, semi));
+static_assert(sizeof(HierarchicalInstanceSyntaxLayout) == sizeof(HierarchicalInstanceSyntax));
+static_assert(offsetof(HierarchicalInstanceSyntaxLayout, name) == offsetof(HierarchicalInstanceSyntax, name));
+static_assert(offsetof(HierarchicalInstanceSyntaxLayout, dimensions) == offsetof(HierarchicalInstanceSyntax, dimensions));
+static_assert(offsetof(HierarchicalInstanceSyntaxLayout, openParen) == offsetof(HierarchicalInstanceSyntax, openParen));
+static_assert(offsetof(HierarchicalInstanceSyntaxLayout, connections) == offsetof(HierarchicalInstanceSyntax, connections));
+static_assert(offsetof(HierarchicalInstanceSyntaxLayout, closeParen) == offsetof(HierarchicalInstanceSyntax, closeParen));
+static_assert(sizeof(HierarchyInstantiationSyntaxLayout) == sizeof(HierarchyInstantiationSyntax));
+static_assert(offsetof(HierarchyInstantiationSyntaxLayout, attributes) == offsetof(HierarchyInstantiationSyntax, attributes));
+static_assert(offsetof(HierarchyInstantiationSyntaxLayout, type) == offsetof(HierarchyInstantiationSyntax, type));
+static_assert(offsetof(HierarchyInstantiationSyntaxLayout, parameters) == offsetof(HierarchyInstantiationSyntax, parameters));
+static_assert(offsetof(HierarchyInstantiationSyntaxLayout, instances) == offsetof(HierarchyInstantiationSyntax, instances));
+static_assert(offsetof(HierarchyInstantiationSyntaxLayout, semi) == offsetof(HierarchyInstantiationSyntax, semi));
+static_assert(sizeof(IdentifierListSyntaxLayout) == sizeof(IdentifierListSyntax));
+static_assert(offsetof(IdentifierListSyntaxLayout, openParen) == offsetof(IdentifierListSyntax, openParen));
+static_assert(offsetof(IdentifierListSyntaxLayout, identifiers) == offsetof(IdentifierListSyntax, identifiers));
+static_assert(offsetof(IdentifierListSyntaxLayout, closeParen) == offsetof(IdentifierListSyntax, closeParen));
+static_assert(sizeof(IdentifierNameSyntaxLayout) == sizeof(IdentifierNameSyntax));
+static_assert(offsetof(IdentifierNameSyntaxLayout, identifier) == offsetof(IdentifierNameSyntax, identifier));
+static_assert(sizeof(IdentifierSelectNameSyntaxLayout) == sizeof(IdentifierSelectNameSyntax));
+static_assert(offsetof(IdentifierSelectNameSyntaxLayout, identifier) == offsetof(IdentifierSelectNameSyntax, identifier));
+static_assert(offsetof(IdentifierSelectNameSyntaxLayout, selectors) == offsetof(IdentifierSelectNameSyntax, selectors));
+static_assert(sizeof(IfGenerateSyntaxLayout) == sizeof(IfGenerateSyntax));
+static_assert(offsetof(IfGenerateSyntaxLayout, attributes) == offsetof(IfGenerateSyntax, attributes));
+static_assert(offsetof(IfGenerateSyntaxLayout, keyword) == offsetof(IfGenerateSyntax, keyword));
+static_assert(offsetof(IfGenerateSyntaxLayout, openParen) == offsetof(IfGenerateSyntax, openParen));
+static_assert(offsetof(IfGenerateSyntaxLayout, closeParen) == offsetof(IfGenerateSyntax, closeParen));
+static_assert(offsetof(IfGenerateSyntaxLayout, elseClause) == offsetof(IfGenerateSyntax, elseClause));
+static_assert(sizeof(IffClauseSyntaxLayout) == sizeof(IffClauseSyntax));
+static_assert(offsetof(IffClauseSyntaxLayout, iff) == offsetof(IffClauseSyntax, iff));
+static_assert(offsetof(IffClauseSyntaxLayout, openParen) == offsetof(IffClauseSyntax, openParen));
+static_assert(offsetof(IffClauseSyntaxLayout, closeParen) == offsetof(IffClauseSyntax, closeParen));
+static_assert(sizeof(ImmediateAssertionMemberSyntaxLayout) == sizeof(ImmediateAssertionMemberSyntax));
+static_assert(offsetof(ImmediateAssertionMemberSyntaxLayout, attributes) == offsetof(ImmediateAssertionMemberSyntax, attributes));
+static_assert(sizeof(ImmediateAssertionStatementSyntaxLayout) == sizeof(ImmediateAssertionStatementSyntax));
+static_assert(offsetof(ImmediateAssertionStatementSyntaxLayout, label) == offsetof(ImmediateAssertionStatementSyntax, label));
+static_assert(offsetof(ImmediateAssertionStatementSyntaxLayout, attributes) == offsetof(ImmediateAssertionStatementSyntax, attributes));
+static_assert(offsetof(ImmediateAssertionStatementSyntaxLayout, keyword) == offsetof(ImmediateAssertionStatementSyntax, keyword));
+static_assert(offsetof(ImmediateAssertionStatementSyntaxLayout, delay) == offsetof(ImmediateAssertionStatementSyntax, delay));
+static_assert(sizeof(ImplementsClauseSyntaxLayout) == sizeof(ImplementsClauseSyntax));
+static_assert(offsetof(ImplementsClauseSyntaxLayout, keyword) == offsetof(ImplementsClauseSyntax, keyword));
+static_assert(offsetof(ImplementsClauseSyntaxLayout, interfaces) == offsetof(ImplementsClauseSyntax, interfaces));
+static_assert(sizeof(ImplicationConstraintSyntaxLayout) == sizeof(ImplicationConstraintSyntax));
+static_assert(offsetof(ImplicationConstraintSyntaxLayout, arrow) == offsetof(ImplicationConstraintSyntax, arrow));
+static_assert(sizeof(ImplicitAnsiPortSyntaxLayout) == sizeof(ImplicitAnsiPortSyntax));
+static_assert(offsetof(ImplicitAnsiPortSyntaxLayout, attributes) == offsetof(ImplicitAnsiPortSyntax, attributes));
+static_assert(sizeof(ImplicitEventControlSyntaxLayout) == sizeof(ImplicitEventControlSyntax));
+static_assert(offsetof(ImplicitEventControlSyntaxLayout, atStar) == offsetof(ImplicitEventControlSyntax, atStar));
+static_assert(sizeof(ImplicitNonAnsiPortSyntaxLayout) == sizeof(ImplicitNonAnsiPortSyntax));
+static_assert(sizeof(ImplicitTypeSyntaxLayout) == sizeof(ImplicitTypeSyntax));
+static_assert(offsetof(ImplicitTypeSyntaxLayout, signing) == offsetof(ImplicitTypeSyntax, signing));
+static_assert(offsetof(ImplicitTypeSyntaxLayout, dimensions) == offsetof(ImplicitTypeSyntax, dimensions));
+static_assert(sizeof(IncludeDirectiveSyntaxLayout) == sizeof(IncludeDirectiveSyntax));
+static_assert(offsetof(IncludeDirectiveSyntaxLayout, directive) == offsetof(IncludeDirectiveSyntax, directive));
+static_assert(offsetof(IncludeDirectiveSyntaxLayout, fileName) == offsetof(IncludeDirectiveSyntax, fileName));
+static_assert(offsetof(IncludeDirectiveSyntaxLayout, endOfDirective) == offsetof(IncludeDirectiveSyntax, endOfDirective));
+static_assert(sizeof(InsideExpressionSyntaxLayout) == sizeof(InsideExpressionSyntax));
+static_assert(offsetof(InsideExpressionSyntaxLayout, inside) == offsetof(InsideExpressionSyntax, inside));
+static_assert(sizeof(IntegerTypeSyntaxLayout) == sizeof(IntegerTypeSyntax));
+static_assert(offsetof(IntegerTypeSyntaxLayout, keyword) == offsetof(IntegerTypeSyntax, keyword));
+static_assert(offsetof(IntegerTypeSyntaxLayout, signing) == offsetof(IntegerTypeSyntax, signing));
+static_assert(offsetof(IntegerTypeSyntaxLayout, dimensions) == offsetof(IntegerTypeSyntax, dimensions));
+static_assert(sizeof(IntegerVectorExpressionSyntaxLayout) == sizeof(IntegerVectorExpressionSyntax));
+static_assert(offsetof(IntegerVectorExpressionSyntaxLayout, size) == offsetof(IntegerVectorExpressionSyntax, size));
+static_assert(offsetof(IntegerVectorExpressionSyntaxLayout, base) == offsetof(IntegerVectorExpressionSyntax, base));
+static_assert(offsetof(IntegerVectorExpressionSyntaxLayout, value) == offsetof(IntegerVectorExpressionSyntax, value));
+static_assert(sizeof(InterconnectPortHeaderSyntaxLayout) == sizeof(InterconnectPortHeaderSyntax));
+static_assert(offsetof(InterconnectPortHeaderSyntaxLayout, direction) == offsetof(InterconnectPortHeaderSyntax, direction));
+static_assert(offsetof(InterconnectPortHeaderSyntaxLayout, interconnect) == offsetof(InterconnectPortHeaderSyntax, interconnect));
+static_assert(offsetof(InterconnectPortHeaderSyntaxLayout, type) == offsetof(InterconnectPortHeaderSyntax, type));
+static_assert(sizeof(InterfacePortHeaderSyntaxLayout) == sizeof(InterfacePortHeaderSyntax));
+static_assert(offsetof(InterfacePortHeaderSyntaxLayout, nameOrKeyword) == offsetof(InterfacePortHeaderSyntax, nameOrKeyword));
+static_assert(offsetof(InterfacePortHeaderSyntaxLayout, modport) == offsetof(InterfacePortHeaderSyntax, modport));
+static_assert(sizeof(InvocationExpressionSyntaxLayout) == sizeof(InvocationExpressionSyntax));
+static_assert(offsetof(InvocationExpressionSyntaxLayout, attributes) == offsetof(InvocationExpressionSyntax, attributes));
+static_assert(offsetof(InvocationExpressionSyntaxLayout, arguments) == offsetof(InvocationExpressionSyntax, arguments));
+static_assert(sizeof(JumpStatementSyntaxLayout) == sizeof(JumpStatementSyntax));
+static_assert(offsetof(JumpStatementSyntaxLayout, label) == offsetof(JumpStatementSyntax, label));
+static_assert(offsetof(JumpStatementSyntaxLayout, attributes) == offsetof(JumpStatementSyntax, attributes));
+static_assert(offsetof(JumpStatementSyntaxLayout, breakOrContinue) == offsetof(JumpStatementSyntax, breakOrContinue));
+static_assert(offsetof(JumpStatementSyntaxLayout, semi) == offsetof(JumpStatementSyntax, semi));
+static_assert(sizeof(KeywordNameSyntaxLayout) == sizeof(KeywordNameSyntax));
+static_assert(offsetof(KeywordNameSyntaxLayout, keyword) == offsetof(KeywordNameSyntax, keyword));
+static_assert(sizeof(KeywordTypeSyntaxLayout) == sizeof(KeywordTypeSyntax));
+static_assert(offsetof(KeywordTypeSyntaxLayout, keyword) == offsetof(KeywordTypeSyntax, keyword));
+static_assert(sizeof(LetDeclarationSyntaxLayout) == sizeof(LetDeclarationSyntax));
+static_assert(offsetof(LetDeclarationSyntaxLayout, attributes) == offsetof(LetDeclarationSyntax, attributes));
+static_assert(offsetof(LetDeclarationSyntaxLayout, let) == offsetof(LetDeclarationSyntax, let));
+static_assert(offsetof(LetDeclarationSyntaxLayout, identifier) == offsetof(LetDeclarationSyntax, identifier));
+static_assert(offsetof(LetDeclarationSyntaxLayout, portList) == offsetof(LetDeclarationSyntax, portList));
+static_assert(offsetof(LetDeclarationSyntaxLayout, semi) == offsetof(LetDeclarationSyntax, semi));
+static_assert(sizeof(LineDirectiveSyntaxLayout) == sizeof(LineDirectiveSyntax));
+static_assert(offsetof(LineDirectiveSyntaxLayout, directive) == offsetof(LineDirectiveSyntax, directive));
+static_assert(offsetof(LineDirectiveSyntaxLayout, lineNumber) == offsetof(LineDirectiveSyntax, lineNumber));
+static_assert(offsetof(LineDirectiveSyntaxLayout, fileName) == offsetof(LineDirectiveSyntax, fileName));
+static_assert(offsetof(LineDirectiveSyntaxLayout, level) == offsetof(LineDirectiveSyntax, level));
+static_assert(offsetof(LineDirectiveSyntaxLayout, endOfDirective) == offsetof(LineDirectiveSyntax, endOfDirective));
+static_assert(sizeof(LiteralExpressionSyntaxLayout) == sizeof(LiteralExpressionSyntax));
+static_assert(offsetof(LiteralExpressionSyntaxLayout, literal) == offsetof(LiteralExpressionSyntax, literal));
+static_assert(sizeof(LoopConstraintSyntaxLayout) == sizeof(LoopConstraintSyntax));
+static_assert(offsetof(LoopConstraintSyntaxLayout, foreachKeyword) == offsetof(LoopConstraintSyntax, foreachKeyword));
+static_assert(sizeof(LoopGenerateSyntaxLayout) == sizeof(LoopGenerateSyntax));
+static_assert(offsetof(LoopGenerateSyntaxLayout, attributes) == offsetof(LoopGenerateSyntax, attributes));
+static_assert(offsetof(LoopGenerateSyntaxLayout, keyword) == offsetof(LoopGenerateSyntax, keyword));
+static_assert(offsetof(LoopGenerateSyntaxLayout, openParen) == offsetof(LoopGenerateSyntax, openParen));
+static_assert(offsetof(LoopGenerateSyntaxLayout, genvar) == offsetof(LoopGenerateSyntax, genvar));
+static_assert(offsetof(LoopGenerateSyntaxLayout, identifier) == offsetof(LoopGenerateSyntax, identifier));
+static_assert(offsetof(LoopGenerateSyntaxLayout, equals) == offsetof(LoopGenerateSyntax, equals));
+static_assert(offsetof(LoopGenerateSyntaxLayout, semi1) == offsetof(LoopGenerateSyntax, semi1));
+static_assert(offsetof(LoopGenerateSyntaxLayout, semi2) == offsetof(LoopGenerateSyntax, semi2));
+static_assert(offsetof(LoopGenerateSyntaxLayout, closeParen) == offsetof(LoopGenerateSyntax, closeParen));
+static_assert(sizeof(LoopStatementSyntaxLayout) == sizeof(LoopStatementSyntax));
+static_assert(offsetof(LoopStatementSyntaxLayout, label) == offsetof(LoopStatementSyntax, label));
+static_assert(offsetof(LoopStatementSyntaxLayout, attributes) == offsetof(LoopStatementSyntax, attributes));
+static_assert(offsetof(LoopStatementSyntaxLayout, repeatOrWhile) == offsetof(LoopStatementSyntax, repeatOrWhile));
+static_assert(offsetof(LoopStatementSyntaxLayout, openParen) == offsetof(LoopStatementSyntax, openParen));
+static_assert(offsetof(LoopStatementSyntaxLayout, closeParen) == offsetof(LoopStatementSyntax, closeParen));
+static_assert(sizeof(MacroActualArgumentListSyntaxLayout) == sizeof(MacroActualArgumentListSyntax));
+static_assert(offsetof(MacroActualArgumentListSyntaxLayout, openParen) == offsetof(MacroActualArgumentListSyntax, openParen));
+static_assert(offsetof(MacroActualArgumentListSyntaxLayout, args) == offsetof(MacroActualArgumentListSyntax, args));
+static_assert(offsetof(MacroActualArgumentListSyntaxLayout, closeParen) == offsetof(MacroActualArgumentListSyntax, closeParen));
+static_assert(sizeof(MacroActualArgumentSyntaxLayout) == sizeof(MacroActualArgumentSyntax));
+static_assert(offsetof(MacroActualArgumentSyntaxLayout, tokens) == offsetof(MacroActualArgumentSyntax, tokens));
+static_assert(sizeof(MacroArgumentDefaultSyntaxLayout) == sizeof(MacroArgumentDefaultSyntax));
+static_assert(offsetof(MacroArgumentDefaultSyntaxLayout, equals) == offsetof(MacroArgumentDefaultSyntax, equals));
+static_assert(offsetof(MacroArgumentDefaultSyntaxLayout, tokens) == offsetof(MacroArgumentDefaultSyntax, tokens));
+static_assert(sizeof(MacroFormalArgumentListSyntaxLayout) == sizeof(MacroFormalArgumentListSyntax));
+static_assert(offsetof(MacroFormalArgumentListSyntaxLayout, openParen) == offsetof(MacroFormalArgumentListSyntax, openParen));
+static_assert(offsetof(MacroFormalArgumentListSyntaxLayout, args) == offsetof(MacroFormalArgumentListSyntax, args));
+static_assert(offsetof(MacroFormalArgumentListSyntaxLayout, closeParen) == offsetof(MacroFormalArgumentListSyntax, closeParen));
+static_assert(sizeof(MacroFormalArgumentSyntaxLayout) == sizeof(MacroFormalArgumentSyntax));
+static_assert(offsetof(MacroFormalArgumentSyntaxLayout, name) == offsetof(MacroFormalArgumentSyntax, name));
+static_assert(offsetof(MacroFormalArgumentSyntaxLayout, defaultValue) == offsetof(MacroFormalArgumentSyntax, defaultValue));
+static_assert(sizeof(MacroUsageSyntaxLayout) == sizeof(MacroUsageSyntax));
+static_assert(offsetof(MacroUsageSyntaxLayout, directive) == offsetof(MacroUsageSyntax, directive));
+static_assert(offsetof(MacroUsageSyntaxLayout, args) == offsetof(MacroUsageSyntax, args));
+static_assert(sizeof(MatchesClauseSyntaxLayout) == sizeof(MatchesClauseSyntax));
+static_assert(offsetof(MatchesClauseSyntaxLayout, matchesKeyword) == offsetof(MatchesClauseSyntax, matchesKeyword));
+static_assert(sizeof(MemberAccessExpressionSyntaxLayout) == sizeof(MemberAccessExpressionSyntax));
+static_assert(offsetof(MemberAccessExpressionSyntaxLayout, dot) == offsetof(MemberAccessExpressionSyntax, dot));
+static_assert(offsetof(MemberAccessExpressionSyntaxLayout, name) == offsetof(MemberAccessExpressionSyntax, name));
+static_assert(sizeof(MinTypMaxExpressionSyntaxLayout) == sizeof(MinTypMaxExpressionSyntax));
+static_assert(offsetof(MinTypMaxExpressionSyntaxLayout, colon1) == offsetof(MinTypMaxExpressionSyntax, colon1));
+static_assert(offsetof(MinTypMaxExpressionSyntaxLayout, colon2) == offsetof(MinTypMaxExpressionSyntax, colon2));
+static_assert(sizeof(ModportClockingPortSyntaxLayout) == sizeof(ModportClockingPortSyntax));
+static_assert(offsetof(ModportClockingPortSyntaxLayout, attributes) == offsetof(ModportClockingPortSyntax, attributes));
+static_assert(offsetof(ModportClockingPortSyntaxLayout, clocking) == offsetof(ModportClockingPortSyntax, clocking));
+static_assert(offsetof(ModportClockingPortSyntaxLayout, name) == offsetof(ModportClockingPortSyntax, name));
+static_assert(sizeof(ModportDeclarationSyntaxLayout) == sizeof(ModportDeclarationSyntax));
+static_assert(offsetof(ModportDeclarationSyntaxLayout, attributes) == offsetof(ModportDeclarationSyntax, attributes));
+static_assert(offsetof(ModportDeclarationSyntaxLayout, keyword) == offsetof(ModportDeclarationSyntax, keyword));
+static_assert(offsetof(ModportDeclarationSyntaxLayout, items) == offsetof(ModportDeclarationSyntax, items));
+static_assert(offsetof(ModportDeclarationSyntaxLayout, semi) == offsetof(ModportDeclarationSyntax, semi));
+static_assert(sizeof(ModportExplicitPortSyntaxLayout) == sizeof(ModportExplicitPortSyntax));
+static_assert(offsetof(ModportExplicitPortSyntaxLayout, dot) == offsetof(ModportExplicitPortSyntax, dot));
+static_assert(offsetof(ModportExplicitPortSyntaxLayout, name) == offsetof(ModportExplicitPortSyntax, name));
+static_assert(offsetof(ModportExplicitPortSyntaxLayout, openParen) == offsetof(ModportExplicitPortSyntax, openParen));
+static_assert(offsetof(ModportExplicitPortSyntaxLayout, expr) == offsetof(ModportExplicitPortSyntax, expr));
+static_assert(offsetof(ModportExplicitPortSyntaxLayout, closeParen) == offsetof(ModportExplicitPortSyntax, closeParen));
+static_assert(sizeof(ModportItemSyntaxLayout) == sizeof(ModportItemSyntax));
+static_assert(offsetof(ModportItemSyntaxLayout, name) == offsetof(ModportItemSyntax, name));
+static_assert(sizeof(ModportNamedPortSyntaxLayout) == sizeof(ModportNamedPortSyntax));
+static_assert(offsetof(ModportNamedPortSyntaxLayout, name) == offsetof(ModportNamedPortSyntax, name));
+static_assert(sizeof(ModportSimplePortListSyntaxLayout) == sizeof(ModportSimplePortListSyntax));
+static_assert(offsetof(ModportSimplePortListSyntaxLayout, attributes) == offsetof(ModportSimplePortListSyntax, attributes));
+static_assert(offsetof(ModportSimplePortListSyntaxLayout, direction) == offsetof(ModportSimplePortListSyntax, direction));
+static_assert(offsetof(ModportSimplePortListSyntaxLayout, ports) == offsetof(ModportSimplePortListSyntax, ports));
+static_assert(sizeof(ModportSubroutinePortListSyntaxLayout) == sizeof(ModportSubroutinePortListSyntax));
+static_assert(offsetof(ModportSubroutinePortListSyntaxLayout, attributes) == offsetof(ModportSubroutinePortListSyntax, attributes));
+static_assert(offsetof(ModportSubroutinePortListSyntaxLayout, importExport) == offsetof(ModportSubroutinePortListSyntax, importExport));
+static_assert(offsetof(ModportSubroutinePortListSyntaxLayout, ports) == offsetof(ModportSubroutinePortListSyntax, ports));
+static_assert(sizeof(ModportSubroutinePortSyntaxLayout) == sizeof(ModportSubroutinePortSyntax));
+static_assert(sizeof(ModuleDeclarationSyntaxLayout) == sizeof(ModuleDeclarationSyntax));
+static_assert(offsetof(ModuleDeclarationSyntaxLayout, attributes) == offsetof(ModuleDeclarationSyntax, attributes));
+static_assert(offsetof(ModuleDeclarationSyntaxLayout, members) == offsetof(ModuleDeclarationSyntax, members));
+static_assert(offsetof(ModuleDeclarationSyntaxLayout, endmodule) == offsetof(ModuleDeclarationSyntax, endmodule));
+static_assert(offsetof(ModuleDeclarationSyntaxLayout, blockName) == offsetof(ModuleDeclarationSyntax, blockName));
+static_assert(sizeof(ModuleHeaderSyntaxLayout) == sizeof(ModuleHeaderSyntax));
+static_assert(offsetof(ModuleHeaderSyntaxLayout, moduleKeyword) == offsetof(ModuleHeaderSyntax, moduleKeyword));
+static_assert(offsetof(ModuleHeaderSyntaxLayout, lifetime) == offsetof(ModuleHeaderSyntax, lifetime));
+static_assert(offsetof(ModuleHeaderSyntaxLayout, name) == offsetof(ModuleHeaderSyntax, name));
+static_assert(offsetof(ModuleHeaderSyntaxLayout, imports) == offsetof(ModuleHeaderSyntax, imports));
+static_assert(offsetof(ModuleHeaderSyntaxLayout, parameters) == offsetof(ModuleHeaderSyntax, parameters));
+static_assert(offsetof(ModuleHeaderSyntaxLayout, ports) == offsetof(ModuleHeaderSyntax, ports));
+static_assert(offsetof(ModuleHeaderSyntaxLayout, semi) == offsetof(ModuleHeaderSyntax, semi));
+static_assert(sizeof(MultipleConcatenationExpressionSyntaxLayout) == sizeof(MultipleConcatenationExpressionSyntax));
+static_assert(offsetof(MultipleConcatenationExpressionSyntaxLayout, openBrace) == offsetof(MultipleConcatenationExpressionSyntax, openBrace));
+static_assert(offsetof(MultipleConcatenationExpressionSyntaxLayout, closeBrace) == offsetof(MultipleConcatenationExpressionSyntax, closeBrace));
+static_assert(sizeof(NamedArgumentSyntaxLayout) == sizeof(NamedArgumentSyntax));
+static_assert(offsetof(NamedArgumentSyntaxLayout, dot) == offsetof(NamedArgumentSyntax, dot));
+static_assert(offsetof(NamedArgumentSyntaxLayout, name) == offsetof(NamedArgumentSyntax, name));
+static_assert(offsetof(NamedArgumentSyntaxLayout, openParen) == offsetof(NamedArgumentSyntax, openParen));
+static_assert(offsetof(NamedArgumentSyntaxLayout, expr) == offsetof(NamedArgumentSyntax, expr));
+static_assert(offsetof(NamedArgumentSyntaxLayout, closeParen) == offsetof(NamedArgumentSyntax, closeParen));
+static_assert(sizeof(NamedBlockClauseSyntaxLayout) == sizeof(NamedBlockClauseSyntax));
+static_assert(offsetof(NamedBlockClauseSyntaxLayout, colon) == offsetof(NamedBlockClauseSyntax, colon));
+static_assert(offsetof(NamedBlockClauseSyntaxLayout, name) == offsetof(NamedBlockClauseSyntax, name));
+static_assert(sizeof(NamedLabelSyntaxLayout) == sizeof(NamedLabelSyntax));
+static_assert(offsetof(NamedLabelSyntaxLayout, name) == offsetof(NamedLabelSyntax, name));
+static_assert(offsetof(NamedLabelSyntaxLayout, colon) == offsetof(NamedLabelSyntax, colon));
+static_assert(sizeof(NamedPortConnectionSyntaxLayout) == sizeof(NamedPortConnectionSyntax));
+static_assert(offsetof(NamedPortConnectionSyntaxLayout, attributes) == offsetof(NamedPortConnectionSyntax, attributes));
+static_assert(offsetof(NamedPortConnectionSyntaxLayout, dot) == offsetof(NamedPortConnectionSyntax, dot));
+static_assert(offsetof(NamedPortConnectionSyntaxLayout, name) == offsetof(NamedPortConnectionSyntax, name));
+static_assert(offsetof(NamedPortConnectionSyntaxLayout, openParen) == offsetof(NamedPortConnectionSyntax, openParen));
+static_assert(offsetof(NamedPortConnectionSyntaxLayout, expr) == offsetof(NamedPortConnectionSyntax, expr));
+static_assert(offsetof(NamedPortConnectionSyntaxLayout, closeParen) == offsetof(NamedPortConnectionSyntax, closeParen));
+static_assert(sizeof(NamedStructurePatternMemberSyntaxLayout) == sizeof(NamedStructurePatternMemberSyntax));
+static_assert(offsetof(NamedStructurePatternMemberSyntaxLayout, name) == offsetof(NamedStructurePatternMemberSyntax, name));
+static_assert(offsetof(NamedStructurePatternMemberSyntaxLayout, colon) == offsetof(NamedStructurePatternMemberSyntax, colon));
+static_assert(sizeof(NamedTypeSyntaxLayout) == sizeof(NamedTypeSyntax));
+static_assert(sizeof(NetDeclarationSyntaxLayout) == sizeof(NetDeclarationSyntax));
+static_assert(offsetof(NetDeclarationSyntaxLayout, attributes) == offsetof(NetDeclarationSyntax, attributes));
+static_assert(offsetof(NetDeclarationSyntaxLayout, netType) == offsetof(NetDeclarationSyntax, netType));
+static_assert(offsetof(NetDeclarationSyntaxLayout, strength) == offsetof(NetDeclarationSyntax, strength));
+static_assert(offsetof(NetDeclarationSyntaxLayout, expansionHint) == offsetof(NetDeclarationSyntax, expansionHint));
+static_assert(offsetof(NetDeclarationSyntaxLayout, declarators) == offsetof(NetDeclarationSyntax, declarators));
+static_assert(offsetof(NetDeclarationSyntaxLayout, semi) == offsetof(NetDeclarationSyntax, semi));
+static_assert(sizeof(NetPortHeaderSyntaxLayout) == sizeof(NetPortHeaderSyntax));
+static_assert(offsetof(NetPortHeaderSyntaxLayout, direction) == offsetof(NetPortHeaderSyntax, direction));
+static_assert(offsetof(NetPortHeaderSyntaxLayout, netType) == offsetof(NetPortHeaderSyntax, netType));
+static_assert(sizeof(NewArrayExpressionSyntaxLayout) == sizeof(NewArrayExpressionSyntax));
+static_assert(offsetof(NewArrayExpressionSyntaxLayout, newKeyword) == offsetof(NewArrayExpressionSyntax, newKeyword));
+static_assert(offsetof(NewArrayExpressionSyntaxLayout, openBracket) == offsetof(NewArrayExpressionSyntax, openBracket));
+static_assert(offsetof(NewArrayExpressionSyntaxLayout, closeBracket) == offsetof(NewArrayExpressionSyntax, closeBracket));
+static_assert(offsetof(NewArrayExpressionSyntaxLayout, initializer) == offsetof(NewArrayExpressionSyntax, initializer));
+static_assert(sizeof(NewClassExpressionSyntaxLayout) == sizeof(NewClassExpressionSyntax));
+static_assert(offsetof(NewClassExpressionSyntaxLayout, classScope) == offsetof(NewClassExpressionSyntax, classScope));
+static_assert(offsetof(NewClassExpressionSyntaxLayout, newKeyword) == offsetof(NewClassExpressionSyntax, newKeyword));
+static_assert(offsetof(NewClassExpressionSyntaxLayout, arguments) == offsetof(NewClassExpressionSyntax, arguments));
+static_assert(sizeof(NewExpressionSyntaxLayout) == sizeof(NewExpressionSyntax));
+static_assert(offsetof(NewExpressionSyntaxLayout, newKeyword) == offsetof(NewExpressionSyntax, newKeyword));
+static_assert(sizeof(NonAnsiPortListSyntaxLayout) == sizeof(NonAnsiPortListSyntax));
+static_assert(offsetof(NonAnsiPortListSyntaxLayout, openParen) == offsetof(NonAnsiPortListSyntax, openParen));
+static_assert(offsetof(NonAnsiPortListSyntaxLayout, ports) == offsetof(NonAnsiPortListSyntax, ports));
+static_assert(offsetof(NonAnsiPortListSyntaxLayout, closeParen) == offsetof(NonAnsiPortListSyntax, closeParen));
+static_assert(sizeof(OpenRangeListSyntaxLayout) == sizeof(OpenRangeListSyntax));
+static_assert(offsetof(OpenRangeListSyntaxLayout, openBrace) == offsetof(OpenRangeListSyntax, openBrace));
+static_assert(offsetof(OpenRangeListSyntaxLayout, valueRanges) == offsetof(OpenRangeListSyntax, valueRanges));
+static_assert(offsetof(OpenRangeListSyntaxLayout, closeBrace) == offsetof(OpenRangeListSyntax, closeBrace));
+static_assert(sizeof(OrderedArgumentSyntaxLayout) == sizeof(OrderedArgumentSyntax));
+static_assert(sizeof(OrderedPortConnectionSyntaxLayout) == sizeof(OrderedPortConnectionSyntax));
+static_assert(offsetof(OrderedPortConnectionSyntaxLayout, attributes) == offsetof(OrderedPortConnectionSyntax, attributes));
+static_assert(sizeof(OrderedStructurePatternMemberSyntaxLayout) == sizeof(OrderedStructurePatternMemberSyntax));
+static_assert(sizeof(PackageImportDeclarationSyntaxLayout) == sizeof(PackageImportDeclarationSyntax));
+static_assert(offsetof(PackageImportDeclarationSyntaxLayout, attributes) == offsetof(PackageImportDeclarationSyntax, attributes));
+static_assert(offsetof(PackageImportDeclarationSyntaxLayout, keyword) == offsetof(PackageImportDeclarationSyntax, keyword));
+static_assert(offsetof(PackageImportDeclarationSyntaxLayout, items) == offsetof(PackageImportDeclarationSyntax, items));
+static_assert(offsetof(PackageImportDeclarationSyntaxLayout, semi) == offsetof(PackageImportDeclarationSyntax, semi));
+static_assert(sizeof(PackageImportItemSyntaxLayout) == sizeof(PackageImportItemSyntax));
+static_assert(offsetof(PackageImportItemSyntaxLayout, package) == offsetof(PackageImportItemSyntax, package));
+static_assert(offsetof(PackageImportItemSyntaxLayout, doubleColon) == offsetof(PackageImportItemSyntax, doubleColon));
+static_assert(offsetof(PackageImportItemSyntaxLayout, item) == offsetof(PackageImportItemSyntax, item));
+static_assert(sizeof(ParameterDeclarationStatementSyntaxLayout) == sizeof(ParameterDeclarationStatementSyntax));
+static_assert(offsetof(ParameterDeclarationStatementSyntaxLayout, attributes) == offsetof(ParameterDeclarationStatementSyntax, attributes));
+static_assert(offsetof(ParameterDeclarationStatementSyntaxLayout, semi) == offsetof(ParameterDeclarationStatementSyntax, semi));
+static_assert(sizeof(ParameterDeclarationSyntaxLayout) == sizeof(ParameterDeclarationSyntax));
+static_assert(offsetof(ParameterDeclarationSyntaxLayout, keyword) == offsetof(ParameterDeclarationSyntax, keyword));
+static_assert(offsetof(ParameterDeclarationSyntaxLayout, declarators) == offsetof(ParameterDeclarationSyntax, declarators));
+static_assert(sizeof(ParameterPortListSyntaxLayout) == sizeof(ParameterPortListSyntax));
+static_assert(offsetof(ParameterPortListSyntaxLayout, hash) == offsetof(ParameterPortListSyntax, hash));
+static_assert(offsetof(ParameterPortListSyntaxLayout, openParen) == offsetof(ParameterPortListSyntax, openParen));
+static_assert(offsetof(ParameterPortListSyntaxLayout, declarations) == offsetof(ParameterPortListSyntax, declarations));
+static_assert(offsetof(ParameterPortListSyntaxLayout, closeParen) == offsetof(ParameterPortListSyntax, closeParen));
+static_assert(sizeof(ParameterValueAssignmentSyntaxLayout) == sizeof(ParameterValueAssignmentSyntax));
+static_assert(offsetof(ParameterValueAssignmentSyntaxLayout, hash) == offsetof(ParameterValueAssignmentSyntax, hash));
+static_assert(sizeof(ParenImplicitEventControlSyntaxLayout) == sizeof(ParenImplicitEventControlSyntax));
+static_assert(offsetof(ParenImplicitEventControlSyntaxLayout, at) == offsetof(ParenImplicitEventControlSyntax, at));
+static_assert(offsetof(ParenImplicitEventControlSyntaxLayout, openParenStarCloseParen) == offsetof(ParenImplicitEventControlSyntax, openParenStarCloseParen));
+static_assert(sizeof(ParenthesizedEventExpressionSyntaxLayout) == sizeof(ParenthesizedEventExpressionSyntax));
+static_assert(offsetof(ParenthesizedEventExpressionSyntaxLayout, openParen) == offsetof(ParenthesizedEventExpressionSyntax, openParen));
+static_assert(offsetof(ParenthesizedEventExpressionSyntaxLayout, closeParen) == offsetof(ParenthesizedEventExpressionSyntax, closeParen));
+static_assert(sizeof(ParenthesizedExpressionSyntaxLayout) == sizeof(ParenthesizedExpressionSyntax));
+static_assert(offsetof(ParenthesizedExpressionSyntaxLayout, openParen) == offsetof(ParenthesizedExpressionSyntax, openParen));
+static_assert(offsetof(ParenthesizedExpressionSyntaxLayout, closeParen) == offsetof(ParenthesizedExpressionSyntax, closeParen));
+static_assert(sizeof(PatternCaseItemSyntaxLayout) == sizeof(PatternCaseItemSyntax));
+static_assert(offsetof(PatternCaseItemSyntaxLayout, tripleAnd) == offsetof(PatternCaseItemSyntax, tripleAnd));
+static_assert(offsetof(PatternCaseItemSyntaxLayout, expr) == offsetof(PatternCaseItemSyntax, expr));
+static_assert(offsetof(PatternCaseItemSyntaxLayout, colon) == offsetof(PatternCaseItemSyntax, colon));
+static_assert(sizeof(PortDeclarationSyntaxLayout) == sizeof(PortDeclarationSyntax));
+static_assert(offsetof(PortDeclarationSyntaxLayout, attributes) == offsetof(PortDeclarationSyntax, attributes));
+static_assert(offsetof(PortDeclarationSyntaxLayout, declarators) == offsetof(PortDeclarationSyntax, declarators));
+static_assert(offsetof(PortDeclarationSyntaxLayout, semi) == offsetof(PortDeclarationSyntax, semi));
+static_assert(sizeof(PostfixUnaryExpressionSyntaxLayout) == sizeof(PostfixUnaryExpressionSyntax));
+static_assert(offsetof(PostfixUnaryExpressionSyntaxLayout, attributes) == offsetof(PostfixUnaryExpressionSyntax, attributes));
+static_assert(offsetof(PostfixUnaryExpressionSyntaxLayout, operatorToken) == offsetof(PostfixUnaryExpressionSyntax, operatorToken));
+static_assert(sizeof(PrefixUnaryExpressionSyntaxLayout) == sizeof(PrefixUnaryExpressionSyntax));
+static_assert(offsetof(PrefixUnaryExpressionSyntaxLayout, operatorToken) == offsetof(PrefixUnaryExpressionSyntax, operatorToken));
+static_assert(offsetof(PrefixUnaryExpressionSyntaxLayout, attributes) == offsetof(PrefixUnaryExpressionSyntax, attributes));
+static_assert(sizeof(PrimaryBlockEventExpressionSyntaxLayout) == sizeof(PrimaryBlockEventExpressionSyntax));
+static_assert(offsetof(PrimaryBlockEventExpressionSyntaxLayout, keyword) == offsetof(PrimaryBlockEventExpressionSyntax, keyword));
+static_assert(sizeof(ProceduralAssignStatementSyntaxLayout) == sizeof(ProceduralAssignStatementSyntax));
+static_assert(offsetof(ProceduralAssignStatementSyntaxLayout, label) == offsetof(ProceduralAssignStatementSyntax, label));
+static_assert(offsetof(ProceduralAssignStatementSyntaxLayout, attributes) == offsetof(ProceduralAssignStatementSyntax, attributes));
+static_assert(offsetof(ProceduralAssignStatementSyntaxLayout, keyword) == offsetof(ProceduralAssignStatementSyntax, keyword));
+static_assert(offsetof(ProceduralAssignStatementSyntaxLayout, equals) == offsetof(ProceduralAssignStatementSyntax, equals));
+static_assert(offsetof(ProceduralAssignStatementSyntaxLayout, semi) == offsetof(ProceduralAssignStatementSyntax, semi));
+static_assert(sizeof(ProceduralBlockSyntaxLayout) == sizeof(ProceduralBlockSyntax));
+static_assert(offsetof(ProceduralBlockSyntaxLayout, attributes) == offsetof(ProceduralBlockSyntax, attributes));
+static_assert(offsetof(ProceduralBlockSyntaxLayout, keyword) == offsetof(ProceduralBlockSyntax, keyword));
+static_assert(sizeof(ProceduralDeassignStatementSyntaxLayout) == sizeof(ProceduralDeassignStatementSyntax));
+static_assert(offsetof(ProceduralDeassignStatementSyntaxLayout, label) == offsetof(ProceduralDeassignStatementSyntax, label));
+static_assert(offsetof(ProceduralDeassignStatementSyntaxLayout, attributes) == offsetof(ProceduralDeassignStatementSyntax, attributes));
+static_assert(offsetof(ProceduralDeassignStatementSyntaxLayout, keyword) == offsetof(ProceduralDeassignStatementSyntax, keyword));
+static_assert(offsetof(ProceduralDeassignStatementSyntaxLayout, semi) == offsetof(ProceduralDeassignStatementSyntax, semi));
+static_assert(sizeof(PropertyDeclarationSyntaxLayout) == sizeof(PropertyDeclarationSyntax));
+static_assert(offsetof(PropertyDeclarationSyntaxLayout, attributes) == offsetof(PropertyDeclarationSyntax, attributes));
+static_assert(offsetof(PropertyDeclarationSyntaxLayout, keyword) == offsetof(PropertyDeclarationSyntax, keyword));
+static_assert(offsetof(PropertyDeclarationSyntaxLayout, name) == offsetof(PropertyDeclarationSyntax, name));
+static_assert(offsetof(PropertyDeclarationSyntaxLayout, portList) == offsetof(PropertyDeclarationSyntax, portList));
+static_assert(offsetof(PropertyDeclarationSyntaxLayout, semi) == offsetof(PropertyDeclarationSyntax, semi));
+static_assert(offsetof(PropertyDeclarationSyntaxLayout, assertionVariables) == offsetof(PropertyDeclarationSyntax, assertionVariables));
+static_assert(offsetof(PropertyDeclarationSyntaxLayout, optionalSemi) == offsetof(PropertyDeclarationSyntax, optionalSemi));
+static_assert(offsetof(PropertyDeclarationSyntaxLayout, end) == offsetof(PropertyDeclarationSyntax, end));
+static_assert(offsetof(PropertyDeclarationSyntaxLayout, endBlockName) == offsetof(PropertyDeclarationSyntax, endBlockName));
+static_assert(sizeof(PropertySpecSyntaxLayout) == sizeof(PropertySpecSyntax));
+static_assert(offsetof(PropertySpecSyntaxLayout, clocking) == offsetof(PropertySpecSyntax, clocking));
+static_assert(offsetof(PropertySpecSyntaxLayout, disable) == offsetof(PropertySpecSyntax, disable));
+static_assert(sizeof(QueueDimensionSpecifierSyntaxLayout) == sizeof(QueueDimensionSpecifierSyntax));
+static_assert(offsetof(QueueDimensionSpecifierSyntaxLayout, dollar) == offsetof(QueueDimensionSpecifierSyntax, dollar));
+static_assert(offsetof(QueueDimensionSpecifierSyntaxLayout, maxSizeClause) == offsetof(QueueDimensionSpecifierSyntax, maxSizeClause));
+static_assert(sizeof(RandCaseItemSyntaxLayout) == sizeof(RandCaseItemSyntax));
+static_assert(offsetof(RandCaseItemSyntaxLayout, colon) == offsetof(RandCaseItemSyntax, colon));
+static_assert(sizeof(RandCaseStatementSyntaxLayout) == sizeof(RandCaseStatementSyntax));
+static_assert(offsetof(RandCaseStatementSyntaxLayout, label) == offsetof(RandCaseStatementSyntax, label));
+static_assert(offsetof(RandCaseStatementSyntaxLayout, attributes) == offsetof(RandCaseStatementSyntax, attributes));
+static_assert(offsetof(RandCaseStatementSyntaxLayout, randCase) == offsetof(RandCaseStatementSyntax, randCase));
+static_assert(offsetof(RandCaseStatementSyntaxLayout, items) == offsetof(RandCaseStatementSyntax, items));
+static_assert(offsetof(RandCaseStatementSyntaxLayout, endCase) == offsetof(RandCaseStatementSyntax, endCase));
+static_assert(sizeof(RandomizeMethodWithClauseSyntaxLayout) == sizeof(RandomizeMethodWithClauseSyntax));
+static_assert(offsetof(RandomizeMethodWithClauseSyntaxLayout, with) == offsetof(RandomizeMethodWithClauseSyntax, with));
+static_assert(offsetof(RandomizeMethodWithClauseSyntaxLayout, names) == offsetof(RandomizeMethodWithClauseSyntax, names));
+static_assert(sizeof(RangeCoverageBinInitializerSyntaxLayout) == sizeof(RangeCoverageBinInitializerSyntax));
+static_assert(offsetof(RangeCoverageBinInitializerSyntaxLayout, withClause) == offsetof(RangeCoverageBinInitializerSyntax, withClause));
+static_assert(sizeof(RangeDimensionSpecifierSyntaxLayout) == sizeof(RangeDimensionSpecifierSyntax));
+static_assert(sizeof(RangeSelectSyntaxLayout) == sizeof(RangeSelectSyntax));
+static_assert(offsetof(RangeSelectSyntaxLayout, range) == offsetof(RangeSelectSyntax, range));
+static_assert(sizeof(RepeatedEventControlSyntaxLayout) == sizeof(RepeatedEventControlSyntax));
+static_assert(offsetof(RepeatedEventControlSyntaxLayout, repeat) == offsetof(RepeatedEventControlSyntax, repeat));
+static_assert(offsetof(RepeatedEventControlSyntaxLayout, openParen) == offsetof(RepeatedEventControlSyntax, openParen));
+static_assert(offsetof(RepeatedEventControlSyntaxLayout, closeParen) == offsetof(RepeatedEventControlSyntax, closeParen));
+static_assert(offsetof(RepeatedEventControlSyntaxLayout, eventControl) == offsetof(RepeatedEventControlSyntax, eventControl));
+static_assert(sizeof(ReplicatedAssignmentPatternSyntaxLayout) == sizeof(ReplicatedAssignmentPatternSyntax));
+static_assert(offsetof(ReplicatedAssignmentPatternSyntaxLayout, openBrace) == offsetof(ReplicatedAssignmentPatternSyntax, openBrace));
+static_assert(offsetof(ReplicatedAssignmentPatternSyntaxLayout, innerOpenBrace) == offsetof(ReplicatedAssignmentPatternSyntax, innerOpenBrace));
+static_assert(offsetof(ReplicatedAssignmentPatternSyntaxLayout, items) == offsetof(ReplicatedAssignmentPatternSyntax, items));
+static_assert(offsetof(ReplicatedAssignmentPatternSyntaxLayout, innerCloseBrace) == offsetof(ReplicatedAssignmentPatternSyntax, innerCloseBrace));
+static_assert(offsetof(ReplicatedAssignmentPatternSyntaxLayout, closeBrace) == offsetof(ReplicatedAssignmentPatternSyntax, closeBrace));
+static_assert(sizeof(ReturnStatementSyntaxLayout) == sizeof(ReturnStatementSyntax));
+static_assert(offsetof(ReturnStatementSyntaxLayout, label) == offsetof(ReturnStatementSyntax, label));
+static_assert(offsetof(ReturnStatementSyntaxLayout, attributes) == offsetof(ReturnStatementSyntax, attributes));
+static_assert(offsetof(ReturnStatementSyntaxLayout, returnKeyword) == offsetof(ReturnStatementSyntax, returnKeyword));
+static_assert(offsetof(ReturnStatementSyntaxLayout, returnValue) == offsetof(ReturnStatementSyntax, returnValue));
+static_assert(offsetof(ReturnStatementSyntaxLayout, semi) == offsetof(ReturnStatementSyntax, semi));
+static_assert(sizeof(ScopedNameSyntaxLayout) == sizeof(ScopedNameSyntax));
+static_assert(offsetof(ScopedNameSyntaxLayout, separator) == offsetof(ScopedNameSyntax, separator));
+static_assert(sizeof(SequenceDeclarationSyntaxLayout) == sizeof(SequenceDeclarationSyntax));
+static_assert(offsetof(SequenceDeclarationSyntaxLayout, attributes) == offsetof(SequenceDeclarationSyntax, attributes));
+static_assert(offsetof(SequenceDeclarationSyntaxLayout, keyword) == offsetof(SequenceDeclarationSyntax, keyword));
+static_assert(offsetof(SequenceDeclarationSyntaxLayout, name) == offsetof(SequenceDeclarationSyntax, name));
+static_assert(offsetof(SequenceDeclarationSyntaxLayout, portList) == offsetof(SequenceDeclarationSyntax, portList));
+static_assert(offsetof(SequenceDeclarationSyntaxLayout, semi) == offsetof(SequenceDeclarationSyntax, semi));
+static_assert(offsetof(SequenceDeclarationSyntaxLayout, assertionVariables) == offsetof(SequenceDeclarationSyntax, assertionVariables));
+static_assert(offsetof(SequenceDeclarationSyntaxLayout, optionalSemi) == offsetof(SequenceDeclarationSyntax, optionalSemi));
+static_assert(offsetof(SequenceDeclarationSyntaxLayout, end) == offsetof(SequenceDeclarationSyntax, end));
+static_assert(offsetof(SequenceDeclarationSyntaxLayout, endBlockName) == offsetof(SequenceDeclarationSyntax, endBlockName));
+static_assert(sizeof(ShortcutCycleDelayRangeSyntaxLayout) == sizeof(ShortcutCycleDelayRangeSyntax));
+static_assert(offsetof(ShortcutCycleDelayRangeSyntaxLayout, doubleHash) == offsetof(ShortcutCycleDelayRangeSyntax, doubleHash));
+static_assert(offsetof(ShortcutCycleDelayRangeSyntaxLayout, openBracket) == offsetof(ShortcutCycleDelayRangeSyntax, openBracket));
+static_assert(offsetof(ShortcutCycleDelayRangeSyntaxLayout, op) == offsetof(ShortcutCycleDelayRangeSyntax, op));
+static_assert(offsetof(ShortcutCycleDelayRangeSyntaxLayout, closeBracket) == offsetof(ShortcutCycleDelayRangeSyntax, closeBracket));
+static_assert(sizeof(SignalEventExpressionSyntaxLayout) == sizeof(SignalEventExpressionSyntax));
+static_assert(offsetof(SignalEventExpressionSyntaxLayout, edge) == offsetof(SignalEventExpressionSyntax, edge));
+static_assert(sizeof(SignedCastExpressionSyntaxLayout) == sizeof(SignedCastExpressionSyntax));
+static_assert(offsetof(SignedCastExpressionSyntaxLayout, signing) == offsetof(SignedCastExpressionSyntax, signing));
+static_assert(offsetof(SignedCastExpressionSyntaxLayout, apostrophe) == offsetof(SignedCastExpressionSyntax, apostrophe));
+static_assert(sizeof(SimpleAssignmentPatternSyntaxLayout) == sizeof(SimpleAssignmentPatternSyntax));
+static_assert(offsetof(SimpleAssignmentPatternSyntaxLayout, openBrace) == offsetof(SimpleAssignmentPatternSyntax, openBrace));
+static_assert(offsetof(SimpleAssignmentPatternSyntaxLayout, items) == offsetof(SimpleAssignmentPatternSyntax, items));
+static_assert(offsetof(SimpleAssignmentPatternSyntaxLayout, closeBrace) == offsetof(SimpleAssignmentPatternSyntax, closeBrace));
+static_assert(sizeof(SimpleDirectiveSyntaxLayout) == sizeof(SimpleDirectiveSyntax));
+static_assert(offsetof(SimpleDirectiveSyntaxLayout, directive) == offsetof(SimpleDirectiveSyntax, directive));
+static_assert(offsetof(SimpleDirectiveSyntaxLayout, endOfDirective) == offsetof(SimpleDirectiveSyntax, endOfDirective));
+static_assert(sizeof(SolveBeforeConstraintSyntaxLayout) == sizeof(SolveBeforeConstraintSyntax));
+static_assert(offsetof(SolveBeforeConstraintSyntaxLayout, solve) == offsetof(SolveBeforeConstraintSyntax, solve));
+static_assert(offsetof(SolveBeforeConstraintSyntaxLayout, beforeExpr) == offsetof(SolveBeforeConstraintSyntax, beforeExpr));
+static_assert(offsetof(SolveBeforeConstraintSyntaxLayout, before) == offsetof(SolveBeforeConstraintSyntax, before));
+static_assert(offsetof(SolveBeforeConstraintSyntaxLayout, afterExpr) == offsetof(SolveBeforeConstraintSyntax, afterExpr));
+static_assert(offsetof(SolveBeforeConstraintSyntaxLayout, semi) == offsetof(SolveBeforeConstraintSyntax, semi));
+static_assert(sizeof(StandardCaseItemSyntaxLayout) == sizeof(StandardCaseItemSyntax));
+static_assert(offsetof(StandardCaseItemSyntaxLayout, expressions) == offsetof(StandardCaseItemSyntax, expressions));
+static_assert(offsetof(StandardCaseItemSyntaxLayout, colon) == offsetof(StandardCaseItemSyntax, colon));
+static_assert(sizeof(StreamExpressionSyntaxLayout) == sizeof(StreamExpressionSyntax));
+static_assert(offsetof(StreamExpressionSyntaxLayout, withRange) == offsetof(StreamExpressionSyntax, withRange));
+static_assert(sizeof(StreamExpressionWithRangeLayout) == sizeof(StreamExpressionWithRange));
+static_assert(offsetof(StreamExpressionWithRangeLayout, withKeyword) == offsetof(StreamExpressionWithRange, withKeyword));
+static_assert(sizeof(StreamingConcatenationExpressionSyntaxLayout) == sizeof(StreamingConcatenationExpressionSyntax));
+static_assert(offsetof(StreamingConcatenationExpressionSyntaxLayout, openBrace) == offsetof(StreamingConcatenationExpressionSyntax, openBrace));
+static_assert(offsetof(StreamingConcatenationExpressionSyntaxLayout, operatorToken) == offsetof(StreamingConcatenationExpressionSyntax, operatorToken));
+static_assert(offsetof(StreamingConcatenationExpressionSyntaxLayout, sliceSize) == offsetof(StreamingConcatenationExpressionSyntax, sliceSize));
+static_assert(offsetof(StreamingConcatenationExpressionSyntaxLayout, innerOpenBrace) == offsetof(StreamingConcatenationExpressionSyntax, innerOpenBrace));
+static_assert(offsetof(StreamingConcatenationExpressionSyntaxLayout, expressions) == offsetof(StreamingConcatenationExpressionSyntax, expressions));
+static_assert(offsetof(StreamingConcatenationExpressionSyntaxLayout, innerCloseBrace) == offsetof(StreamingConcatenationExpressionSyntax, innerCloseBrace));
+static_assert(offsetof(StreamingConcatenationExpressionSyntaxLayout, closeBrace) == offsetof(StreamingConcatenationExpressionSyntax, closeBrace));
+static_assert(sizeof(StructUnionMemberSyntaxLayout) == sizeof(StructUnionMemberSyntax));
+static_assert(offsetof(StructUnionMemberSyntaxLayout, attributes) == offsetof(StructUnionMemberSyntax, attributes));
+static_assert(offsetof(StructUnionMemberSyntaxLayout, randomQualifier) == offsetof(StructUnionMemberSyntax, randomQualifier));
+static_assert(offsetof(StructUnionMemberSyntaxLayout, declarators) == offsetof(StructUnionMemberSyntax, declarators));
+static_assert(offsetof(StructUnionMemberSyntaxLayout, semi) == offsetof(StructUnionMemberSyntax, semi));
+static_assert(sizeof(StructUnionTypeSyntaxLayout) == sizeof(StructUnionTypeSyntax));
+static_assert(offsetof(StructUnionTypeSyntaxLayout, keyword) == offsetof(StructUnionTypeSyntax, keyword));
+static_assert(offsetof(StructUnionTypeSyntaxLayout, tagged) == offsetof(StructUnionTypeSyntax, tagged));
+static_assert(offsetof(StructUnionTypeSyntaxLayout, packed) == offsetof(StructUnionTypeSyntax, packed));
+static_assert(offsetof(StructUnionTypeSyntaxLayout, signing) == offsetof(StructUnionTypeSyntax, signing));
+static_assert(offsetof(StructUnionTypeSyntaxLayout, openBrace) == offsetof(StructUnionTypeSyntax, openBrace));
+static_assert(offsetof(StructUnionTypeSyntaxLayout, members) == offsetof(StructUnionTypeSyntax, members));
+static_assert(offsetof(StructUnionTypeSyntaxLayout, closeBrace) == offsetof(StructUnionTypeSyntax, closeBrace));
+static_assert(offsetof(StructUnionTypeSyntaxLayout, dimensions) == offsetof(StructUnionTypeSyntax, dimensions));
+static_assert(sizeof(StructurePatternSyntaxLayout) == sizeof(StructurePatternSyntax));
+static_assert(offsetof(StructurePatternSyntaxLayout, openBrace) == offsetof(StructurePatternSyntax, openBrace));
+static_assert(offsetof(StructurePatternSyntaxLayout, members) == offsetof(StructurePatternSyntax, members));
+static_assert(offsetof(StructurePatternSyntaxLayout, closeBrace) == offsetof(StructurePatternSyntax, closeBrace));
+static_assert(sizeof(StructuredAssignmentPatternSyntaxLayout) == sizeof(StructuredAssignmentPatternSyntax));
+static_assert(offsetof(StructuredAssignmentPatternSyntaxLayout, openBrace) == offsetof(StructuredAssignmentPatternSyntax, openBrace));
+static_assert(offsetof(StructuredAssignmentPatternSyntaxLayout, items) == offsetof(StructuredAssignmentPatternSyntax, items));
+static_assert(offsetof(StructuredAssignmentPatternSyntaxLayout, closeBrace) == offsetof(StructuredAssignmentPatternSyntax, closeBrace));
+static_assert(sizeof(TaggedPatternSyntaxLayout) == sizeof(TaggedPatternSyntax));
+static_assert(offsetof(TaggedPatternSyntaxLayout, tagged) == offsetof(TaggedPatternSyntax, tagged));
+static_assert(offsetof(TaggedPatternSyntaxLayout, memberName) == offsetof(TaggedPatternSyntax, memberName));
+static_assert(offsetof(TaggedPatternSyntaxLayout, pattern) == offsetof(TaggedPatternSyntax, pattern));
+static_assert(sizeof(TaggedUnionExpressionSyntaxLayout) == sizeof(TaggedUnionExpressionSyntax));
+static_assert(offsetof(TaggedUnionExpressionSyntaxLayout, tagged) == offsetof(TaggedUnionExpressionSyntax, tagged));
+static_assert(offsetof(TaggedUnionExpressionSyntaxLayout, member) == offsetof(TaggedUnionExpressionSyntax, member));
+static_assert(offsetof(TaggedUnionExpressionSyntaxLayout, expr) == offsetof(TaggedUnionExpressionSyntax, expr));
+static_assert(sizeof(TimeUnitsDeclarationSyntaxLayout) == sizeof(TimeUnitsDeclarationSyntax));
+static_assert(offsetof(TimeUnitsDeclarationSyntaxLayout, attributes) == offsetof(TimeUnitsDeclarationSyntax, attributes));
+static_assert(offsetof(TimeUnitsDeclarationSyntaxLayout, keyword) == offsetof(TimeUnitsDeclarationSyntax, keyword));
+static_assert(offsetof(TimeUnitsDeclarationSyntaxLayout, time) == offsetof(TimeUnitsDeclarationSyntax, time));
+static_assert(offsetof(TimeUnitsDeclarationSyntaxLayout, divider) == offsetof(TimeUnitsDeclarationSyntax, divider));
+static_assert(offsetof(TimeUnitsDeclarationSyntaxLayout, semi) == offsetof(TimeUnitsDeclarationSyntax, semi));
+static_assert(sizeof(TimescaleDirectiveSyntaxLayout) == sizeof(TimescaleDirectiveSyntax));
+static_assert(offsetof(TimescaleDirectiveSyntaxLayout, directive) == offsetof(TimescaleDirectiveSyntax, directive));
+static_assert(offsetof(TimescaleDirectiveSyntaxLayout, timeUnit) == offsetof(TimescaleDirectiveSyntax, timeUnit));
+static_assert(offsetof(TimescaleDirectiveSyntaxLayout, timeUnitUnit) == offsetof(TimescaleDirectiveSyntax, timeUnitUnit));
+static_assert(offsetof(TimescaleDirectiveSyntaxLayout, slash) == offsetof(TimescaleDirectiveSyntax, slash));
+static_assert(offsetof(TimescaleDirectiveSyntaxLayout, timePrecision) == offsetof(TimescaleDirectiveSyntax, timePrecision));
+static_assert(offsetof(TimescaleDirectiveSyntaxLayout, timePrecisionUnit) == offsetof(TimescaleDirectiveSyntax, timePrecisionUnit));
+static_assert(offsetof(TimescaleDirectiveSyntaxLayout, endOfDirective) == offsetof(TimescaleDirectiveSyntax, endOfDirective));
+static_assert(sizeof(TimingControlExpressionConcatenationSyntaxLayout) == sizeof(TimingControlExpressionConcatenationSyntax));
+static_assert(sizeof(TimingControlExpressionSyntaxLayout) == sizeof(TimingControlExpressionSyntax));
+static_assert(sizeof(TimingControlStatementSyntaxLayout) == sizeof(TimingControlStatementSyntax));
+static_assert(offsetof(TimingControlStatementSyntaxLayout, label) == offsetof(TimingControlStatementSyntax, label));
+static_assert(offsetof(TimingControlStatementSyntaxLayout, attributes) == offsetof(TimingControlStatementSyntax, attributes));
+static_assert(sizeof(TransListCoverageBinInitializerSyntaxLayout) == sizeof(TransListCoverageBinInitializerSyntax));
+static_assert(offsetof(TransListCoverageBinInitializerSyntaxLayout, sets) == offsetof(TransListCoverageBinInitializerSyntax, sets));
+static_assert(offsetof(TransListCoverageBinInitializerSyntaxLayout, withClause) == offsetof(TransListCoverageBinInitializerSyntax, withClause));
+static_assert(sizeof(TransRangeSyntaxLayout) == sizeof(TransRangeSyntax));
+static_assert(offsetof(TransRangeSyntaxLayout, items) == offsetof(TransRangeSyntax, items));
+static_assert(offsetof(TransRangeSyntaxLayout, repeat) == offsetof(TransRangeSyntax, repeat));
+static_assert(sizeof(TransRepeatRangeSyntaxLayout) == sizeof(TransRepeatRangeSyntax));
+static_assert(offsetof(TransRepeatRangeSyntaxLayout, openBracket) == offsetof(TransRepeatRangeSyntax, openBracket));
+static_assert(offsetof(TransRepeatRangeSyntaxLayout, specifier) == offsetof(TransRepeatRangeSyntax, specifier));
+static_assert(offsetof(TransRepeatRangeSyntaxLayout, selector) == offsetof(TransRepeatRangeSyntax, selector));
+static_assert(offsetof(TransRepeatRangeSyntaxLayout, closeBracket) == offsetof(TransRepeatRangeSyntax, closeBracket));
+static_assert(sizeof(TransSetSyntaxLayout) == sizeof(TransSetSyntax));
+static_assert(offsetof(TransSetSyntaxLayout, openParen) == offsetof(TransSetSyntax, openParen));
+static_assert(offsetof(TransSetSyntaxLayout, ranges) == offsetof(TransSetSyntax, ranges));
+static_assert(offsetof(TransSetSyntaxLayout, closeParen) == offsetof(TransSetSyntax, closeParen));
+static_assert(sizeof(TypeReferenceSyntaxLayout) == sizeof(TypeReferenceSyntax));
+static_assert(offsetof(TypeReferenceSyntaxLayout, typeKeyword) == offsetof(TypeReferenceSyntax, typeKeyword));
+static_assert(offsetof(TypeReferenceSyntaxLayout, openParen) == offsetof(TypeReferenceSyntax, openParen));
+static_assert(offsetof(TypeReferenceSyntaxLayout, closeParen) == offsetof(TypeReferenceSyntax, closeParen));
+static_assert(sizeof(TypedefDeclarationSyntaxLayout) == sizeof(TypedefDeclarationSyntax));
+static_assert(offsetof(TypedefDeclarationSyntaxLayout, attributes) == offsetof(TypedefDeclarationSyntax, attributes));
+static_assert(offsetof(TypedefDeclarationSyntaxLayout, typedefKeyword) == offsetof(TypedefDeclarationSyntax, typedefKeyword));
+static_assert(offsetof(TypedefDeclarationSyntaxLayout, name) == offsetof(TypedefDeclarationSyntax, name));
+static_assert(offsetof(TypedefDeclarationSyntaxLayout, dimensions) == offsetof(TypedefDeclarationSyntax, dimensions));
+static_assert(offsetof(TypedefDeclarationSyntaxLayout, semi) == offsetof(TypedefDeclarationSyntax, semi));
+static_assert(sizeof(UnconditionalBranchDirectiveSyntaxLayout) == sizeof(UnconditionalBranchDirectiveSyntax));
+static_assert(offsetof(UnconditionalBranchDirectiveSyntaxLayout, directive) == offsetof(UnconditionalBranchDirectiveSyntax, directive));
+static_assert(offsetof(UnconditionalBranchDirectiveSyntaxLayout, endOfDirective) == offsetof(UnconditionalBranchDirectiveSyntax, endOfDirective));
+static_assert(offsetof(UnconditionalBranchDirectiveSyntaxLayout, disabledTokens) == offsetof(UnconditionalBranchDirectiveSyntax, disabledTokens));
+static_assert(sizeof(UndefDirectiveSyntaxLayout) == sizeof(UndefDirectiveSyntax));
+static_assert(offsetof(UndefDirectiveSyntaxLayout, directive) == offsetof(UndefDirectiveSyntax, directive));
+static_assert(offsetof(UndefDirectiveSyntaxLayout, name) == offsetof(UndefDirectiveSyntax, name));
+static_assert(offsetof(UndefDirectiveSyntaxLayout, endOfDirective) == offsetof(UndefDirectiveSyntax, endOfDirective));
+static_assert(sizeof(UniquenessConstraintSyntaxLayout) == sizeof(UniquenessConstraintSyntax));
+static_assert(offsetof(UniquenessConstraintSyntaxLayout, unique) == offsetof(UniquenessConstraintSyntax, unique));
+static_assert(offsetof(UniquenessConstraintSyntaxLayout, semi) == offsetof(UniquenessConstraintSyntax, semi));
+static_assert(sizeof(VarDataTypeSyntaxLayout) == sizeof(VarDataTypeSyntax));
+static_assert(offsetof(VarDataTypeSyntaxLayout, var) == offsetof(VarDataTypeSyntax, var));
+static_assert(sizeof(VariableDeclaratorSyntaxLayout) == sizeof(VariableDeclaratorSyntax));
+static_assert(offsetof(VariableDeclaratorSyntaxLayout, name) == offsetof(VariableDeclaratorSyntax, name));
+static_assert(offsetof(VariableDeclaratorSyntaxLayout, dimensions) == offsetof(VariableDeclaratorSyntax, dimensions));
+static_assert(offsetof(VariableDeclaratorSyntaxLayout, initializer) == offsetof(VariableDeclaratorSyntax, initializer));
+static_assert(sizeof(VariableDimensionSyntaxLayout) == sizeof(VariableDimensionSyntax));
+static_assert(offsetof(VariableDimensionSyntaxLayout, openBracket) == offsetof(VariableDimensionSyntax, openBracket));
+static_assert(offsetof(VariableDimensionSyntaxLayout, specifier) == offsetof(VariableDimensionSyntax, specifier));
+static_assert(offsetof(VariableDimensionSyntaxLayout, closeBracket) == offsetof(VariableDimensionSyntax, closeBracket));
+static_assert(sizeof(VariablePatternSyntaxLayout) == sizeof(VariablePatternSyntax));
+static_assert(offsetof(VariablePatternSyntaxLayout, dot) == offsetof(VariablePatternSyntax, dot));
+static_assert(offsetof(VariablePatternSyntaxLayout, variableName) == offsetof(VariablePatternSyntax, variableName));
+static_assert(sizeof(VariablePortHeaderSyntaxLayout) == sizeof(VariablePortHeaderSyntax));
+static_assert(offsetof(VariablePortHeaderSyntaxLayout, direction) == offsetof(VariablePortHeaderSyntax, direction));
+static_assert(offsetof(VariablePortHeaderSyntaxLayout, varKeyword) == offsetof(VariablePortHeaderSyntax, varKeyword));
+static_assert(sizeof(VirtualInterfaceTypeSyntaxLayout) == sizeof(VirtualInterfaceTypeSyntax));
+static_assert(offsetof(VirtualInterfaceTypeSyntaxLayout, virtualKeyword) == offsetof(VirtualInterfaceTypeSyntax, virtualKeyword));
+static_assert(offsetof(VirtualInterfaceTypeSyntaxLayout, interfaceKeyword) == offsetof(VirtualInterfaceTypeSyntax, interfaceKeyword));
+static_assert(offsetof(VirtualInterfaceTypeSyntaxLayout, name) == offsetof(VirtualInterfaceTypeSyntax, name));
+static_assert(offsetof(VirtualInterfaceTypeSyntaxLayout, parameters) == offsetof(VirtualInterfaceTypeSyntax, parameters));
+static_assert(offsetof(VirtualInterfaceTypeSyntaxLayout, modport) == offsetof(VirtualInterfaceTypeSyntax, modport));
+static_assert(sizeof(WaitForkStatementSyntaxLayout) == sizeof(WaitForkStatementSyntax));
+static_assert(offsetof(WaitForkStatementSyntaxLayout, label) == offsetof(WaitForkStatementSyntax, label));
+static_assert(offsetof(WaitForkStatementSyntaxLayout, attributes) == offsetof(WaitForkStatementSyntax, attributes));
+static_assert(offsetof(WaitForkStatementSyntaxLayout, wait) == offsetof(WaitForkStatementSyntax, wait));
+static_assert(offsetof(WaitForkStatementSyntaxLayout, fork) == offsetof(WaitForkStatementSyntax, fork));
+static_assert(offsetof(WaitForkStatementSyntaxLayout, semi) == offsetof(WaitForkStatementSyntax, semi));
+static_assert(sizeof(WaitOrderStatementSyntaxLayout) == sizeof(WaitOrderStatementSyntax));
+static_assert(offsetof(WaitOrderStatementSyntaxLayout, label) == offsetof(WaitOrderStatementSyntax, label));
+static_assert(offsetof(WaitOrderStatementSyntaxLayout, attributes) == offsetof(WaitOrderStatementSyntax, attributes));
+static_assert(offsetof(WaitOrderStatementSyntaxLayout, wait_order) == offsetof(WaitOrderStatementSyntax, wait_order));
+static_assert(offsetof(WaitOrderStatementSyntaxLayout, openParen) == offsetof(WaitOrderStatementSyntax, openParen));
+static_assert(offsetof(WaitOrderStatementSyntaxLayout, names) == offsetof(WaitOrderStatementSyntax, names));
+static_assert(offsetof(WaitOrderStatementSyntaxLayout, closeParen) == offsetof(WaitOrderStatementSyntax, closeParen));
+static_assert(sizeof(WaitStatementSyntaxLayout) == sizeof(WaitStatementSyntax));
+static_assert(offsetof(WaitStatementSyntaxLayout, label) == offsetof(WaitStatementSyntax, label));
+static_assert(offsetof(WaitStatementSyntaxLayout, attributes) == offsetof(WaitStatementSyntax, attributes));
+static_assert(offsetof(WaitStatementSyntaxLayout, wait) == offsetof(WaitStatementSyntax, wait));
+static_assert(offsetof(WaitStatementSyntaxLayout, openParen) == offsetof(WaitStatementSyntax, openParen));
+static_assert(offsetof(WaitStatementSyntaxLayout, closeParen) == offsetof(WaitStatementSyntax, closeParen));
+static_assert(sizeof(WildcardDimensionSpecifierSyntaxLayout) == sizeof(WildcardDimensionSpecifierSyntax));
+static_assert(offsetof(WildcardDimensionSpecifierSyntaxLayout, star) == offsetof(WildcardDimensionSpecifierSyntax, star));
+static_assert(sizeof(WildcardPatternSyntaxLayout) == sizeof(WildcardPatternSyntax));
+static_assert(offsetof(WildcardPatternSyntaxLayout, dotStar) == offsetof(WildcardPatternSyntax, dotStar));
+static_assert(sizeof(WildcardPortConnectionSyntaxLayout) == sizeof(WildcardPortConnectionSyntax));
+static_assert(offsetof(WildcardPortConnectionSyntaxLayout, attributes) == offsetof(WildcardPortConnectionSyntax, attributes));
+static_assert(offsetof(WildcardPortConnectionSyntaxLayout, dotStar) == offsetof(WildcardPortConnectionSyntax, dotStar));
+static_assert(sizeof(WildcardPortListSyntaxLayout) == sizeof(WildcardPortListSyntax));
+static_assert(offsetof(WildcardPortListSyntaxLayout, openParen) == offsetof(WildcardPortListSyntax, openParen));
+static_assert(offsetof(WildcardPortListSyntaxLayout, dotStar) == offsetof(WildcardPortListSyntax, dotStar));
+static_assert(offsetof(WildcardPortListSyntaxLayout, closeParen) == offsetof(WildcardPortListSyntax, closeParen));
+static_assert(sizeof(WithClauseSyntaxLayout) == sizeof(WithClauseSyntax));
+static_assert(offsetof(WithClauseSyntaxLayout, with) == offsetof(WithClauseSyntax, with));
+static_assert(offsetof(WithClauseSyntaxLayout, openParen) == offsetof(WithClauseSyntax, openParen));
+static_assert(offsetof(WithClauseSyntaxLayout, closeParen) == offsetof(WithClauseSyntax, closeParen));
+static_assert(sizeof(WithFunctionSampleSyntaxLayout) == sizeof(WithFunctionSampleSyntax));
+static_assert(offsetof(WithFunctionSampleSyntaxLayout, with) == offsetof(WithFunctionSampleSyntax, with));
+static_assert(offsetof(WithFunctionSampleSyntaxLayout, function) == offsetof(WithFunctionSampleSyntax, function));
+static_assert(offsetof(WithFunctionSampleSyntaxLayout, sample) == offsetof(WithFunctionSampleSyntax, sample));
+
+constexpr SyntaxChildInfo ActionBlockSyntaxChildren[] = {
+    { offsetof(ActionBlockSyntaxLayout, statement), SyntaxChildKind::Node },
+    { offsetof(ActionBlockSyntaxLayout, elseClause), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo AnsiPortListSyntaxChildren[] = {
+    { offsetof(AnsiPortListSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(AnsiPortListSyntaxLayout, ports), SyntaxChildKind::List },
+    { offsetof(AnsiPortListSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ArgumentListSyntaxChildren[] = {
+    { offsetof(ArgumentListSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(ArgumentListSyntaxLayout, parameters), SyntaxChildKind::List },
+    { offsetof(ArgumentListSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo AssertionItemPortListSyntaxChildren[] = {
+    { offsetof(AssertionItemPortListSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(AssertionItemPortListSyntaxLayout, ports), SyntaxChildKind::List },
+    { offsetof(AssertionItemPortListSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo AssertionItemPortSyntaxChildren[] = {
+    { offsetof(AssertionItemPortSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(AssertionItemPortSyntaxLayout, local), SyntaxChildKind::Token },
+    { offsetof(AssertionItemPortSyntaxLayout, direction), SyntaxChildKind::Token },
+    { offsetof(AssertionItemPortSyntaxLayout, type), SyntaxChildKind::NodeReference },
+    { offsetof(AssertionItemPortSyntaxLayout, declarator), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo AssignmentPatternExpressionSyntaxChildren[] = {
+    { offsetof(AssignmentPatternExpressionSyntaxLayout, type), SyntaxChildKind::Node },
+    { offsetof(AssignmentPatternExpressionSyntaxLayout, pattern), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo AssignmentPatternItemSyntaxChildren[] = {
+    { offsetof(AssignmentPatternItemSyntaxLayout, key), SyntaxChildKind::NodeReference },
+    { offsetof(AssignmentPatternItemSyntaxLayout, colon), SyntaxChildKind::Token },
+    { offsetof(AssignmentPatternItemSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo AttributeInstanceSyntaxChildren[] = {
+    { offsetof(AttributeInstanceSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(AttributeInstanceSyntaxLayout, specs), SyntaxChildKind::List },
+    { offsetof(AttributeInstanceSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo AttributeSpecSyntaxChildren[] = {
+    { offsetof(AttributeSpecSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(AttributeSpecSyntaxLayout, value), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo BadExpressionSyntaxChildren[] = {
+    { offsetof(BadExpressionSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo BeginKeywordsDirectiveSyntaxChildren[] = {
+    { offsetof(BeginKeywordsDirectiveSyntaxLayout, directive), SyntaxChildKind::Token },
+    { offsetof(BeginKeywordsDirectiveSyntaxLayout, versionSpecifier), SyntaxChildKind::Token },
+    { offsetof(BeginKeywordsDirectiveSyntaxLayout, endOfDirective), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo BinaryBlockEventExpressionSyntaxChildren[] = {
+    { offsetof(BinaryBlockEventExpressionSyntaxLayout, left), SyntaxChildKind::NodeReference },
+    { offsetof(BinaryBlockEventExpressionSyntaxLayout, orKeyword), SyntaxChildKind::Token },
+    { offsetof(BinaryBlockEventExpressionSyntaxLayout, right), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo BinaryEventExpressionSyntaxChildren[] = {
+    { offsetof(BinaryEventExpressionSyntaxLayout, left), SyntaxChildKind::NodeReference },
+    { offsetof(BinaryEventExpressionSyntaxLayout, operatorToken), SyntaxChildKind::Token },
+    { offsetof(BinaryEventExpressionSyntaxLayout, right), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo BinaryExpressionSyntaxChildren[] = {
+    { offsetof(BinaryExpressionSyntaxLayout, left), SyntaxChildKind::NodeReference },
+    { offsetof(BinaryExpressionSyntaxLayout, operatorToken), SyntaxChildKind::Token },
+    { offsetof(BinaryExpressionSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(BinaryExpressionSyntaxLayout, right), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo BitSelectSyntaxChildren[] = {
+    { offsetof(BitSelectSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo BlockCoverageEventSyntaxChildren[] = {
+    { offsetof(BlockCoverageEventSyntaxLayout, atat), SyntaxChildKind::Token },
+    { offsetof(BlockCoverageEventSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(BlockCoverageEventSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(BlockCoverageEventSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo BlockStatementSyntaxChildren[] = {
+    { offsetof(BlockStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(BlockStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(BlockStatementSyntaxLayout, begin), SyntaxChildKind::Token },
+    { offsetof(BlockStatementSyntaxLayout, blockName), SyntaxChildKind::Node },
+    { offsetof(BlockStatementSyntaxLayout, items), SyntaxChildKind::List },
+    { offsetof(BlockStatementSyntaxLayout, end), SyntaxChildKind::Token },
+    { offsetof(BlockStatementSyntaxLayout, endBlockName), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo CaseGenerateSyntaxChildren[] = {
+    { offsetof(CaseGenerateSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(CaseGenerateSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(CaseGenerateSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(CaseGenerateSyntaxLayout, condition), SyntaxChildKind::NodeReference },
+    { offsetof(CaseGenerateSyntaxLayout, closeParen), SyntaxChildKind::Token },
+    { offsetof(CaseGenerateSyntaxLayout, items), SyntaxChildKind::List },
+    { offsetof(CaseGenerateSyntaxLayout, endCase), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo CaseStatementSyntaxChildren[] = {
+    { offsetof(CaseStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(CaseStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(CaseStatementSyntaxLayout, uniqueOrPriority), SyntaxChildKind::Token },
+    { offsetof(CaseStatementSyntaxLayout, caseKeyword), SyntaxChildKind::Token },
+    { offsetof(CaseStatementSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(CaseStatementSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(CaseStatementSyntaxLayout, closeParen), SyntaxChildKind::Token },
+    { offsetof(CaseStatementSyntaxLayout, matchesOrInside), SyntaxChildKind::Token },
+    { offsetof(CaseStatementSyntaxLayout, items), SyntaxChildKind::List },
+    { offsetof(CaseStatementSyntaxLayout, endcase), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo CastExpressionSyntaxChildren[] = {
+    { offsetof(CastExpressionSyntaxLayout, left), SyntaxChildKind::NodeReference },
+    { offsetof(CastExpressionSyntaxLayout, apostrophe), SyntaxChildKind::Token },
+    { offsetof(CastExpressionSyntaxLayout, right), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ChargeStrengthSyntaxChildren[] = {
+    { offsetof(ChargeStrengthSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(ChargeStrengthSyntaxLayout, strength), SyntaxChildKind::Token },
+    { offsetof(ChargeStrengthSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ClassDeclarationSyntaxChildren[] = {
+    { offsetof(ClassDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ClassDeclarationSyntaxLayout, virtualOrInterface), SyntaxChildKind::Token },
+    { offsetof(ClassDeclarationSyntaxLayout, classKeyword), SyntaxChildKind::Token },
+    { offsetof(ClassDeclarationSyntaxLayout, lifetime), SyntaxChildKind::Token },
+    { offsetof(ClassDeclarationSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(ClassDeclarationSyntaxLayout, parameters), SyntaxChildKind::Node },
+    { offsetof(ClassDeclarationSyntaxLayout, extendsClause), SyntaxChildKind::Node },
+    { offsetof(ClassDeclarationSyntaxLayout, implementsClause), SyntaxChildKind::Node },
+    { offsetof(ClassDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+    { offsetof(ClassDeclarationSyntaxLayout, items), SyntaxChildKind::List },
+    { offsetof(ClassDeclarationSyntaxLayout, endClass), SyntaxChildKind::Token },
+    { offsetof(ClassDeclarationSyntaxLayout, endBlockName), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo ClassMethodDeclarationSyntaxChildren[] = {
+    { offsetof(ClassMethodDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ClassMethodDeclarationSyntaxLayout, qualifiers), SyntaxChildKind::List },
+    { offsetof(ClassMethodDeclarationSyntaxLayout, declaration), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ClassMethodPrototypeSyntaxChildren[] = {
+    { offsetof(ClassMethodPrototypeSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ClassMethodPrototypeSyntaxLayout, qualifiers), SyntaxChildKind::List },
+    { offsetof(ClassMethodPrototypeSyntaxLayout, prototype), SyntaxChildKind::NodeReference },
+    { offsetof(ClassMethodPrototypeSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ClassNameSyntaxChildren[] = {
+    { offsetof(ClassNameSyntaxLayout, identifier), SyntaxChildKind::Token },
+    { offsetof(ClassNameSyntaxLayout, parameters), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ClassPropertyDeclarationSyntaxChildren[] = {
+    { offsetof(ClassPropertyDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ClassPropertyDeclarationSyntaxLayout, qualifiers), SyntaxChildKind::List },
+    { offsetof(ClassPropertyDeclarationSyntaxLayout, declaration), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ClassScopeSyntaxChildren[] = {
+    { offsetof(ClassScopeSyntaxLayout, left), SyntaxChildKind::NodeReference },
+    { offsetof(ClassScopeSyntaxLayout, separator), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ClockingDeclarationSyntaxChildren[] = {
+    { offsetof(ClockingDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ClockingDeclarationSyntaxLayout, globalOrDefault), SyntaxChildKind::Token },
+    { offsetof(ClockingDeclarationSyntaxLayout, clocking), SyntaxChildKind::Token },
+    { offsetof(ClockingDeclarationSyntaxLayout, blockName), SyntaxChildKind::Token },
+    { offsetof(ClockingDeclarationSyntaxLayout, at), SyntaxChildKind::Token },
+    { offsetof(ClockingDeclarationSyntaxLayout, event), SyntaxChildKind::Node },
+    { offsetof(ClockingDeclarationSyntaxLayout, eventIdentifier), SyntaxChildKind::Token },
+    { offsetof(ClockingDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+    { offsetof(ClockingDeclarationSyntaxLayout, items), SyntaxChildKind::List },
+    { offsetof(ClockingDeclarationSyntaxLayout, endClocking), SyntaxChildKind::Token },
+    { offsetof(ClockingDeclarationSyntaxLayout, endBlockName), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo ClockingDirectionSyntaxChildren[] = {
+    { offsetof(ClockingDirectionSyntaxLayout, input), SyntaxChildKind::Token },
+    { offsetof(ClockingDirectionSyntaxLayout, inputSkew), SyntaxChildKind::Node },
+    { offsetof(ClockingDirectionSyntaxLayout, output), SyntaxChildKind::Token },
+    { offsetof(ClockingDirectionSyntaxLayout, ouputSkew), SyntaxChildKind::Node },
+    { offsetof(ClockingDirectionSyntaxLayout, inout), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ClockingItemSyntaxChildren[] = {
+    { offsetof(ClockingItemSyntaxLayout, defaultKeyword), SyntaxChildKind::Token },
+    { offsetof(ClockingItemSyntaxLayout, direction), SyntaxChildKind::Node },
+    { offsetof(ClockingItemSyntaxLayout, assignments), SyntaxChildKind::List },
+    { offsetof(ClockingItemSyntaxLayout, semi), SyntaxChildKind::Token },
+    { offsetof(ClockingItemSyntaxLayout, declaration), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo ClockingSkewSyntaxChildren[] = {
+    { offsetof(ClockingSkewSyntaxLayout, edge), SyntaxChildKind::Token },
+    { offsetof(ClockingSkewSyntaxLayout, hash), SyntaxChildKind::Token },
+    { offsetof(ClockingSkewSyntaxLayout, value), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo ColonExpressionClauseSyntaxChildren[] = {
+    { offsetof(ColonExpressionClauseSyntaxLayout, colon), SyntaxChildKind::Token },
+    { offsetof(ColonExpressionClauseSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo CompilationUnitSyntaxChildren[] = {
+    { offsetof(CompilationUnitSyntaxLayout, members), SyntaxChildKind::List },
+    { offsetof(CompilationUnitSyntaxLayout, endOfFile), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ConcatenationExpressionSyntaxChildren[] = {
+    { offsetof(ConcatenationExpressionSyntaxLayout, openBrace), SyntaxChildKind::Token },
+    { offsetof(ConcatenationExpressionSyntaxLayout, expressions), SyntaxChildKind::List },
+    { offsetof(ConcatenationExpressionSyntaxLayout, closeBrace), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ConcurrentAssertionMemberSyntaxChildren[] = {
+    { offsetof(ConcurrentAssertionMemberSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ConcurrentAssertionMemberSyntaxLayout, statement), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ConcurrentAssertionStatementSyntaxChildren[] = {
+    { offsetof(ConcurrentAssertionStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(ConcurrentAssertionStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ConcurrentAssertionStatementSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(ConcurrentAssertionStatementSyntaxLayout, propertyOrSequence), SyntaxChildKind::Token },
+    { offsetof(ConcurrentAssertionStatementSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(ConcurrentAssertionStatementSyntaxLayout, propertySpec), SyntaxChildKind::NodeReference },
+    { offsetof(ConcurrentAssertionStatementSyntaxLayout, closeParen), SyntaxChildKind::Token },
+    { offsetof(ConcurrentAssertionStatementSyntaxLayout, action), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ConditionalBranchDirectiveSyntaxChildren[] = {
+    { offsetof(ConditionalBranchDirectiveSyntaxLayout, directive), SyntaxChildKind::Token },
+    { offsetof(ConditionalBranchDirectiveSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(ConditionalBranchDirectiveSyntaxLayout, endOfDirective), SyntaxChildKind::Token },
+    { offsetof(ConditionalBranchDirectiveSyntaxLayout, disabledTokens), SyntaxChildKind::List },
+};
+
+constexpr SyntaxChildInfo ConditionalConstraintSyntaxChildren[] = {
+    { offsetof(ConditionalConstraintSyntaxLayout, ifKeyword), SyntaxChildKind::Token },
+    { offsetof(ConditionalConstraintSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(ConditionalConstraintSyntaxLayout, condition), SyntaxChildKind::NodeReference },
+    { offsetof(ConditionalConstraintSyntaxLayout, closeParen), SyntaxChildKind::Token },
+    { offsetof(ConditionalConstraintSyntaxLayout, constraints), SyntaxChildKind::NodeReference },
+    { offsetof(ConditionalConstraintSyntaxLayout, elseClause), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo ConditionalExpressionSyntaxChildren[] = {
+    { offsetof(ConditionalExpressionSyntaxLayout, predicate), SyntaxChildKind::NodeReference },
+    { offsetof(ConditionalExpressionSyntaxLayout, question), SyntaxChildKind::Token },
+    { offsetof(ConditionalExpressionSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ConditionalExpressionSyntaxLayout, left), SyntaxChildKind::NodeReference },
+    { offsetof(ConditionalExpressionSyntaxLayout, colon), SyntaxChildKind::Token },
+    { offsetof(ConditionalExpressionSyntaxLayout, right), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ConditionalPatternSyntaxChildren[] = {
+    { offsetof(ConditionalPatternSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(ConditionalPatternSyntaxLayout, matchesClause), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo ConditionalPredicateSyntaxChildren[] = {
+    { offsetof(ConditionalPredicateSyntaxLayout, conditions), SyntaxChildKind::List },
+};
+
+constexpr SyntaxChildInfo ConditionalStatementSyntaxChildren[] = {
+    { offsetof(ConditionalStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(ConditionalStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ConditionalStatementSyntaxLayout, uniqueOrPriority), SyntaxChildKind::Token },
+    { offsetof(ConditionalStatementSyntaxLayout, ifKeyword), SyntaxChildKind::Token },
+    { offsetof(ConditionalStatementSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(ConditionalStatementSyntaxLayout, predicate), SyntaxChildKind::NodeReference },
+    { offsetof(ConditionalStatementSyntaxLayout, closeParen), SyntaxChildKind::Token },
+    { offsetof(ConditionalStatementSyntaxLayout, statement), SyntaxChildKind::NodeReference },
+    { offsetof(ConditionalStatementSyntaxLayout, elseClause), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo ConstraintBlockSyntaxChildren[] = {
+    { offsetof(ConstraintBlockSyntaxLayout, openBrace), SyntaxChildKind::Token },
+    { offsetof(ConstraintBlockSyntaxLayout, items), SyntaxChildKind::List },
+    { offsetof(ConstraintBlockSyntaxLayout, closeBrace), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ConstraintDeclarationSyntaxChildren[] = {
+    { offsetof(ConstraintDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ConstraintDeclarationSyntaxLayout, qualifiers), SyntaxChildKind::List },
+    { offsetof(ConstraintDeclarationSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(ConstraintDeclarationSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(ConstraintDeclarationSyntaxLayout, block), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ConstraintPrototypeSyntaxChildren[] = {
+    { offsetof(ConstraintPrototypeSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ConstraintPrototypeSyntaxLayout, qualifiers), SyntaxChildKind::List },
+    { offsetof(ConstraintPrototypeSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(ConstraintPrototypeSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(ConstraintPrototypeSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ContinuousAssignSyntaxChildren[] = {
+    { offsetof(ContinuousAssignSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ContinuousAssignSyntaxLayout, assign), SyntaxChildKind::Token },
+    { offsetof(ContinuousAssignSyntaxLayout, assignments), SyntaxChildKind::List },
+    { offsetof(ContinuousAssignSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo CoverageBinsSyntaxChildren[] = {
+    { offsetof(CoverageBinsSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(CoverageBinsSyntaxLayout, wildcard), SyntaxChildKind::Token },
+    { offsetof(CoverageBinsSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(CoverageBinsSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(CoverageBinsSyntaxLayout, selector), SyntaxChildKind::Node },
+    { offsetof(CoverageBinsSyntaxLayout, equals), SyntaxChildKind::Token },
+    { offsetof(CoverageBinsSyntaxLayout, initializer), SyntaxChildKind::NodeReference },
+    { offsetof(CoverageBinsSyntaxLayout, iff), SyntaxChildKind::Node },
+    { offsetof(CoverageBinsSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo CoverageOptionSyntaxChildren[] = {
+    { offsetof(CoverageOptionSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(CoverageOptionSyntaxLayout, option), SyntaxChildKind::Token },
+    { offsetof(CoverageOptionSyntaxLayout, dot), SyntaxChildKind::Token },
+    { offsetof(CoverageOptionSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(CoverageOptionSyntaxLayout, equals), SyntaxChildKind::Token },
+    { offsetof(CoverageOptionSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(CoverageOptionSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo CovergroupDeclarationSyntaxChildren[] = {
+    { offsetof(CovergroupDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(CovergroupDeclarationSyntaxLayout, covergroup), SyntaxChildKind::Token },
+    { offsetof(CovergroupDeclarationSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(CovergroupDeclarationSyntaxLayout, portList), SyntaxChildKind::Node },
+    { offsetof(CovergroupDeclarationSyntaxLayout, event), SyntaxChildKind::Node },
+    { offsetof(CovergroupDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+    { offsetof(CovergroupDeclarationSyntaxLayout, members), SyntaxChildKind::List },
+    { offsetof(CovergroupDeclarationSyntaxLayout, endgroup), SyntaxChildKind::Token },
+    { offsetof(CovergroupDeclarationSyntaxLayout, endBlockName), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo CoverpointSyntaxChildren[] = {
+    { offsetof(CoverpointSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(CoverpointSyntaxLayout, type), SyntaxChildKind::Node },
+    { offsetof(CoverpointSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(CoverpointSyntaxLayout, coverpoint), SyntaxChildKind::Token },
+    { offsetof(CoverpointSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(CoverpointSyntaxLayout, openBrace), SyntaxChildKind::Token },
+    { offsetof(CoverpointSyntaxLayout, members), SyntaxChildKind::List },
+    { offsetof(CoverpointSyntaxLayout, closeBrace), SyntaxChildKind::Token },
+    { offsetof(CoverpointSyntaxLayout, emptySemi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DPIImportExportSyntaxChildren[] = {
+    { offsetof(DPIImportExportSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(DPIImportExportSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(DPIImportExportSyntaxLayout, stringLiteral), SyntaxChildKind::Token },
+    { offsetof(DPIImportExportSyntaxLayout, property), SyntaxChildKind::Token },
+    { offsetof(DPIImportExportSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(DPIImportExportSyntaxLayout, equals), SyntaxChildKind::Token },
+    { offsetof(DPIImportExportSyntaxLayout, method), SyntaxChildKind::NodeReference },
+    { offsetof(DPIImportExportSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DataDeclarationSyntaxChildren[] = {
+    { offsetof(DataDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(DataDeclarationSyntaxLayout, modifiers), SyntaxChildKind::List },
+    { offsetof(DataDeclarationSyntaxLayout, type), SyntaxChildKind::NodeReference },
+    { offsetof(DataDeclarationSyntaxLayout, declarators), SyntaxChildKind::List },
+    { offsetof(DataDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DataTypeDimensionSpecifierSyntaxChildren[] = {
+    { offsetof(DataTypeDimensionSpecifierSyntaxLayout, type), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo DefParamAssignmentSyntaxChildren[] = {
+    { offsetof(DefParamAssignmentSyntaxLayout, name), SyntaxChildKind::NodeReference },
+    { offsetof(DefParamAssignmentSyntaxLayout, setter), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo DefParamSyntaxChildren[] = {
+    { offsetof(DefParamSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(DefParamSyntaxLayout, defparam), SyntaxChildKind::Token },
+    { offsetof(DefParamSyntaxLayout, assignments), SyntaxChildKind::List },
+    { offsetof(DefParamSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DefaultCaseItemSyntaxChildren[] = {
+    { offsetof(DefaultCaseItemSyntaxLayout, defaultKeyword), SyntaxChildKind::Token },
+    { offsetof(DefaultCaseItemSyntaxLayout, colon), SyntaxChildKind::Token },
+    { offsetof(DefaultCaseItemSyntaxLayout, clause), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo DefaultCoverageBinInitializerSyntaxChildren[] = {
+    { offsetof(DefaultCoverageBinInitializerSyntaxLayout, defaultKeyword), SyntaxChildKind::Token },
+    { offsetof(DefaultCoverageBinInitializerSyntaxLayout, sequenceKeyword), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DefaultNetTypeDirectiveSyntaxChildren[] = {
+    { offsetof(DefaultNetTypeDirectiveSyntaxLayout, directive), SyntaxChildKind::Token },
+    { offsetof(DefaultNetTypeDirectiveSyntaxLayout, netType), SyntaxChildKind::Token },
+    { offsetof(DefaultNetTypeDirectiveSyntaxLayout, endOfDirective), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DeferredAssertionSyntaxChildren[] = {
+    { offsetof(DeferredAssertionSyntaxLayout, hash), SyntaxChildKind::Token },
+    { offsetof(DeferredAssertionSyntaxLayout, zero), SyntaxChildKind::Token },
+    { offsetof(DeferredAssertionSyntaxLayout, finalKeyword), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DefineDirectiveSyntaxChildren[] = {
+    { offsetof(DefineDirectiveSyntaxLayout, directive), SyntaxChildKind::Token },
+    { offsetof(DefineDirectiveSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(DefineDirectiveSyntaxLayout, formalArguments), SyntaxChildKind::Node },
+    { offsetof(DefineDirectiveSyntaxLayout, body), SyntaxChildKind::List },
+    { offsetof(DefineDirectiveSyntaxLayout, endOfDirective), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DelaySyntaxChildren[] = {
+    { offsetof(DelaySyntaxLayout, hash), SyntaxChildKind::Token },
+    { offsetof(DelaySyntaxLayout, delayValue), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo DisableConstraintSyntaxChildren[] = {
+    { offsetof(DisableConstraintSyntaxLayout, disable), SyntaxChildKind::Token },
+    { offsetof(DisableConstraintSyntaxLayout, soft), SyntaxChildKind::Token },
+    { offsetof(DisableConstraintSyntaxLayout, name), SyntaxChildKind::NodeReference },
+    { offsetof(DisableConstraintSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DisableForkStatementSyntaxChildren[] = {
+    { offsetof(DisableForkStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(DisableForkStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(DisableForkStatementSyntaxLayout, disable), SyntaxChildKind::Token },
+    { offsetof(DisableForkStatementSyntaxLayout, fork), SyntaxChildKind::Token },
+    { offsetof(DisableForkStatementSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DisableIffSyntaxChildren[] = {
+    { offsetof(DisableIffSyntaxLayout, disable), SyntaxChildKind::Token },
+    { offsetof(DisableIffSyntaxLayout, iff), SyntaxChildKind::Token },
+    { offsetof(DisableIffSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(DisableIffSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(DisableIffSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DisableStatementSyntaxChildren[] = {
+    { offsetof(DisableStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(DisableStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(DisableStatementSyntaxLayout, disable), SyntaxChildKind::Token },
+    { offsetof(DisableStatementSyntaxLayout, name), SyntaxChildKind::NodeReference },
+    { offsetof(DisableStatementSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DistConstraintListSyntaxChildren[] = {
+    { offsetof(DistConstraintListSyntaxLayout, dist), SyntaxChildKind::Token },
+    { offsetof(DistConstraintListSyntaxLayout, openBrace), SyntaxChildKind::Token },
+    { offsetof(DistConstraintListSyntaxLayout, items), SyntaxChildKind::List },
+    { offsetof(DistConstraintListSyntaxLayout, closeBrace), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DistItemSyntaxChildren[] = {
+    { offsetof(DistItemSyntaxLayout, range), SyntaxChildKind::NodeReference },
+    { offsetof(DistItemSyntaxLayout, weight), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo DistWeightSyntaxChildren[] = {
+    { offsetof(DistWeightSyntaxLayout, op), SyntaxChildKind::Token },
+    { offsetof(DistWeightSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo DividerClauseSyntaxChildren[] = {
+    { offsetof(DividerClauseSyntaxLayout, divide), SyntaxChildKind::Token },
+    { offsetof(DividerClauseSyntaxLayout, value), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DoWhileStatementSyntaxChildren[] = {
+    { offsetof(DoWhileStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(DoWhileStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(DoWhileStatementSyntaxLayout, doKeyword), SyntaxChildKind::Token },
+    { offsetof(DoWhileStatementSyntaxLayout, statement), SyntaxChildKind::NodeReference },
+    { offsetof(DoWhileStatementSyntaxLayout, whileKeyword), SyntaxChildKind::Token },
+    { offsetof(DoWhileStatementSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(DoWhileStatementSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(DoWhileStatementSyntaxLayout, closeParen), SyntaxChildKind::Token },
+    { offsetof(DoWhileStatementSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DotMemberClauseSyntaxChildren[] = {
+    { offsetof(DotMemberClauseSyntaxLayout, dot), SyntaxChildKind::Token },
+    { offsetof(DotMemberClauseSyntaxLayout, member), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo DriveStrengthSyntaxChildren[] = {
+    { offsetof(DriveStrengthSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(DriveStrengthSyntaxLayout, strength0), SyntaxChildKind::Token },
+    { offsetof(DriveStrengthSyntaxLayout, comma), SyntaxChildKind::Token },
+    { offsetof(DriveStrengthSyntaxLayout, strength1), SyntaxChildKind::Token },
+    { offsetof(DriveStrengthSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ElementSelectExpressionSyntaxChildren[] = {
+    { offsetof(ElementSelectExpressionSyntaxLayout, left), SyntaxChildKind::NodeReference },
+    { offsetof(ElementSelectExpressionSyntaxLayout, select), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ElementSelectSyntaxChildren[] = {
+    { offsetof(ElementSelectSyntaxLayout, openBracket), SyntaxChildKind::Token },
+    { offsetof(ElementSelectSyntaxLayout, selector), SyntaxChildKind::Node },
+    { offsetof(ElementSelectSyntaxLayout, closeBracket), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ElseClauseSyntaxChildren[] = {
+    { offsetof(ElseClauseSyntaxLayout, elseKeyword), SyntaxChildKind::Token },
+    { offsetof(ElseClauseSyntaxLayout, clause), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ElseConstraintClauseSyntaxChildren[] = {
+    { offsetof(ElseConstraintClauseSyntaxLayout, elseKeyword), SyntaxChildKind::Token },
+    { offsetof(ElseConstraintClauseSyntaxLayout, constraints), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo EmptyMemberSyntaxChildren[] = {
+    { offsetof(EmptyMemberSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(EmptyMemberSyntaxLayout, qualifiers), SyntaxChildKind::List },
+    { offsetof(EmptyMemberSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo EmptyQueueExpressionSyntaxChildren[] = {
+    { offsetof(EmptyQueueExpressionSyntaxLayout, openBrace), SyntaxChildKind::Token },
+    { offsetof(EmptyQueueExpressionSyntaxLayout, closeBrace), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo EmptyStatementSyntaxChildren[] = {
+    { offsetof(EmptyStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(EmptyStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(EmptyStatementSyntaxLayout, semicolon), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo EnumTypeSyntaxChildren[] = {
+    { offsetof(EnumTypeSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(EnumTypeSyntaxLayout, baseType), SyntaxChildKind::Node },
+    { offsetof(EnumTypeSyntaxLayout, openBrace), SyntaxChildKind::Token },
+    { offsetof(EnumTypeSyntaxLayout, members), SyntaxChildKind::List },
+    { offsetof(EnumTypeSyntaxLayout, closeBrace), SyntaxChildKind::Token },
+    { offsetof(EnumTypeSyntaxLayout, dimensions), SyntaxChildKind::List },
+};
+
+constexpr SyntaxChildInfo EqualsValueClauseSyntaxChildren[] = {
+    { offsetof(EqualsValueClauseSyntaxLayout, equals), SyntaxChildKind::Token },
+    { offsetof(EqualsValueClauseSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo EventControlSyntaxChildren[] = {
+    { offsetof(EventControlSyntaxLayout, at), SyntaxChildKind::Token },
+    { offsetof(EventControlSyntaxLayout, eventName), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo EventControlWithExpressionSyntaxChildren[] = {
+    { offsetof(EventControlWithExpressionSyntaxLayout, at), SyntaxChildKind::Token },
+    { offsetof(EventControlWithExpressionSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo EventTriggerStatementSyntaxChildren[] = {
+    { offsetof(EventTriggerStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(EventTriggerStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(EventTriggerStatementSyntaxLayout, trigger), SyntaxChildKind::Token },
+    { offsetof(EventTriggerStatementSyntaxLayout, timing), SyntaxChildKind::Node },
+    { offsetof(EventTriggerStatementSyntaxLayout, name), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ExplicitAnsiPortSyntaxChildren[] = {
+    { offsetof(ExplicitAnsiPortSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ExplicitAnsiPortSyntaxLayout, direction), SyntaxChildKind::Token },
+    { offsetof(ExplicitAnsiPortSyntaxLayout, dot), SyntaxChildKind::Token },
+    { offsetof(ExplicitAnsiPortSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(ExplicitAnsiPortSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(ExplicitAnsiPortSyntaxLayout, expr), SyntaxChildKind::Node },
+    { offsetof(ExplicitAnsiPortSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ExplicitNonAnsiPortSyntaxChildren[] = {
+    { offsetof(ExplicitNonAnsiPortSyntaxLayout, dot), SyntaxChildKind::Token },
+    { offsetof(ExplicitNonAnsiPortSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(ExplicitNonAnsiPortSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(ExplicitNonAnsiPortSyntaxLayout, expr), SyntaxChildKind::Node },
+    { offsetof(ExplicitNonAnsiPortSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ExpressionConstraintSyntaxChildren[] = {
+    { offsetof(ExpressionConstraintSyntaxLayout, soft), SyntaxChildKind::Token },
+    { offsetof(ExpressionConstraintSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(ExpressionConstraintSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ExpressionCoverageBinInitializerSyntaxChildren[] = {
+    { offsetof(ExpressionCoverageBinInitializerSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(ExpressionCoverageBinInitializerSyntaxLayout, withClause), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo ExpressionOrDistSyntaxChildren[] = {
+    { offsetof(ExpressionOrDistSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(ExpressionOrDistSyntaxLayout, distribution), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ExpressionPatternSyntaxChildren[] = {
+    { offsetof(ExpressionPatternSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ExpressionStatementSyntaxChildren[] = {
+    { offsetof(ExpressionStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(ExpressionStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ExpressionStatementSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(ExpressionStatementSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ExtendsClauseSyntaxChildren[] = {
+    { offsetof(ExtendsClauseSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(ExtendsClauseSyntaxLayout, baseName), SyntaxChildKind::NodeReference },
+    { offsetof(ExtendsClauseSyntaxLayout, arguments), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo ExternModuleSyntaxChildren[] = {
+    { offsetof(ExternModuleSyntaxLayout, externKeyword), SyntaxChildKind::Token },
+    { offsetof(ExternModuleSyntaxLayout, header), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ForLoopStatementSyntaxChildren[] = {
+    { offsetof(ForLoopStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(ForLoopStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ForLoopStatementSyntaxLayout, forKeyword), SyntaxChildKind::Token },
+    { offsetof(ForLoopStatementSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(ForLoopStatementSyntaxLayout, initializers), SyntaxChildKind::List },
+    { offsetof(ForLoopStatementSyntaxLayout, semi1), SyntaxChildKind::Token },
+    { offsetof(ForLoopStatementSyntaxLayout, stopExpr), SyntaxChildKind::NodeReference },
+    { offsetof(ForLoopStatementSyntaxLayout, semi2), SyntaxChildKind::Token },
+    { offsetof(ForLoopStatementSyntaxLayout, steps), SyntaxChildKind::List },
+    { offsetof(ForLoopStatementSyntaxLayout, closeParen), SyntaxChildKind::Token },
+    { offsetof(ForLoopStatementSyntaxLayout, statement), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ForVariableDeclarationSyntaxChildren[] = {
+    { offsetof(ForVariableDeclarationSyntaxLayout, varKeyword), SyntaxChildKind::Token },
+    { offsetof(ForVariableDeclarationSyntaxLayout, type), SyntaxChildKind::NodeReference },
+    { offsetof(ForVariableDeclarationSyntaxLayout, declarator), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ForeachLoopListSyntaxChildren[] = {
+    { offsetof(ForeachLoopListSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(ForeachLoopListSyntaxLayout, arrayName), SyntaxChildKind::NodeReference },
+    { offsetof(ForeachLoopListSyntaxLayout, openBracket), SyntaxChildKind::Token },
+    { offsetof(ForeachLoopListSyntaxLayout, loopVariables), SyntaxChildKind::List },
+    { offsetof(ForeachLoopListSyntaxLayout, closeBracket), SyntaxChildKind::Token },
+    { offsetof(ForeachLoopListSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ForeachLoopStatementSyntaxChildren[] = {
+    { offsetof(ForeachLoopStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(ForeachLoopStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ForeachLoopStatementSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(ForeachLoopStatementSyntaxLayout, loopList), SyntaxChildKind::NodeReference },
+    { offsetof(ForeachLoopStatementSyntaxLayout, statement), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ForeverStatementSyntaxChildren[] = {
+    { offsetof(ForeverStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(ForeverStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ForeverStatementSyntaxLayout, foreverKeyword), SyntaxChildKind::Token },
+    { offsetof(ForeverStatementSyntaxLayout, statement), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ForwardInterfaceClassTypedefDeclarationSyntaxChildren[] = {
+    { offsetof(ForwardInterfaceClassTypedefDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ForwardInterfaceClassTypedefDeclarationSyntaxLayout, typedefKeyword), SyntaxChildKind::Token },
+    { offsetof(ForwardInterfaceClassTypedefDeclarationSyntaxLayout, interfaceKeyword), SyntaxChildKind::Token },
+    { offsetof(ForwardInterfaceClassTypedefDeclarationSyntaxLayout, classKeyword), SyntaxChildKind::Token },
+    { offsetof(ForwardInterfaceClassTypedefDeclarationSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(ForwardInterfaceClassTypedefDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ForwardTypedefDeclarationSyntaxChildren[] = {
+    { offsetof(ForwardTypedefDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ForwardTypedefDeclarationSyntaxLayout, typedefKeyword), SyntaxChildKind::Token },
+    { offsetof(ForwardTypedefDeclarationSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(ForwardTypedefDeclarationSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(ForwardTypedefDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo FunctionDeclarationSyntaxChildren[] = {
+    { offsetof(FunctionDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(FunctionDeclarationSyntaxLayout, prototype), SyntaxChildKind::NodeReference },
+    { offsetof(FunctionDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+    { offsetof(FunctionDeclarationSyntaxLayout, items), SyntaxChildKind::List },
+    { offsetof(FunctionDeclarationSyntaxLayout, end), SyntaxChildKind::Token },
+    { offsetof(FunctionDeclarationSyntaxLayout, endBlockName), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo FunctionPortListSyntaxChildren[] = {
+    { offsetof(FunctionPortListSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(FunctionPortListSyntaxLayout, ports), SyntaxChildKind::List },
+    { offsetof(FunctionPortListSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo FunctionPortSyntaxChildren[] = {
+    { offsetof(FunctionPortSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(FunctionPortSyntaxLayout, constKeyword), SyntaxChildKind::Token },
+    { offsetof(FunctionPortSyntaxLayout, direction), SyntaxChildKind::Token },
+    { offsetof(FunctionPortSyntaxLayout, varKeyword), SyntaxChildKind::Token },
+    { offsetof(FunctionPortSyntaxLayout, dataType), SyntaxChildKind::Node },
+    { offsetof(FunctionPortSyntaxLayout, declarator), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo FunctionPrototypeSyntaxChildren[] = {
+    { offsetof(FunctionPrototypeSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(FunctionPrototypeSyntaxLayout, lifetime), SyntaxChildKind::Token },
+    { offsetof(FunctionPrototypeSyntaxLayout, returnType), SyntaxChildKind::Node },
+    { offsetof(FunctionPrototypeSyntaxLayout, name), SyntaxChildKind::NodeReference },
+    { offsetof(FunctionPrototypeSyntaxLayout, portList), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo GenerateBlockSyntaxChildren[] = {
+    { offsetof(GenerateBlockSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(GenerateBlockSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(GenerateBlockSyntaxLayout, begin), SyntaxChildKind::Token },
+    { offsetof(GenerateBlockSyntaxLayout, beginName), SyntaxChildKind::Node },
+    { offsetof(GenerateBlockSyntaxLayout, members), SyntaxChildKind::List },
+    { offsetof(GenerateBlockSyntaxLayout, end), SyntaxChildKind::Token },
+    { offsetof(GenerateBlockSyntaxLayout, endName), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo GenerateRegionSyntaxChildren[] = {
+    { offsetof(GenerateRegionSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(GenerateRegionSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(GenerateRegionSyntaxLayout, members), SyntaxChildKind::List },
+    { offsetof(GenerateRegionSyntaxLayout, endgenerate), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo GenvarDeclarationSyntaxChildren[] = {
+    { offsetof(GenvarDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(GenvarDeclarationSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(GenvarDeclarationSyntaxLayout, identifiers), SyntaxChildKind::List },
+    { offsetof(GenvarDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo HierarchicalInstanceSyntaxChildren[] = {
+    { offsetof(HierarchicalInstanceSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(HierarchicalInstanceSyntaxLayout, dimensions), SyntaxChildKind::List },
+    { offsetof(HierarchicalInstanceSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(HierarchicalInstanceSyntaxLayout, connections), SyntaxChildKind::List },
+    { offsetof(HierarchicalInstanceSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo HierarchyInstantiationSyntaxChildren[] = {
+    { offsetof(HierarchyInstantiationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(HierarchyInstantiationSyntaxLayout, type), SyntaxChildKind::Token },
+    { offsetof(HierarchyInstantiationSyntaxLayout, parameters), SyntaxChildKind::Node },
+    { offsetof(HierarchyInstantiationSyntaxLayout, instances), SyntaxChildKind::List },
+    { offsetof(HierarchyInstantiationSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo IdentifierListSyntaxChildren[] = {
+    { offsetof(IdentifierListSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(IdentifierListSyntaxLayout, identifiers), SyntaxChildKind::List },
+    { offsetof(IdentifierListSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo IdentifierNameSyntaxChildren[] = {
+    { offsetof(IdentifierNameSyntaxLayout, identifier), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo IdentifierSelectNameSyntaxChildren[] = {
+    { offsetof(IdentifierSelectNameSyntaxLayout, identifier), SyntaxChildKind::Token },
+    { offsetof(IdentifierSelectNameSyntaxLayout, selectors), SyntaxChildKind::List },
+};
+
+constexpr SyntaxChildInfo IfGenerateSyntaxChildren[] = {
+    { offsetof(IfGenerateSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(IfGenerateSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(IfGenerateSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(IfGenerateSyntaxLayout, condition), SyntaxChildKind::NodeReference },
+    { offsetof(IfGenerateSyntaxLayout, closeParen), SyntaxChildKind::Token },
+    { offsetof(IfGenerateSyntaxLayout, block), SyntaxChildKind::NodeReference },
+    { offsetof(IfGenerateSyntaxLayout, elseClause), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo IffClauseSyntaxChildren[] = {
+    { offsetof(IffClauseSyntaxLayout, iff), SyntaxChildKind::Token },
+    { offsetof(IffClauseSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(IffClauseSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(IffClauseSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ImmediateAssertionMemberSyntaxChildren[] = {
+    { offsetof(ImmediateAssertionMemberSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ImmediateAssertionMemberSyntaxLayout, statement), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ImmediateAssertionStatementSyntaxChildren[] = {
+    { offsetof(ImmediateAssertionStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(ImmediateAssertionStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ImmediateAssertionStatementSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(ImmediateAssertionStatementSyntaxLayout, delay), SyntaxChildKind::Node },
+    { offsetof(ImmediateAssertionStatementSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(ImmediateAssertionStatementSyntaxLayout, action), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ImplementsClauseSyntaxChildren[] = {
+    { offsetof(ImplementsClauseSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(ImplementsClauseSyntaxLayout, interfaces), SyntaxChildKind::List },
+};
+
+constexpr SyntaxChildInfo ImplicationConstraintSyntaxChildren[] = {
+    { offsetof(ImplicationConstraintSyntaxLayout, left), SyntaxChildKind::NodeReference },
+    { offsetof(ImplicationConstraintSyntaxLayout, arrow), SyntaxChildKind::Token },
+    { offsetof(ImplicationConstraintSyntaxLayout, constraints), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ImplicitAnsiPortSyntaxChildren[] = {
+    { offsetof(ImplicitAnsiPortSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ImplicitAnsiPortSyntaxLayout, header), SyntaxChildKind::NodeReference },
+    { offsetof(ImplicitAnsiPortSyntaxLayout, declarator), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ImplicitEventControlSyntaxChildren[] = {
+    { offsetof(ImplicitEventControlSyntaxLayout, atStar), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ImplicitNonAnsiPortSyntaxChildren[] = {
+    { offsetof(ImplicitNonAnsiPortSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ImplicitTypeSyntaxChildren[] = {
+    { offsetof(ImplicitTypeSyntaxLayout, signing), SyntaxChildKind::Token },
+    { offsetof(ImplicitTypeSyntaxLayout, dimensions), SyntaxChildKind::List },
+};
+
+constexpr SyntaxChildInfo IncludeDirectiveSyntaxChildren[] = {
+    { offsetof(IncludeDirectiveSyntaxLayout, directive), SyntaxChildKind::Token },
+    { offsetof(IncludeDirectiveSyntaxLayout, fileName), SyntaxChildKind::Token },
+    { offsetof(IncludeDirectiveSyntaxLayout, endOfDirective), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo InsideExpressionSyntaxChildren[] = {
+    { offsetof(InsideExpressionSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(InsideExpressionSyntaxLayout, inside), SyntaxChildKind::Token },
+    { offsetof(InsideExpressionSyntaxLayout, ranges), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo IntegerTypeSyntaxChildren[] = {
+    { offsetof(IntegerTypeSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(IntegerTypeSyntaxLayout, signing), SyntaxChildKind::Token },
+    { offsetof(IntegerTypeSyntaxLayout, dimensions), SyntaxChildKind::List },
+};
+
+constexpr SyntaxChildInfo IntegerVectorExpressionSyntaxChildren[] = {
+    { offsetof(IntegerVectorExpressionSyntaxLayout, size), SyntaxChildKind::Token },
+    { offsetof(IntegerVectorExpressionSyntaxLayout, base), SyntaxChildKind::Token },
+    { offsetof(IntegerVectorExpressionSyntaxLayout, value), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo InterconnectPortHeaderSyntaxChildren[] = {
+    { offsetof(InterconnectPortHeaderSyntaxLayout, direction), SyntaxChildKind::Token },
+    { offsetof(InterconnectPortHeaderSyntaxLayout, interconnect), SyntaxChildKind::Token },
+    { offsetof(InterconnectPortHeaderSyntaxLayout, type), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo InterfacePortHeaderSyntaxChildren[] = {
+    { offsetof(InterfacePortHeaderSyntaxLayout, nameOrKeyword), SyntaxChildKind::Token },
+    { offsetof(InterfacePortHeaderSyntaxLayout, modport), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo InvocationExpressionSyntaxChildren[] = {
+    { offsetof(InvocationExpressionSyntaxLayout, left), SyntaxChildKind::NodeReference },
+    { offsetof(InvocationExpressionSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(InvocationExpressionSyntaxLayout, arguments), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo JumpStatementSyntaxChildren[] = {
+    { offsetof(JumpStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(JumpStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(JumpStatementSyntaxLayout, breakOrContinue), SyntaxChildKind::Token },
+    { offsetof(JumpStatementSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo KeywordNameSyntaxChildren[] = {
+    { offsetof(KeywordNameSyntaxLayout, keyword), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo KeywordTypeSyntaxChildren[] = {
+    { offsetof(KeywordTypeSyntaxLayout, keyword), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo LetDeclarationSyntaxChildren[] = {
+    { offsetof(LetDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(LetDeclarationSyntaxLayout, let), SyntaxChildKind::Token },
+    { offsetof(LetDeclarationSyntaxLayout, identifier), SyntaxChildKind::Token },
+    { offsetof(LetDeclarationSyntaxLayout, portList), SyntaxChildKind::Node },
+    { offsetof(LetDeclarationSyntaxLayout, initializer), SyntaxChildKind::NodeReference },
+    { offsetof(LetDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo LineDirectiveSyntaxChildren[] = {
+    { offsetof(LineDirectiveSyntaxLayout, directive), SyntaxChildKind::Token },
+    { offsetof(LineDirectiveSyntaxLayout, lineNumber), SyntaxChildKind::Token },
+    { offsetof(LineDirectiveSyntaxLayout, fileName), SyntaxChildKind::Token },
+    { offsetof(LineDirectiveSyntaxLayout, level), SyntaxChildKind::Token },
+    { offsetof(LineDirectiveSyntaxLayout, endOfDirective), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo LiteralExpressionSyntaxChildren[] = {
+    { offsetof(LiteralExpressionSyntaxLayout, literal), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo LoopConstraintSyntaxChildren[] = {
+    { offsetof(LoopConstraintSyntaxLayout, foreachKeyword), SyntaxChildKind::Token },
+    { offsetof(LoopConstraintSyntaxLayout, loopList), SyntaxChildKind::NodeReference },
+    { offsetof(LoopConstraintSyntaxLayout, constraints), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo LoopGenerateSyntaxChildren[] = {
+    { offsetof(LoopGenerateSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(LoopGenerateSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(LoopGenerateSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(LoopGenerateSyntaxLayout, genvar), SyntaxChildKind::Token },
+    { offsetof(LoopGenerateSyntaxLayout, identifier), SyntaxChildKind::Token },
+    { offsetof(LoopGenerateSyntaxLayout, equals), SyntaxChildKind::Token },
+    { offsetof(LoopGenerateSyntaxLayout, initialExpr), SyntaxChildKind::NodeReference },
+    { offsetof(LoopGenerateSyntaxLayout, semi1), SyntaxChildKind::Token },
+    { offsetof(LoopGenerateSyntaxLayout, stopExpr), SyntaxChildKind::NodeReference },
+    { offsetof(LoopGenerateSyntaxLayout, semi2), SyntaxChildKind::Token },
+    { offsetof(LoopGenerateSyntaxLayout, iterationExpr), SyntaxChildKind::NodeReference },
+    { offsetof(LoopGenerateSyntaxLayout, closeParen), SyntaxChildKind::Token },
+    { offsetof(LoopGenerateSyntaxLayout, block), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo LoopStatementSyntaxChildren[] = {
+    { offsetof(LoopStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(LoopStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(LoopStatementSyntaxLayout, repeatOrWhile), SyntaxChildKind::Token },
+    { offsetof(LoopStatementSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(LoopStatementSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(LoopStatementSyntaxLayout, closeParen), SyntaxChildKind::Token },
+    { offsetof(LoopStatementSyntaxLayout, statement), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo MacroActualArgumentListSyntaxChildren[] = {
+    { offsetof(MacroActualArgumentListSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(MacroActualArgumentListSyntaxLayout, args), SyntaxChildKind::List },
+    { offsetof(MacroActualArgumentListSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo MacroActualArgumentSyntaxChildren[] = {
+    { offsetof(MacroActualArgumentSyntaxLayout, tokens), SyntaxChildKind::List },
+};
+
+constexpr SyntaxChildInfo MacroArgumentDefaultSyntaxChildren[] = {
+    { offsetof(MacroArgumentDefaultSyntaxLayout, equals), SyntaxChildKind::Token },
+    { offsetof(MacroArgumentDefaultSyntaxLayout, tokens), SyntaxChildKind::List },
+};
+
+constexpr SyntaxChildInfo MacroFormalArgumentListSyntaxChildren[] = {
+    { offsetof(MacroFormalArgumentListSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(MacroFormalArgumentListSyntaxLayout, args), SyntaxChildKind::List },
+    { offsetof(MacroFormalArgumentListSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo MacroFormalArgumentSyntaxChildren[] = {
+    { offsetof(MacroFormalArgumentSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(MacroFormalArgumentSyntaxLayout, defaultValue), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo MacroUsageSyntaxChildren[] = {
+    { offsetof(MacroUsageSyntaxLayout, directive), SyntaxChildKind::Token },
+    { offsetof(MacroUsageSyntaxLayout, args), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo MatchesClauseSyntaxChildren[] = {
+    { offsetof(MatchesClauseSyntaxLayout, matchesKeyword), SyntaxChildKind::Token },
+    { offsetof(MatchesClauseSyntaxLayout, pattern), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo MemberAccessExpressionSyntaxChildren[] = {
+    { offsetof(MemberAccessExpressionSyntaxLayout, left), SyntaxChildKind::NodeReference },
+    { offsetof(MemberAccessExpressionSyntaxLayout, dot), SyntaxChildKind::Token },
+    { offsetof(MemberAccessExpressionSyntaxLayout, name), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo MinTypMaxExpressionSyntaxChildren[] = {
+    { offsetof(MinTypMaxExpressionSyntaxLayout, min), SyntaxChildKind::NodeReference },
+    { offsetof(MinTypMaxExpressionSyntaxLayout, colon1), SyntaxChildKind::Token },
+    { offsetof(MinTypMaxExpressionSyntaxLayout, typ), SyntaxChildKind::NodeReference },
+    { offsetof(MinTypMaxExpressionSyntaxLayout, colon2), SyntaxChildKind::Token },
+    { offsetof(MinTypMaxExpressionSyntaxLayout, max), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ModportClockingPortSyntaxChildren[] = {
+    { offsetof(ModportClockingPortSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ModportClockingPortSyntaxLayout, clocking), SyntaxChildKind::Token },
+    { offsetof(ModportClockingPortSyntaxLayout, name), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ModportDeclarationSyntaxChildren[] = {
+    { offsetof(ModportDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ModportDeclarationSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(ModportDeclarationSyntaxLayout, items), SyntaxChildKind::List },
+    { offsetof(ModportDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ModportExplicitPortSyntaxChildren[] = {
+    { offsetof(ModportExplicitPortSyntaxLayout, dot), SyntaxChildKind::Token },
+    { offsetof(ModportExplicitPortSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(ModportExplicitPortSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(ModportExplicitPortSyntaxLayout, expr), SyntaxChildKind::Node },
+    { offsetof(ModportExplicitPortSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ModportItemSyntaxChildren[] = {
+    { offsetof(ModportItemSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(ModportItemSyntaxLayout, ports), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ModportNamedPortSyntaxChildren[] = {
+    { offsetof(ModportNamedPortSyntaxLayout, name), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ModportSimplePortListSyntaxChildren[] = {
+    { offsetof(ModportSimplePortListSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ModportSimplePortListSyntaxLayout, direction), SyntaxChildKind::Token },
+    { offsetof(ModportSimplePortListSyntaxLayout, ports), SyntaxChildKind::List },
+};
+
+constexpr SyntaxChildInfo ModportSubroutinePortListSyntaxChildren[] = {
+    { offsetof(ModportSubroutinePortListSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ModportSubroutinePortListSyntaxLayout, importExport), SyntaxChildKind::Token },
+    { offsetof(ModportSubroutinePortListSyntaxLayout, ports), SyntaxChildKind::List },
+};
+
+constexpr SyntaxChildInfo ModportSubroutinePortSyntaxChildren[] = {
+    { offsetof(ModportSubroutinePortSyntaxLayout, prototype), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ModuleDeclarationSyntaxChildren[] = {
+    { offsetof(ModuleDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ModuleDeclarationSyntaxLayout, header), SyntaxChildKind::NodeReference },
+    { offsetof(ModuleDeclarationSyntaxLayout, members), SyntaxChildKind::List },
+    { offsetof(ModuleDeclarationSyntaxLayout, endmodule), SyntaxChildKind::Token },
+    { offsetof(ModuleDeclarationSyntaxLayout, blockName), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo ModuleHeaderSyntaxChildren[] = {
+    { offsetof(ModuleHeaderSyntaxLayout, moduleKeyword), SyntaxChildKind::Token },
+    { offsetof(ModuleHeaderSyntaxLayout, lifetime), SyntaxChildKind::Token },
+    { offsetof(ModuleHeaderSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(ModuleHeaderSyntaxLayout, imports), SyntaxChildKind::List },
+    { offsetof(ModuleHeaderSyntaxLayout, parameters), SyntaxChildKind::Node },
+    { offsetof(ModuleHeaderSyntaxLayout, ports), SyntaxChildKind::Node },
+    { offsetof(ModuleHeaderSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo MultipleConcatenationExpressionSyntaxChildren[] = {
+    { offsetof(MultipleConcatenationExpressionSyntaxLayout, openBrace), SyntaxChildKind::Token },
+    { offsetof(MultipleConcatenationExpressionSyntaxLayout, expression), SyntaxChildKind::NodeReference },
+    { offsetof(MultipleConcatenationExpressionSyntaxLayout, concatenation), SyntaxChildKind::NodeReference },
+    { offsetof(MultipleConcatenationExpressionSyntaxLayout, closeBrace), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo NamedArgumentSyntaxChildren[] = {
+    { offsetof(NamedArgumentSyntaxLayout, dot), SyntaxChildKind::Token },
+    { offsetof(NamedArgumentSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(NamedArgumentSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(NamedArgumentSyntaxLayout, expr), SyntaxChildKind::Node },
+    { offsetof(NamedArgumentSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo NamedBlockClauseSyntaxChildren[] = {
+    { offsetof(NamedBlockClauseSyntaxLayout, colon), SyntaxChildKind::Token },
+    { offsetof(NamedBlockClauseSyntaxLayout, name), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo NamedLabelSyntaxChildren[] = {
+    { offsetof(NamedLabelSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(NamedLabelSyntaxLayout, colon), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo NamedPortConnectionSyntaxChildren[] = {
+    { offsetof(NamedPortConnectionSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(NamedPortConnectionSyntaxLayout, dot), SyntaxChildKind::Token },
+    { offsetof(NamedPortConnectionSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(NamedPortConnectionSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(NamedPortConnectionSyntaxLayout, expr), SyntaxChildKind::Node },
+    { offsetof(NamedPortConnectionSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo NamedStructurePatternMemberSyntaxChildren[] = {
+    { offsetof(NamedStructurePatternMemberSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(NamedStructurePatternMemberSyntaxLayout, colon), SyntaxChildKind::Token },
+    { offsetof(NamedStructurePatternMemberSyntaxLayout, pattern), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo NamedTypeSyntaxChildren[] = {
+    { offsetof(NamedTypeSyntaxLayout, name), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo NetDeclarationSyntaxChildren[] = {
+    { offsetof(NetDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(NetDeclarationSyntaxLayout, netType), SyntaxChildKind::Token },
+    { offsetof(NetDeclarationSyntaxLayout, strength), SyntaxChildKind::Node },
+    { offsetof(NetDeclarationSyntaxLayout, expansionHint), SyntaxChildKind::Token },
+    { offsetof(NetDeclarationSyntaxLayout, type), SyntaxChildKind::NodeReference },
+    { offsetof(NetDeclarationSyntaxLayout, declarators), SyntaxChildKind::List },
+    { offsetof(NetDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo NetPortHeaderSyntaxChildren[] = {
+    { offsetof(NetPortHeaderSyntaxLayout, direction), SyntaxChildKind::Token },
+    { offsetof(NetPortHeaderSyntaxLayout, netType), SyntaxChildKind::Token },
+    { offsetof(NetPortHeaderSyntaxLayout, dataType), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo NewArrayExpressionSyntaxChildren[] = {
+    { offsetof(NewArrayExpressionSyntaxLayout, newKeyword), SyntaxChildKind::Token },
+    { offsetof(NewArrayExpressionSyntaxLayout, openBracket), SyntaxChildKind::Token },
+    { offsetof(NewArrayExpressionSyntaxLayout, sizeExpr), SyntaxChildKind::NodeReference },
+    { offsetof(NewArrayExpressionSyntaxLayout, closeBracket), SyntaxChildKind::Token },
+    { offsetof(NewArrayExpressionSyntaxLayout, initializer), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo NewClassExpressionSyntaxChildren[] = {
+    { offsetof(NewClassExpressionSyntaxLayout, classScope), SyntaxChildKind::Node },
+    { offsetof(NewClassExpressionSyntaxLayout, newKeyword), SyntaxChildKind::Token },
+    { offsetof(NewClassExpressionSyntaxLayout, arguments), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo NewExpressionSyntaxChildren[] = {
+    { offsetof(NewExpressionSyntaxLayout, newKeyword), SyntaxChildKind::Token },
+    { offsetof(NewExpressionSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo NonAnsiPortListSyntaxChildren[] = {
+    { offsetof(NonAnsiPortListSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(NonAnsiPortListSyntaxLayout, ports), SyntaxChildKind::List },
+    { offsetof(NonAnsiPortListSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo OpenRangeListSyntaxChildren[] = {
+    { offsetof(OpenRangeListSyntaxLayout, openBrace), SyntaxChildKind::Token },
+    { offsetof(OpenRangeListSyntaxLayout, valueRanges), SyntaxChildKind::List },
+    { offsetof(OpenRangeListSyntaxLayout, closeBrace), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo OrderedArgumentSyntaxChildren[] = {
+    { offsetof(OrderedArgumentSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo OrderedPortConnectionSyntaxChildren[] = {
+    { offsetof(OrderedPortConnectionSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(OrderedPortConnectionSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo OrderedStructurePatternMemberSyntaxChildren[] = {
+    { offsetof(OrderedStructurePatternMemberSyntaxLayout, pattern), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo PackageImportDeclarationSyntaxChildren[] = {
+    { offsetof(PackageImportDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(PackageImportDeclarationSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(PackageImportDeclarationSyntaxLayout, items), SyntaxChildKind::List },
+    { offsetof(PackageImportDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo PackageImportItemSyntaxChildren[] = {
+    { offsetof(PackageImportItemSyntaxLayout, package), SyntaxChildKind::Token },
+    { offsetof(PackageImportItemSyntaxLayout, doubleColon), SyntaxChildKind::Token },
+    { offsetof(PackageImportItemSyntaxLayout, item), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ParameterDeclarationStatementSyntaxChildren[] = {
+    { offsetof(ParameterDeclarationStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ParameterDeclarationStatementSyntaxLayout, parameter), SyntaxChildKind::NodeReference },
+    { offsetof(ParameterDeclarationStatementSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ParameterDeclarationSyntaxChildren[] = {
+    { offsetof(ParameterDeclarationSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(ParameterDeclarationSyntaxLayout, type), SyntaxChildKind::NodeReference },
+    { offsetof(ParameterDeclarationSyntaxLayout, declarators), SyntaxChildKind::List },
+};
+
+constexpr SyntaxChildInfo ParameterPortListSyntaxChildren[] = {
+    { offsetof(ParameterPortListSyntaxLayout, hash), SyntaxChildKind::Token },
+    { offsetof(ParameterPortListSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(ParameterPortListSyntaxLayout, declarations), SyntaxChildKind::List },
+    { offsetof(ParameterPortListSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ParameterValueAssignmentSyntaxChildren[] = {
+    { offsetof(ParameterValueAssignmentSyntaxLayout, hash), SyntaxChildKind::Token },
+    { offsetof(ParameterValueAssignmentSyntaxLayout, parameters), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ParenImplicitEventControlSyntaxChildren[] = {
+    { offsetof(ParenImplicitEventControlSyntaxLayout, at), SyntaxChildKind::Token },
+    { offsetof(ParenImplicitEventControlSyntaxLayout, openParenStarCloseParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ParenthesizedEventExpressionSyntaxChildren[] = {
+    { offsetof(ParenthesizedEventExpressionSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(ParenthesizedEventExpressionSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(ParenthesizedEventExpressionSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ParenthesizedExpressionSyntaxChildren[] = {
+    { offsetof(ParenthesizedExpressionSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(ParenthesizedExpressionSyntaxLayout, expression), SyntaxChildKind::NodeReference },
+    { offsetof(ParenthesizedExpressionSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo PatternCaseItemSyntaxChildren[] = {
+    { offsetof(PatternCaseItemSyntaxLayout, pattern), SyntaxChildKind::NodeReference },
+    { offsetof(PatternCaseItemSyntaxLayout, tripleAnd), SyntaxChildKind::Token },
+    { offsetof(PatternCaseItemSyntaxLayout, expr), SyntaxChildKind::Node },
+    { offsetof(PatternCaseItemSyntaxLayout, colon), SyntaxChildKind::Token },
+    { offsetof(PatternCaseItemSyntaxLayout, statement), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo PortDeclarationSyntaxChildren[] = {
+    { offsetof(PortDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(PortDeclarationSyntaxLayout, header), SyntaxChildKind::NodeReference },
+    { offsetof(PortDeclarationSyntaxLayout, declarators), SyntaxChildKind::List },
+    { offsetof(PortDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo PostfixUnaryExpressionSyntaxChildren[] = {
+    { offsetof(PostfixUnaryExpressionSyntaxLayout, operand), SyntaxChildKind::NodeReference },
+    { offsetof(PostfixUnaryExpressionSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(PostfixUnaryExpressionSyntaxLayout, operatorToken), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo PrefixUnaryExpressionSyntaxChildren[] = {
+    { offsetof(PrefixUnaryExpressionSyntaxLayout, operatorToken), SyntaxChildKind::Token },
+    { offsetof(PrefixUnaryExpressionSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(PrefixUnaryExpressionSyntaxLayout, operand), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo PrimaryBlockEventExpressionSyntaxChildren[] = {
+    { offsetof(PrimaryBlockEventExpressionSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(PrimaryBlockEventExpressionSyntaxLayout, name), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ProceduralAssignStatementSyntaxChildren[] = {
+    { offsetof(ProceduralAssignStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(ProceduralAssignStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ProceduralAssignStatementSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(ProceduralAssignStatementSyntaxLayout, lvalue), SyntaxChildKind::NodeReference },
+    { offsetof(ProceduralAssignStatementSyntaxLayout, equals), SyntaxChildKind::Token },
+    { offsetof(ProceduralAssignStatementSyntaxLayout, value), SyntaxChildKind::NodeReference },
+    { offsetof(ProceduralAssignStatementSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ProceduralBlockSyntaxChildren[] = {
+    { offsetof(ProceduralBlockSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ProceduralBlockSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(ProceduralBlockSyntaxLayout, statement), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo ProceduralDeassignStatementSyntaxChildren[] = {
+    { offsetof(ProceduralDeassignStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(ProceduralDeassignStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ProceduralDeassignStatementSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(ProceduralDeassignStatementSyntaxLayout, variable), SyntaxChildKind::NodeReference },
+    { offsetof(ProceduralDeassignStatementSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo PropertyDeclarationSyntaxChildren[] = {
+    { offsetof(PropertyDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(PropertyDeclarationSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(PropertyDeclarationSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(PropertyDeclarationSyntaxLayout, portList), SyntaxChildKind::Node },
+    { offsetof(PropertyDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+    { offsetof(PropertyDeclarationSyntaxLayout, assertionVariables), SyntaxChildKind::List },
+    { offsetof(PropertyDeclarationSyntaxLayout, propertySpec), SyntaxChildKind::NodeReference },
+    { offsetof(PropertyDeclarationSyntaxLayout, optionalSemi), SyntaxChildKind::Token },
+    { offsetof(PropertyDeclarationSyntaxLayout, end), SyntaxChildKind::Token },
+    { offsetof(PropertyDeclarationSyntaxLayout, endBlockName), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo PropertySpecSyntaxChildren[] = {
+    { offsetof(PropertySpecSyntaxLayout, clocking), SyntaxChildKind::Node },
+    { offsetof(PropertySpecSyntaxLayout, disable), SyntaxChildKind::Node },
+    { offsetof(PropertySpecSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo QueueDimensionSpecifierSyntaxChildren[] = {
+    { offsetof(QueueDimensionSpecifierSyntaxLayout, dollar), SyntaxChildKind::Token },
+    { offsetof(QueueDimensionSpecifierSyntaxLayout, maxSizeClause), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo RandCaseItemSyntaxChildren[] = {
+    { offsetof(RandCaseItemSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(RandCaseItemSyntaxLayout, colon), SyntaxChildKind::Token },
+    { offsetof(RandCaseItemSyntaxLayout, statement), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo RandCaseStatementSyntaxChildren[] = {
+    { offsetof(RandCaseStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(RandCaseStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(RandCaseStatementSyntaxLayout, randCase), SyntaxChildKind::Token },
+    { offsetof(RandCaseStatementSyntaxLayout, items), SyntaxChildKind::List },
+    { offsetof(RandCaseStatementSyntaxLayout, endCase), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo RandomizeMethodWithClauseSyntaxChildren[] = {
+    { offsetof(RandomizeMethodWithClauseSyntaxLayout, with), SyntaxChildKind::Token },
+    { offsetof(RandomizeMethodWithClauseSyntaxLayout, names), SyntaxChildKind::Node },
+    { offsetof(RandomizeMethodWithClauseSyntaxLayout, constraints), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo RangeCoverageBinInitializerSyntaxChildren[] = {
+    { offsetof(RangeCoverageBinInitializerSyntaxLayout, ranges), SyntaxChildKind::NodeReference },
+    { offsetof(RangeCoverageBinInitializerSyntaxLayout, withClause), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo RangeDimensionSpecifierSyntaxChildren[] = {
+    { offsetof(RangeDimensionSpecifierSyntaxLayout, selector), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo RangeSelectSyntaxChildren[] = {
+    { offsetof(RangeSelectSyntaxLayout, left), SyntaxChildKind::NodeReference },
+    { offsetof(RangeSelectSyntaxLayout, range), SyntaxChildKind::Token },
+    { offsetof(RangeSelectSyntaxLayout, right), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo RepeatedEventControlSyntaxChildren[] = {
+    { offsetof(RepeatedEventControlSyntaxLayout, repeat), SyntaxChildKind::Token },
+    { offsetof(RepeatedEventControlSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(RepeatedEventControlSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(RepeatedEventControlSyntaxLayout, closeParen), SyntaxChildKind::Token },
+    { offsetof(RepeatedEventControlSyntaxLayout, eventControl), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo ReplicatedAssignmentPatternSyntaxChildren[] = {
+    { offsetof(ReplicatedAssignmentPatternSyntaxLayout, openBrace), SyntaxChildKind::Token },
+    { offsetof(ReplicatedAssignmentPatternSyntaxLayout, countExpr), SyntaxChildKind::NodeReference },
+    { offsetof(ReplicatedAssignmentPatternSyntaxLayout, innerOpenBrace), SyntaxChildKind::Token },
+    { offsetof(ReplicatedAssignmentPatternSyntaxLayout, items), SyntaxChildKind::List },
+    { offsetof(ReplicatedAssignmentPatternSyntaxLayout, innerCloseBrace), SyntaxChildKind::Token },
+    { offsetof(ReplicatedAssignmentPatternSyntaxLayout, closeBrace), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ReturnStatementSyntaxChildren[] = {
+    { offsetof(ReturnStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(ReturnStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(ReturnStatementSyntaxLayout, returnKeyword), SyntaxChildKind::Token },
+    { offsetof(ReturnStatementSyntaxLayout, returnValue), SyntaxChildKind::Node },
+    { offsetof(ReturnStatementSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo ScopedNameSyntaxChildren[] = {
+    { offsetof(ScopedNameSyntaxLayout, left), SyntaxChildKind::NodeReference },
+    { offsetof(ScopedNameSyntaxLayout, separator), SyntaxChildKind::Token },
+    { offsetof(ScopedNameSyntaxLayout, right), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo SequenceDeclarationSyntaxChildren[] = {
+    { offsetof(SequenceDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(SequenceDeclarationSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(SequenceDeclarationSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(SequenceDeclarationSyntaxLayout, portList), SyntaxChildKind::Node },
+    { offsetof(SequenceDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+    { offsetof(SequenceDeclarationSyntaxLayout, assertionVariables), SyntaxChildKind::List },
+    { offsetof(SequenceDeclarationSyntaxLayout, seqExpr), SyntaxChildKind::NodeReference },
+    { offsetof(SequenceDeclarationSyntaxLayout, optionalSemi), SyntaxChildKind::Token },
+    { offsetof(SequenceDeclarationSyntaxLayout, end), SyntaxChildKind::Token },
+    { offsetof(SequenceDeclarationSyntaxLayout, endBlockName), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo ShortcutCycleDelayRangeSyntaxChildren[] = {
+    { offsetof(ShortcutCycleDelayRangeSyntaxLayout, doubleHash), SyntaxChildKind::Token },
+    { offsetof(ShortcutCycleDelayRangeSyntaxLayout, openBracket), SyntaxChildKind::Token },
+    { offsetof(ShortcutCycleDelayRangeSyntaxLayout, op), SyntaxChildKind::Token },
+    { offsetof(ShortcutCycleDelayRangeSyntaxLayout, closeBracket), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo SignalEventExpressionSyntaxChildren[] = {
+    { offsetof(SignalEventExpressionSyntaxLayout, edge), SyntaxChildKind::Token },
+    { offsetof(SignalEventExpressionSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo SignedCastExpressionSyntaxChildren[] = {
+    { offsetof(SignedCastExpressionSyntaxLayout, signing), SyntaxChildKind::Token },
+    { offsetof(SignedCastExpressionSyntaxLayout, apostrophe), SyntaxChildKind::Token },
+    { offsetof(SignedCastExpressionSyntaxLayout, inner), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo SimpleAssignmentPatternSyntaxChildren[] = {
+    { offsetof(SimpleAssignmentPatternSyntaxLayout, openBrace), SyntaxChildKind::Token },
+    { offsetof(SimpleAssignmentPatternSyntaxLayout, items), SyntaxChildKind::List },
+    { offsetof(SimpleAssignmentPatternSyntaxLayout, closeBrace), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo SimpleDirectiveSyntaxChildren[] = {
+    { offsetof(SimpleDirectiveSyntaxLayout, directive), SyntaxChildKind::Token },
+    { offsetof(SimpleDirectiveSyntaxLayout, endOfDirective), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo SolveBeforeConstraintSyntaxChildren[] = {
+    { offsetof(SolveBeforeConstraintSyntaxLayout, solve), SyntaxChildKind::Token },
+    { offsetof(SolveBeforeConstraintSyntaxLayout, beforeExpr), SyntaxChildKind::List },
+    { offsetof(SolveBeforeConstraintSyntaxLayout, before), SyntaxChildKind::Token },
+    { offsetof(SolveBeforeConstraintSyntaxLayout, afterExpr), SyntaxChildKind::List },
+    { offsetof(SolveBeforeConstraintSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo StandardCaseItemSyntaxChildren[] = {
+    { offsetof(StandardCaseItemSyntaxLayout, expressions), SyntaxChildKind::List },
+    { offsetof(StandardCaseItemSyntaxLayout, colon), SyntaxChildKind::Token },
+    { offsetof(StandardCaseItemSyntaxLayout, clause), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo StreamExpressionSyntaxChildren[] = {
+    { offsetof(StreamExpressionSyntaxLayout, expression), SyntaxChildKind::NodeReference },
+    { offsetof(StreamExpressionSyntaxLayout, withRange), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo StreamExpressionWithRangeChildren[] = {
+    { offsetof(StreamExpressionWithRangeLayout, withKeyword), SyntaxChildKind::Token },
+    { offsetof(StreamExpressionWithRangeLayout, range), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo StreamingConcatenationExpressionSyntaxChildren[] = {
+    { offsetof(StreamingConcatenationExpressionSyntaxLayout, openBrace), SyntaxChildKind::Token },
+    { offsetof(StreamingConcatenationExpressionSyntaxLayout, operatorToken), SyntaxChildKind::Token },
+    { offsetof(StreamingConcatenationExpressionSyntaxLayout, sliceSize), SyntaxChildKind::Node },
+    { offsetof(StreamingConcatenationExpressionSyntaxLayout, innerOpenBrace), SyntaxChildKind::Token },
+    { offsetof(StreamingConcatenationExpressionSyntaxLayout, expressions), SyntaxChildKind::List },
+    { offsetof(StreamingConcatenationExpressionSyntaxLayout, innerCloseBrace), SyntaxChildKind::Token },
+    { offsetof(StreamingConcatenationExpressionSyntaxLayout, closeBrace), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo StructUnionMemberSyntaxChildren[] = {
+    { offsetof(StructUnionMemberSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(StructUnionMemberSyntaxLayout, randomQualifier), SyntaxChildKind::Token },
+    { offsetof(StructUnionMemberSyntaxLayout, type), SyntaxChildKind::NodeReference },
+    { offsetof(StructUnionMemberSyntaxLayout, declarators), SyntaxChildKind::List },
+    { offsetof(StructUnionMemberSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo StructUnionTypeSyntaxChildren[] = {
+    { offsetof(StructUnionTypeSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(StructUnionTypeSyntaxLayout, tagged), SyntaxChildKind::Token },
+    { offsetof(StructUnionTypeSyntaxLayout, packed), SyntaxChildKind::Token },
+    { offsetof(StructUnionTypeSyntaxLayout, signing), SyntaxChildKind::Token },
+    { offsetof(StructUnionTypeSyntaxLayout, openBrace), SyntaxChildKind::Token },
+    { offsetof(StructUnionTypeSyntaxLayout, members), SyntaxChildKind::List },
+    { offsetof(StructUnionTypeSyntaxLayout, closeBrace), SyntaxChildKind::Token },
+    { offsetof(StructUnionTypeSyntaxLayout, dimensions), SyntaxChildKind::List },
+};
+
+constexpr SyntaxChildInfo StructurePatternSyntaxChildren[] = {
+    { offsetof(StructurePatternSyntaxLayout, openBrace), SyntaxChildKind::Token },
+    { offsetof(StructurePatternSyntaxLayout, members), SyntaxChildKind::List },
+    { offsetof(StructurePatternSyntaxLayout, closeBrace), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo StructuredAssignmentPatternSyntaxChildren[] = {
+    { offsetof(StructuredAssignmentPatternSyntaxLayout, openBrace), SyntaxChildKind::Token },
+    { offsetof(StructuredAssignmentPatternSyntaxLayout, items), SyntaxChildKind::List },
+    { offsetof(StructuredAssignmentPatternSyntaxLayout, closeBrace), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo TaggedPatternSyntaxChildren[] = {
+    { offsetof(TaggedPatternSyntaxLayout, tagged), SyntaxChildKind::Token },
+    { offsetof(TaggedPatternSyntaxLayout, memberName), SyntaxChildKind::Token },
+    { offsetof(TaggedPatternSyntaxLayout, pattern), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo TaggedUnionExpressionSyntaxChildren[] = {
+    { offsetof(TaggedUnionExpressionSyntaxLayout, tagged), SyntaxChildKind::Token },
+    { offsetof(TaggedUnionExpressionSyntaxLayout, member), SyntaxChildKind::Token },
+    { offsetof(TaggedUnionExpressionSyntaxLayout, expr), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo TimeUnitsDeclarationSyntaxChildren[] = {
+    { offsetof(TimeUnitsDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(TimeUnitsDeclarationSyntaxLayout, keyword), SyntaxChildKind::Token },
+    { offsetof(TimeUnitsDeclarationSyntaxLayout, time), SyntaxChildKind::Token },
+    { offsetof(TimeUnitsDeclarationSyntaxLayout, divider), SyntaxChildKind::Node },
+    { offsetof(TimeUnitsDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo TimescaleDirectiveSyntaxChildren[] = {
+    { offsetof(TimescaleDirectiveSyntaxLayout, directive), SyntaxChildKind::Token },
+    { offsetof(TimescaleDirectiveSyntaxLayout, timeUnit), SyntaxChildKind::Token },
+    { offsetof(TimescaleDirectiveSyntaxLayout, timeUnitUnit), SyntaxChildKind::Token },
+    { offsetof(TimescaleDirectiveSyntaxLayout, slash), SyntaxChildKind::Token },
+    { offsetof(TimescaleDirectiveSyntaxLayout, timePrecision), SyntaxChildKind::Token },
+    { offsetof(TimescaleDirectiveSyntaxLayout, timePrecisionUnit), SyntaxChildKind::Token },
+    { offsetof(TimescaleDirectiveSyntaxLayout, endOfDirective), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo TimingControlExpressionConcatenationSyntaxChildren[] = {
+    { offsetof(TimingControlExpressionConcatenationSyntaxLayout, left), SyntaxChildKind::NodeReference },
+    { offsetof(TimingControlExpressionConcatenationSyntaxLayout, timing), SyntaxChildKind::NodeReference },
+    { offsetof(TimingControlExpressionConcatenationSyntaxLayout, right), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo TimingControlExpressionSyntaxChildren[] = {
+    { offsetof(TimingControlExpressionSyntaxLayout, timing), SyntaxChildKind::NodeReference },
+    { offsetof(TimingControlExpressionSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo TimingControlStatementSyntaxChildren[] = {
+    { offsetof(TimingControlStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(TimingControlStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(TimingControlStatementSyntaxLayout, timingControl), SyntaxChildKind::NodeReference },
+    { offsetof(TimingControlStatementSyntaxLayout, statement), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo TransListCoverageBinInitializerSyntaxChildren[] = {
+    { offsetof(TransListCoverageBinInitializerSyntaxLayout, sets), SyntaxChildKind::List },
+    { offsetof(TransListCoverageBinInitializerSyntaxLayout, withClause), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo TransRangeSyntaxChildren[] = {
+    { offsetof(TransRangeSyntaxLayout, items), SyntaxChildKind::List },
+    { offsetof(TransRangeSyntaxLayout, repeat), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo TransRepeatRangeSyntaxChildren[] = {
+    { offsetof(TransRepeatRangeSyntaxLayout, openBracket), SyntaxChildKind::Token },
+    { offsetof(TransRepeatRangeSyntaxLayout, specifier), SyntaxChildKind::Token },
+    { offsetof(TransRepeatRangeSyntaxLayout, selector), SyntaxChildKind::Node },
+    { offsetof(TransRepeatRangeSyntaxLayout, closeBracket), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo TransSetSyntaxChildren[] = {
+    { offsetof(TransSetSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(TransSetSyntaxLayout, ranges), SyntaxChildKind::List },
+    { offsetof(TransSetSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo TypeReferenceSyntaxChildren[] = {
+    { offsetof(TypeReferenceSyntaxLayout, typeKeyword), SyntaxChildKind::Token },
+    { offsetof(TypeReferenceSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(TypeReferenceSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(TypeReferenceSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo TypedefDeclarationSyntaxChildren[] = {
+    { offsetof(TypedefDeclarationSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(TypedefDeclarationSyntaxLayout, typedefKeyword), SyntaxChildKind::Token },
+    { offsetof(TypedefDeclarationSyntaxLayout, type), SyntaxChildKind::NodeReference },
+    { offsetof(TypedefDeclarationSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(TypedefDeclarationSyntaxLayout, dimensions), SyntaxChildKind::List },
+    { offsetof(TypedefDeclarationSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo UnconditionalBranchDirectiveSyntaxChildren[] = {
+    { offsetof(UnconditionalBranchDirectiveSyntaxLayout, directive), SyntaxChildKind::Token },
+    { offsetof(UnconditionalBranchDirectiveSyntaxLayout, endOfDirective), SyntaxChildKind::Token },
+    { offsetof(UnconditionalBranchDirectiveSyntaxLayout, disabledTokens), SyntaxChildKind::List },
+};
+
+constexpr SyntaxChildInfo UndefDirectiveSyntaxChildren[] = {
+    { offsetof(UndefDirectiveSyntaxLayout, directive), SyntaxChildKind::Token },
+    { offsetof(UndefDirectiveSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(UndefDirectiveSyntaxLayout, endOfDirective), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo UniquenessConstraintSyntaxChildren[] = {
+    { offsetof(UniquenessConstraintSyntaxLayout, unique), SyntaxChildKind::Token },
+    { offsetof(UniquenessConstraintSyntaxLayout, ranges), SyntaxChildKind::NodeReference },
+    { offsetof(UniquenessConstraintSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo VarDataTypeSyntaxChildren[] = {
+    { offsetof(VarDataTypeSyntaxLayout, var), SyntaxChildKind::Token },
+    { offsetof(VarDataTypeSyntaxLayout, type), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo VariableDeclaratorSyntaxChildren[] = {
+    { offsetof(VariableDeclaratorSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(VariableDeclaratorSyntaxLayout, dimensions), SyntaxChildKind::List },
+    { offsetof(VariableDeclaratorSyntaxLayout, initializer), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo VariableDimensionSyntaxChildren[] = {
+    { offsetof(VariableDimensionSyntaxLayout, openBracket), SyntaxChildKind::Token },
+    { offsetof(VariableDimensionSyntaxLayout, specifier), SyntaxChildKind::Node },
+    { offsetof(VariableDimensionSyntaxLayout, closeBracket), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo VariablePatternSyntaxChildren[] = {
+    { offsetof(VariablePatternSyntaxLayout, dot), SyntaxChildKind::Token },
+    { offsetof(VariablePatternSyntaxLayout, variableName), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo VariablePortHeaderSyntaxChildren[] = {
+    { offsetof(VariablePortHeaderSyntaxLayout, direction), SyntaxChildKind::Token },
+    { offsetof(VariablePortHeaderSyntaxLayout, varKeyword), SyntaxChildKind::Token },
+    { offsetof(VariablePortHeaderSyntaxLayout, dataType), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo VirtualInterfaceTypeSyntaxChildren[] = {
+    { offsetof(VirtualInterfaceTypeSyntaxLayout, virtualKeyword), SyntaxChildKind::Token },
+    { offsetof(VirtualInterfaceTypeSyntaxLayout, interfaceKeyword), SyntaxChildKind::Token },
+    { offsetof(VirtualInterfaceTypeSyntaxLayout, name), SyntaxChildKind::Token },
+    { offsetof(VirtualInterfaceTypeSyntaxLayout, parameters), SyntaxChildKind::Node },
+    { offsetof(VirtualInterfaceTypeSyntaxLayout, modport), SyntaxChildKind::Node },
+};
+
+constexpr SyntaxChildInfo WaitForkStatementSyntaxChildren[] = {
+    { offsetof(WaitForkStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(WaitForkStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(WaitForkStatementSyntaxLayout, wait), SyntaxChildKind::Token },
+    { offsetof(WaitForkStatementSyntaxLayout, fork), SyntaxChildKind::Token },
+    { offsetof(WaitForkStatementSyntaxLayout, semi), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo WaitOrderStatementSyntaxChildren[] = {
+    { offsetof(WaitOrderStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(WaitOrderStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(WaitOrderStatementSyntaxLayout, wait_order), SyntaxChildKind::Token },
+    { offsetof(WaitOrderStatementSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(WaitOrderStatementSyntaxLayout, names), SyntaxChildKind::List },
+    { offsetof(WaitOrderStatementSyntaxLayout, closeParen), SyntaxChildKind::Token },
+    { offsetof(WaitOrderStatementSyntaxLayout, action), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo WaitStatementSyntaxChildren[] = {
+    { offsetof(WaitStatementSyntaxLayout, label), SyntaxChildKind::Node },
+    { offsetof(WaitStatementSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(WaitStatementSyntaxLayout, wait), SyntaxChildKind::Token },
+    { offsetof(WaitStatementSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(WaitStatementSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(WaitStatementSyntaxLayout, closeParen), SyntaxChildKind::Token },
+    { offsetof(WaitStatementSyntaxLayout, statement), SyntaxChildKind::NodeReference },
+};
+
+constexpr SyntaxChildInfo WildcardDimensionSpecifierSyntaxChildren[] = {
+    { offsetof(WildcardDimensionSpecifierSyntaxLayout, star), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo WildcardPatternSyntaxChildren[] = {
+    { offsetof(WildcardPatternSyntaxLayout, dotStar), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo WildcardPortConnectionSyntaxChildren[] = {
+    { offsetof(WildcardPortConnectionSyntaxLayout, attributes), SyntaxChildKind::List },
+    { offsetof(WildcardPortConnectionSyntaxLayout, dotStar), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo WildcardPortListSyntaxChildren[] = {
+    { offsetof(WildcardPortListSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(WildcardPortListSyntaxLayout, dotStar), SyntaxChildKind::Token },
+    { offsetof(WildcardPortListSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo WithClauseSyntaxChildren[] = {
+    { offsetof(WithClauseSyntaxLayout, with), SyntaxChildKind::Token },
+    { offsetof(WithClauseSyntaxLayout, openParen), SyntaxChildKind::Token },
+    { offsetof(WithClauseSyntaxLayout, expr), SyntaxChildKind::NodeReference },
+    { offsetof(WithClauseSyntaxLayout, closeParen), SyntaxChildKind::Token },
+};
+
+constexpr SyntaxChildInfo WithFunctionSampleSyntaxChildren[] = {
+    { offsetof(WithFunctionSampleSyntaxLayout, with), SyntaxChildKind::Token },
+    { offsetof(WithFunctionSampleSyntaxLayout, function), SyntaxChildKind::Token },
+    { offsetof(WithFunctionSampleSyntaxLayout, sample), SyntaxChildKind::Token },
+    { offsetof(WithFunctionSampleSyntaxLayout, portList), SyntaxChildKind::NodeReference },
+};
+
+}
+
+const SyntaxChildTable SyntaxChildTables[] = {
+    { nullptr, 0 }, // Unknown
+    { nullptr, 0 }, // List
+    { BeginKeywordsDirectiveSyntaxChildren, 3 }, // BeginKeywordsDirective
+    { SimpleDirectiveSyntaxChildren, 2 }, // CellDefineDirective
+    { DefaultNetTypeDirectiveSyntaxChildren, 3 }, // DefaultNetTypeDirective
+    { DefineDirectiveSyntaxChildren, 5 }, // DefineDirective
+    { UnconditionalBranchDirectiveSyntaxChildren, 3 }, // ElseDirective
+    { ConditionalBranchDirectiveSyntaxChildren, 4 }, // ElsIfDirective
+    { SimpleDirectiveSyntaxChildren, 2 }, // EndKeywordsDirective
+    { SimpleDirectiveSyntaxChildren, 2 }, // EndCellDefineDirective
+    { UnconditionalBranchDirectiveSyntaxChildren, 3 }, // EndIfDirective
+    { ConditionalBranchDirectiveSyntaxChildren, 4 }, // IfDefDirective
+    { ConditionalBranchDirectiveSyntaxChildren, 4 }, // IfNDefDirective
+    { IncludeDirectiveSyntaxChildren, 3 }, // IncludeDirective
+    { LineDirectiveSyntaxChildren, 5 }, // LineDirective
+    { SimpleDirectiveSyntaxChildren, 2 }, // NoUnconnectedDriveDirective
+    { SimpleDirectiveSyntaxChildren, 2 }, // PragmaDirective
+    { SimpleDirectiveSyntaxChildren, 2 }, // ResetAllDirective
+    { TimescaleDirectiveSyntaxChildren, 7 }, // TimescaleDirective
+    { SimpleDirectiveSyntaxChildren, 2 }, // UnconnectedDriveDirective
+    { UndefDirectiveSyntaxChildren, 3 }, // UndefDirective
+    { SimpleDirectiveSyntaxChildren, 2 }, // UndefineAllDirective
+    { MacroUsageSyntaxChildren, 2 }, // MacroUsage
+    { MacroFormalArgumentListSyntaxChildren, 3 }, // MacroFormalArgumentList
+    { MacroFormalArgumentSyntaxChildren, 2 }, // MacroFormalArgument
+    { MacroArgumentDefaultSyntaxChildren, 2 }, // MacroArgumentDefault
+    { MacroActualArgumentListSyntaxChildren, 3 }, // MacroActualArgumentList
+    { MacroActualArgumentSyntaxChildren, 1 }, // MacroActualArgument
+    { AttributeSpecSyntaxChildren, 2 }, // AttributeSpec
+    { AttributeInstanceSyntaxChildren, 3 }, // AttributeInstance
+    { nullptr, 0 }, // EmptyArgument
+    { OrderedArgumentSyntaxChildren, 1 }, // OrderedArgument
+    { NamedArgumentSyntaxChildren, 5 }, // NamedArgument
+    { ArgumentListSyntaxChildren, 3 }, // ArgumentList
+    { ParameterValueAssignmentSyntaxChildren, 2 }, // ParameterValueAssignment
+    { VariablePatternSyntaxChildren, 2 }, // VariablePattern
+    { WildcardPatternSyntaxChildren, 1 }, // WildcardPattern
+    { ExpressionPatternSyntaxChildren, 1 }, // ExpressionPattern
+    { TaggedPatternSyntaxChildren, 3 }, // TaggedPattern
+    { OrderedStructurePatternMemberSyntaxChildren, 1 }, // OrderedStructurePatternMember
+    { NamedStructurePatternMemberSyntaxChildren, 3 }, // NamedStructurePatternMember
+    { StructurePatternSyntaxChildren, 3 }, // StructurePattern
+    { MatchesClauseSyntaxChildren, 2 }, // MatchesClause
+    { ConditionalPatternSyntaxChildren, 2 }, // ConditionalPattern
+    { ConditionalPredicateSyntaxChildren, 1 }, // ConditionalPredicate
+    { SimpleAssignmentPatternSyntaxChildren, 3 }, // SimpleAssignmentPattern
+    { AssignmentPatternItemSyntaxChildren, 3 }, // AssignmentPatternItem
+    { StructuredAssignmentPatternSyntaxChildren, 3 }, // StructuredAssignmentPattern
+    { ReplicatedAssignmentPatternSyntaxChildren, 6 }, // ReplicatedAssignmentPattern
+    { TaggedUnionExpressionSyntaxChildren, 3 }, // TaggedUnionExpression
+    { OpenRangeListSyntaxChildren, 3 }, // OpenRangeList
+    { InsideExpressionSyntaxChildren, 3 }, // InsideExpression
+    { ConditionalExpressionSyntaxChildren, 6 }, // ConditionalExpression
+    { ExpressionOrDistSyntaxChildren, 2 }, // ExpressionOrDist
+    { BadExpressionSyntaxChildren, 1 }, // BadExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // UnaryPlusExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // UnaryMinusExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // UnaryBitwiseAndExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // UnaryBitwiseNandExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // UnaryBitwiseOrExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // UnaryBitwiseNorExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // UnaryBitwiseXorExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // UnaryBitwiseXnorExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // UnaryPreincrementExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // UnaryPredecrementExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // UnaryLogicalNotExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // UnaryBitwiseNotExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // UnarySequenceDelayExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // UnarySequenceEventExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // UnaryNotPropertyExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // AcceptOnPropertyExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // RejectOnPropertyExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // SyncAcceptOnPropertyExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // SyncRejectOnPropertyExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // NextTimePropertyExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // SNextTimePropertyExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // AlwaysPropertyExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // SAlwaysPropertyExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // EventuallyPropertyExpression
+    { PrefixUnaryExpressionSyntaxChildren, 3 }, // SEventuallyPropertyExpression
+    { LiteralExpressionSyntaxChildren, 1 }, // NullLiteralExpression
+    { LiteralExpressionSyntaxChildren, 1 }, // StringLiteralExpression
+    { LiteralExpressionSyntaxChildren, 1 }, // IntegerLiteralExpression
+    { IntegerVectorExpressionSyntaxChildren, 3 }, // IntegerVectorExpression
+    { LiteralExpressionSyntaxChildren, 1 }, // UnbasedUnsizedLiteralExpression
+    { LiteralExpressionSyntaxChildren, 1 }, // RealLiteralExpression
+    { LiteralExpressionSyntaxChildren, 1 }, // TimeLiteralExpression
+    { LiteralExpressionSyntaxChildren, 1 }, // WildcardLiteralExpression
+    { LiteralExpressionSyntaxChildren, 1 }, // OneStepLiteralExpression
+    { ParenthesizedExpressionSyntaxChildren, 3 }, // ParenthesizedExpression
+    { MinTypMaxExpressionSyntaxChildren, 5 }, // MinTypMaxExpression
+    { EmptyQueueExpressionSyntaxChildren, 2 }, // EmptyQueueExpression
+    { ConcatenationExpressionSyntaxChildren, 3 }, // ConcatenationExpression
+    { MultipleConcatenationExpressionSyntaxChildren, 4 }, // MultipleConcatenationExpression
+    { StreamingConcatenationExpressionSyntaxChildren, 7 }, // StreamingConcatenationExpression
+    { StreamExpressionSyntaxChildren, 2 }, // StreamExpression
+    { StreamExpressionWithRangeChildren, 2 }, // StreamExpressionWithRange
+    { NewClassExpressionSyntaxChildren, 3 }, // NewClassExpression
+    { NewArrayExpressionSyntaxChildren, 5 }, // NewArrayExpression
+    { AssignmentPatternExpressionSyntaxChildren, 2 }, // AssignmentPatternExpression
+    { LiteralExpressionSyntaxChildren, 1 }, // DefaultPatternKeyExpression
+    { NewExpressionSyntaxChildren, 2 }, // NewExpression
+    { BitSelectSyntaxChildren, 1 }, // BitSelect
+    { RangeSelectSyntaxChildren, 3 }, // SimpleRangeSelect
+    { RangeSelectSyntaxChildren, 3 }, // AscendingRangeSelect
+    { RangeSelectSyntaxChildren, 3 }, // DescendingRangeSelect
+    { ElementSelectSyntaxChildren, 3 }, // ElementSelect
+    { ElementSelectExpressionSyntaxChildren, 2 }, // ElementSelectExpression
+    { MemberAccessExpressionSyntaxChildren, 3 }, // MemberAccessExpression
+    { InvocationExpressionSyntaxChildren, 3 }, // InvocationExpression
+    { PostfixUnaryExpressionSyntaxChildren, 3 }, // PostincrementExpression
+    { PostfixUnaryExpressionSyntaxChildren, 3 }, // PostdecrementExpression
+    { CastExpressionSyntaxChildren, 3 }, // CastExpression
+    { SignedCastExpressionSyntaxChildren, 3 }, // SignedCastExpression
+    { WithClauseSyntaxChildren, 4 }, // WithClause
+    { IdentifierListSyntaxChildren, 3 }, // IdentifierList
+    { RandomizeMethodWithClauseSyntaxChildren, 3 }, // RandomizeMethodWithClause
+    { BinaryExpressionSyntaxChildren, 4 }, // AddExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // SubtractExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // MultiplyExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // DivideExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // PowerExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // ModExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // EqualityExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // InequalityExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // CaseEqualityExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // CaseInequalityExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // WildcardEqualityExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // WildcardInequalityExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // LessThanExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // LessThanEqualExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // GreaterThanExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // GreaterThanEqualExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // LogicalAndExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // LogicalOrExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // BinaryAndExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // BinaryOrExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // BinaryXorExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // BinaryXnorExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // LogicalImplicationExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // LogicalEquivalenceExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // LogicalShiftLeftExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // LogicalShiftRightExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // ArithmeticShiftLeftExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // ArithmeticShiftRightExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // BinarySequenceDelayExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // OrSequenceExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // AndSequenceExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // IntersectSequenceExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // WithinSequenceExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // ThroughoutSequenceExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // IffPropertyExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // UntilPropertyExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // SUntilPropertyExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // UntilWithPropertyExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // SUntilWithPropertyExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // ImpliesPropertyExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // OverlappedImplicationPropertyExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // NonOverlappedImplicationPropertyExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // OverlappedFollowedByPropertyExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // NonOverlappedFollowedByPropertyExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // AssignmentExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // AddAssignmentExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // SubtractAssignmentExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // MultiplyAssignmentExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // DivideAssignmentExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // ModAssignmentExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // AndAssignmentExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // OrAssignmentExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // XorAssignmentExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // LogicalLeftShiftAssignmentExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // LogicalRightShiftAssignmentExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // ArithmeticLeftShiftAssignmentExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // ArithmeticRightShiftAssignmentExpression
+    { BinaryExpressionSyntaxChildren, 4 }, // NonblockingAssignmentExpression
+    { KeywordNameSyntaxChildren, 1 }, // LocalScope
+    { KeywordNameSyntaxChildren, 1 }, // UnitScope
+    { KeywordNameSyntaxChildren, 1 }, // RootScope
+    { IdentifierNameSyntaxChildren, 1 }, // IdentifierName
+    { IdentifierSelectNameSyntaxChildren, 2 }, // IdentifierSelectName
+    { nullptr, 0 }, // EmptyIdentifierName
+    { ClassNameSyntaxChildren, 2 }, // ClassName
+    { ScopedNameSyntaxChildren, 3 }, // ScopedName
+    { KeywordNameSyntaxChildren, 1 }, // SystemName
+    { KeywordNameSyntaxChildren, 1 }, // ThisHandle
+    { KeywordNameSyntaxChildren, 1 }, // SuperHandle
+    { KeywordNameSyntaxChildren, 1 }, // ArrayUniqueMethod
+    { KeywordNameSyntaxChildren, 1 }, // ArrayAndMethod
+    { KeywordNameSyntaxChildren, 1 }, // ArrayOrMethod
+    { KeywordNameSyntaxChildren, 1 }, // ArrayXorMethod
+    { ClassScopeSyntaxChildren, 2 }, // ClassScope
+    { KeywordNameSyntaxChildren, 1 }, // ConstructorName
+    { DelaySyntaxChildren, 2 }, // DelayControl
+    { DelaySyntaxChildren, 2 }, // CycleDelay
+    { EventControlSyntaxChildren, 2 }, // EventControl
+    { SignalEventExpressionSyntaxChildren, 2 }, // SignalEventExpression
+    { BinaryEventExpressionSyntaxChildren, 3 }, // BinaryEventExpression
+    { ParenthesizedEventExpressionSyntaxChildren, 3 }, // ParenthesizedEventExpression
+    { ImplicitEventControlSyntaxChildren, 1 }, // ImplicitEventControl
+    { ParenImplicitEventControlSyntaxChildren, 2 }, // ParenImplicitEventControl
+    { EventControlWithExpressionSyntaxChildren, 2 }, // EventControlWithExpression
+    { RepeatedEventControlSyntaxChildren, 5 }, // RepeatedEventControl
+    { TimingControlExpressionSyntaxChildren, 2 }, // TimingControlExpression
+    { TimingControlExpressionConcatenationSyntaxChildren, 3 }, // TimingControlExpressionConcatenation
+    { ShortcutCycleDelayRangeSyntaxChildren, 4 }, // ShortcutCycleDelayRange
+    { RangeDimensionSpecifierSyntaxChildren, 1 }, // RangeDimensionSpecifier
+    { DataTypeDimensionSpecifierSyntaxChildren, 1 }, // DataTypeDimensionSpecifier
+    { WildcardDimensionSpecifierSyntaxChildren, 1 }, // WildcardDimensionSpecifier
+    { ColonExpressionClauseSyntaxChildren, 2 }, // ColonExpressionClause
+    { QueueDimensionSpecifierSyntaxChildren, 2 }, // QueueDimensionSpecifier
+    { VariableDimensionSyntaxChildren, 3 }, // VariableDimension
+    { EqualsValueClauseSyntaxChildren, 2 }, // EqualsValueClause
+    { VariableDeclaratorSyntaxChildren, 3 }, // VariableDeclarator
+    { DataDeclarationSyntaxChildren, 5 }, // DataDeclaration
+    { TypedefDeclarationSyntaxChildren, 6 }, // TypedefDeclaration
+    { ForwardTypedefDeclarationSyntaxChildren, 5 }, // ForwardTypedefDeclaration
+    { ForwardInterfaceClassTypedefDeclarationSyntaxChildren, 6 }, // ForwardInterfaceClassTypedefDeclaration
+    { PackageImportItemSyntaxChildren, 3 }, // PackageImportItem
+    { PackageImportDeclarationSyntaxChildren, 4 }, // PackageImportDeclaration
+    { ParameterDeclarationSyntaxChildren, 3 }, // ParameterDeclaration
+    { ParameterDeclarationStatementSyntaxChildren, 3 }, // ParameterDeclarationStatement
+    { ChargeStrengthSyntaxChildren, 3 }, // ChargeStrength
+    { DriveStrengthSyntaxChildren, 5 }, // DriveStrength
+    { NetDeclarationSyntaxChildren, 7 }, // NetDeclaration
+    { PortDeclarationSyntaxChildren, 4 }, // PortDeclaration
+    { GenvarDeclarationSyntaxChildren, 4 }, // GenvarDeclaration
+    { IntegerTypeSyntaxChildren, 3 }, // BitType
+    { IntegerTypeSyntaxChildren, 3 }, // LogicType
+    { IntegerTypeSyntaxChildren, 3 }, // RegType
+    { IntegerTypeSyntaxChildren, 3 }, // ByteType
+    { IntegerTypeSyntaxChildren, 3 }, // ShortIntType
+    { IntegerTypeSyntaxChildren, 3 }, // IntType
+    { IntegerTypeSyntaxChildren, 3 }, // LongIntType
+    { IntegerTypeSyntaxChildren, 3 }, // IntegerType
+    { IntegerTypeSyntaxChildren, 3 }, // TimeType
+    { KeywordTypeSyntaxChildren, 1 }, // ShortRealType
+    { KeywordTypeSyntaxChildren, 1 }, // RealType
+    { KeywordTypeSyntaxChildren, 1 }, // RealTimeType
+    { StructUnionTypeSyntaxChildren, 8 }, // StructType
+    { StructUnionTypeSyntaxChildren, 8 }, // UnionType
+    { EnumTypeSyntaxChildren, 6 }, // EnumType
+    { KeywordTypeSyntaxChildren, 1 }, // StringType
+    { KeywordTypeSyntaxChildren, 1 }, // CHandleType
+    { VirtualInterfaceTypeSyntaxChildren, 5 }, // VirtualInterfaceType
+    { NamedTypeSyntaxChildren, 1 }, // NamedType
+    { KeywordTypeSyntaxChildren, 1 }, // EventType
+    { KeywordTypeSyntaxChildren, 1 }, // VoidType
+    { KeywordTypeSyntaxChildren, 1 }, // TypeType
+    { ImplicitTypeSyntaxChildren, 2 }, // ImplicitType
+    { TypeReferenceSyntaxChildren, 4 }, // TypeReference
+    { StructUnionMemberSyntaxChildren, 5 }, // StructUnionMember
+    { DotMemberClauseSyntaxChildren, 2 }, // DotMemberClause
+    { KeywordTypeSyntaxChildren, 1 }, // Untyped
+    { KeywordTypeSyntaxChildren, 1 }, // PropertyType
+    { KeywordTypeSyntaxChildren, 1 }, // SequenceType
+    { VarDataTypeSyntaxChildren, 2 }, // VarDataType
+    { NamedLabelSyntaxChildren, 2 }, // NamedLabel
+    { EmptyStatementSyntaxChildren, 3 }, // EmptyStatement
+    { ElseClauseSyntaxChildren, 2 }, // ElseClause
+    { ConditionalStatementSyntaxChildren, 9 }, // ConditionalStatement
+    { DefaultCaseItemSyntaxChildren, 3 }, // DefaultCaseItem
+    { PatternCaseItemSyntaxChildren, 5 }, // PatternCaseItem
+    { StandardCaseItemSyntaxChildren, 3 }, // StandardCaseItem
+    { CaseStatementSyntaxChildren, 10 }, // CaseStatement
+    { ForeverStatementSyntaxChildren, 4 }, // ForeverStatement
+    { LoopStatementSyntaxChildren, 7 }, // LoopStatement
+    { DoWhileStatementSyntaxChildren, 9 }, // DoWhileStatement
+    { ForVariableDeclarationSyntaxChildren, 3 }, // ForVariableDeclaration
+    { ForLoopStatementSyntaxChildren, 11 }, // ForLoopStatement
+    { ForeachLoopListSyntaxChildren, 6 }, // ForeachLoopList
+    { ForeachLoopStatementSyntaxChildren, 5 }, // ForeachLoopStatement
+    { ReturnStatementSyntaxChildren, 5 }, // ReturnStatement
+    { JumpStatementSyntaxChildren, 4 }, // JumpStatement
+    { TimingControlStatementSyntaxChildren, 4 }, // TimingControlStatement
+    { ExpressionStatementSyntaxChildren, 4 }, // ExpressionStatement
+    { ProceduralAssignStatementSyntaxChildren, 7 }, // ProceduralAssignStatement
+    { ProceduralAssignStatementSyntaxChildren, 7 }, // ProceduralForceStatement
+    { ProceduralDeassignStatementSyntaxChildren, 5 }, // ProceduralDeassignStatement
+    { ProceduralDeassignStatementSyntaxChildren, 5 }, // ProceduralReleaseStatement
+    { DisableStatementSyntaxChildren, 5 }, // DisableStatement
+    { DisableForkStatementSyntaxChildren, 5 }, // DisableForkStatement
+    { NamedBlockClauseSyntaxChildren, 2 }, // NamedBlockClause
+    { BlockStatementSyntaxChildren, 7 }, // SequentialBlockStatement
+    { BlockStatementSyntaxChildren, 7 }, // ParallelBlockStatement
+    { WaitStatementSyntaxChildren, 7 }, // WaitStatement
+    { WaitForkStatementSyntaxChildren, 5 }, // WaitForkStatement
+    { WaitOrderStatementSyntaxChildren, 7 }, // WaitOrderStatement
+    { RandCaseItemSyntaxChildren, 3 }, // RandCaseItem
+    { RandCaseStatementSyntaxChildren, 5 }, // RandCaseStatement
+    { EventTriggerStatementSyntaxChildren, 5 }, // BlockingEventTriggerStatement
+    { EventTriggerStatementSyntaxChildren, 5 }, // NonblockingEventTriggerStatement
+    { DeferredAssertionSyntaxChildren, 3 }, // DeferredAssertion
+    { ConcurrentAssertionMemberSyntaxChildren, 2 }, // ConcurrentAssertionMember
+    { ImmediateAssertionMemberSyntaxChildren, 2 }, // ImmediateAssertionMember
+    { ActionBlockSyntaxChildren, 2 }, // ActionBlock
+    { ImmediateAssertionStatementSyntaxChildren, 6 }, // ImmediateAssertStatement
+    { ImmediateAssertionStatementSyntaxChildren, 6 }, // ImmediateAssumeStatement
+    { ImmediateAssertionStatementSyntaxChildren, 6 }, // ImmediateCoverStatement
+    { DisableIffSyntaxChildren, 5 }, // DisableIff
+    { PropertySpecSyntaxChildren, 3 }, // PropertySpec
+    { ConcurrentAssertionStatementSyntaxChildren, 8 }, // AssertPropertyStatement
+    { ConcurrentAssertionStatementSyntaxChildren, 8 }, // AssumePropertyStatement
+    { ConcurrentAssertionStatementSyntaxChildren, 8 }, // CoverPropertyStatement
+    { ConcurrentAssertionStatementSyntaxChildren, 8 }, // CoverSequenceStatement
+    { ConcurrentAssertionStatementSyntaxChildren, 8 }, // RestrictPropertyStatement
+    { ConcurrentAssertionStatementSyntaxChildren, 8 }, // ExpectPropertyStatement
+    { ImplicitNonAnsiPortSyntaxChildren, 1 }, // ImplicitNonAnsiPort
+    { ExplicitNonAnsiPortSyntaxChildren, 5 }, // ExplicitNonAnsiPort
+    { NonAnsiPortListSyntaxChildren, 3 }, // NonAnsiPortList
+    { InterfacePortHeaderSyntaxChildren, 2 }, // InterfacePortHeader
+    { VariablePortHeaderSyntaxChildren, 3 }, // VariablePortHeader
+    { InterconnectPortHeaderSyntaxChildren, 3 }, // InterconnectPortHeader
+    { NetPortHeaderSyntaxChildren, 3 }, // NetPortHeader
+    { ImplicitAnsiPortSyntaxChildren, 3 }, // ImplicitAnsiPort
+    { ExplicitAnsiPortSyntaxChildren, 7 }, // ExplicitAnsiPort
+    { AnsiPortListSyntaxChildren, 3 }, // AnsiPortList
+    { WildcardPortListSyntaxChildren, 3 }, // WildcardPortList
+    { ParameterPortListSyntaxChildren, 4 }, // ParameterPortList
+    { ModuleHeaderSyntaxChildren, 7 }, // ModuleHeader
+    { ModuleDeclarationSyntaxChildren, 5 }, // ModuleDeclaration
+    { ModuleHeaderSyntaxChildren, 7 }, // InterfaceHeader
+    { ModuleDeclarationSyntaxChildren, 5 }, // InterfaceDeclaration
+    { ModuleHeaderSyntaxChildren, 7 }, // ProgramHeader
+    { ModuleDeclarationSyntaxChildren, 5 }, // ProgramDeclaration
+    { ModuleHeaderSyntaxChildren, 7 }, // PackageHeader
+    { ModuleDeclarationSyntaxChildren, 5 }, // PackageDeclaration
+    { ExternModuleSyntaxChildren, 2 }, // ExternModule
+    { EmptyMemberSyntaxChildren, 3 }, // EmptyMember
+    { ProceduralBlockSyntaxChildren, 3 }, // InitialBlock
+    { ProceduralBlockSyntaxChildren, 3 }, // FinalBlock
+    { ProceduralBlockSyntaxChildren, 3 }, // AlwaysBlock
+    { ProceduralBlockSyntaxChildren, 3 }, // AlwaysFFBlock
+    { ProceduralBlockSyntaxChildren, 3 }, // AlwaysCombBlock
+    { ProceduralBlockSyntaxChildren, 3 }, // AlwaysLatchBlock
+    { GenerateRegionSyntaxChildren, 4 }, // GenerateRegion
+    { LoopGenerateSyntaxChildren, 13 }, // LoopGenerate
+    { IfGenerateSyntaxChildren, 7 }, // IfGenerate
+    { CaseGenerateSyntaxChildren, 7 }, // CaseGenerate
+    { GenerateBlockSyntaxChildren, 7 }, // GenerateBlock
+    { DividerClauseSyntaxChildren, 2 }, // DividerClause
+    { TimeUnitsDeclarationSyntaxChildren, 5 }, // TimeUnitsDeclaration
+    { OrderedPortConnectionSyntaxChildren, 2 }, // OrderedPortConnection
+    { NamedPortConnectionSyntaxChildren, 6 }, // NamedPortConnection
+    { WildcardPortConnectionSyntaxChildren, 2 }, // WildcardPortConnection
+    { HierarchicalInstanceSyntaxChildren, 5 }, // HierarchicalInstance
+    { HierarchyInstantiationSyntaxChildren, 5 }, // HierarchyInstantiation
+    { FunctionPortSyntaxChildren, 6 }, // FunctionPort
+    { FunctionPortListSyntaxChildren, 3 }, // FunctionPortList
+    { FunctionPrototypeSyntaxChildren, 5 }, // FunctionPrototype
+    { FunctionDeclarationSyntaxChildren, 6 }, // FunctionDeclaration
+    { AssertionItemPortSyntaxChildren, 5 }, // AssertionItemPort
+    { AssertionItemPortListSyntaxChildren, 3 }, // AssertionItemPortList
+    { LetDeclarationSyntaxChildren, 6 }, // LetDeclaration
+    { PropertyDeclarationSyntaxChildren, 10 }, // PropertyDeclaration
+    { SequenceDeclarationSyntaxChildren, 10 }, // SequenceDeclaration
+    { FunctionDeclarationSyntaxChildren, 6 }, // TaskDeclaration
+    { ExtendsClauseSyntaxChildren, 3 }, // ExtendsClause
+    { ImplementsClauseSyntaxChildren, 2 }, // ImplementsClause
+    { ClassDeclarationSyntaxChildren, 12 }, // ClassDeclaration
+    { ClassPropertyDeclarationSyntaxChildren, 3 }, // ClassPropertyDeclaration
+    { ClassMethodDeclarationSyntaxChildren, 3 }, // ClassMethodDeclaration
+    { ClassMethodPrototypeSyntaxChildren, 4 }, // ClassMethodPrototype
+    { ContinuousAssignSyntaxChildren, 4 }, // ContinuousAssign
+    { DefParamAssignmentSyntaxChildren, 2 }, // DefParamAssignment
+    { DefParamSyntaxChildren, 4 }, // DefParam
+    { ModportClockingPortSyntaxChildren, 3 }, // ModportClockingPort
+    { ModportNamedPortSyntaxChildren, 1 }, // ModportNamedPort
+    { ModportExplicitPortSyntaxChildren, 5 }, // ModportExplicitPort
+    { ModportSimplePortListSyntaxChildren, 3 }, // ModportSimplePortList
+    { ModportSubroutinePortSyntaxChildren, 1 }, // ModportSubroutinePort
+    { ModportSubroutinePortListSyntaxChildren, 3 }, // ModportSubroutinePortList
+    { ModportItemSyntaxChildren, 2 }, // ModportItem
+    { ModportDeclarationSyntaxChildren, 4 }, // ModportDeclaration
+    { ClockingSkewSyntaxChildren, 3 }, // ClockingSkew
+    { ClockingDirectionSyntaxChildren, 5 }, // ClockingDirection
+    { ClockingItemSyntaxChildren, 5 }, // ClockingItem
+    { ClockingDeclarationSyntaxChildren, 11 }, // ClockingDeclaration
+    { DPIImportExportSyntaxChildren, 8 }, // DPIImportExport
+    { DistWeightSyntaxChildren, 2 }, // DistWeight
+    { DistItemSyntaxChildren, 2 }, // DistItem
+    { DistConstraintListSyntaxChildren, 4 }, // DistConstraintList
+    { ExpressionConstraintSyntaxChildren, 3 }, // ExpressionConstraint
+    { UniquenessConstraintSyntaxChildren, 3 }, // UniquenessConstraint
+    { ImplicationConstraintSyntaxChildren, 3 }, // ImplicationConstraint
+    { ElseConstraintClauseSyntaxChildren, 2 }, // ElseConstraintClause
+    { ConditionalConstraintSyntaxChildren, 6 }, // ConditionalConstraint
+    { LoopConstraintSyntaxChildren, 3 }, // LoopConstraint
+    { DisableConstraintSyntaxChildren, 4 }, // DisableConstraint
+    { SolveBeforeConstraintSyntaxChildren, 5 }, // SolveBeforeConstraint
+    { ConstraintBlockSyntaxChildren, 3 }, // ConstraintBlock
+    { ConstraintPrototypeSyntaxChildren, 5 }, // ConstraintPrototype
+    { ConstraintDeclarationSyntaxChildren, 5 }, // ConstraintDeclaration
+    { WithFunctionSampleSyntaxChildren, 4 }, // WithFunctionSample
+    { BinaryBlockEventExpressionSyntaxChildren, 3 }, // BinaryBlockEventExpression
+    { PrimaryBlockEventExpressionSyntaxChildren, 2 }, // PrimaryBlockEventExpression
+    { BlockCoverageEventSyntaxChildren, 4 }, // BlockCoverageEvent
+    { CovergroupDeclarationSyntaxChildren, 9 }, // CovergroupDeclaration
+    { CoverageOptionSyntaxChildren, 7 }, // CoverageOption
+    { CoverpointSyntaxChildren, 9 }, // Coverpoint
+    { TransRepeatRangeSyntaxChildren, 4 }, // TransRepeatRange
+    { TransRangeSyntaxChildren, 2 }, // TransRange
+    { TransSetSyntaxChildren, 3 }, // TransSet
+    { DefaultCoverageBinInitializerSyntaxChildren, 2 }, // DefaultCoverageBinInitializer
+    { ExpressionCoverageBinInitializerSyntaxChildren, 2 }, // ExpressionCoverageBinInitializer
+    { RangeCoverageBinInitializerSyntaxChildren, 2 }, // RangeCoverageBinInitializer
+    { TransListCoverageBinInitializerSyntaxChildren, 2 }, // TransListCoverageBinInitializer
+    { IffClauseSyntaxChildren, 4 }, // IffClause
+    { CoverageBinsSyntaxChildren, 9 }, // CoverageBins
+    { CompilationUnitSyntaxChildren, 2 }, // CompilationUnit
+};
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#endif
 
 bool ActionBlockSyntax::isKind(SyntaxKind kind) {
     return kind == SyntaxKind::ActionBlock;
@@ -41,21 +41,14 @@ struct EqualsValueClauseSyntax : public SyntaxNode {
 
     EqualsValueClauseSyntax(Token equals, ExpressionSyntax& expr) :
         SyntaxNode(SyntaxKind::EqualsValueClause), equals(equals), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     EqualsValueClauseSyntax(const EqualsValueClauseSyntax&) = delete;
     EqualsValueClauseSyntax& operator=(const EqualsValueClauseSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return equals;
-            case 1: return &expr;
-            default: return nullptr;
-        }
-    }
 };
 
 struct AttributeSpecSyntax : public SyntaxNode {
@@ -64,21 +57,14 @@ struct AttributeSpecSyntax : public SyntaxNode {
 
     AttributeSpecSyntax(Token name, EqualsValueClauseSyntax* value) :
         SyntaxNode(SyntaxKind::AttributeSpec), name(name), value(value)
-    {}
+    {
+        computeSourceRange();
+    }
 
     AttributeSpecSyntax(const AttributeSpecSyntax&) = delete;
     AttributeSpecSyntax& operator=(const AttributeSpecSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return name;
-            case 1: return value;
-            default: return nullptr;
-        }
-    }
 };
 
 struct AttributeInstanceSyntax : public SyntaxNode {
@@ -88,22 +74,14 @@ struct AttributeInstanceSyntax : public SyntaxNode {
 
     AttributeInstanceSyntax(Token openParen, SeparatedSyntaxList<AttributeSpecSyntax> specs, Token closeParen) :
         SyntaxNode(SyntaxKind::AttributeInstance), openParen(openParen), specs(specs), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     AttributeInstanceSyntax(const AttributeInstanceSyntax&) = delete;
     AttributeInstanceSyntax& operator=(const AttributeInstanceSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return &specs;
-            case 2: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct NamedLabelSyntax : public SyntaxNode {
@@ -112,21 +90,14 @@ struct NamedLabelSyntax : public SyntaxNode {
 
     NamedLabelSyntax(Token name, Token colon) :
         SyntaxNode(SyntaxKind::NamedLabel), name(name), colon(colon)
-    {}
+    {
+        computeSourceRange();
+    }
 
     NamedLabelSyntax(const NamedLabelSyntax&) = delete;
     NamedLabelSyntax& operator=(const NamedLabelSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return name;
-            case 1: return colon;
-            default: return nullptr;
-        }
-    }
 };
 
 struct StatementSyntax : public SyntaxNode {
@@ -141,15 +112,6 @@ struct StatementSyntax : public SyntaxNode {
     StatementSyntax& operator=(const StatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            default: return nullptr;
-        }
-    }
 };
 
 struct MemberSyntax : public SyntaxNode {
@@ -163,14 +125,6 @@ struct MemberSyntax : public SyntaxNode {
     MemberSyntax& operator=(const MemberSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override {
-        switch (index) {
-            case 0: return &attributes;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- ARGUMENTS -----
@@ -188,18 +142,14 @@ struct EmptyArgumentSyntax : public ArgumentSyntax {
 
     EmptyArgumentSyntax() :
         ArgumentSyntax(SyntaxKind::EmptyArgument)
-    {}
+    {
+        computeSourceRange();
+    }
 
     EmptyArgumentSyntax(const EmptyArgumentSyntax&) = delete;
     EmptyArgumentSyntax& operator=(const EmptyArgumentSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        (void)index;
-        return nullptr;
-    }
 };
 
 struct OrderedArgumentSyntax : public ArgumentSyntax {
@@ -207,20 +157,14 @@ struct OrderedArgumentSyntax : public ArgumentSyntax {
 
     OrderedArgumentSyntax(ExpressionSyntax& expr) :
         ArgumentSyntax(SyntaxKind::OrderedArgument), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     OrderedArgumentSyntax(const OrderedArgumentSyntax&) = delete;
     OrderedArgumentSyntax& operator=(const OrderedArgumentSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &expr;
-            default: return nullptr;
-        }
-    }
 };
 
 struct NamedArgumentSyntax : public ArgumentSyntax {
@@ -232,24 +176,14 @@ struct NamedArgumentSyntax : public ArgumentSyntax {
 
     NamedArgumentSyntax(Token dot, Token name, Token openParen, ExpressionSyntax* expr, Token closeParen) :
         ArgumentSyntax(SyntaxKind::NamedArgument), dot(dot), name(name), openParen(openParen), expr(expr), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     NamedArgumentSyntax(const NamedArgumentSyntax&) = delete;
     NamedArgumentSyntax& operator=(const NamedArgumentSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return dot;
-            case 1: return name;
-            case 2: return openParen;
-            case 3: return expr;
-            case 4: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ArgumentListSyntax : public SyntaxNode {
@@ -259,22 +193,14 @@ struct ArgumentListSyntax : public SyntaxNode {
 
     ArgumentListSyntax(Token openParen, SeparatedSyntaxList<ArgumentSyntax> parameters, Token closeParen) :
         SyntaxNode(SyntaxKind::ArgumentList), openParen(openParen), parameters(parameters), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ArgumentListSyntax(const ArgumentListSyntax&) = delete;
     ArgumentListSyntax& operator=(const ArgumentListSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return &parameters;
-            case 2: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ParameterValueAssignmentSyntax : public SyntaxNode {
@@ -283,21 +209,14 @@ struct ParameterValueAssignmentSyntax : public SyntaxNode {
 
     ParameterValueAssignmentSyntax(Token hash, ArgumentListSyntax& parameters) :
         SyntaxNode(SyntaxKind::ParameterValueAssignment), hash(hash), parameters(parameters)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ParameterValueAssignmentSyntax(const ParameterValueAssignmentSyntax&) = delete;
     ParameterValueAssignmentSyntax& operator=(const ParameterValueAssignmentSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return hash;
-            case 1: return &parameters;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- PATTERNS -----
@@ -317,21 +236,14 @@ struct VariablePatternSyntax : public PatternSyntax {
 
     VariablePatternSyntax(Token dot, Token variableName) :
         PatternSyntax(SyntaxKind::VariablePattern), dot(dot), variableName(variableName)
-    {}
+    {
+        computeSourceRange();
+    }
 
     VariablePatternSyntax(const VariablePatternSyntax&) = delete;
     VariablePatternSyntax& operator=(const VariablePatternSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return dot;
-            case 1: return variableName;
-            default: return nullptr;
-        }
-    }
 };
 
 struct WildcardPatternSyntax : public PatternSyntax {
@@ -339,20 +251,14 @@ struct WildcardPatternSyntax : public PatternSyntax {
 
     WildcardPatternSyntax(Token dotStar) :
         PatternSyntax(SyntaxKind::WildcardPattern), dotStar(dotStar)
-    {}
+    {
+        computeSourceRange();
+    }
 
     WildcardPatternSyntax(const WildcardPatternSyntax&) = delete;
     WildcardPatternSyntax& operator=(const WildcardPatternSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return dotStar;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ExpressionPatternSyntax : public PatternSyntax {
@@ -360,20 +266,14 @@ struct ExpressionPatternSyntax : public PatternSyntax {
 
     ExpressionPatternSyntax(ExpressionSyntax& expr) :
         PatternSyntax(SyntaxKind::ExpressionPattern), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ExpressionPatternSyntax(const ExpressionPatternSyntax&) = delete;
     ExpressionPatternSyntax& operator=(const ExpressionPatternSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &expr;
-            default: return nullptr;
-        }
-    }
 };
 
 struct TaggedPatternSyntax : public PatternSyntax {
@@ -383,22 +283,14 @@ struct TaggedPatternSyntax : public PatternSyntax {
 
     TaggedPatternSyntax(Token tagged, Token memberName, PatternSyntax* pattern) :
         PatternSyntax(SyntaxKind::TaggedPattern), tagged(tagged), memberName(memberName), pattern(pattern)
-    {}
+    {
+        computeSourceRange();
+    }
 
     TaggedPatternSyntax(const TaggedPatternSyntax&) = delete;
     TaggedPatternSyntax& operator=(const TaggedPatternSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return tagged;
-            case 1: return memberName;
-            case 2: return pattern;
-            default: return nullptr;
-        }
-    }
 };
 
 struct StructurePatternMemberSyntax : public SyntaxNode {
@@ -415,20 +307,14 @@ struct OrderedStructurePatternMemberSyntax : public StructurePatternMemberSyntax
 
     OrderedStructurePatternMemberSyntax(PatternSyntax& pattern) :
         StructurePatternMemberSyntax(SyntaxKind::OrderedStructurePatternMember), pattern(pattern)
-    {}
+    {
+        computeSourceRange();
+    }
 
     OrderedStructurePatternMemberSyntax(const OrderedStructurePatternMemberSyntax&) = delete;
     OrderedStructurePatternMemberSyntax& operator=(const OrderedStructurePatternMemberSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &pattern;
-            default: return nullptr;
-        }
-    }
 };
 
 struct NamedStructurePatternMemberSyntax : public StructurePatternMemberSyntax {
@@ -438,22 +324,14 @@ struct NamedStructurePatternMemberSyntax : public StructurePatternMemberSyntax {
 
     NamedStructurePatternMemberSyntax(Token name, Token colon, PatternSyntax& pattern) :
         StructurePatternMemberSyntax(SyntaxKind::NamedStructurePatternMember), name(name), colon(colon), pattern(pattern)
-    {}
+    {
+        computeSourceRange();
+    }
 
     NamedStructurePatternMemberSyntax(const NamedStructurePatternMemberSyntax&) = delete;
     NamedStructurePatternMemberSyntax& operator=(const NamedStructurePatternMemberSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return name;
-            case 1: return colon;
-            case 2: return &pattern;
-            default: return nullptr;
-        }
-    }
 };
 
 struct StructurePatternSyntax : public PatternSyntax {
@@ -463,22 +341,14 @@ struct StructurePatternSyntax : public PatternSyntax {
 
     StructurePatternSyntax(Token openBrace, SeparatedSyntaxList<StructurePatternMemberSyntax> members, Token closeBrace) :
         PatternSyntax(SyntaxKind::StructurePattern), openBrace(openBrace), members(members), closeBrace(closeBrace)
-    {}
+    {
+        computeSourceRange();
+    }
 
     StructurePatternSyntax(const StructurePatternSyntax&) = delete;
     StructurePatternSyntax& operator=(const StructurePatternSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openBrace;
-            case 1: return &members;
-            case 2: return closeBrace;
-            default: return nullptr;
-        }
-    }
 };
 
 struct MatchesClauseSyntax : public SyntaxNode {
@@ -487,21 +357,14 @@ struct MatchesClauseSyntax : public SyntaxNode {
 
     MatchesClauseSyntax(Token matchesKeyword, PatternSyntax& pattern) :
         SyntaxNode(SyntaxKind::MatchesClause), matchesKeyword(matchesKeyword), pattern(pattern)
-    {}
+    {
+        computeSourceRange();
+    }
 
     MatchesClauseSyntax(const MatchesClauseSyntax&) = delete;
     MatchesClauseSyntax& operator=(const MatchesClauseSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return matchesKeyword;
-            case 1: return &pattern;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ConditionalPatternSyntax : public SyntaxNode {
@@ -510,21 +373,14 @@ struct ConditionalPatternSyntax : public SyntaxNode {
 
     ConditionalPatternSyntax(ExpressionSyntax& expr, MatchesClauseSyntax* matchesClause) :
         SyntaxNode(SyntaxKind::ConditionalPattern), expr(expr), matchesClause(matchesClause)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ConditionalPatternSyntax(const ConditionalPatternSyntax&) = delete;
     ConditionalPatternSyntax& operator=(const ConditionalPatternSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &expr;
-            case 1: return matchesClause;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ConditionalPredicateSyntax : public SyntaxNode {
@@ -532,20 +388,14 @@ struct ConditionalPredicateSyntax : public SyntaxNode {
 
     ConditionalPredicateSyntax(SeparatedSyntaxList<ConditionalPatternSyntax> conditions) :
         SyntaxNode(SyntaxKind::ConditionalPredicate), conditions(conditions)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ConditionalPredicateSyntax(const ConditionalPredicateSyntax&) = delete;
     ConditionalPredicateSyntax& operator=(const ConditionalPredicateSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &conditions;
-            default: return nullptr;
-        }
-    }
 };
 
 struct AssignmentPatternSyntax : public SyntaxNode {
@@ -564,22 +414,14 @@ struct SimpleAssignmentPatternSyntax : public AssignmentPatternSyntax {
 
     SimpleAssignmentPatternSyntax(Token openBrace, SeparatedSyntaxList<ExpressionSyntax> items, Token closeBrace) :
         AssignmentPatternSyntax(SyntaxKind::SimpleAssignmentPattern), openBrace(openBrace), items(items), closeBrace(closeBrace)
-    {}
+    {
+        computeSourceRange();
+    }
 
     SimpleAssignmentPatternSyntax(const SimpleAssignmentPatternSyntax&) = delete;
     SimpleAssignmentPatternSyntax& operator=(const SimpleAssignmentPatternSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openBrace;
-            case 1: return &items;
-            case 2: return closeBrace;
-            default: return nullptr;
-        }
-    }
 };
 
 struct AssignmentPatternItemSyntax : public SyntaxNode {
@@ -589,22 +431,14 @@ struct AssignmentPatternItemSyntax : public SyntaxNode {
 
     AssignmentPatternItemSyntax(ExpressionSyntax& key, Token colon, ExpressionSyntax& expr) :
         SyntaxNode(SyntaxKind::AssignmentPatternItem), key(key), colon(colon), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     AssignmentPatternItemSyntax(const AssignmentPatternItemSyntax&) = delete;
     AssignmentPatternItemSyntax& operator=(const AssignmentPatternItemSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &key;
-            case 1: return colon;
-            case 2: return &expr;
-            default: return nullptr;
-        }
-    }
 };
 
 struct StructuredAssignmentPatternSyntax : public AssignmentPatternSyntax {
@@ -614,22 +448,14 @@ struct StructuredAssignmentPatternSyntax : public AssignmentPatternSyntax {
 
     StructuredAssignmentPatternSyntax(Token openBrace, SeparatedSyntaxList<AssignmentPatternItemSyntax> items, Token closeBrace) :
         AssignmentPatternSyntax(SyntaxKind::StructuredAssignmentPattern), openBrace(openBrace), items(items), closeBrace(closeBrace)
-    {}
+    {
+        computeSourceRange();
+    }
 
     StructuredAssignmentPatternSyntax(const StructuredAssignmentPatternSyntax&) = delete;
     StructuredAssignmentPatternSyntax& operator=(const StructuredAssignmentPatternSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openBrace;
-            case 1: return &items;
-            case 2: return closeBrace;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ReplicatedAssignmentPatternSyntax : public AssignmentPatternSyntax {
@@ -642,25 +468,14 @@ struct ReplicatedAssignmentPatternSyntax : public AssignmentPatternSyntax {
 
     ReplicatedAssignmentPatternSyntax(Token openBrace, ExpressionSyntax& countExpr, Token innerOpenBrace, SeparatedSyntaxList<ExpressionSyntax> items, Token innerCloseBrace, Token closeBrace) :
         AssignmentPatternSyntax(SyntaxKind::ReplicatedAssignmentPattern), openBrace(openBrace), countExpr(countExpr), innerOpenBrace(innerOpenBrace), items(items), innerCloseBrace(innerCloseBrace), closeBrace(closeBrace)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ReplicatedAssignmentPatternSyntax(const ReplicatedAssignmentPatternSyntax&) = delete;
     ReplicatedAssignmentPatternSyntax& operator=(const ReplicatedAssignmentPatternSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openBrace;
-            case 1: return &countExpr;
-            case 2: return innerOpenBrace;
-            case 3: return &items;
-            case 4: return innerCloseBrace;
-            case 5: return closeBrace;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- EXPRESSIONS -----
@@ -670,20 +485,14 @@ struct BadExpressionSyntax : public ExpressionSyntax {
 
     BadExpressionSyntax(ExpressionSyntax& expr) :
         ExpressionSyntax(SyntaxKind::BadExpression), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     BadExpressionSyntax(const BadExpressionSyntax&) = delete;
     BadExpressionSyntax& operator=(const BadExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &expr;
-            default: return nullptr;
-        }
-    }
 };
 
 struct PrimaryExpressionSyntax : public ExpressionSyntax {
@@ -702,22 +511,14 @@ struct PrefixUnaryExpressionSyntax : public ExpressionSyntax {
 
     PrefixUnaryExpressionSyntax(SyntaxKind kind, Token operatorToken, SyntaxList<AttributeInstanceSyntax> attributes, ExpressionSyntax& operand) :
         ExpressionSyntax(kind), operatorToken(operatorToken), attributes(attributes), operand(operand)
-    {}
+    {
+        computeSourceRange();
+    }
 
     PrefixUnaryExpressionSyntax(const PrefixUnaryExpressionSyntax&) = delete;
     PrefixUnaryExpressionSyntax& operator=(const PrefixUnaryExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return operatorToken;
-            case 1: return &attributes;
-            case 2: return &operand;
-            default: return nullptr;
-        }
-    }
 };
 
 struct PostfixUnaryExpressionSyntax : public ExpressionSyntax {
@@ -727,22 +528,14 @@ struct PostfixUnaryExpressionSyntax : public ExpressionSyntax {
 
     PostfixUnaryExpressionSyntax(SyntaxKind kind, ExpressionSyntax& operand, SyntaxList<AttributeInstanceSyntax> attributes, Token operatorToken) :
         ExpressionSyntax(kind), operand(operand), attributes(attributes), operatorToken(operatorToken)
-    {}
+    {
+        computeSourceRange();
+    }
 
     PostfixUnaryExpressionSyntax(const PostfixUnaryExpressionSyntax&) = delete;
     PostfixUnaryExpressionSyntax& operator=(const PostfixUnaryExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &operand;
-            case 1: return &attributes;
-            case 2: return operatorToken;
-            default: return nullptr;
-        }
-    }
 };
 
 struct BinaryExpressionSyntax : public ExpressionSyntax {
@@ -753,23 +546,14 @@ struct BinaryExpressionSyntax : public ExpressionSyntax {
 
     BinaryExpressionSyntax(SyntaxKind kind, ExpressionSyntax& left, Token operatorToken, SyntaxList<AttributeInstanceSyntax> attributes, ExpressionSyntax& right) :
         ExpressionSyntax(kind), left(left), operatorToken(operatorToken), attributes(attributes), right(right)
-    {}
+    {
+        computeSourceRange();
+    }
 
     BinaryExpressionSyntax(const BinaryExpressionSyntax&) = delete;
     BinaryExpressionSyntax& operator=(const BinaryExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &left;
-            case 1: return operatorToken;
-            case 2: return &attributes;
-            case 3: return &right;
-            default: return nullptr;
-        }
-    }
 };
 
 struct MinTypMaxExpressionSyntax : public ExpressionSyntax {
@@ -781,24 +565,14 @@ struct MinTypMaxExpressionSyntax : public ExpressionSyntax {
 
     MinTypMaxExpressionSyntax(ExpressionSyntax& min, Token colon1, ExpressionSyntax& typ, Token colon2, ExpressionSyntax& max) :
         ExpressionSyntax(SyntaxKind::MinTypMaxExpression), min(min), colon1(colon1), typ(typ), colon2(colon2), max(max)
-    {}
+    {
+        computeSourceRange();
+    }
 
     MinTypMaxExpressionSyntax(const MinTypMaxExpressionSyntax&) = delete;
     MinTypMaxExpressionSyntax& operator=(const MinTypMaxExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &min;
-            case 1: return colon1;
-            case 2: return &typ;
-            case 3: return colon2;
-            case 4: return &max;
-            default: return nullptr;
-        }
-    }
 };
 
 struct TaggedUnionExpressionSyntax : public ExpressionSyntax {
@@ -808,22 +582,14 @@ struct TaggedUnionExpressionSyntax : public ExpressionSyntax {
 
     TaggedUnionExpressionSyntax(Token tagged, Token member, ExpressionSyntax* expr) :
         ExpressionSyntax(SyntaxKind::TaggedUnionExpression), tagged(tagged), member(member), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     TaggedUnionExpressionSyntax(const TaggedUnionExpressionSyntax&) = delete;
     TaggedUnionExpressionSyntax& operator=(const TaggedUnionExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return tagged;
-            case 1: return member;
-            case 2: return expr;
-            default: return nullptr;
-        }
-    }
 };
 
 struct OpenRangeListSyntax : public SyntaxNode {
@@ -833,22 +599,14 @@ struct OpenRangeListSyntax : public SyntaxNode {
 
     OpenRangeListSyntax(Token openBrace, SeparatedSyntaxList<ExpressionSyntax> valueRanges, Token closeBrace) :
         SyntaxNode(SyntaxKind::OpenRangeList), openBrace(openBrace), valueRanges(valueRanges), closeBrace(closeBrace)
-    {}
+    {
+        computeSourceRange();
+    }
 
     OpenRangeListSyntax(const OpenRangeListSyntax&) = delete;
     OpenRangeListSyntax& operator=(const OpenRangeListSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openBrace;
-            case 1: return &valueRanges;
-            case 2: return closeBrace;
-            default: return nullptr;
-        }
-    }
 };
 
 struct InsideExpressionSyntax : public ExpressionSyntax {
@@ -858,22 +616,14 @@ struct InsideExpressionSyntax : public ExpressionSyntax {
 
     InsideExpressionSyntax(ExpressionSyntax& expr, Token inside, OpenRangeListSyntax& ranges) :
         ExpressionSyntax(SyntaxKind::InsideExpression), expr(expr), inside(inside), ranges(ranges)
-    {}
+    {
+        computeSourceRange();
+    }
 
     InsideExpressionSyntax(const InsideExpressionSyntax&) = delete;
     InsideExpressionSyntax& operator=(const InsideExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &expr;
-            case 1: return inside;
-            case 2: return &ranges;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ConditionalExpressionSyntax : public ExpressionSyntax {
@@ -886,25 +636,14 @@ struct ConditionalExpressionSyntax : public ExpressionSyntax {
 
     ConditionalExpressionSyntax(ConditionalPredicateSyntax& predicate, Token question, SyntaxList<AttributeInstanceSyntax> attributes, ExpressionSyntax& left, Token colon, ExpressionSyntax& right) :
         ExpressionSyntax(SyntaxKind::ConditionalExpression), predicate(predicate), question(question), attributes(attributes), left(left), colon(colon), right(right)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ConditionalExpressionSyntax(const ConditionalExpressionSyntax&) = delete;
     ConditionalExpressionSyntax& operator=(const ConditionalExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &predicate;
-            case 1: return question;
-            case 2: return &attributes;
-            case 3: return &left;
-            case 4: return colon;
-            case 5: return &right;
-            default: return nullptr;
-        }
-    }
 };
 
 struct AssignmentPatternExpressionSyntax : public PrimaryExpressionSyntax {
@@ -913,21 +652,14 @@ struct AssignmentPatternExpressionSyntax : public PrimaryExpressionSyntax {
 
     AssignmentPatternExpressionSyntax(DataTypeSyntax* type, AssignmentPatternSyntax& pattern) :
         PrimaryExpressionSyntax(SyntaxKind::AssignmentPatternExpression), type(type), pattern(pattern)
-    {}
+    {
+        computeSourceRange();
+    }
 
     AssignmentPatternExpressionSyntax(const AssignmentPatternExpressionSyntax&) = delete;
     AssignmentPatternExpressionSyntax& operator=(const AssignmentPatternExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return type;
-            case 1: return &pattern;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- SELECTORS -----
@@ -946,20 +678,14 @@ struct BitSelectSyntax : public SelectorSyntax {
 
     BitSelectSyntax(ExpressionSyntax& expr) :
         SelectorSyntax(SyntaxKind::BitSelect), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     BitSelectSyntax(const BitSelectSyntax&) = delete;
     BitSelectSyntax& operator=(const BitSelectSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &expr;
-            default: return nullptr;
-        }
-    }
 };
 
 struct RangeSelectSyntax : public SelectorSyntax {
@@ -969,22 +695,14 @@ struct RangeSelectSyntax : public SelectorSyntax {
 
     RangeSelectSyntax(SyntaxKind kind, ExpressionSyntax& left, Token range, ExpressionSyntax& right) :
         SelectorSyntax(kind), left(left), range(range), right(right)
-    {}
+    {
+        computeSourceRange();
+    }
 
     RangeSelectSyntax(const RangeSelectSyntax&) = delete;
     RangeSelectSyntax& operator=(const RangeSelectSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &left;
-            case 1: return range;
-            case 2: return &right;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ElementSelectSyntax : public ExpressionSyntax {
@@ -994,22 +712,14 @@ struct ElementSelectSyntax : public ExpressionSyntax {
 
     ElementSelectSyntax(Token openBracket, SelectorSyntax* selector, Token closeBracket) :
         ExpressionSyntax(SyntaxKind::ElementSelect), openBracket(openBracket), selector(selector), closeBracket(closeBracket)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ElementSelectSyntax(const ElementSelectSyntax&) = delete;
     ElementSelectSyntax& operator=(const ElementSelectSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openBracket;
-            case 1: return selector;
-            case 2: return closeBracket;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- NAMES -----
@@ -1028,20 +738,14 @@ struct IdentifierNameSyntax : public NameSyntax {
 
     IdentifierNameSyntax(Token identifier) :
         NameSyntax(SyntaxKind::IdentifierName), identifier(identifier)
-    {}
+    {
+        computeSourceRange();
+    }
 
     IdentifierNameSyntax(const IdentifierNameSyntax&) = delete;
     IdentifierNameSyntax& operator=(const IdentifierNameSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return identifier;
-            default: return nullptr;
-        }
-    }
 };
 
 struct IdentifierSelectNameSyntax : public NameSyntax {
@@ -1050,39 +754,28 @@ struct IdentifierSelectNameSyntax : public NameSyntax {
 
     IdentifierSelectNameSyntax(Token identifier, SyntaxList<ElementSelectSyntax> selectors) :
         NameSyntax(SyntaxKind::IdentifierSelectName), identifier(identifier), selectors(selectors)
-    {}
+    {
+        computeSourceRange();
+    }
 
     IdentifierSelectNameSyntax(const IdentifierSelectNameSyntax&) = delete;
     IdentifierSelectNameSyntax& operator=(const IdentifierSelectNameSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return identifier;
-            case 1: return &selectors;
-            default: return nullptr;
-        }
-    }
 };
 
 struct EmptyIdentifierNameSyntax : public NameSyntax {
 
     EmptyIdentifierNameSyntax() :
         NameSyntax(SyntaxKind::EmptyIdentifierName)
-    {}
+    {
+        computeSourceRange();
+    }
 
     EmptyIdentifierNameSyntax(const EmptyIdentifierNameSyntax&) = delete;
     EmptyIdentifierNameSyntax& operator=(const EmptyIdentifierNameSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        (void)index;
-        return nullptr;
-    }
 };
 
 struct KeywordNameSyntax : public NameSyntax {
@@ -1090,20 +783,14 @@ struct KeywordNameSyntax : public NameSyntax {
 
     KeywordNameSyntax(SyntaxKind kind, Token keyword) :
         NameSyntax(kind), keyword(keyword)
-    {}
+    {
+        computeSourceRange();
+    }
 
     KeywordNameSyntax(const KeywordNameSyntax&) = delete;
     KeywordNameSyntax& operator=(const KeywordNameSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return keyword;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ClassNameSyntax : public NameSyntax {
@@ -1112,21 +799,14 @@ struct ClassNameSyntax : public NameSyntax {
 
     ClassNameSyntax(Token identifier, ParameterValueAssignmentSyntax& parameters) :
         NameSyntax(SyntaxKind::ClassName), identifier(identifier), parameters(parameters)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ClassNameSyntax(const ClassNameSyntax&) = delete;
     ClassNameSyntax& operator=(const ClassNameSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return identifier;
-            case 1: return &parameters;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ScopedNameSyntax : public NameSyntax {
@@ -1136,22 +816,14 @@ struct ScopedNameSyntax : public NameSyntax {
 
     ScopedNameSyntax(NameSyntax& left, Token separator, NameSyntax& right) :
         NameSyntax(SyntaxKind::ScopedName), left(left), separator(separator), right(right)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ScopedNameSyntax(const ScopedNameSyntax&) = delete;
     ScopedNameSyntax& operator=(const ScopedNameSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &left;
-            case 1: return separator;
-            case 2: return &right;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ClassScopeSyntax : public NameSyntax {
@@ -1160,21 +832,14 @@ struct ClassScopeSyntax : public NameSyntax {
 
     ClassScopeSyntax(NameSyntax& left, Token separator) :
         NameSyntax(SyntaxKind::ClassScope), left(left), separator(separator)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ClassScopeSyntax(const ClassScopeSyntax&) = delete;
     ClassScopeSyntax& operator=(const ClassScopeSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &left;
-            case 1: return separator;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- PRIMARY EXPRESSIONS -----
@@ -1184,20 +849,14 @@ struct LiteralExpressionSyntax : public PrimaryExpressionSyntax {
 
     LiteralExpressionSyntax(SyntaxKind kind, Token literal) :
         PrimaryExpressionSyntax(kind), literal(literal)
-    {}
+    {
+        computeSourceRange();
+    }
 
     LiteralExpressionSyntax(const LiteralExpressionSyntax&) = delete;
     LiteralExpressionSyntax& operator=(const LiteralExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return literal;
-            default: return nullptr;
-        }
-    }
 };
 
 struct IntegerVectorExpressionSyntax : public PrimaryExpressionSyntax {
@@ -1207,22 +866,14 @@ struct IntegerVectorExpressionSyntax : public PrimaryExpressionSyntax {
 
     IntegerVectorExpressionSyntax(Token size, Token base, Token value) :
         PrimaryExpressionSyntax(SyntaxKind::IntegerVectorExpression), size(size), base(base), value(value)
-    {}
+    {
+        computeSourceRange();
+    }
 
     IntegerVectorExpressionSyntax(const IntegerVectorExpressionSyntax&) = delete;
     IntegerVectorExpressionSyntax& operator=(const IntegerVectorExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return size;
-            case 1: return base;
-            case 2: return value;
-            default: return nullptr;
-        }
-    }
 };
 
 struct EmptyQueueExpressionSyntax : public PrimaryExpressionSyntax {
@@ -1231,21 +882,14 @@ struct EmptyQueueExpressionSyntax : public PrimaryExpressionSyntax {
 
     EmptyQueueExpressionSyntax(Token openBrace, Token closeBrace) :
         PrimaryExpressionSyntax(SyntaxKind::EmptyQueueExpression), openBrace(openBrace), closeBrace(closeBrace)
-    {}
+    {
+        computeSourceRange();
+    }
 
     EmptyQueueExpressionSyntax(const EmptyQueueExpressionSyntax&) = delete;
     EmptyQueueExpressionSyntax& operator=(const EmptyQueueExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openBrace;
-            case 1: return closeBrace;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ConcatenationExpressionSyntax : public PrimaryExpressionSyntax {
@@ -1255,22 +899,14 @@ struct ConcatenationExpressionSyntax : public PrimaryExpressionSyntax {
 
     ConcatenationExpressionSyntax(Token openBrace, SeparatedSyntaxList<ExpressionSyntax> expressions, Token closeBrace) :
         PrimaryExpressionSyntax(SyntaxKind::ConcatenationExpression), openBrace(openBrace), expressions(expressions), closeBrace(closeBrace)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ConcatenationExpressionSyntax(const ConcatenationExpressionSyntax&) = delete;
     ConcatenationExpressionSyntax& operator=(const ConcatenationExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openBrace;
-            case 1: return &expressions;
-            case 2: return closeBrace;
-            default: return nullptr;
-        }
-    }
 };
 
 struct MultipleConcatenationExpressionSyntax : public PrimaryExpressionSyntax {
@@ -1281,23 +917,14 @@ struct MultipleConcatenationExpressionSyntax : public PrimaryExpressionSyntax {
 
     MultipleConcatenationExpressionSyntax(Token openBrace, ExpressionSyntax& expression, ConcatenationExpressionSyntax& concatenation, Token closeBrace) :
         PrimaryExpressionSyntax(SyntaxKind::MultipleConcatenationExpression), openBrace(openBrace), expression(expression), concatenation(concatenation), closeBrace(closeBrace)
-    {}
+    {
+        computeSourceRange();
+    }
 
     MultipleConcatenationExpressionSyntax(const MultipleConcatenationExpressionSyntax&) = delete;
     MultipleConcatenationExpressionSyntax& operator=(const MultipleConcatenationExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openBrace;
-            case 1: return &expression;
-            case 2: return &concatenation;
-            case 3: return closeBrace;
-            default: return nullptr;
-        }
-    }
 };
 
 struct StreamExpressionWithRange : public SyntaxNode {
@@ -1306,21 +933,14 @@ struct StreamExpressionWithRange : public SyntaxNode {
 
     StreamExpressionWithRange(Token withKeyword, ElementSelectSyntax& range) :
         SyntaxNode(SyntaxKind::StreamExpressionWithRange), withKeyword(withKeyword), range(range)
-    {}
+    {
+        computeSourceRange();
+    }
 
     StreamExpressionWithRange(const StreamExpressionWithRange&) = delete;
     StreamExpressionWithRange& operator=(const StreamExpressionWithRange&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return withKeyword;
-            case 1: return &range;
-            default: return nullptr;
-        }
-    }
 };
 
 struct StreamExpressionSyntax : public SyntaxNode {
@@ -1329,21 +949,14 @@ struct StreamExpressionSyntax : public SyntaxNode {
 
     StreamExpressionSyntax(ExpressionSyntax& expression, StreamExpressionWithRange* withRange) :
         SyntaxNode(SyntaxKind::StreamExpression), expression(expression), withRange(withRange)
-    {}
+    {
+        computeSourceRange();
+    }
 
     StreamExpressionSyntax(const StreamExpressionSyntax&) = delete;
     StreamExpressionSyntax& operator=(const StreamExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &expression;
-            case 1: return withRange;
-            default: return nullptr;
-        }
-    }
 };
 
 struct StreamingConcatenationExpressionSyntax : public PrimaryExpressionSyntax {
@@ -1357,26 +970,14 @@ struct StreamingConcatenationExpressionSyntax : public PrimaryExpressionSyntax {
 
     StreamingConcatenationExpressionSyntax(Token openBrace, Token operatorToken, ExpressionSyntax* sliceSize, Token innerOpenBrace, SeparatedSyntaxList<StreamExpressionSyntax> expressions, Token innerCloseBrace, Token closeBrace) :
         PrimaryExpressionSyntax(SyntaxKind::StreamingConcatenationExpression), openBrace(openBrace), operatorToken(operatorToken), sliceSize(sliceSize), innerOpenBrace(innerOpenBrace), expressions(expressions), innerCloseBrace(innerCloseBrace), closeBrace(closeBrace)
-    {}
+    {
+        computeSourceRange();
+    }
 
     StreamingConcatenationExpressionSyntax(const StreamingConcatenationExpressionSyntax&) = delete;
     StreamingConcatenationExpressionSyntax& operator=(const StreamingConcatenationExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openBrace;
-            case 1: return operatorToken;
-            case 2: return sliceSize;
-            case 3: return innerOpenBrace;
-            case 4: return &expressions;
-            case 5: return innerCloseBrace;
-            case 6: return closeBrace;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ParenthesizedExpressionSyntax : public PrimaryExpressionSyntax {
@@ -1386,22 +987,14 @@ struct ParenthesizedExpressionSyntax : public PrimaryExpressionSyntax {
 
     ParenthesizedExpressionSyntax(Token openParen, ExpressionSyntax& expression, Token closeParen) :
         PrimaryExpressionSyntax(SyntaxKind::ParenthesizedExpression), openParen(openParen), expression(expression), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ParenthesizedExpressionSyntax(const ParenthesizedExpressionSyntax&) = delete;
     ParenthesizedExpressionSyntax& operator=(const ParenthesizedExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return &expression;
-            case 2: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct NewClassExpressionSyntax : public ExpressionSyntax {
@@ -1411,22 +1004,14 @@ struct NewClassExpressionSyntax : public ExpressionSyntax {
 
     NewClassExpressionSyntax(ClassScopeSyntax* classScope, Token newKeyword, ArgumentListSyntax* arguments) :
         ExpressionSyntax(SyntaxKind::NewClassExpression), classScope(classScope), newKeyword(newKeyword), arguments(arguments)
-    {}
+    {
+        computeSourceRange();
+    }
 
     NewClassExpressionSyntax(const NewClassExpressionSyntax&) = delete;
     NewClassExpressionSyntax& operator=(const NewClassExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return classScope;
-            case 1: return newKeyword;
-            case 2: return arguments;
-            default: return nullptr;
-        }
-    }
 };
 
 struct NewArrayExpressionSyntax : public ExpressionSyntax {
@@ -1438,24 +1023,14 @@ struct NewArrayExpressionSyntax : public ExpressionSyntax {
 
     NewArrayExpressionSyntax(Token newKeyword, Token openBracket, ExpressionSyntax& sizeExpr, Token closeBracket, ParenthesizedExpressionSyntax* initializer) :
         ExpressionSyntax(SyntaxKind::NewArrayExpression), newKeyword(newKeyword), openBracket(openBracket), sizeExpr(sizeExpr), closeBracket(closeBracket), initializer(initializer)
-    {}
+    {
+        computeSourceRange();
+    }
 
     NewArrayExpressionSyntax(const NewArrayExpressionSyntax&) = delete;
     NewArrayExpressionSyntax& operator=(const NewArrayExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return newKeyword;
-            case 1: return openBracket;
-            case 2: return &sizeExpr;
-            case 3: return closeBracket;
-            case 4: return initializer;
-            default: return nullptr;
-        }
-    }
 };
 
 struct NewExpressionSyntax : public ExpressionSyntax {
@@ -1464,21 +1039,14 @@ struct NewExpressionSyntax : public ExpressionSyntax {
 
     NewExpressionSyntax(Token newKeyword, ExpressionSyntax& expr) :
         ExpressionSyntax(SyntaxKind::NewExpression), newKeyword(newKeyword), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     NewExpressionSyntax(const NewExpressionSyntax&) = delete;
     NewExpressionSyntax& operator=(const NewExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return newKeyword;
-            case 1: return &expr;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- POSTFIX EXPRESSIONS -----
@@ -1489,21 +1057,14 @@ struct ElementSelectExpressionSyntax : public ExpressionSyntax {
 
     ElementSelectExpressionSyntax(ExpressionSyntax& left, ElementSelectSyntax& select) :
         ExpressionSyntax(SyntaxKind::ElementSelectExpression), left(left), select(select)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ElementSelectExpressionSyntax(const ElementSelectExpressionSyntax&) = delete;
     ElementSelectExpressionSyntax& operator=(const ElementSelectExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &left;
-            case 1: return &select;
-            default: return nullptr;
-        }
-    }
 };
 
 struct MemberAccessExpressionSyntax : public ExpressionSyntax {
@@ -1513,22 +1074,14 @@ struct MemberAccessExpressionSyntax : public ExpressionSyntax {
 
     MemberAccessExpressionSyntax(ExpressionSyntax& left, Token dot, Token name) :
         ExpressionSyntax(SyntaxKind::MemberAccessExpression), left(left), dot(dot), name(name)
-    {}
+    {
+        computeSourceRange();
+    }
 
     MemberAccessExpressionSyntax(const MemberAccessExpressionSyntax&) = delete;
     MemberAccessExpressionSyntax& operator=(const MemberAccessExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &left;
-            case 1: return dot;
-            case 2: return name;
-            default: return nullptr;
-        }
-    }
 };
 
 struct InvocationExpressionSyntax : public ExpressionSyntax {
@@ -1538,22 +1091,14 @@ struct InvocationExpressionSyntax : public ExpressionSyntax {
 
     InvocationExpressionSyntax(ExpressionSyntax& left, SyntaxList<AttributeInstanceSyntax> attributes, ArgumentListSyntax* arguments) :
         ExpressionSyntax(SyntaxKind::InvocationExpression), left(left), attributes(attributes), arguments(arguments)
-    {}
+    {
+        computeSourceRange();
+    }
 
     InvocationExpressionSyntax(const InvocationExpressionSyntax&) = delete;
     InvocationExpressionSyntax& operator=(const InvocationExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &left;
-            case 1: return &attributes;
-            case 2: return arguments;
-            default: return nullptr;
-        }
-    }
 };
 
 struct CastExpressionSyntax : public ExpressionSyntax {
@@ -1563,22 +1108,14 @@ struct CastExpressionSyntax : public ExpressionSyntax {
 
     CastExpressionSyntax(ExpressionSyntax& left, Token apostrophe, ParenthesizedExpressionSyntax& right) :
         ExpressionSyntax(SyntaxKind::CastExpression), left(left), apostrophe(apostrophe), right(right)
-    {}
+    {
+        computeSourceRange();
+    }
 
     CastExpressionSyntax(const CastExpressionSyntax&) = delete;
     CastExpressionSyntax& operator=(const CastExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &left;
-            case 1: return apostrophe;
-            case 2: return &right;
-            default: return nullptr;
-        }
-    }
 };
 
 struct SignedCastExpressionSyntax : public ExpressionSyntax {
@@ -1588,22 +1125,14 @@ struct SignedCastExpressionSyntax : public ExpressionSyntax {
 
     SignedCastExpressionSyntax(Token signing, Token apostrophe, ParenthesizedExpressionSyntax& inner) :
         ExpressionSyntax(SyntaxKind::SignedCastExpression), signing(signing), apostrophe(apostrophe), inner(inner)
-    {}
+    {
+        computeSourceRange();
+    }
 
     SignedCastExpressionSyntax(const SignedCastExpressionSyntax&) = delete;
     SignedCastExpressionSyntax& operator=(const SignedCastExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return signing;
-            case 1: return apostrophe;
-            case 2: return &inner;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- TIMING CONTROL -----
@@ -1623,21 +1152,14 @@ struct DelaySyntax : public TimingControlSyntax {
 
     DelaySyntax(SyntaxKind kind, Token hash, ExpressionSyntax& delayValue) :
         TimingControlSyntax(kind), hash(hash), delayValue(delayValue)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DelaySyntax(const DelaySyntax&) = delete;
     DelaySyntax& operator=(const DelaySyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return hash;
-            case 1: return &delayValue;
-            default: return nullptr;
-        }
-    }
 };
 
 struct EventControlSyntax : public TimingControlSyntax {
@@ -1646,21 +1168,14 @@ struct EventControlSyntax : public TimingControlSyntax {
 
     EventControlSyntax(Token at, NameSyntax& eventName) :
         TimingControlSyntax(SyntaxKind::EventControl), at(at), eventName(eventName)
-    {}
+    {
+        computeSourceRange();
+    }
 
     EventControlSyntax(const EventControlSyntax&) = delete;
     EventControlSyntax& operator=(const EventControlSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return at;
-            case 1: return &eventName;
-            default: return nullptr;
-        }
-    }
 };
 
 struct EventExpressionSyntax : public SyntaxNode {
@@ -1678,21 +1193,14 @@ struct SignalEventExpressionSyntax : public EventExpressionSyntax {
 
     SignalEventExpressionSyntax(Token edge, ExpressionSyntax& expr) :
         EventExpressionSyntax(SyntaxKind::SignalEventExpression), edge(edge), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     SignalEventExpressionSyntax(const SignalEventExpressionSyntax&) = delete;
     SignalEventExpressionSyntax& operator=(const SignalEventExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return edge;
-            case 1: return &expr;
-            default: return nullptr;
-        }
-    }
 };
 
 struct BinaryEventExpressionSyntax : public EventExpressionSyntax {
@@ -1702,22 +1210,14 @@ struct BinaryEventExpressionSyntax : public EventExpressionSyntax {
 
     BinaryEventExpressionSyntax(EventExpressionSyntax& left, Token operatorToken, EventExpressionSyntax& right) :
         EventExpressionSyntax(SyntaxKind::BinaryEventExpression), left(left), operatorToken(operatorToken), right(right)
-    {}
+    {
+        computeSourceRange();
+    }
 
     BinaryEventExpressionSyntax(const BinaryEventExpressionSyntax&) = delete;
     BinaryEventExpressionSyntax& operator=(const BinaryEventExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &left;
-            case 1: return operatorToken;
-            case 2: return &right;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ParenthesizedEventExpressionSyntax : public EventExpressionSyntax {
@@ -1727,22 +1227,14 @@ struct ParenthesizedEventExpressionSyntax : public EventExpressionSyntax {
 
     ParenthesizedEventExpressionSyntax(Token openParen, EventExpressionSyntax& expr, Token closeParen) :
         EventExpressionSyntax(SyntaxKind::ParenthesizedEventExpression), openParen(openParen), expr(expr), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ParenthesizedEventExpressionSyntax(const ParenthesizedEventExpressionSyntax&) = delete;
     ParenthesizedEventExpressionSyntax& operator=(const ParenthesizedEventExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return &expr;
-            case 2: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ImplicitEventControlSyntax : public TimingControlSyntax {
@@ -1750,20 +1242,14 @@ struct ImplicitEventControlSyntax : public TimingControlSyntax {
 
     ImplicitEventControlSyntax(Token atStar) :
         TimingControlSyntax(SyntaxKind::ImplicitEventControl), atStar(atStar)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ImplicitEventControlSyntax(const ImplicitEventControlSyntax&) = delete;
     ImplicitEventControlSyntax& operator=(const ImplicitEventControlSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return atStar;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ParenImplicitEventControlSyntax : public TimingControlSyntax {
@@ -1772,21 +1258,14 @@ struct ParenImplicitEventControlSyntax : public TimingControlSyntax {
 
     ParenImplicitEventControlSyntax(Token at, Token openParenStarCloseParen) :
         TimingControlSyntax(SyntaxKind::ParenImplicitEventControl), at(at), openParenStarCloseParen(openParenStarCloseParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ParenImplicitEventControlSyntax(const ParenImplicitEventControlSyntax&) = delete;
     ParenImplicitEventControlSyntax& operator=(const ParenImplicitEventControlSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return at;
-            case 1: return openParenStarCloseParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct EventControlWithExpressionSyntax : public TimingControlSyntax {
@@ -1795,21 +1274,14 @@ struct EventControlWithExpressionSyntax : public TimingControlSyntax {
 
     EventControlWithExpressionSyntax(Token at, EventExpressionSyntax& expr) :
         TimingControlSyntax(SyntaxKind::EventControlWithExpression), at(at), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     EventControlWithExpressionSyntax(const EventControlWithExpressionSyntax&) = delete;
     EventControlWithExpressionSyntax& operator=(const EventControlWithExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return at;
-            case 1: return &expr;
-            default: return nullptr;
-        }
-    }
 };
 
 struct RepeatedEventControlSyntax : public TimingControlSyntax {
@@ -1821,24 +1293,14 @@ struct RepeatedEventControlSyntax : public TimingControlSyntax {
 
     RepeatedEventControlSyntax(Token repeat, Token openParen, ExpressionSyntax& expr, Token closeParen, TimingControlSyntax* eventControl) :
         TimingControlSyntax(SyntaxKind::RepeatedEventControl), repeat(repeat), openParen(openParen), expr(expr), closeParen(closeParen), eventControl(eventControl)
-    {}
+    {
+        computeSourceRange();
+    }
 
     RepeatedEventControlSyntax(const RepeatedEventControlSyntax&) = delete;
     RepeatedEventControlSyntax& operator=(const RepeatedEventControlSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return repeat;
-            case 1: return openParen;
-            case 2: return &expr;
-            case 3: return closeParen;
-            case 4: return eventControl;
-            default: return nullptr;
-        }
-    }
 };
 
 struct TimingControlExpressionSyntax : public ExpressionSyntax {
@@ -1847,21 +1309,14 @@ struct TimingControlExpressionSyntax : public ExpressionSyntax {
 
     TimingControlExpressionSyntax(TimingControlSyntax& timing, ExpressionSyntax& expr) :
         ExpressionSyntax(SyntaxKind::TimingControlExpression), timing(timing), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     TimingControlExpressionSyntax(const TimingControlExpressionSyntax&) = delete;
     TimingControlExpressionSyntax& operator=(const TimingControlExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &timing;
-            case 1: return &expr;
-            default: return nullptr;
-        }
-    }
 };
 
 struct TimingControlExpressionConcatenationSyntax : public ExpressionSyntax {
@@ -1871,22 +1326,14 @@ struct TimingControlExpressionConcatenationSyntax : public ExpressionSyntax {
 
     TimingControlExpressionConcatenationSyntax(ExpressionSyntax& left, TimingControlSyntax& timing, ExpressionSyntax& right) :
         ExpressionSyntax(SyntaxKind::TimingControlExpressionConcatenation), left(left), timing(timing), right(right)
-    {}
+    {
+        computeSourceRange();
+    }
 
     TimingControlExpressionConcatenationSyntax(const TimingControlExpressionConcatenationSyntax&) = delete;
     TimingControlExpressionConcatenationSyntax& operator=(const TimingControlExpressionConcatenationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &left;
-            case 1: return &timing;
-            case 2: return &right;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ShortcutCycleDelayRangeSyntax : public TimingControlSyntax {
@@ -1897,23 +1344,14 @@ struct ShortcutCycleDelayRangeSyntax : public TimingControlSyntax {
 
     ShortcutCycleDelayRangeSyntax(Token doubleHash, Token openBracket, Token op, Token closeBracket) :
         TimingControlSyntax(SyntaxKind::ShortcutCycleDelayRange), doubleHash(doubleHash), openBracket(openBracket), op(op), closeBracket(closeBracket)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ShortcutCycleDelayRangeSyntax(const ShortcutCycleDelayRangeSyntax&) = delete;
     ShortcutCycleDelayRangeSyntax& operator=(const ShortcutCycleDelayRangeSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return doubleHash;
-            case 1: return openBracket;
-            case 2: return op;
-            case 3: return closeBracket;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- DECLARATIONS -----
@@ -1932,20 +1370,14 @@ struct RangeDimensionSpecifierSyntax : public DimensionSpecifierSyntax {
 
     RangeDimensionSpecifierSyntax(SelectorSyntax& selector) :
         DimensionSpecifierSyntax(SyntaxKind::RangeDimensionSpecifier), selector(selector)
-    {}
+    {
+        computeSourceRange();
+    }
 
     RangeDimensionSpecifierSyntax(const RangeDimensionSpecifierSyntax&) = delete;
     RangeDimensionSpecifierSyntax& operator=(const RangeDimensionSpecifierSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &selector;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DataTypeDimensionSpecifierSyntax : public DimensionSpecifierSyntax {
@@ -1953,20 +1385,14 @@ struct DataTypeDimensionSpecifierSyntax : public DimensionSpecifierSyntax {
 
     DataTypeDimensionSpecifierSyntax(DataTypeSyntax& type) :
         DimensionSpecifierSyntax(SyntaxKind::DataTypeDimensionSpecifier), type(type)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DataTypeDimensionSpecifierSyntax(const DataTypeDimensionSpecifierSyntax&) = delete;
     DataTypeDimensionSpecifierSyntax& operator=(const DataTypeDimensionSpecifierSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &type;
-            default: return nullptr;
-        }
-    }
 };
 
 struct WildcardDimensionSpecifierSyntax : public DimensionSpecifierSyntax {
@@ -1974,20 +1400,14 @@ struct WildcardDimensionSpecifierSyntax : public DimensionSpecifierSyntax {
 
     WildcardDimensionSpecifierSyntax(Token star) :
         DimensionSpecifierSyntax(SyntaxKind::WildcardDimensionSpecifier), star(star)
-    {}
+    {
+        computeSourceRange();
+    }
 
     WildcardDimensionSpecifierSyntax(const WildcardDimensionSpecifierSyntax&) = delete;
     WildcardDimensionSpecifierSyntax& operator=(const WildcardDimensionSpecifierSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return star;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ColonExpressionClauseSyntax : public SyntaxNode {
@@ -1996,21 +1416,14 @@ struct ColonExpressionClauseSyntax : public SyntaxNode {
 
     ColonExpressionClauseSyntax(Token colon, ExpressionSyntax& expr) :
         SyntaxNode(SyntaxKind::ColonExpressionClause), colon(colon), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ColonExpressionClauseSyntax(const ColonExpressionClauseSyntax&) = delete;
     ColonExpressionClauseSyntax& operator=(const ColonExpressionClauseSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return colon;
-            case 1: return &expr;
-            default: return nullptr;
-        }
-    }
 };
 
 struct QueueDimensionSpecifierSyntax : public DimensionSpecifierSyntax {
@@ -2019,21 +1432,14 @@ struct QueueDimensionSpecifierSyntax : public DimensionSpecifierSyntax {
 
     QueueDimensionSpecifierSyntax(Token dollar, ColonExpressionClauseSyntax* maxSizeClause) :
         DimensionSpecifierSyntax(SyntaxKind::QueueDimensionSpecifier), dollar(dollar), maxSizeClause(maxSizeClause)
-    {}
+    {
+        computeSourceRange();
+    }
 
     QueueDimensionSpecifierSyntax(const QueueDimensionSpecifierSyntax&) = delete;
     QueueDimensionSpecifierSyntax& operator=(const QueueDimensionSpecifierSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return dollar;
-            case 1: return maxSizeClause;
-            default: return nullptr;
-        }
-    }
 };
 
 struct VariableDimensionSyntax : public SyntaxNode {
@@ -2043,22 +1449,14 @@ struct VariableDimensionSyntax : public SyntaxNode {
 
     VariableDimensionSyntax(Token openBracket, DimensionSpecifierSyntax* specifier, Token closeBracket) :
         SyntaxNode(SyntaxKind::VariableDimension), openBracket(openBracket), specifier(specifier), closeBracket(closeBracket)
-    {}
+    {
+        computeSourceRange();
+    }
 
     VariableDimensionSyntax(const VariableDimensionSyntax&) = delete;
     VariableDimensionSyntax& operator=(const VariableDimensionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openBracket;
-            case 1: return specifier;
-            case 2: return closeBracket;
-            default: return nullptr;
-        }
-    }
 };
 
 struct VariableDeclaratorSyntax : public SyntaxNode {
@@ -2068,22 +1466,14 @@ struct VariableDeclaratorSyntax : public SyntaxNode {
 
     VariableDeclaratorSyntax(Token name, SyntaxList<VariableDimensionSyntax> dimensions, EqualsValueClauseSyntax* initializer) :
         SyntaxNode(SyntaxKind::VariableDeclarator), name(name), dimensions(dimensions), initializer(initializer)
-    {}
+    {
+        computeSourceRange();
+    }
 
     VariableDeclaratorSyntax(const VariableDeclaratorSyntax&) = delete;
     VariableDeclaratorSyntax& operator=(const VariableDeclaratorSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return name;
-            case 1: return &dimensions;
-            case 2: return initializer;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DataDeclarationSyntax : public MemberSyntax {
@@ -2094,24 +1484,14 @@ struct DataDeclarationSyntax : public MemberSyntax {
 
     DataDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, TokenList modifiers, DataTypeSyntax& type, SeparatedSyntaxList<VariableDeclaratorSyntax> declarators, Token semi) :
         MemberSyntax(SyntaxKind::DataDeclaration, attributes), modifiers(modifiers), type(type), declarators(declarators), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DataDeclarationSyntax(const DataDeclarationSyntax&) = delete;
     DataDeclarationSyntax& operator=(const DataDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return &modifiers;
-            case 2: return &type;
-            case 3: return &declarators;
-            case 4: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct TypedefDeclarationSyntax : public MemberSyntax {
@@ -2123,25 +1503,14 @@ struct TypedefDeclarationSyntax : public MemberSyntax {
 
     TypedefDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token typedefKeyword, DataTypeSyntax& type, Token name, SyntaxList<VariableDimensionSyntax> dimensions, Token semi) :
         MemberSyntax(SyntaxKind::TypedefDeclaration, attributes), typedefKeyword(typedefKeyword), type(type), name(name), dimensions(dimensions), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     TypedefDeclarationSyntax(const TypedefDeclarationSyntax&) = delete;
     TypedefDeclarationSyntax& operator=(const TypedefDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return typedefKeyword;
-            case 2: return &type;
-            case 3: return name;
-            case 4: return &dimensions;
-            case 5: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ForwardTypedefDeclarationSyntax : public MemberSyntax {
@@ -2152,24 +1521,14 @@ struct ForwardTypedefDeclarationSyntax : public MemberSyntax {
 
     ForwardTypedefDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token typedefKeyword, Token keyword, Token name, Token semi) :
         MemberSyntax(SyntaxKind::ForwardTypedefDeclaration, attributes), typedefKeyword(typedefKeyword), keyword(keyword), name(name), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ForwardTypedefDeclarationSyntax(const ForwardTypedefDeclarationSyntax&) = delete;
     ForwardTypedefDeclarationSyntax& operator=(const ForwardTypedefDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return typedefKeyword;
-            case 2: return keyword;
-            case 3: return name;
-            case 4: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ForwardInterfaceClassTypedefDeclarationSyntax : public MemberSyntax {
@@ -2181,25 +1540,14 @@ struct ForwardInterfaceClassTypedefDeclarationSyntax : public MemberSyntax {
 
     ForwardInterfaceClassTypedefDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token typedefKeyword, Token interfaceKeyword, Token classKeyword, Token name, Token semi) :
         MemberSyntax(SyntaxKind::ForwardInterfaceClassTypedefDeclaration, attributes), typedefKeyword(typedefKeyword), interfaceKeyword(interfaceKeyword), classKeyword(classKeyword), name(name), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ForwardInterfaceClassTypedefDeclarationSyntax(const ForwardInterfaceClassTypedefDeclarationSyntax&) = delete;
     ForwardInterfaceClassTypedefDeclarationSyntax& operator=(const ForwardInterfaceClassTypedefDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return typedefKeyword;
-            case 2: return interfaceKeyword;
-            case 3: return classKeyword;
-            case 4: return name;
-            case 5: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct NetStrengthSyntax : public SyntaxNode {
@@ -2218,22 +1566,14 @@ struct ChargeStrengthSyntax : public NetStrengthSyntax {
 
     ChargeStrengthSyntax(Token openParen, Token strength, Token closeParen) :
         NetStrengthSyntax(SyntaxKind::ChargeStrength), openParen(openParen), strength(strength), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ChargeStrengthSyntax(const ChargeStrengthSyntax&) = delete;
     ChargeStrengthSyntax& operator=(const ChargeStrengthSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return strength;
-            case 2: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DriveStrengthSyntax : public NetStrengthSyntax {
@@ -2245,24 +1585,14 @@ struct DriveStrengthSyntax : public NetStrengthSyntax {
 
     DriveStrengthSyntax(Token openParen, Token strength0, Token comma, Token strength1, Token closeParen) :
         NetStrengthSyntax(SyntaxKind::DriveStrength), openParen(openParen), strength0(strength0), comma(comma), strength1(strength1), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DriveStrengthSyntax(const DriveStrengthSyntax&) = delete;
     DriveStrengthSyntax& operator=(const DriveStrengthSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return strength0;
-            case 2: return comma;
-            case 3: return strength1;
-            case 4: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct NetDeclarationSyntax : public MemberSyntax {
@@ -2275,26 +1605,14 @@ struct NetDeclarationSyntax : public MemberSyntax {
 
     NetDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token netType, NetStrengthSyntax* strength, Token expansionHint, DataTypeSyntax& type, SeparatedSyntaxList<VariableDeclaratorSyntax> declarators, Token semi) :
         MemberSyntax(SyntaxKind::NetDeclaration, attributes), netType(netType), strength(strength), expansionHint(expansionHint), type(type), declarators(declarators), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     NetDeclarationSyntax(const NetDeclarationSyntax&) = delete;
     NetDeclarationSyntax& operator=(const NetDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return netType;
-            case 2: return strength;
-            case 3: return expansionHint;
-            case 4: return &type;
-            case 5: return &declarators;
-            case 6: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct PackageImportItemSyntax : public SyntaxNode {
@@ -2304,22 +1622,14 @@ struct PackageImportItemSyntax : public SyntaxNode {
 
     PackageImportItemSyntax(Token package, Token doubleColon, Token item) :
         SyntaxNode(SyntaxKind::PackageImportItem), package(package), doubleColon(doubleColon), item(item)
-    {}
+    {
+        computeSourceRange();
+    }
 
     PackageImportItemSyntax(const PackageImportItemSyntax&) = delete;
     PackageImportItemSyntax& operator=(const PackageImportItemSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return package;
-            case 1: return doubleColon;
-            case 2: return item;
-            default: return nullptr;
-        }
-    }
 };
 
 struct PackageImportDeclarationSyntax : public MemberSyntax {
@@ -2329,23 +1639,14 @@ struct PackageImportDeclarationSyntax : public MemberSyntax {
 
     PackageImportDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, SeparatedSyntaxList<PackageImportItemSyntax> items, Token semi) :
         MemberSyntax(SyntaxKind::PackageImportDeclaration, attributes), keyword(keyword), items(items), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     PackageImportDeclarationSyntax(const PackageImportDeclarationSyntax&) = delete;
     PackageImportDeclarationSyntax& operator=(const PackageImportDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return keyword;
-            case 2: return &items;
-            case 3: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ParameterDeclarationSyntax : public SyntaxNode {
@@ -2355,22 +1656,14 @@ struct ParameterDeclarationSyntax : public SyntaxNode {
 
     ParameterDeclarationSyntax(Token keyword, DataTypeSyntax& type, SeparatedSyntaxList<VariableDeclaratorSyntax> declarators) :
         SyntaxNode(SyntaxKind::ParameterDeclaration), keyword(keyword), type(type), declarators(declarators)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ParameterDeclarationSyntax(const ParameterDeclarationSyntax&) = delete;
     ParameterDeclarationSyntax& operator=(const ParameterDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return keyword;
-            case 1: return &type;
-            case 2: return &declarators;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ParameterDeclarationStatementSyntax : public MemberSyntax {
@@ -2379,22 +1672,14 @@ struct ParameterDeclarationStatementSyntax : public MemberSyntax {
 
     ParameterDeclarationStatementSyntax(SyntaxList<AttributeInstanceSyntax> attributes, ParameterDeclarationSyntax& parameter, Token semi) :
         MemberSyntax(SyntaxKind::ParameterDeclarationStatement, attributes), parameter(parameter), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ParameterDeclarationStatementSyntax(const ParameterDeclarationStatementSyntax&) = delete;
     ParameterDeclarationStatementSyntax& operator=(const ParameterDeclarationStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return &parameter;
-            case 2: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct PortHeaderSyntax : public SyntaxNode {
@@ -2413,23 +1698,14 @@ struct PortDeclarationSyntax : public MemberSyntax {
 
     PortDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, PortHeaderSyntax& header, SeparatedSyntaxList<VariableDeclaratorSyntax> declarators, Token semi) :
         MemberSyntax(SyntaxKind::PortDeclaration, attributes), header(header), declarators(declarators), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     PortDeclarationSyntax(const PortDeclarationSyntax&) = delete;
     PortDeclarationSyntax& operator=(const PortDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return &header;
-            case 2: return &declarators;
-            case 3: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct GenvarDeclarationSyntax : public MemberSyntax {
@@ -2439,23 +1715,14 @@ struct GenvarDeclarationSyntax : public MemberSyntax {
 
     GenvarDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, SeparatedSyntaxList<IdentifierNameSyntax> identifiers, Token semi) :
         MemberSyntax(SyntaxKind::GenvarDeclaration, attributes), keyword(keyword), identifiers(identifiers), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     GenvarDeclarationSyntax(const GenvarDeclarationSyntax&) = delete;
     GenvarDeclarationSyntax& operator=(const GenvarDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return keyword;
-            case 2: return &identifiers;
-            case 3: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- TYPES -----
@@ -2467,22 +1734,14 @@ struct IntegerTypeSyntax : public DataTypeSyntax {
 
     IntegerTypeSyntax(SyntaxKind kind, Token keyword, Token signing, SyntaxList<VariableDimensionSyntax> dimensions) :
         DataTypeSyntax(kind), keyword(keyword), signing(signing), dimensions(dimensions)
-    {}
+    {
+        computeSourceRange();
+    }
 
     IntegerTypeSyntax(const IntegerTypeSyntax&) = delete;
     IntegerTypeSyntax& operator=(const IntegerTypeSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return keyword;
-            case 1: return signing;
-            case 2: return &dimensions;
-            default: return nullptr;
-        }
-    }
 };
 
 struct KeywordTypeSyntax : public DataTypeSyntax {
@@ -2490,20 +1749,14 @@ struct KeywordTypeSyntax : public DataTypeSyntax {
 
     KeywordTypeSyntax(SyntaxKind kind, Token keyword) :
         DataTypeSyntax(kind), keyword(keyword)
-    {}
+    {
+        computeSourceRange();
+    }
 
     KeywordTypeSyntax(const KeywordTypeSyntax&) = delete;
     KeywordTypeSyntax& operator=(const KeywordTypeSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return keyword;
-            default: return nullptr;
-        }
-    }
 };
 
 struct NamedTypeSyntax : public DataTypeSyntax {
@@ -2511,20 +1764,14 @@ struct NamedTypeSyntax : public DataTypeSyntax {
 
     NamedTypeSyntax(NameSyntax& name) :
         DataTypeSyntax(SyntaxKind::NamedType), name(name)
-    {}
+    {
+        computeSourceRange();
+    }
 
     NamedTypeSyntax(const NamedTypeSyntax&) = delete;
     NamedTypeSyntax& operator=(const NamedTypeSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &name;
-            default: return nullptr;
-        }
-    }
 };
 
 struct StructUnionMemberSyntax : public SyntaxNode {
@@ -2536,24 +1783,14 @@ struct StructUnionMemberSyntax : public SyntaxNode {
 
     StructUnionMemberSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token randomQualifier, DataTypeSyntax& type, SeparatedSyntaxList<VariableDeclaratorSyntax> declarators, Token semi) :
         SyntaxNode(SyntaxKind::StructUnionMember), attributes(attributes), randomQualifier(randomQualifier), type(type), declarators(declarators), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     StructUnionMemberSyntax(const StructUnionMemberSyntax&) = delete;
     StructUnionMemberSyntax& operator=(const StructUnionMemberSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return randomQualifier;
-            case 2: return &type;
-            case 3: return &declarators;
-            case 4: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct StructUnionTypeSyntax : public DataTypeSyntax {
@@ -2568,27 +1805,14 @@ struct StructUnionTypeSyntax : public DataTypeSyntax {
 
     StructUnionTypeSyntax(SyntaxKind kind, Token keyword, Token tagged, Token packed, Token signing, Token openBrace, SyntaxList<StructUnionMemberSyntax> members, Token closeBrace, SyntaxList<VariableDimensionSyntax> dimensions) :
         DataTypeSyntax(kind), keyword(keyword), tagged(tagged), packed(packed), signing(signing), openBrace(openBrace), members(members), closeBrace(closeBrace), dimensions(dimensions)
-    {}
+    {
+        computeSourceRange();
+    }
 
     StructUnionTypeSyntax(const StructUnionTypeSyntax&) = delete;
     StructUnionTypeSyntax& operator=(const StructUnionTypeSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return keyword;
-            case 1: return tagged;
-            case 2: return packed;
-            case 3: return signing;
-            case 4: return openBrace;
-            case 5: return &members;
-            case 6: return closeBrace;
-            case 7: return &dimensions;
-            default: return nullptr;
-        }
-    }
 };
 
 struct EnumTypeSyntax : public DataTypeSyntax {
@@ -2601,25 +1825,14 @@ struct EnumTypeSyntax : public DataTypeSyntax {
 
     EnumTypeSyntax(Token keyword, DataTypeSyntax* baseType, Token openBrace, SeparatedSyntaxList<VariableDeclaratorSyntax> members, Token closeBrace, SyntaxList<VariableDimensionSyntax> dimensions) :
         DataTypeSyntax(SyntaxKind::EnumType), keyword(keyword), baseType(baseType), openBrace(openBrace), members(members), closeBrace(closeBrace), dimensions(dimensions)
-    {}
+    {
+        computeSourceRange();
+    }
 
     EnumTypeSyntax(const EnumTypeSyntax&) = delete;
     EnumTypeSyntax& operator=(const EnumTypeSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return keyword;
-            case 1: return baseType;
-            case 2: return openBrace;
-            case 3: return &members;
-            case 4: return closeBrace;
-            case 5: return &dimensions;
-            default: return nullptr;
-        }
-    }
 };
 
 struct TypeReferenceSyntax : public DataTypeSyntax {
@@ -2630,23 +1843,14 @@ struct TypeReferenceSyntax : public DataTypeSyntax {
 
     TypeReferenceSyntax(Token typeKeyword, Token openParen, ExpressionSyntax& expr, Token closeParen) :
         DataTypeSyntax(SyntaxKind::TypeReference), typeKeyword(typeKeyword), openParen(openParen), expr(expr), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     TypeReferenceSyntax(const TypeReferenceSyntax&) = delete;
     TypeReferenceSyntax& operator=(const TypeReferenceSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return typeKeyword;
-            case 1: return openParen;
-            case 2: return &expr;
-            case 3: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DotMemberClauseSyntax : public SyntaxNode {
@@ -2655,21 +1859,14 @@ struct DotMemberClauseSyntax : public SyntaxNode {
 
     DotMemberClauseSyntax(Token dot, Token member) :
         SyntaxNode(SyntaxKind::DotMemberClause), dot(dot), member(member)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DotMemberClauseSyntax(const DotMemberClauseSyntax&) = delete;
     DotMemberClauseSyntax& operator=(const DotMemberClauseSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return dot;
-            case 1: return member;
-            default: return nullptr;
-        }
-    }
 };
 
 struct VirtualInterfaceTypeSyntax : public DataTypeSyntax {
@@ -2681,24 +1878,14 @@ struct VirtualInterfaceTypeSyntax : public DataTypeSyntax {
 
     VirtualInterfaceTypeSyntax(Token virtualKeyword, Token interfaceKeyword, Token name, ParameterValueAssignmentSyntax* parameters, DotMemberClauseSyntax* modport) :
         DataTypeSyntax(SyntaxKind::VirtualInterfaceType), virtualKeyword(virtualKeyword), interfaceKeyword(interfaceKeyword), name(name), parameters(parameters), modport(modport)
-    {}
+    {
+        computeSourceRange();
+    }
 
     VirtualInterfaceTypeSyntax(const VirtualInterfaceTypeSyntax&) = delete;
     VirtualInterfaceTypeSyntax& operator=(const VirtualInterfaceTypeSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return virtualKeyword;
-            case 1: return interfaceKeyword;
-            case 2: return name;
-            case 3: return parameters;
-            case 4: return modport;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ImplicitTypeSyntax : public DataTypeSyntax {
@@ -2707,21 +1894,14 @@ struct ImplicitTypeSyntax : public DataTypeSyntax {
 
     ImplicitTypeSyntax(Token signing, SyntaxList<VariableDimensionSyntax> dimensions) :
         DataTypeSyntax(SyntaxKind::ImplicitType), signing(signing), dimensions(dimensions)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ImplicitTypeSyntax(const ImplicitTypeSyntax&) = delete;
     ImplicitTypeSyntax& operator=(const ImplicitTypeSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return signing;
-            case 1: return &dimensions;
-            default: return nullptr;
-        }
-    }
 };
 
 struct VarDataTypeSyntax : public DataTypeSyntax {
@@ -2730,21 +1910,14 @@ struct VarDataTypeSyntax : public DataTypeSyntax {
 
     VarDataTypeSyntax(Token var, DataTypeSyntax& type) :
         DataTypeSyntax(SyntaxKind::VarDataType), var(var), type(type)
-    {}
+    {
+        computeSourceRange();
+    }
 
     VarDataTypeSyntax(const VarDataTypeSyntax&) = delete;
     VarDataTypeSyntax& operator=(const VarDataTypeSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return var;
-            case 1: return &type;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- ASSERTIONS -----
@@ -2756,22 +1929,14 @@ struct DeferredAssertionSyntax : public SyntaxNode {
 
     DeferredAssertionSyntax(Token hash, Token zero, Token finalKeyword) :
         SyntaxNode(SyntaxKind::DeferredAssertion), hash(hash), zero(zero), finalKeyword(finalKeyword)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DeferredAssertionSyntax(const DeferredAssertionSyntax&) = delete;
     DeferredAssertionSyntax& operator=(const DeferredAssertionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return hash;
-            case 1: return zero;
-            case 2: return finalKeyword;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ElseClauseSyntax : public SyntaxNode {
@@ -2780,21 +1945,14 @@ struct ElseClauseSyntax : public SyntaxNode {
 
     ElseClauseSyntax(Token elseKeyword, SyntaxNode& clause) :
         SyntaxNode(SyntaxKind::ElseClause), elseKeyword(elseKeyword), clause(clause)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ElseClauseSyntax(const ElseClauseSyntax&) = delete;
     ElseClauseSyntax& operator=(const ElseClauseSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return elseKeyword;
-            case 1: return &clause;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ActionBlockSyntax : public SyntaxNode {
@@ -2803,21 +1961,14 @@ struct ActionBlockSyntax : public SyntaxNode {
 
     ActionBlockSyntax(StatementSyntax* statement, ElseClauseSyntax* elseClause) :
         SyntaxNode(SyntaxKind::ActionBlock), statement(statement), elseClause(elseClause)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ActionBlockSyntax(const ActionBlockSyntax&) = delete;
     ActionBlockSyntax& operator=(const ActionBlockSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return statement;
-            case 1: return elseClause;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ImmediateAssertionStatementSyntax : public StatementSyntax {
@@ -2828,25 +1979,14 @@ struct ImmediateAssertionStatementSyntax : public StatementSyntax {
 
     ImmediateAssertionStatementSyntax(SyntaxKind kind, NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, DeferredAssertionSyntax* delay, ParenthesizedExpressionSyntax& expr, ActionBlockSyntax& action) :
         StatementSyntax(kind, label, attributes), keyword(keyword), delay(delay), expr(expr), action(action)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ImmediateAssertionStatementSyntax(const ImmediateAssertionStatementSyntax&) = delete;
     ImmediateAssertionStatementSyntax& operator=(const ImmediateAssertionStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return keyword;
-            case 3: return delay;
-            case 4: return &expr;
-            case 5: return &action;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DisableIffSyntax : public SyntaxNode {
@@ -2858,24 +1998,14 @@ struct DisableIffSyntax : public SyntaxNode {
 
     DisableIffSyntax(Token disable, Token iff, Token openParen, ExpressionSyntax& expr, Token closeParen) :
         SyntaxNode(SyntaxKind::DisableIff), disable(disable), iff(iff), openParen(openParen), expr(expr), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DisableIffSyntax(const DisableIffSyntax&) = delete;
     DisableIffSyntax& operator=(const DisableIffSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return disable;
-            case 1: return iff;
-            case 2: return openParen;
-            case 3: return &expr;
-            case 4: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct PropertySpecSyntax : public SyntaxNode {
@@ -2885,22 +2015,14 @@ struct PropertySpecSyntax : public SyntaxNode {
 
     PropertySpecSyntax(TimingControlSyntax* clocking, DisableIffSyntax* disable, ExpressionSyntax& expr) :
         SyntaxNode(SyntaxKind::PropertySpec), clocking(clocking), disable(disable), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     PropertySpecSyntax(const PropertySpecSyntax&) = delete;
     PropertySpecSyntax& operator=(const PropertySpecSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return clocking;
-            case 1: return disable;
-            case 2: return &expr;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ConcurrentAssertionStatementSyntax : public StatementSyntax {
@@ -2913,27 +2035,14 @@ struct ConcurrentAssertionStatementSyntax : public StatementSyntax {
 
     ConcurrentAssertionStatementSyntax(SyntaxKind kind, NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, Token propertyOrSequence, Token openParen, PropertySpecSyntax& propertySpec, Token closeParen, ActionBlockSyntax& action) :
         StatementSyntax(kind, label, attributes), keyword(keyword), propertyOrSequence(propertyOrSequence), openParen(openParen), propertySpec(propertySpec), closeParen(closeParen), action(action)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ConcurrentAssertionStatementSyntax(const ConcurrentAssertionStatementSyntax&) = delete;
     ConcurrentAssertionStatementSyntax& operator=(const ConcurrentAssertionStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return keyword;
-            case 3: return propertyOrSequence;
-            case 4: return openParen;
-            case 5: return &propertySpec;
-            case 6: return closeParen;
-            case 7: return &action;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ConcurrentAssertionMemberSyntax : public MemberSyntax {
@@ -2941,21 +2050,14 @@ struct ConcurrentAssertionMemberSyntax : public MemberSyntax {
 
     ConcurrentAssertionMemberSyntax(SyntaxList<AttributeInstanceSyntax> attributes, ConcurrentAssertionStatementSyntax& statement) :
         MemberSyntax(SyntaxKind::ConcurrentAssertionMember, attributes), statement(statement)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ConcurrentAssertionMemberSyntax(const ConcurrentAssertionMemberSyntax&) = delete;
     ConcurrentAssertionMemberSyntax& operator=(const ConcurrentAssertionMemberSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return &statement;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ImmediateAssertionMemberSyntax : public MemberSyntax {
@@ -2963,21 +2065,14 @@ struct ImmediateAssertionMemberSyntax : public MemberSyntax {
 
     ImmediateAssertionMemberSyntax(SyntaxList<AttributeInstanceSyntax> attributes, ImmediateAssertionStatementSyntax& statement) :
         MemberSyntax(SyntaxKind::ImmediateAssertionMember, attributes), statement(statement)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ImmediateAssertionMemberSyntax(const ImmediateAssertionMemberSyntax&) = delete;
     ImmediateAssertionMemberSyntax& operator=(const ImmediateAssertionMemberSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return &statement;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- STATEMENTS -----
@@ -2987,22 +2082,14 @@ struct EmptyStatementSyntax : public StatementSyntax {
 
     EmptyStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token semicolon) :
         StatementSyntax(SyntaxKind::EmptyStatement, label, attributes), semicolon(semicolon)
-    {}
+    {
+        computeSourceRange();
+    }
 
     EmptyStatementSyntax(const EmptyStatementSyntax&) = delete;
     EmptyStatementSyntax& operator=(const EmptyStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return semicolon;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ConditionalStatementSyntax : public StatementSyntax {
@@ -3016,28 +2103,14 @@ struct ConditionalStatementSyntax : public StatementSyntax {
 
     ConditionalStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token uniqueOrPriority, Token ifKeyword, Token openParen, ConditionalPredicateSyntax& predicate, Token closeParen, StatementSyntax& statement, ElseClauseSyntax* elseClause) :
         StatementSyntax(SyntaxKind::ConditionalStatement, label, attributes), uniqueOrPriority(uniqueOrPriority), ifKeyword(ifKeyword), openParen(openParen), predicate(predicate), closeParen(closeParen), statement(statement), elseClause(elseClause)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ConditionalStatementSyntax(const ConditionalStatementSyntax&) = delete;
     ConditionalStatementSyntax& operator=(const ConditionalStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return uniqueOrPriority;
-            case 3: return ifKeyword;
-            case 4: return openParen;
-            case 5: return &predicate;
-            case 6: return closeParen;
-            case 7: return &statement;
-            case 8: return elseClause;
-            default: return nullptr;
-        }
-    }
 };
 
 struct CaseItemSyntax : public SyntaxNode {
@@ -3056,22 +2129,14 @@ struct DefaultCaseItemSyntax : public CaseItemSyntax {
 
     DefaultCaseItemSyntax(Token defaultKeyword, Token colon, SyntaxNode& clause) :
         CaseItemSyntax(SyntaxKind::DefaultCaseItem), defaultKeyword(defaultKeyword), colon(colon), clause(clause)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DefaultCaseItemSyntax(const DefaultCaseItemSyntax&) = delete;
     DefaultCaseItemSyntax& operator=(const DefaultCaseItemSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return defaultKeyword;
-            case 1: return colon;
-            case 2: return &clause;
-            default: return nullptr;
-        }
-    }
 };
 
 struct PatternCaseItemSyntax : public CaseItemSyntax {
@@ -3083,24 +2148,14 @@ struct PatternCaseItemSyntax : public CaseItemSyntax {
 
     PatternCaseItemSyntax(PatternSyntax& pattern, Token tripleAnd, ExpressionSyntax* expr, Token colon, StatementSyntax& statement) :
         CaseItemSyntax(SyntaxKind::PatternCaseItem), pattern(pattern), tripleAnd(tripleAnd), expr(expr), colon(colon), statement(statement)
-    {}
+    {
+        computeSourceRange();
+    }
 
     PatternCaseItemSyntax(const PatternCaseItemSyntax&) = delete;
     PatternCaseItemSyntax& operator=(const PatternCaseItemSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &pattern;
-            case 1: return tripleAnd;
-            case 2: return expr;
-            case 3: return colon;
-            case 4: return &statement;
-            default: return nullptr;
-        }
-    }
 };
 
 struct StandardCaseItemSyntax : public CaseItemSyntax {
@@ -3110,22 +2165,14 @@ struct StandardCaseItemSyntax : public CaseItemSyntax {
 
     StandardCaseItemSyntax(SeparatedSyntaxList<ExpressionSyntax> expressions, Token colon, SyntaxNode& clause) :
         CaseItemSyntax(SyntaxKind::StandardCaseItem), expressions(expressions), colon(colon), clause(clause)
-    {}
+    {
+        computeSourceRange();
+    }
 
     StandardCaseItemSyntax(const StandardCaseItemSyntax&) = delete;
     StandardCaseItemSyntax& operator=(const StandardCaseItemSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &expressions;
-            case 1: return colon;
-            case 2: return &clause;
-            default: return nullptr;
-        }
-    }
 };
 
 struct CaseStatementSyntax : public StatementSyntax {
@@ -3140,29 +2187,14 @@ struct CaseStatementSyntax : public StatementSyntax {
 
     CaseStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token uniqueOrPriority, Token caseKeyword, Token openParen, ExpressionSyntax& expr, Token closeParen, Token matchesOrInside, SyntaxList<CaseItemSyntax> items, Token endcase) :
         StatementSyntax(SyntaxKind::CaseStatement, label, attributes), uniqueOrPriority(uniqueOrPriority), caseKeyword(caseKeyword), openParen(openParen), expr(expr), closeParen(closeParen), matchesOrInside(matchesOrInside), items(items), endcase(endcase)
-    {}
+    {
+        computeSourceRange();
+    }
 
     CaseStatementSyntax(const CaseStatementSyntax&) = delete;
     CaseStatementSyntax& operator=(const CaseStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return uniqueOrPriority;
-            case 3: return caseKeyword;
-            case 4: return openParen;
-            case 5: return &expr;
-            case 6: return closeParen;
-            case 7: return matchesOrInside;
-            case 8: return &items;
-            case 9: return endcase;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ForeverStatementSyntax : public StatementSyntax {
@@ -3171,23 +2203,14 @@ struct ForeverStatementSyntax : public StatementSyntax {
 
     ForeverStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token foreverKeyword, StatementSyntax& statement) :
         StatementSyntax(SyntaxKind::ForeverStatement, label, attributes), foreverKeyword(foreverKeyword), statement(statement)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ForeverStatementSyntax(const ForeverStatementSyntax&) = delete;
     ForeverStatementSyntax& operator=(const ForeverStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return foreverKeyword;
-            case 3: return &statement;
-            default: return nullptr;
-        }
-    }
 };
 
 struct LoopStatementSyntax : public StatementSyntax {
@@ -3199,26 +2222,14 @@ struct LoopStatementSyntax : public StatementSyntax {
 
     LoopStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token repeatOrWhile, Token openParen, ExpressionSyntax& expr, Token closeParen, StatementSyntax& statement) :
         StatementSyntax(SyntaxKind::LoopStatement, label, attributes), repeatOrWhile(repeatOrWhile), openParen(openParen), expr(expr), closeParen(closeParen), statement(statement)
-    {}
+    {
+        computeSourceRange();
+    }
 
     LoopStatementSyntax(const LoopStatementSyntax&) = delete;
     LoopStatementSyntax& operator=(const LoopStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return repeatOrWhile;
-            case 3: return openParen;
-            case 4: return &expr;
-            case 5: return closeParen;
-            case 6: return &statement;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DoWhileStatementSyntax : public StatementSyntax {
@@ -3232,28 +2243,14 @@ struct DoWhileStatementSyntax : public StatementSyntax {
 
     DoWhileStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token doKeyword, StatementSyntax& statement, Token whileKeyword, Token openParen, ExpressionSyntax& expr, Token closeParen, Token semi) :
         StatementSyntax(SyntaxKind::DoWhileStatement, label, attributes), doKeyword(doKeyword), statement(statement), whileKeyword(whileKeyword), openParen(openParen), expr(expr), closeParen(closeParen), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DoWhileStatementSyntax(const DoWhileStatementSyntax&) = delete;
     DoWhileStatementSyntax& operator=(const DoWhileStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return doKeyword;
-            case 3: return &statement;
-            case 4: return whileKeyword;
-            case 5: return openParen;
-            case 6: return &expr;
-            case 7: return closeParen;
-            case 8: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ForVariableDeclarationSyntax : public SyntaxNode {
@@ -3263,22 +2260,14 @@ struct ForVariableDeclarationSyntax : public SyntaxNode {
 
     ForVariableDeclarationSyntax(Token varKeyword, DataTypeSyntax& type, VariableDeclaratorSyntax& declarator) :
         SyntaxNode(SyntaxKind::ForVariableDeclaration), varKeyword(varKeyword), type(type), declarator(declarator)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ForVariableDeclarationSyntax(const ForVariableDeclarationSyntax&) = delete;
     ForVariableDeclarationSyntax& operator=(const ForVariableDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return varKeyword;
-            case 1: return &type;
-            case 2: return &declarator;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ForLoopStatementSyntax : public StatementSyntax {
@@ -3294,30 +2283,14 @@ struct ForLoopStatementSyntax : public StatementSyntax {
 
     ForLoopStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token forKeyword, Token openParen, SeparatedSyntaxList<SyntaxNode> initializers, Token semi1, ExpressionSyntax& stopExpr, Token semi2, SeparatedSyntaxList<ExpressionSyntax> steps, Token closeParen, StatementSyntax& statement) :
         StatementSyntax(SyntaxKind::ForLoopStatement, label, attributes), forKeyword(forKeyword), openParen(openParen), initializers(initializers), semi1(semi1), stopExpr(stopExpr), semi2(semi2), steps(steps), closeParen(closeParen), statement(statement)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ForLoopStatementSyntax(const ForLoopStatementSyntax&) = delete;
     ForLoopStatementSyntax& operator=(const ForLoopStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return forKeyword;
-            case 3: return openParen;
-            case 4: return &initializers;
-            case 5: return semi1;
-            case 6: return &stopExpr;
-            case 7: return semi2;
-            case 8: return &steps;
-            case 9: return closeParen;
-            case 10: return &statement;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ForeachLoopListSyntax : public SyntaxNode {
@@ -3330,25 +2303,14 @@ struct ForeachLoopListSyntax : public SyntaxNode {
 
     ForeachLoopListSyntax(Token openParen, NameSyntax& arrayName, Token openBracket, SeparatedSyntaxList<NameSyntax> loopVariables, Token closeBracket, Token closeParen) :
         SyntaxNode(SyntaxKind::ForeachLoopList), openParen(openParen), arrayName(arrayName), openBracket(openBracket), loopVariables(loopVariables), closeBracket(closeBracket), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ForeachLoopListSyntax(const ForeachLoopListSyntax&) = delete;
     ForeachLoopListSyntax& operator=(const ForeachLoopListSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return &arrayName;
-            case 2: return openBracket;
-            case 3: return &loopVariables;
-            case 4: return closeBracket;
-            case 5: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ForeachLoopStatementSyntax : public StatementSyntax {
@@ -3358,24 +2320,14 @@ struct ForeachLoopStatementSyntax : public StatementSyntax {
 
     ForeachLoopStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, ForeachLoopListSyntax& loopList, StatementSyntax& statement) :
         StatementSyntax(SyntaxKind::ForeachLoopStatement, label, attributes), keyword(keyword), loopList(loopList), statement(statement)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ForeachLoopStatementSyntax(const ForeachLoopStatementSyntax&) = delete;
     ForeachLoopStatementSyntax& operator=(const ForeachLoopStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return keyword;
-            case 3: return &loopList;
-            case 4: return &statement;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ReturnStatementSyntax : public StatementSyntax {
@@ -3385,24 +2337,14 @@ struct ReturnStatementSyntax : public StatementSyntax {
 
     ReturnStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token returnKeyword, ExpressionSyntax* returnValue, Token semi) :
         StatementSyntax(SyntaxKind::ReturnStatement, label, attributes), returnKeyword(returnKeyword), returnValue(returnValue), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ReturnStatementSyntax(const ReturnStatementSyntax&) = delete;
     ReturnStatementSyntax& operator=(const ReturnStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return returnKeyword;
-            case 3: return returnValue;
-            case 4: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct JumpStatementSyntax : public StatementSyntax {
@@ -3411,23 +2353,14 @@ struct JumpStatementSyntax : public StatementSyntax {
 
     JumpStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token breakOrContinue, Token semi) :
         StatementSyntax(SyntaxKind::JumpStatement, label, attributes), breakOrContinue(breakOrContinue), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     JumpStatementSyntax(const JumpStatementSyntax&) = delete;
     JumpStatementSyntax& operator=(const JumpStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return breakOrContinue;
-            case 3: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct TimingControlStatementSyntax : public StatementSyntax {
@@ -3436,23 +2369,14 @@ struct TimingControlStatementSyntax : public StatementSyntax {
 
     TimingControlStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, TimingControlSyntax& timingControl, StatementSyntax& statement) :
         StatementSyntax(SyntaxKind::TimingControlStatement, label, attributes), timingControl(timingControl), statement(statement)
-    {}
+    {
+        computeSourceRange();
+    }
 
     TimingControlStatementSyntax(const TimingControlStatementSyntax&) = delete;
     TimingControlStatementSyntax& operator=(const TimingControlStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return &timingControl;
-            case 3: return &statement;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ExpressionStatementSyntax : public StatementSyntax {
@@ -3461,23 +2385,14 @@ struct ExpressionStatementSyntax : public StatementSyntax {
 
     ExpressionStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, ExpressionSyntax& expr, Token semi) :
         StatementSyntax(SyntaxKind::ExpressionStatement, label, attributes), expr(expr), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ExpressionStatementSyntax(const ExpressionStatementSyntax&) = delete;
     ExpressionStatementSyntax& operator=(const ExpressionStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return &expr;
-            case 3: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ProceduralAssignStatementSyntax : public StatementSyntax {
@@ -3489,26 +2404,14 @@ struct ProceduralAssignStatementSyntax : public StatementSyntax {
 
     ProceduralAssignStatementSyntax(SyntaxKind kind, NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, ExpressionSyntax& lvalue, Token equals, ExpressionSyntax& value, Token semi) :
         StatementSyntax(kind, label, attributes), keyword(keyword), lvalue(lvalue), equals(equals), value(value), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ProceduralAssignStatementSyntax(const ProceduralAssignStatementSyntax&) = delete;
     ProceduralAssignStatementSyntax& operator=(const ProceduralAssignStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return keyword;
-            case 3: return &lvalue;
-            case 4: return equals;
-            case 5: return &value;
-            case 6: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ProceduralDeassignStatementSyntax : public StatementSyntax {
@@ -3518,24 +2421,14 @@ struct ProceduralDeassignStatementSyntax : public StatementSyntax {
 
     ProceduralDeassignStatementSyntax(SyntaxKind kind, NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, ExpressionSyntax& variable, Token semi) :
         StatementSyntax(kind, label, attributes), keyword(keyword), variable(variable), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ProceduralDeassignStatementSyntax(const ProceduralDeassignStatementSyntax&) = delete;
     ProceduralDeassignStatementSyntax& operator=(const ProceduralDeassignStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return keyword;
-            case 3: return &variable;
-            case 4: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DisableStatementSyntax : public StatementSyntax {
@@ -3545,24 +2438,14 @@ struct DisableStatementSyntax : public StatementSyntax {
 
     DisableStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token disable, NameSyntax& name, Token semi) :
         StatementSyntax(SyntaxKind::DisableStatement, label, attributes), disable(disable), name(name), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DisableStatementSyntax(const DisableStatementSyntax&) = delete;
     DisableStatementSyntax& operator=(const DisableStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return disable;
-            case 3: return &name;
-            case 4: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DisableForkStatementSyntax : public StatementSyntax {
@@ -3572,24 +2455,14 @@ struct DisableForkStatementSyntax : public StatementSyntax {
 
     DisableForkStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token disable, Token fork, Token semi) :
         StatementSyntax(SyntaxKind::DisableForkStatement, label, attributes), disable(disable), fork(fork), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DisableForkStatementSyntax(const DisableForkStatementSyntax&) = delete;
     DisableForkStatementSyntax& operator=(const DisableForkStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return disable;
-            case 3: return fork;
-            case 4: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct NamedBlockClauseSyntax : public SyntaxNode {
@@ -3598,21 +2471,14 @@ struct NamedBlockClauseSyntax : public SyntaxNode {
 
     NamedBlockClauseSyntax(Token colon, Token name) :
         SyntaxNode(SyntaxKind::NamedBlockClause), colon(colon), name(name)
-    {}
+    {
+        computeSourceRange();
+    }
 
     NamedBlockClauseSyntax(const NamedBlockClauseSyntax&) = delete;
     NamedBlockClauseSyntax& operator=(const NamedBlockClauseSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return colon;
-            case 1: return name;
-            default: return nullptr;
-        }
-    }
 };
 
 struct BlockStatementSyntax : public StatementSyntax {
@@ -3624,26 +2490,14 @@ struct BlockStatementSyntax : public StatementSyntax {
 
     BlockStatementSyntax(SyntaxKind kind, NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token begin, NamedBlockClauseSyntax* blockName, SyntaxList<SyntaxNode> items, Token end, NamedBlockClauseSyntax* endBlockName) :
         StatementSyntax(kind, label, attributes), begin(begin), blockName(blockName), items(items), end(end), endBlockName(endBlockName)
-    {}
+    {
+        computeSourceRange();
+    }
 
     BlockStatementSyntax(const BlockStatementSyntax&) = delete;
     BlockStatementSyntax& operator=(const BlockStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return begin;
-            case 3: return blockName;
-            case 4: return &items;
-            case 5: return end;
-            case 6: return endBlockName;
-            default: return nullptr;
-        }
-    }
 };
 
 struct WaitStatementSyntax : public StatementSyntax {
@@ -3655,26 +2509,14 @@ struct WaitStatementSyntax : public StatementSyntax {
 
     WaitStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token wait, Token openParen, ExpressionSyntax& expr, Token closeParen, StatementSyntax& statement) :
         StatementSyntax(SyntaxKind::WaitStatement, label, attributes), wait(wait), openParen(openParen), expr(expr), closeParen(closeParen), statement(statement)
-    {}
+    {
+        computeSourceRange();
+    }
 
     WaitStatementSyntax(const WaitStatementSyntax&) = delete;
     WaitStatementSyntax& operator=(const WaitStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return wait;
-            case 3: return openParen;
-            case 4: return &expr;
-            case 5: return closeParen;
-            case 6: return &statement;
-            default: return nullptr;
-        }
-    }
 };
 
 struct WaitForkStatementSyntax : public StatementSyntax {
@@ -3684,24 +2526,14 @@ struct WaitForkStatementSyntax : public StatementSyntax {
 
     WaitForkStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token wait, Token fork, Token semi) :
         StatementSyntax(SyntaxKind::WaitForkStatement, label, attributes), wait(wait), fork(fork), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     WaitForkStatementSyntax(const WaitForkStatementSyntax&) = delete;
     WaitForkStatementSyntax& operator=(const WaitForkStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return wait;
-            case 3: return fork;
-            case 4: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct WaitOrderStatementSyntax : public StatementSyntax {
@@ -3713,26 +2545,14 @@ struct WaitOrderStatementSyntax : public StatementSyntax {
 
     WaitOrderStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token wait_order, Token openParen, SeparatedSyntaxList<NameSyntax> names, Token closeParen, ActionBlockSyntax& action) :
         StatementSyntax(SyntaxKind::WaitOrderStatement, label, attributes), wait_order(wait_order), openParen(openParen), names(names), closeParen(closeParen), action(action)
-    {}
+    {
+        computeSourceRange();
+    }
 
     WaitOrderStatementSyntax(const WaitOrderStatementSyntax&) = delete;
     WaitOrderStatementSyntax& operator=(const WaitOrderStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return wait_order;
-            case 3: return openParen;
-            case 4: return &names;
-            case 5: return closeParen;
-            case 6: return &action;
-            default: return nullptr;
-        }
-    }
 };
 
 struct RandCaseItemSyntax : public SyntaxNode {
@@ -3742,22 +2562,14 @@ struct RandCaseItemSyntax : public SyntaxNode {
 
     RandCaseItemSyntax(ExpressionSyntax& expr, Token colon, StatementSyntax& statement) :
         SyntaxNode(SyntaxKind::RandCaseItem), expr(expr), colon(colon), statement(statement)
-    {}
+    {
+        computeSourceRange();
+    }
 
     RandCaseItemSyntax(const RandCaseItemSyntax&) = delete;
     RandCaseItemSyntax& operator=(const RandCaseItemSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &expr;
-            case 1: return colon;
-            case 2: return &statement;
-            default: return nullptr;
-        }
-    }
 };
 
 struct RandCaseStatementSyntax : public StatementSyntax {
@@ -3767,24 +2579,14 @@ struct RandCaseStatementSyntax : public StatementSyntax {
 
     RandCaseStatementSyntax(NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token randCase, SyntaxList<RandCaseItemSyntax> items, Token endCase) :
         StatementSyntax(SyntaxKind::RandCaseStatement, label, attributes), randCase(randCase), items(items), endCase(endCase)
-    {}
+    {
+        computeSourceRange();
+    }
 
     RandCaseStatementSyntax(const RandCaseStatementSyntax&) = delete;
     RandCaseStatementSyntax& operator=(const RandCaseStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return randCase;
-            case 3: return &items;
-            case 4: return endCase;
-            default: return nullptr;
-        }
-    }
 };
 
 struct EventTriggerStatementSyntax : public StatementSyntax {
@@ -3794,24 +2596,14 @@ struct EventTriggerStatementSyntax : public StatementSyntax {
 
     EventTriggerStatementSyntax(SyntaxKind kind, NamedLabelSyntax* label, SyntaxList<AttributeInstanceSyntax> attributes, Token trigger, TimingControlSyntax* timing, NameSyntax& name) :
         StatementSyntax(kind, label, attributes), trigger(trigger), timing(timing), name(name)
-    {}
+    {
+        computeSourceRange();
+    }
 
     EventTriggerStatementSyntax(const EventTriggerStatementSyntax&) = delete;
     EventTriggerStatementSyntax& operator=(const EventTriggerStatementSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return label;
-            case 1: return &attributes;
-            case 2: return trigger;
-            case 3: return timing;
-            case 4: return &name;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- MODULES -----
@@ -3839,20 +2631,14 @@ struct ImplicitNonAnsiPortSyntax : public NonAnsiPortSyntax {
 
     ImplicitNonAnsiPortSyntax(ExpressionSyntax& expr) :
         NonAnsiPortSyntax(SyntaxKind::ImplicitNonAnsiPort), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ImplicitNonAnsiPortSyntax(const ImplicitNonAnsiPortSyntax&) = delete;
     ImplicitNonAnsiPortSyntax& operator=(const ImplicitNonAnsiPortSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &expr;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ExplicitNonAnsiPortSyntax : public NonAnsiPortSyntax {
@@ -3864,24 +2650,14 @@ struct ExplicitNonAnsiPortSyntax : public NonAnsiPortSyntax {
 
     ExplicitNonAnsiPortSyntax(Token dot, Token name, Token openParen, ExpressionSyntax* expr, Token closeParen) :
         NonAnsiPortSyntax(SyntaxKind::ExplicitNonAnsiPort), dot(dot), name(name), openParen(openParen), expr(expr), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ExplicitNonAnsiPortSyntax(const ExplicitNonAnsiPortSyntax&) = delete;
     ExplicitNonAnsiPortSyntax& operator=(const ExplicitNonAnsiPortSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return dot;
-            case 1: return name;
-            case 2: return openParen;
-            case 3: return expr;
-            case 4: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct NonAnsiPortListSyntax : public PortListSyntax {
@@ -3891,22 +2667,14 @@ struct NonAnsiPortListSyntax : public PortListSyntax {
 
     NonAnsiPortListSyntax(Token openParen, SeparatedSyntaxList<NonAnsiPortSyntax> ports, Token closeParen) :
         PortListSyntax(SyntaxKind::NonAnsiPortList), openParen(openParen), ports(ports), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     NonAnsiPortListSyntax(const NonAnsiPortListSyntax&) = delete;
     NonAnsiPortListSyntax& operator=(const NonAnsiPortListSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return &ports;
-            case 2: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct InterfacePortHeaderSyntax : public PortHeaderSyntax {
@@ -3915,21 +2683,14 @@ struct InterfacePortHeaderSyntax : public PortHeaderSyntax {
 
     InterfacePortHeaderSyntax(Token nameOrKeyword, DotMemberClauseSyntax* modport) :
         PortHeaderSyntax(SyntaxKind::InterfacePortHeader), nameOrKeyword(nameOrKeyword), modport(modport)
-    {}
+    {
+        computeSourceRange();
+    }
 
     InterfacePortHeaderSyntax(const InterfacePortHeaderSyntax&) = delete;
     InterfacePortHeaderSyntax& operator=(const InterfacePortHeaderSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return nameOrKeyword;
-            case 1: return modport;
-            default: return nullptr;
-        }
-    }
 };
 
 struct VariablePortHeaderSyntax : public PortHeaderSyntax {
@@ -3939,22 +2700,14 @@ struct VariablePortHeaderSyntax : public PortHeaderSyntax {
 
     VariablePortHeaderSyntax(Token direction, Token varKeyword, DataTypeSyntax& dataType) :
         PortHeaderSyntax(SyntaxKind::VariablePortHeader), direction(direction), varKeyword(varKeyword), dataType(dataType)
-    {}
+    {
+        computeSourceRange();
+    }
 
     VariablePortHeaderSyntax(const VariablePortHeaderSyntax&) = delete;
     VariablePortHeaderSyntax& operator=(const VariablePortHeaderSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return direction;
-            case 1: return varKeyword;
-            case 2: return &dataType;
-            default: return nullptr;
-        }
-    }
 };
 
 struct InterconnectPortHeaderSyntax : public PortHeaderSyntax {
@@ -3964,22 +2717,14 @@ struct InterconnectPortHeaderSyntax : public PortHeaderSyntax {
 
     InterconnectPortHeaderSyntax(Token direction, Token interconnect, DataTypeSyntax* type) :
         PortHeaderSyntax(SyntaxKind::InterconnectPortHeader), direction(direction), interconnect(interconnect), type(type)
-    {}
+    {
+        computeSourceRange();
+    }
 
     InterconnectPortHeaderSyntax(const InterconnectPortHeaderSyntax&) = delete;
     InterconnectPortHeaderSyntax& operator=(const InterconnectPortHeaderSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return direction;
-            case 1: return interconnect;
-            case 2: return type;
-            default: return nullptr;
-        }
-    }
 };
 
 struct NetPortHeaderSyntax : public PortHeaderSyntax {
@@ -3989,22 +2734,14 @@ struct NetPortHeaderSyntax : public PortHeaderSyntax {
 
     NetPortHeaderSyntax(Token direction, Token netType, DataTypeSyntax& dataType) :
         PortHeaderSyntax(SyntaxKind::NetPortHeader), direction(direction), netType(netType), dataType(dataType)
-    {}
+    {
+        computeSourceRange();
+    }
 
     NetPortHeaderSyntax(const NetPortHeaderSyntax&) = delete;
     NetPortHeaderSyntax& operator=(const NetPortHeaderSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return direction;
-            case 1: return netType;
-            case 2: return &dataType;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ImplicitAnsiPortSyntax : public MemberSyntax {
@@ -4013,22 +2750,14 @@ struct ImplicitAnsiPortSyntax : public MemberSyntax {
 
     ImplicitAnsiPortSyntax(SyntaxList<AttributeInstanceSyntax> attributes, PortHeaderSyntax& header, VariableDeclaratorSyntax& declarator) :
         MemberSyntax(SyntaxKind::ImplicitAnsiPort, attributes), header(header), declarator(declarator)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ImplicitAnsiPortSyntax(const ImplicitAnsiPortSyntax&) = delete;
     ImplicitAnsiPortSyntax& operator=(const ImplicitAnsiPortSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return &header;
-            case 2: return &declarator;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ExplicitAnsiPortSyntax : public MemberSyntax {
@@ -4041,26 +2770,14 @@ struct ExplicitAnsiPortSyntax : public MemberSyntax {
 
     ExplicitAnsiPortSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token direction, Token dot, Token name, Token openParen, ExpressionSyntax* expr, Token closeParen) :
         MemberSyntax(SyntaxKind::ExplicitAnsiPort, attributes), direction(direction), dot(dot), name(name), openParen(openParen), expr(expr), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ExplicitAnsiPortSyntax(const ExplicitAnsiPortSyntax&) = delete;
     ExplicitAnsiPortSyntax& operator=(const ExplicitAnsiPortSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return direction;
-            case 2: return dot;
-            case 3: return name;
-            case 4: return openParen;
-            case 5: return expr;
-            case 6: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct AnsiPortListSyntax : public PortListSyntax {
@@ -4070,22 +2787,14 @@ struct AnsiPortListSyntax : public PortListSyntax {
 
     AnsiPortListSyntax(Token openParen, SeparatedSyntaxList<MemberSyntax> ports, Token closeParen) :
         PortListSyntax(SyntaxKind::AnsiPortList), openParen(openParen), ports(ports), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     AnsiPortListSyntax(const AnsiPortListSyntax&) = delete;
     AnsiPortListSyntax& operator=(const AnsiPortListSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return &ports;
-            case 2: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct WildcardPortListSyntax : public PortListSyntax {
@@ -4095,22 +2804,14 @@ struct WildcardPortListSyntax : public PortListSyntax {
 
     WildcardPortListSyntax(Token openParen, Token dotStar, Token closeParen) :
         PortListSyntax(SyntaxKind::WildcardPortList), openParen(openParen), dotStar(dotStar), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     WildcardPortListSyntax(const WildcardPortListSyntax&) = delete;
     WildcardPortListSyntax& operator=(const WildcardPortListSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return dotStar;
-            case 2: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ParameterPortListSyntax : public SyntaxNode {
@@ -4121,23 +2822,14 @@ struct ParameterPortListSyntax : public SyntaxNode {
 
     ParameterPortListSyntax(Token hash, Token openParen, SeparatedSyntaxList<ParameterDeclarationSyntax> declarations, Token closeParen) :
         SyntaxNode(SyntaxKind::ParameterPortList), hash(hash), openParen(openParen), declarations(declarations), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ParameterPortListSyntax(const ParameterPortListSyntax&) = delete;
     ParameterPortListSyntax& operator=(const ParameterPortListSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return hash;
-            case 1: return openParen;
-            case 2: return &declarations;
-            case 3: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ModuleHeaderSyntax : public SyntaxNode {
@@ -4151,26 +2843,14 @@ struct ModuleHeaderSyntax : public SyntaxNode {
 
     ModuleHeaderSyntax(SyntaxKind kind, Token moduleKeyword, Token lifetime, Token name, SyntaxList<PackageImportDeclarationSyntax> imports, ParameterPortListSyntax* parameters, PortListSyntax* ports, Token semi) :
         SyntaxNode(kind), moduleKeyword(moduleKeyword), lifetime(lifetime), name(name), imports(imports), parameters(parameters), ports(ports), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ModuleHeaderSyntax(const ModuleHeaderSyntax&) = delete;
     ModuleHeaderSyntax& operator=(const ModuleHeaderSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return moduleKeyword;
-            case 1: return lifetime;
-            case 2: return name;
-            case 3: return &imports;
-            case 4: return parameters;
-            case 5: return ports;
-            case 6: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ModuleDeclarationSyntax : public MemberSyntax {
@@ -4181,24 +2861,14 @@ struct ModuleDeclarationSyntax : public MemberSyntax {
 
     ModuleDeclarationSyntax(SyntaxKind kind, SyntaxList<AttributeInstanceSyntax> attributes, ModuleHeaderSyntax& header, SyntaxList<MemberSyntax> members, Token endmodule, NamedBlockClauseSyntax* blockName) :
         MemberSyntax(kind, attributes), header(header), members(members), endmodule(endmodule), blockName(blockName)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ModuleDeclarationSyntax(const ModuleDeclarationSyntax&) = delete;
     ModuleDeclarationSyntax& operator=(const ModuleDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return &header;
-            case 2: return &members;
-            case 3: return endmodule;
-            case 4: return blockName;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ExternModuleSyntax : public SyntaxNode {
@@ -4207,21 +2877,14 @@ struct ExternModuleSyntax : public SyntaxNode {
 
     ExternModuleSyntax(Token externKeyword, ModuleHeaderSyntax& header) :
         SyntaxNode(SyntaxKind::ExternModule), externKeyword(externKeyword), header(header)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ExternModuleSyntax(const ExternModuleSyntax&) = delete;
     ExternModuleSyntax& operator=(const ExternModuleSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return externKeyword;
-            case 1: return &header;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- MEMBERS -----
@@ -4232,22 +2895,14 @@ struct EmptyMemberSyntax : public MemberSyntax {
 
     EmptyMemberSyntax(SyntaxList<AttributeInstanceSyntax> attributes, TokenList qualifiers, Token semi) :
         MemberSyntax(SyntaxKind::EmptyMember, attributes), qualifiers(qualifiers), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     EmptyMemberSyntax(const EmptyMemberSyntax&) = delete;
     EmptyMemberSyntax& operator=(const EmptyMemberSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return &qualifiers;
-            case 2: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ProceduralBlockSyntax : public MemberSyntax {
@@ -4256,22 +2911,14 @@ struct ProceduralBlockSyntax : public MemberSyntax {
 
     ProceduralBlockSyntax(SyntaxKind kind, SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, StatementSyntax& statement) :
         MemberSyntax(kind, attributes), keyword(keyword), statement(statement)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ProceduralBlockSyntax(const ProceduralBlockSyntax&) = delete;
     ProceduralBlockSyntax& operator=(const ProceduralBlockSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return keyword;
-            case 2: return &statement;
-            default: return nullptr;
-        }
-    }
 };
 
 struct GenerateRegionSyntax : public MemberSyntax {
@@ -4281,23 +2928,14 @@ struct GenerateRegionSyntax : public MemberSyntax {
 
     GenerateRegionSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, SyntaxList<MemberSyntax> members, Token endgenerate) :
         MemberSyntax(SyntaxKind::GenerateRegion, attributes), keyword(keyword), members(members), endgenerate(endgenerate)
-    {}
+    {
+        computeSourceRange();
+    }
 
     GenerateRegionSyntax(const GenerateRegionSyntax&) = delete;
     GenerateRegionSyntax& operator=(const GenerateRegionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return keyword;
-            case 2: return &members;
-            case 3: return endgenerate;
-            default: return nullptr;
-        }
-    }
 };
 
 struct LoopGenerateSyntax : public MemberSyntax {
@@ -4316,32 +2954,14 @@ struct LoopGenerateSyntax : public MemberSyntax {
 
     LoopGenerateSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, Token openParen, Token genvar, Token identifier, Token equals, ExpressionSyntax& initialExpr, Token semi1, ExpressionSyntax& stopExpr, Token semi2, ExpressionSyntax& iterationExpr, Token closeParen, MemberSyntax& block) :
         MemberSyntax(SyntaxKind::LoopGenerate, attributes), keyword(keyword), openParen(openParen), genvar(genvar), identifier(identifier), equals(equals), initialExpr(initialExpr), semi1(semi1), stopExpr(stopExpr), semi2(semi2), iterationExpr(iterationExpr), closeParen(closeParen), block(block)
-    {}
+    {
+        computeSourceRange();
+    }
 
     LoopGenerateSyntax(const LoopGenerateSyntax&) = delete;
     LoopGenerateSyntax& operator=(const LoopGenerateSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return keyword;
-            case 2: return openParen;
-            case 3: return genvar;
-            case 4: return identifier;
-            case 5: return equals;
-            case 6: return &initialExpr;
-            case 7: return semi1;
-            case 8: return &stopExpr;
-            case 9: return semi2;
-            case 10: return &iterationExpr;
-            case 11: return closeParen;
-            case 12: return &block;
-            default: return nullptr;
-        }
-    }
 };
 
 struct IfGenerateSyntax : public MemberSyntax {
@@ -4354,26 +2974,14 @@ struct IfGenerateSyntax : public MemberSyntax {
 
     IfGenerateSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, Token openParen, ExpressionSyntax& condition, Token closeParen, MemberSyntax& block, ElseClauseSyntax* elseClause) :
         MemberSyntax(SyntaxKind::IfGenerate, attributes), keyword(keyword), openParen(openParen), condition(condition), closeParen(closeParen), block(block), elseClause(elseClause)
-    {}
+    {
+        computeSourceRange();
+    }
 
     IfGenerateSyntax(const IfGenerateSyntax&) = delete;
     IfGenerateSyntax& operator=(const IfGenerateSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return keyword;
-            case 2: return openParen;
-            case 3: return &condition;
-            case 4: return closeParen;
-            case 5: return &block;
-            case 6: return elseClause;
-            default: return nullptr;
-        }
-    }
 };
 
 struct CaseGenerateSyntax : public MemberSyntax {
@@ -4386,26 +2994,14 @@ struct CaseGenerateSyntax : public MemberSyntax {
 
     CaseGenerateSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, Token openParen, ExpressionSyntax& condition, Token closeParen, SyntaxList<CaseItemSyntax> items, Token endCase) :
         MemberSyntax(SyntaxKind::CaseGenerate, attributes), keyword(keyword), openParen(openParen), condition(condition), closeParen(closeParen), items(items), endCase(endCase)
-    {}
+    {
+        computeSourceRange();
+    }
 
     CaseGenerateSyntax(const CaseGenerateSyntax&) = delete;
     CaseGenerateSyntax& operator=(const CaseGenerateSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return keyword;
-            case 2: return openParen;
-            case 3: return &condition;
-            case 4: return closeParen;
-            case 5: return &items;
-            case 6: return endCase;
-            default: return nullptr;
-        }
-    }
 };
 
 struct GenerateBlockSyntax : public MemberSyntax {
@@ -4418,26 +3014,14 @@ struct GenerateBlockSyntax : public MemberSyntax {
 
     GenerateBlockSyntax(SyntaxList<AttributeInstanceSyntax> attributes, NamedLabelSyntax* label, Token begin, NamedBlockClauseSyntax* beginName, SyntaxList<MemberSyntax> members, Token end, NamedBlockClauseSyntax* endName) :
         MemberSyntax(SyntaxKind::GenerateBlock, attributes), label(label), begin(begin), beginName(beginName), members(members), end(end), endName(endName)
-    {}
+    {
+        computeSourceRange();
+    }
 
     GenerateBlockSyntax(const GenerateBlockSyntax&) = delete;
     GenerateBlockSyntax& operator=(const GenerateBlockSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return label;
-            case 2: return begin;
-            case 3: return beginName;
-            case 4: return &members;
-            case 5: return end;
-            case 6: return endName;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DividerClauseSyntax : public SyntaxNode {
@@ -4446,21 +3030,14 @@ struct DividerClauseSyntax : public SyntaxNode {
 
     DividerClauseSyntax(Token divide, Token value) :
         SyntaxNode(SyntaxKind::DividerClause), divide(divide), value(value)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DividerClauseSyntax(const DividerClauseSyntax&) = delete;
     DividerClauseSyntax& operator=(const DividerClauseSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return divide;
-            case 1: return value;
-            default: return nullptr;
-        }
-    }
 };
 
 struct TimeUnitsDeclarationSyntax : public MemberSyntax {
@@ -4471,24 +3048,14 @@ struct TimeUnitsDeclarationSyntax : public MemberSyntax {
 
     TimeUnitsDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, Token time, DividerClauseSyntax* divider, Token semi) :
         MemberSyntax(SyntaxKind::TimeUnitsDeclaration, attributes), keyword(keyword), time(time), divider(divider), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     TimeUnitsDeclarationSyntax(const TimeUnitsDeclarationSyntax&) = delete;
     TimeUnitsDeclarationSyntax& operator=(const TimeUnitsDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return keyword;
-            case 2: return time;
-            case 3: return divider;
-            case 4: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct PortConnectionSyntax : public SyntaxNode {
@@ -4502,14 +3069,6 @@ struct PortConnectionSyntax : public SyntaxNode {
     PortConnectionSyntax& operator=(const PortConnectionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override {
-        switch (index) {
-            case 0: return &attributes;
-            default: return nullptr;
-        }
-    }
 };
 
 struct OrderedPortConnectionSyntax : public PortConnectionSyntax {
@@ -4517,21 +3076,14 @@ struct OrderedPortConnectionSyntax : public PortConnectionSyntax {
 
     OrderedPortConnectionSyntax(SyntaxList<AttributeInstanceSyntax> attributes, ExpressionSyntax& expr) :
         PortConnectionSyntax(SyntaxKind::OrderedPortConnection, attributes), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     OrderedPortConnectionSyntax(const OrderedPortConnectionSyntax&) = delete;
     OrderedPortConnectionSyntax& operator=(const OrderedPortConnectionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return &expr;
-            default: return nullptr;
-        }
-    }
 };
 
 struct NamedPortConnectionSyntax : public PortConnectionSyntax {
@@ -4543,25 +3095,14 @@ struct NamedPortConnectionSyntax : public PortConnectionSyntax {
 
     NamedPortConnectionSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token dot, Token name, Token openParen, ExpressionSyntax* expr, Token closeParen) :
         PortConnectionSyntax(SyntaxKind::NamedPortConnection, attributes), dot(dot), name(name), openParen(openParen), expr(expr), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     NamedPortConnectionSyntax(const NamedPortConnectionSyntax&) = delete;
     NamedPortConnectionSyntax& operator=(const NamedPortConnectionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return dot;
-            case 2: return name;
-            case 3: return openParen;
-            case 4: return expr;
-            case 5: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct WildcardPortConnectionSyntax : public PortConnectionSyntax {
@@ -4569,21 +3110,14 @@ struct WildcardPortConnectionSyntax : public PortConnectionSyntax {
 
     WildcardPortConnectionSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token dotStar) :
         PortConnectionSyntax(SyntaxKind::WildcardPortConnection, attributes), dotStar(dotStar)
-    {}
+    {
+        computeSourceRange();
+    }
 
     WildcardPortConnectionSyntax(const WildcardPortConnectionSyntax&) = delete;
     WildcardPortConnectionSyntax& operator=(const WildcardPortConnectionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return dotStar;
-            default: return nullptr;
-        }
-    }
 };
 
 struct HierarchicalInstanceSyntax : public SyntaxNode {
@@ -4595,24 +3129,14 @@ struct HierarchicalInstanceSyntax : public SyntaxNode {
 
     HierarchicalInstanceSyntax(Token name, SyntaxList<VariableDimensionSyntax> dimensions, Token openParen, SeparatedSyntaxList<PortConnectionSyntax> connections, Token closeParen) :
         SyntaxNode(SyntaxKind::HierarchicalInstance), name(name), dimensions(dimensions), openParen(openParen), connections(connections), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     HierarchicalInstanceSyntax(const HierarchicalInstanceSyntax&) = delete;
     HierarchicalInstanceSyntax& operator=(const HierarchicalInstanceSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return name;
-            case 1: return &dimensions;
-            case 2: return openParen;
-            case 3: return &connections;
-            case 4: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct HierarchyInstantiationSyntax : public MemberSyntax {
@@ -4623,24 +3147,14 @@ struct HierarchyInstantiationSyntax : public MemberSyntax {
 
     HierarchyInstantiationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token type, ParameterValueAssignmentSyntax* parameters, SeparatedSyntaxList<HierarchicalInstanceSyntax> instances, Token semi) :
         MemberSyntax(SyntaxKind::HierarchyInstantiation, attributes), type(type), parameters(parameters), instances(instances), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     HierarchyInstantiationSyntax(const HierarchyInstantiationSyntax&) = delete;
     HierarchyInstantiationSyntax& operator=(const HierarchyInstantiationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return type;
-            case 2: return parameters;
-            case 3: return &instances;
-            case 4: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct FunctionPortSyntax : public SyntaxNode {
@@ -4653,25 +3167,14 @@ struct FunctionPortSyntax : public SyntaxNode {
 
     FunctionPortSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token constKeyword, Token direction, Token varKeyword, DataTypeSyntax* dataType, VariableDeclaratorSyntax& declarator) :
         SyntaxNode(SyntaxKind::FunctionPort), attributes(attributes), constKeyword(constKeyword), direction(direction), varKeyword(varKeyword), dataType(dataType), declarator(declarator)
-    {}
+    {
+        computeSourceRange();
+    }
 
     FunctionPortSyntax(const FunctionPortSyntax&) = delete;
     FunctionPortSyntax& operator=(const FunctionPortSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return constKeyword;
-            case 2: return direction;
-            case 3: return varKeyword;
-            case 4: return dataType;
-            case 5: return &declarator;
-            default: return nullptr;
-        }
-    }
 };
 
 struct FunctionPortListSyntax : public SyntaxNode {
@@ -4681,22 +3184,14 @@ struct FunctionPortListSyntax : public SyntaxNode {
 
     FunctionPortListSyntax(Token openParen, SeparatedSyntaxList<FunctionPortSyntax> ports, Token closeParen) :
         SyntaxNode(SyntaxKind::FunctionPortList), openParen(openParen), ports(ports), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     FunctionPortListSyntax(const FunctionPortListSyntax&) = delete;
     FunctionPortListSyntax& operator=(const FunctionPortListSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return &ports;
-            case 2: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct FunctionPrototypeSyntax : public SyntaxNode {
@@ -4708,24 +3203,14 @@ struct FunctionPrototypeSyntax : public SyntaxNode {
 
     FunctionPrototypeSyntax(Token keyword, Token lifetime, DataTypeSyntax* returnType, NameSyntax& name, FunctionPortListSyntax* portList) :
         SyntaxNode(SyntaxKind::FunctionPrototype), keyword(keyword), lifetime(lifetime), returnType(returnType), name(name), portList(portList)
-    {}
+    {
+        computeSourceRange();
+    }
 
     FunctionPrototypeSyntax(const FunctionPrototypeSyntax&) = delete;
     FunctionPrototypeSyntax& operator=(const FunctionPrototypeSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return keyword;
-            case 1: return lifetime;
-            case 2: return returnType;
-            case 3: return &name;
-            case 4: return portList;
-            default: return nullptr;
-        }
-    }
 };
 
 struct FunctionDeclarationSyntax : public MemberSyntax {
@@ -4737,25 +3222,14 @@ struct FunctionDeclarationSyntax : public MemberSyntax {
 
     FunctionDeclarationSyntax(SyntaxKind kind, SyntaxList<AttributeInstanceSyntax> attributes, FunctionPrototypeSyntax& prototype, Token semi, SyntaxList<SyntaxNode> items, Token end, NamedBlockClauseSyntax* endBlockName) :
         MemberSyntax(kind, attributes), prototype(prototype), semi(semi), items(items), end(end), endBlockName(endBlockName)
-    {}
+    {
+        computeSourceRange();
+    }
 
     FunctionDeclarationSyntax(const FunctionDeclarationSyntax&) = delete;
     FunctionDeclarationSyntax& operator=(const FunctionDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return &prototype;
-            case 2: return semi;
-            case 3: return &items;
-            case 4: return end;
-            case 5: return endBlockName;
-            default: return nullptr;
-        }
-    }
 };
 
 struct AssertionItemPortSyntax : public SyntaxNode {
@@ -4767,24 +3241,14 @@ struct AssertionItemPortSyntax : public SyntaxNode {
 
     AssertionItemPortSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token local, Token direction, DataTypeSyntax& type, VariableDeclaratorSyntax& declarator) :
         SyntaxNode(SyntaxKind::AssertionItemPort), attributes(attributes), local(local), direction(direction), type(type), declarator(declarator)
-    {}
+    {
+        computeSourceRange();
+    }
 
     AssertionItemPortSyntax(const AssertionItemPortSyntax&) = delete;
     AssertionItemPortSyntax& operator=(const AssertionItemPortSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return local;
-            case 2: return direction;
-            case 3: return &type;
-            case 4: return &declarator;
-            default: return nullptr;
-        }
-    }
 };
 
 struct AssertionItemPortListSyntax : public SyntaxNode {
@@ -4794,22 +3258,14 @@ struct AssertionItemPortListSyntax : public SyntaxNode {
 
     AssertionItemPortListSyntax(Token openParen, SeparatedSyntaxList<AssertionItemPortSyntax> ports, Token closeParen) :
         SyntaxNode(SyntaxKind::AssertionItemPortList), openParen(openParen), ports(ports), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     AssertionItemPortListSyntax(const AssertionItemPortListSyntax&) = delete;
     AssertionItemPortListSyntax& operator=(const AssertionItemPortListSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return &ports;
-            case 2: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct LetDeclarationSyntax : public MemberSyntax {
@@ -4821,25 +3277,14 @@ struct LetDeclarationSyntax : public MemberSyntax {
 
     LetDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token let, Token identifier, AssertionItemPortListSyntax* portList, EqualsValueClauseSyntax& initializer, Token semi) :
         MemberSyntax(SyntaxKind::LetDeclaration, attributes), let(let), identifier(identifier), portList(portList), initializer(initializer), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     LetDeclarationSyntax(const LetDeclarationSyntax&) = delete;
     LetDeclarationSyntax& operator=(const LetDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return let;
-            case 2: return identifier;
-            case 3: return portList;
-            case 4: return &initializer;
-            case 5: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct PropertyDeclarationSyntax : public MemberSyntax {
@@ -4855,29 +3300,14 @@ struct PropertyDeclarationSyntax : public MemberSyntax {
 
     PropertyDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, Token name, AssertionItemPortListSyntax* portList, Token semi, SyntaxList<MemberSyntax> assertionVariables, PropertySpecSyntax& propertySpec, Token optionalSemi, Token end, NamedBlockClauseSyntax* endBlockName) :
         MemberSyntax(SyntaxKind::PropertyDeclaration, attributes), keyword(keyword), name(name), portList(portList), semi(semi), assertionVariables(assertionVariables), propertySpec(propertySpec), optionalSemi(optionalSemi), end(end), endBlockName(endBlockName)
-    {}
+    {
+        computeSourceRange();
+    }
 
     PropertyDeclarationSyntax(const PropertyDeclarationSyntax&) = delete;
     PropertyDeclarationSyntax& operator=(const PropertyDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return keyword;
-            case 2: return name;
-            case 3: return portList;
-            case 4: return semi;
-            case 5: return &assertionVariables;
-            case 6: return &propertySpec;
-            case 7: return optionalSemi;
-            case 8: return end;
-            case 9: return endBlockName;
-            default: return nullptr;
-        }
-    }
 };
 
 struct SequenceDeclarationSyntax : public MemberSyntax {
@@ -4893,29 +3323,14 @@ struct SequenceDeclarationSyntax : public MemberSyntax {
 
     SequenceDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, Token name, AssertionItemPortListSyntax* portList, Token semi, SyntaxList<MemberSyntax> assertionVariables, ExpressionSyntax& seqExpr, Token optionalSemi, Token end, NamedBlockClauseSyntax* endBlockName) :
         MemberSyntax(SyntaxKind::SequenceDeclaration, attributes), keyword(keyword), name(name), portList(portList), semi(semi), assertionVariables(assertionVariables), seqExpr(seqExpr), optionalSemi(optionalSemi), end(end), endBlockName(endBlockName)
-    {}
+    {
+        computeSourceRange();
+    }
 
     SequenceDeclarationSyntax(const SequenceDeclarationSyntax&) = delete;
     SequenceDeclarationSyntax& operator=(const SequenceDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return keyword;
-            case 2: return name;
-            case 3: return portList;
-            case 4: return semi;
-            case 5: return &assertionVariables;
-            case 6: return &seqExpr;
-            case 7: return optionalSemi;
-            case 8: return end;
-            case 9: return endBlockName;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ExtendsClauseSyntax : public SyntaxNode {
@@ -4925,22 +3340,14 @@ struct ExtendsClauseSyntax : public SyntaxNode {
 
     ExtendsClauseSyntax(Token keyword, NameSyntax& baseName, ArgumentListSyntax* arguments) :
         SyntaxNode(SyntaxKind::ExtendsClause), keyword(keyword), baseName(baseName), arguments(arguments)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ExtendsClauseSyntax(const ExtendsClauseSyntax&) = delete;
     ExtendsClauseSyntax& operator=(const ExtendsClauseSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return keyword;
-            case 1: return &baseName;
-            case 2: return arguments;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ImplementsClauseSyntax : public SyntaxNode {
@@ -4949,21 +3356,14 @@ struct ImplementsClauseSyntax : public SyntaxNode {
 
     ImplementsClauseSyntax(Token keyword, SeparatedSyntaxList<NameSyntax> interfaces) :
         SyntaxNode(SyntaxKind::ImplementsClause), keyword(keyword), interfaces(interfaces)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ImplementsClauseSyntax(const ImplementsClauseSyntax&) = delete;
     ImplementsClauseSyntax& operator=(const ImplementsClauseSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return keyword;
-            case 1: return &interfaces;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ClassDeclarationSyntax : public MemberSyntax {
@@ -4981,31 +3381,14 @@ struct ClassDeclarationSyntax : public MemberSyntax {
 
     ClassDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token virtualOrInterface, Token classKeyword, Token lifetime, Token name, ParameterPortListSyntax* parameters, ExtendsClauseSyntax* extendsClause, ImplementsClauseSyntax* implementsClause, Token semi, SyntaxList<MemberSyntax> items, Token endClass, NamedBlockClauseSyntax* endBlockName) :
         MemberSyntax(SyntaxKind::ClassDeclaration, attributes), virtualOrInterface(virtualOrInterface), classKeyword(classKeyword), lifetime(lifetime), name(name), parameters(parameters), extendsClause(extendsClause), implementsClause(implementsClause), semi(semi), items(items), endClass(endClass), endBlockName(endBlockName)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ClassDeclarationSyntax(const ClassDeclarationSyntax&) = delete;
     ClassDeclarationSyntax& operator=(const ClassDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return virtualOrInterface;
-            case 2: return classKeyword;
-            case 3: return lifetime;
-            case 4: return name;
-            case 5: return parameters;
-            case 6: return extendsClause;
-            case 7: return implementsClause;
-            case 8: return semi;
-            case 9: return &items;
-            case 10: return endClass;
-            case 11: return endBlockName;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ClassPropertyDeclarationSyntax : public MemberSyntax {
@@ -5014,22 +3397,14 @@ struct ClassPropertyDeclarationSyntax : public MemberSyntax {
 
     ClassPropertyDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, TokenList qualifiers, MemberSyntax& declaration) :
         MemberSyntax(SyntaxKind::ClassPropertyDeclaration, attributes), qualifiers(qualifiers), declaration(declaration)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ClassPropertyDeclarationSyntax(const ClassPropertyDeclarationSyntax&) = delete;
     ClassPropertyDeclarationSyntax& operator=(const ClassPropertyDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return &qualifiers;
-            case 2: return &declaration;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ClassMethodDeclarationSyntax : public MemberSyntax {
@@ -5038,22 +3413,14 @@ struct ClassMethodDeclarationSyntax : public MemberSyntax {
 
     ClassMethodDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, TokenList qualifiers, FunctionDeclarationSyntax& declaration) :
         MemberSyntax(SyntaxKind::ClassMethodDeclaration, attributes), qualifiers(qualifiers), declaration(declaration)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ClassMethodDeclarationSyntax(const ClassMethodDeclarationSyntax&) = delete;
     ClassMethodDeclarationSyntax& operator=(const ClassMethodDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return &qualifiers;
-            case 2: return &declaration;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ClassMethodPrototypeSyntax : public MemberSyntax {
@@ -5063,23 +3430,14 @@ struct ClassMethodPrototypeSyntax : public MemberSyntax {
 
     ClassMethodPrototypeSyntax(SyntaxList<AttributeInstanceSyntax> attributes, TokenList qualifiers, FunctionPrototypeSyntax& prototype, Token semi) :
         MemberSyntax(SyntaxKind::ClassMethodPrototype, attributes), qualifiers(qualifiers), prototype(prototype), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ClassMethodPrototypeSyntax(const ClassMethodPrototypeSyntax&) = delete;
     ClassMethodPrototypeSyntax& operator=(const ClassMethodPrototypeSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return &qualifiers;
-            case 2: return &prototype;
-            case 3: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ContinuousAssignSyntax : public MemberSyntax {
@@ -5089,23 +3447,14 @@ struct ContinuousAssignSyntax : public MemberSyntax {
 
     ContinuousAssignSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token assign, SeparatedSyntaxList<ExpressionSyntax> assignments, Token semi) :
         MemberSyntax(SyntaxKind::ContinuousAssign, attributes), assign(assign), assignments(assignments), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ContinuousAssignSyntax(const ContinuousAssignSyntax&) = delete;
     ContinuousAssignSyntax& operator=(const ContinuousAssignSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return assign;
-            case 2: return &assignments;
-            case 3: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DefParamAssignmentSyntax : public SyntaxNode {
@@ -5114,21 +3463,14 @@ struct DefParamAssignmentSyntax : public SyntaxNode {
 
     DefParamAssignmentSyntax(NameSyntax& name, EqualsValueClauseSyntax* setter) :
         SyntaxNode(SyntaxKind::DefParamAssignment), name(name), setter(setter)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DefParamAssignmentSyntax(const DefParamAssignmentSyntax&) = delete;
     DefParamAssignmentSyntax& operator=(const DefParamAssignmentSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &name;
-            case 1: return setter;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DefParamSyntax : public MemberSyntax {
@@ -5138,23 +3480,14 @@ struct DefParamSyntax : public MemberSyntax {
 
     DefParamSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token defparam, SeparatedSyntaxList<DefParamAssignmentSyntax> assignments, Token semi) :
         MemberSyntax(SyntaxKind::DefParam, attributes), defparam(defparam), assignments(assignments), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DefParamSyntax(const DefParamSyntax&) = delete;
     DefParamSyntax& operator=(const DefParamSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return defparam;
-            case 2: return &assignments;
-            case 3: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ModportClockingPortSyntax : public MemberSyntax {
@@ -5163,22 +3496,14 @@ struct ModportClockingPortSyntax : public MemberSyntax {
 
     ModportClockingPortSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token clocking, Token name) :
         MemberSyntax(SyntaxKind::ModportClockingPort, attributes), clocking(clocking), name(name)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ModportClockingPortSyntax(const ModportClockingPortSyntax&) = delete;
     ModportClockingPortSyntax& operator=(const ModportClockingPortSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return clocking;
-            case 2: return name;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ModportPortSyntax : public SyntaxNode {
@@ -5195,20 +3520,14 @@ struct ModportNamedPortSyntax : public ModportPortSyntax {
 
     ModportNamedPortSyntax(Token name) :
         ModportPortSyntax(SyntaxKind::ModportNamedPort), name(name)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ModportNamedPortSyntax(const ModportNamedPortSyntax&) = delete;
     ModportNamedPortSyntax& operator=(const ModportNamedPortSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return name;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ModportExplicitPortSyntax : public ModportPortSyntax {
@@ -5220,24 +3539,14 @@ struct ModportExplicitPortSyntax : public ModportPortSyntax {
 
     ModportExplicitPortSyntax(Token dot, Token name, Token openParen, ExpressionSyntax* expr, Token closeParen) :
         ModportPortSyntax(SyntaxKind::ModportExplicitPort), dot(dot), name(name), openParen(openParen), expr(expr), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ModportExplicitPortSyntax(const ModportExplicitPortSyntax&) = delete;
     ModportExplicitPortSyntax& operator=(const ModportExplicitPortSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return dot;
-            case 1: return name;
-            case 2: return openParen;
-            case 3: return expr;
-            case 4: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ModportSimplePortListSyntax : public MemberSyntax {
@@ -5246,22 +3555,14 @@ struct ModportSimplePortListSyntax : public MemberSyntax {
 
     ModportSimplePortListSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token direction, SeparatedSyntaxList<ModportPortSyntax> ports) :
         MemberSyntax(SyntaxKind::ModportSimplePortList, attributes), direction(direction), ports(ports)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ModportSimplePortListSyntax(const ModportSimplePortListSyntax&) = delete;
     ModportSimplePortListSyntax& operator=(const ModportSimplePortListSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return direction;
-            case 2: return &ports;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ModportSubroutinePortSyntax : public ModportPortSyntax {
@@ -5269,20 +3570,14 @@ struct ModportSubroutinePortSyntax : public ModportPortSyntax {
 
     ModportSubroutinePortSyntax(FunctionPrototypeSyntax& prototype) :
         ModportPortSyntax(SyntaxKind::ModportSubroutinePort), prototype(prototype)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ModportSubroutinePortSyntax(const ModportSubroutinePortSyntax&) = delete;
     ModportSubroutinePortSyntax& operator=(const ModportSubroutinePortSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &prototype;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ModportSubroutinePortListSyntax : public MemberSyntax {
@@ -5291,22 +3586,14 @@ struct ModportSubroutinePortListSyntax : public MemberSyntax {
 
     ModportSubroutinePortListSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token importExport, SeparatedSyntaxList<ModportPortSyntax> ports) :
         MemberSyntax(SyntaxKind::ModportSubroutinePortList, attributes), importExport(importExport), ports(ports)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ModportSubroutinePortListSyntax(const ModportSubroutinePortListSyntax&) = delete;
     ModportSubroutinePortListSyntax& operator=(const ModportSubroutinePortListSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return importExport;
-            case 2: return &ports;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ModportItemSyntax : public SyntaxNode {
@@ -5315,21 +3602,14 @@ struct ModportItemSyntax : public SyntaxNode {
 
     ModportItemSyntax(Token name, AnsiPortListSyntax& ports) :
         SyntaxNode(SyntaxKind::ModportItem), name(name), ports(ports)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ModportItemSyntax(const ModportItemSyntax&) = delete;
     ModportItemSyntax& operator=(const ModportItemSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return name;
-            case 1: return &ports;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ModportDeclarationSyntax : public MemberSyntax {
@@ -5339,23 +3619,14 @@ struct ModportDeclarationSyntax : public MemberSyntax {
 
     ModportDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, SeparatedSyntaxList<ModportItemSyntax> items, Token semi) :
         MemberSyntax(SyntaxKind::ModportDeclaration, attributes), keyword(keyword), items(items), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ModportDeclarationSyntax(const ModportDeclarationSyntax&) = delete;
     ModportDeclarationSyntax& operator=(const ModportDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return keyword;
-            case 2: return &items;
-            case 3: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ClockingSkewSyntax : public SyntaxNode {
@@ -5365,22 +3636,14 @@ struct ClockingSkewSyntax : public SyntaxNode {
 
     ClockingSkewSyntax(Token edge, Token hash, ExpressionSyntax* value) :
         SyntaxNode(SyntaxKind::ClockingSkew), edge(edge), hash(hash), value(value)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ClockingSkewSyntax(const ClockingSkewSyntax&) = delete;
     ClockingSkewSyntax& operator=(const ClockingSkewSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return edge;
-            case 1: return hash;
-            case 2: return value;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ClockingDirectionSyntax : public SyntaxNode {
@@ -5392,24 +3655,14 @@ struct ClockingDirectionSyntax : public SyntaxNode {
 
     ClockingDirectionSyntax(Token input, ClockingSkewSyntax* inputSkew, Token output, ClockingSkewSyntax* ouputSkew, Token inout) :
         SyntaxNode(SyntaxKind::ClockingDirection), input(input), inputSkew(inputSkew), output(output), ouputSkew(ouputSkew), inout(inout)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ClockingDirectionSyntax(const ClockingDirectionSyntax&) = delete;
     ClockingDirectionSyntax& operator=(const ClockingDirectionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return input;
-            case 1: return inputSkew;
-            case 2: return output;
-            case 3: return ouputSkew;
-            case 4: return inout;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ClockingItemSyntax : public SyntaxNode {
@@ -5421,24 +3674,14 @@ struct ClockingItemSyntax : public SyntaxNode {
 
     ClockingItemSyntax(Token defaultKeyword, ClockingDirectionSyntax* direction, SeparatedSyntaxList<AttributeSpecSyntax> assignments, Token semi, MemberSyntax* declaration) :
         SyntaxNode(SyntaxKind::ClockingItem), defaultKeyword(defaultKeyword), direction(direction), assignments(assignments), semi(semi), declaration(declaration)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ClockingItemSyntax(const ClockingItemSyntax&) = delete;
     ClockingItemSyntax& operator=(const ClockingItemSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return defaultKeyword;
-            case 1: return direction;
-            case 2: return &assignments;
-            case 3: return semi;
-            case 4: return declaration;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ClockingDeclarationSyntax : public MemberSyntax {
@@ -5455,30 +3698,14 @@ struct ClockingDeclarationSyntax : public MemberSyntax {
 
     ClockingDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token globalOrDefault, Token clocking, Token blockName, Token at, ParenthesizedEventExpressionSyntax* event, Token eventIdentifier, Token semi, SyntaxList<ClockingItemSyntax> items, Token endClocking, NamedBlockClauseSyntax* endBlockName) :
         MemberSyntax(SyntaxKind::ClockingDeclaration, attributes), globalOrDefault(globalOrDefault), clocking(clocking), blockName(blockName), at(at), event(event), eventIdentifier(eventIdentifier), semi(semi), items(items), endClocking(endClocking), endBlockName(endBlockName)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ClockingDeclarationSyntax(const ClockingDeclarationSyntax&) = delete;
     ClockingDeclarationSyntax& operator=(const ClockingDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return globalOrDefault;
-            case 2: return clocking;
-            case 3: return blockName;
-            case 4: return at;
-            case 5: return event;
-            case 6: return eventIdentifier;
-            case 7: return semi;
-            case 8: return &items;
-            case 9: return endClocking;
-            case 10: return endBlockName;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DPIImportExportSyntax : public MemberSyntax {
@@ -5492,27 +3719,14 @@ struct DPIImportExportSyntax : public MemberSyntax {
 
     DPIImportExportSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token keyword, Token stringLiteral, Token property, Token name, Token equals, FunctionPrototypeSyntax& method, Token semi) :
         MemberSyntax(SyntaxKind::DPIImportExport, attributes), keyword(keyword), stringLiteral(stringLiteral), property(property), name(name), equals(equals), method(method), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DPIImportExportSyntax(const DPIImportExportSyntax&) = delete;
     DPIImportExportSyntax& operator=(const DPIImportExportSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return keyword;
-            case 2: return stringLiteral;
-            case 3: return property;
-            case 4: return name;
-            case 5: return equals;
-            case 6: return &method;
-            case 7: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- CONSTRAINTS -----
@@ -5532,21 +3746,14 @@ struct DistWeightSyntax : public SyntaxNode {
 
     DistWeightSyntax(Token op, ExpressionSyntax& expr) :
         SyntaxNode(SyntaxKind::DistWeight), op(op), expr(expr)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DistWeightSyntax(const DistWeightSyntax&) = delete;
     DistWeightSyntax& operator=(const DistWeightSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return op;
-            case 1: return &expr;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DistItemSyntax : public SyntaxNode {
@@ -5555,21 +3762,14 @@ struct DistItemSyntax : public SyntaxNode {
 
     DistItemSyntax(ExpressionSyntax& range, DistWeightSyntax* weight) :
         SyntaxNode(SyntaxKind::DistItem), range(range), weight(weight)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DistItemSyntax(const DistItemSyntax&) = delete;
     DistItemSyntax& operator=(const DistItemSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &range;
-            case 1: return weight;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DistConstraintListSyntax : public SyntaxNode {
@@ -5580,23 +3780,14 @@ struct DistConstraintListSyntax : public SyntaxNode {
 
     DistConstraintListSyntax(Token dist, Token openBrace, SeparatedSyntaxList<DistItemSyntax> items, Token closeBrace) :
         SyntaxNode(SyntaxKind::DistConstraintList), dist(dist), openBrace(openBrace), items(items), closeBrace(closeBrace)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DistConstraintListSyntax(const DistConstraintListSyntax&) = delete;
     DistConstraintListSyntax& operator=(const DistConstraintListSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return dist;
-            case 1: return openBrace;
-            case 2: return &items;
-            case 3: return closeBrace;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ExpressionOrDistSyntax : public ExpressionSyntax {
@@ -5605,21 +3796,14 @@ struct ExpressionOrDistSyntax : public ExpressionSyntax {
 
     ExpressionOrDistSyntax(ExpressionSyntax& expr, DistConstraintListSyntax& distribution) :
         ExpressionSyntax(SyntaxKind::ExpressionOrDist), expr(expr), distribution(distribution)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ExpressionOrDistSyntax(const ExpressionOrDistSyntax&) = delete;
     ExpressionOrDistSyntax& operator=(const ExpressionOrDistSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &expr;
-            case 1: return &distribution;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ExpressionConstraintSyntax : public ConstraintItemSyntax {
@@ -5629,22 +3813,14 @@ struct ExpressionConstraintSyntax : public ConstraintItemSyntax {
 
     ExpressionConstraintSyntax(Token soft, ExpressionSyntax& expr, Token semi) :
         ConstraintItemSyntax(SyntaxKind::ExpressionConstraint), soft(soft), expr(expr), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ExpressionConstraintSyntax(const ExpressionConstraintSyntax&) = delete;
     ExpressionConstraintSyntax& operator=(const ExpressionConstraintSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return soft;
-            case 1: return &expr;
-            case 2: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct UniquenessConstraintSyntax : public ConstraintItemSyntax {
@@ -5654,22 +3830,14 @@ struct UniquenessConstraintSyntax : public ConstraintItemSyntax {
 
     UniquenessConstraintSyntax(Token unique, OpenRangeListSyntax& ranges, Token semi) :
         ConstraintItemSyntax(SyntaxKind::UniquenessConstraint), unique(unique), ranges(ranges), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     UniquenessConstraintSyntax(const UniquenessConstraintSyntax&) = delete;
     UniquenessConstraintSyntax& operator=(const UniquenessConstraintSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return unique;
-            case 1: return &ranges;
-            case 2: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ImplicationConstraintSyntax : public ConstraintItemSyntax {
@@ -5679,22 +3847,14 @@ struct ImplicationConstraintSyntax : public ConstraintItemSyntax {
 
     ImplicationConstraintSyntax(ExpressionSyntax& left, Token arrow, ConstraintItemSyntax& constraints) :
         ConstraintItemSyntax(SyntaxKind::ImplicationConstraint), left(left), arrow(arrow), constraints(constraints)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ImplicationConstraintSyntax(const ImplicationConstraintSyntax&) = delete;
     ImplicationConstraintSyntax& operator=(const ImplicationConstraintSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &left;
-            case 1: return arrow;
-            case 2: return &constraints;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ElseConstraintClauseSyntax : public SyntaxNode {
@@ -5703,21 +3863,14 @@ struct ElseConstraintClauseSyntax : public SyntaxNode {
 
     ElseConstraintClauseSyntax(Token elseKeyword, ConstraintItemSyntax& constraints) :
         SyntaxNode(SyntaxKind::ElseConstraintClause), elseKeyword(elseKeyword), constraints(constraints)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ElseConstraintClauseSyntax(const ElseConstraintClauseSyntax&) = delete;
     ElseConstraintClauseSyntax& operator=(const ElseConstraintClauseSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return elseKeyword;
-            case 1: return &constraints;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ConditionalConstraintSyntax : public ConstraintItemSyntax {
@@ -5730,25 +3883,14 @@ struct ConditionalConstraintSyntax : public ConstraintItemSyntax {
 
     ConditionalConstraintSyntax(Token ifKeyword, Token openParen, ExpressionSyntax& condition, Token closeParen, ConstraintItemSyntax& constraints, ElseConstraintClauseSyntax* elseClause) :
         ConstraintItemSyntax(SyntaxKind::ConditionalConstraint), ifKeyword(ifKeyword), openParen(openParen), condition(condition), closeParen(closeParen), constraints(constraints), elseClause(elseClause)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ConditionalConstraintSyntax(const ConditionalConstraintSyntax&) = delete;
     ConditionalConstraintSyntax& operator=(const ConditionalConstraintSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return ifKeyword;
-            case 1: return openParen;
-            case 2: return &condition;
-            case 3: return closeParen;
-            case 4: return &constraints;
-            case 5: return elseClause;
-            default: return nullptr;
-        }
-    }
 };
 
 struct LoopConstraintSyntax : public ConstraintItemSyntax {
@@ -5758,22 +3900,14 @@ struct LoopConstraintSyntax : public ConstraintItemSyntax {
 
     LoopConstraintSyntax(Token foreachKeyword, ForeachLoopListSyntax& loopList, ConstraintItemSyntax& constraints) :
         ConstraintItemSyntax(SyntaxKind::LoopConstraint), foreachKeyword(foreachKeyword), loopList(loopList), constraints(constraints)
-    {}
+    {
+        computeSourceRange();
+    }
 
     LoopConstraintSyntax(const LoopConstraintSyntax&) = delete;
     LoopConstraintSyntax& operator=(const LoopConstraintSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return foreachKeyword;
-            case 1: return &loopList;
-            case 2: return &constraints;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DisableConstraintSyntax : public ConstraintItemSyntax {
@@ -5784,23 +3918,14 @@ struct DisableConstraintSyntax : public ConstraintItemSyntax {
 
     DisableConstraintSyntax(Token disable, Token soft, NameSyntax& name, Token semi) :
         ConstraintItemSyntax(SyntaxKind::DisableConstraint), disable(disable), soft(soft), name(name), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DisableConstraintSyntax(const DisableConstraintSyntax&) = delete;
     DisableConstraintSyntax& operator=(const DisableConstraintSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return disable;
-            case 1: return soft;
-            case 2: return &name;
-            case 3: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct SolveBeforeConstraintSyntax : public ConstraintItemSyntax {
@@ -5812,24 +3937,14 @@ struct SolveBeforeConstraintSyntax : public ConstraintItemSyntax {
 
     SolveBeforeConstraintSyntax(Token solve, SeparatedSyntaxList<ExpressionSyntax> beforeExpr, Token before, SeparatedSyntaxList<ExpressionSyntax> afterExpr, Token semi) :
         ConstraintItemSyntax(SyntaxKind::SolveBeforeConstraint), solve(solve), beforeExpr(beforeExpr), before(before), afterExpr(afterExpr), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     SolveBeforeConstraintSyntax(const SolveBeforeConstraintSyntax&) = delete;
     SolveBeforeConstraintSyntax& operator=(const SolveBeforeConstraintSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return solve;
-            case 1: return &beforeExpr;
-            case 2: return before;
-            case 3: return &afterExpr;
-            case 4: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ConstraintBlockSyntax : public ConstraintItemSyntax {
@@ -5839,22 +3954,14 @@ struct ConstraintBlockSyntax : public ConstraintItemSyntax {
 
     ConstraintBlockSyntax(Token openBrace, SyntaxList<ConstraintItemSyntax> items, Token closeBrace) :
         ConstraintItemSyntax(SyntaxKind::ConstraintBlock), openBrace(openBrace), items(items), closeBrace(closeBrace)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ConstraintBlockSyntax(const ConstraintBlockSyntax&) = delete;
     ConstraintBlockSyntax& operator=(const ConstraintBlockSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openBrace;
-            case 1: return &items;
-            case 2: return closeBrace;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ConstraintPrototypeSyntax : public MemberSyntax {
@@ -5865,24 +3972,14 @@ struct ConstraintPrototypeSyntax : public MemberSyntax {
 
     ConstraintPrototypeSyntax(SyntaxList<AttributeInstanceSyntax> attributes, TokenList qualifiers, Token keyword, Token name, Token semi) :
         MemberSyntax(SyntaxKind::ConstraintPrototype, attributes), qualifiers(qualifiers), keyword(keyword), name(name), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ConstraintPrototypeSyntax(const ConstraintPrototypeSyntax&) = delete;
     ConstraintPrototypeSyntax& operator=(const ConstraintPrototypeSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return &qualifiers;
-            case 2: return keyword;
-            case 3: return name;
-            case 4: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ConstraintDeclarationSyntax : public MemberSyntax {
@@ -5893,24 +3990,14 @@ struct ConstraintDeclarationSyntax : public MemberSyntax {
 
     ConstraintDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, TokenList qualifiers, Token keyword, Token name, ConstraintBlockSyntax& block) :
         MemberSyntax(SyntaxKind::ConstraintDeclaration, attributes), qualifiers(qualifiers), keyword(keyword), name(name), block(block)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ConstraintDeclarationSyntax(const ConstraintDeclarationSyntax&) = delete;
     ConstraintDeclarationSyntax& operator=(const ConstraintDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return &qualifiers;
-            case 2: return keyword;
-            case 3: return name;
-            case 4: return &block;
-            default: return nullptr;
-        }
-    }
 };
 
 struct WithClauseSyntax : public ExpressionSyntax {
@@ -5921,23 +4008,14 @@ struct WithClauseSyntax : public ExpressionSyntax {
 
     WithClauseSyntax(Token with, Token openParen, ExpressionSyntax& expr, Token closeParen) :
         ExpressionSyntax(SyntaxKind::WithClause), with(with), openParen(openParen), expr(expr), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     WithClauseSyntax(const WithClauseSyntax&) = delete;
     WithClauseSyntax& operator=(const WithClauseSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return with;
-            case 1: return openParen;
-            case 2: return &expr;
-            case 3: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct IdentifierListSyntax : public SyntaxNode {
@@ -5947,22 +4025,14 @@ struct IdentifierListSyntax : public SyntaxNode {
 
     IdentifierListSyntax(Token openParen, SeparatedSyntaxList<IdentifierNameSyntax> identifiers, Token closeParen) :
         SyntaxNode(SyntaxKind::IdentifierList), openParen(openParen), identifiers(identifiers), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     IdentifierListSyntax(const IdentifierListSyntax&) = delete;
     IdentifierListSyntax& operator=(const IdentifierListSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return &identifiers;
-            case 2: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct RandomizeMethodWithClauseSyntax : public ExpressionSyntax {
@@ -5972,22 +4042,14 @@ struct RandomizeMethodWithClauseSyntax : public ExpressionSyntax {
 
     RandomizeMethodWithClauseSyntax(Token with, IdentifierListSyntax* names, ConstraintBlockSyntax& constraints) :
         ExpressionSyntax(SyntaxKind::RandomizeMethodWithClause), with(with), names(names), constraints(constraints)
-    {}
+    {
+        computeSourceRange();
+    }
 
     RandomizeMethodWithClauseSyntax(const RandomizeMethodWithClauseSyntax&) = delete;
     RandomizeMethodWithClauseSyntax& operator=(const RandomizeMethodWithClauseSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return with;
-            case 1: return names;
-            case 2: return &constraints;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- COVER GROUPS -----
@@ -6000,23 +4062,14 @@ struct WithFunctionSampleSyntax : public SyntaxNode {
 
     WithFunctionSampleSyntax(Token with, Token function, Token sample, AnsiPortListSyntax& portList) :
         SyntaxNode(SyntaxKind::WithFunctionSample), with(with), function(function), sample(sample), portList(portList)
-    {}
+    {
+        computeSourceRange();
+    }
 
     WithFunctionSampleSyntax(const WithFunctionSampleSyntax&) = delete;
     WithFunctionSampleSyntax& operator=(const WithFunctionSampleSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return with;
-            case 1: return function;
-            case 2: return sample;
-            case 3: return &portList;
-            default: return nullptr;
-        }
-    }
 };
 
 struct BlockEventExpressionSyntax : public SyntaxNode {
@@ -6035,22 +4088,14 @@ struct BinaryBlockEventExpressionSyntax : public BlockEventExpressionSyntax {
 
     BinaryBlockEventExpressionSyntax(BlockEventExpressionSyntax& left, Token orKeyword, BlockEventExpressionSyntax& right) :
         BlockEventExpressionSyntax(SyntaxKind::BinaryBlockEventExpression), left(left), orKeyword(orKeyword), right(right)
-    {}
+    {
+        computeSourceRange();
+    }
 
     BinaryBlockEventExpressionSyntax(const BinaryBlockEventExpressionSyntax&) = delete;
     BinaryBlockEventExpressionSyntax& operator=(const BinaryBlockEventExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &left;
-            case 1: return orKeyword;
-            case 2: return &right;
-            default: return nullptr;
-        }
-    }
 };
 
 struct PrimaryBlockEventExpressionSyntax : public BlockEventExpressionSyntax {
@@ -6059,21 +4104,14 @@ struct PrimaryBlockEventExpressionSyntax : public BlockEventExpressionSyntax {
 
     PrimaryBlockEventExpressionSyntax(Token keyword, NameSyntax& name) :
         BlockEventExpressionSyntax(SyntaxKind::PrimaryBlockEventExpression), keyword(keyword), name(name)
-    {}
+    {
+        computeSourceRange();
+    }
 
     PrimaryBlockEventExpressionSyntax(const PrimaryBlockEventExpressionSyntax&) = delete;
     PrimaryBlockEventExpressionSyntax& operator=(const PrimaryBlockEventExpressionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return keyword;
-            case 1: return &name;
-            default: return nullptr;
-        }
-    }
 };
 
 struct BlockCoverageEventSyntax : public SyntaxNode {
@@ -6084,23 +4122,14 @@ struct BlockCoverageEventSyntax : public SyntaxNode {
 
     BlockCoverageEventSyntax(Token atat, Token openParen, BlockEventExpressionSyntax& expr, Token closeParen) :
         SyntaxNode(SyntaxKind::BlockCoverageEvent), atat(atat), openParen(openParen), expr(expr), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     BlockCoverageEventSyntax(const BlockCoverageEventSyntax&) = delete;
     BlockCoverageEventSyntax& operator=(const BlockCoverageEventSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return atat;
-            case 1: return openParen;
-            case 2: return &expr;
-            case 3: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct CovergroupDeclarationSyntax : public MemberSyntax {
@@ -6115,28 +4144,14 @@ struct CovergroupDeclarationSyntax : public MemberSyntax {
 
     CovergroupDeclarationSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token covergroup, Token name, AnsiPortListSyntax* portList, SyntaxNode* event, Token semi, SyntaxList<MemberSyntax> members, Token endgroup, NamedBlockClauseSyntax* endBlockName) :
         MemberSyntax(SyntaxKind::CovergroupDeclaration, attributes), covergroup(covergroup), name(name), portList(portList), event(event), semi(semi), members(members), endgroup(endgroup), endBlockName(endBlockName)
-    {}
+    {
+        computeSourceRange();
+    }
 
     CovergroupDeclarationSyntax(const CovergroupDeclarationSyntax&) = delete;
     CovergroupDeclarationSyntax& operator=(const CovergroupDeclarationSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return covergroup;
-            case 2: return name;
-            case 3: return portList;
-            case 4: return event;
-            case 5: return semi;
-            case 6: return &members;
-            case 7: return endgroup;
-            case 8: return endBlockName;
-            default: return nullptr;
-        }
-    }
 };
 
 struct CoverageOptionSyntax : public MemberSyntax {
@@ -6149,26 +4164,14 @@ struct CoverageOptionSyntax : public MemberSyntax {
 
     CoverageOptionSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token option, Token dot, Token name, Token equals, ExpressionSyntax& expr, Token semi) :
         MemberSyntax(SyntaxKind::CoverageOption, attributes), option(option), dot(dot), name(name), equals(equals), expr(expr), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     CoverageOptionSyntax(const CoverageOptionSyntax&) = delete;
     CoverageOptionSyntax& operator=(const CoverageOptionSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return option;
-            case 2: return dot;
-            case 3: return name;
-            case 4: return equals;
-            case 5: return &expr;
-            case 6: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct CoverpointSyntax : public MemberSyntax {
@@ -6183,28 +4186,14 @@ struct CoverpointSyntax : public MemberSyntax {
 
     CoverpointSyntax(SyntaxList<AttributeInstanceSyntax> attributes, DataTypeSyntax* type, NamedLabelSyntax* label, Token coverpoint, ExpressionSyntax& expr, Token openBrace, SyntaxList<MemberSyntax> members, Token closeBrace, Token emptySemi) :
         MemberSyntax(SyntaxKind::Coverpoint, attributes), type(type), label(label), coverpoint(coverpoint), expr(expr), openBrace(openBrace), members(members), closeBrace(closeBrace), emptySemi(emptySemi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     CoverpointSyntax(const CoverpointSyntax&) = delete;
     CoverpointSyntax& operator=(const CoverpointSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return type;
-            case 2: return label;
-            case 3: return coverpoint;
-            case 4: return &expr;
-            case 5: return openBrace;
-            case 6: return &members;
-            case 7: return closeBrace;
-            case 8: return emptySemi;
-            default: return nullptr;
-        }
-    }
 };
 
 struct CoverageBinInitializerSyntax : public SyntaxNode {
@@ -6222,21 +4211,14 @@ struct DefaultCoverageBinInitializerSyntax : public CoverageBinInitializerSyntax
 
     DefaultCoverageBinInitializerSyntax(Token defaultKeyword, Token sequenceKeyword) :
         CoverageBinInitializerSyntax(SyntaxKind::DefaultCoverageBinInitializer), defaultKeyword(defaultKeyword), sequenceKeyword(sequenceKeyword)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DefaultCoverageBinInitializerSyntax(const DefaultCoverageBinInitializerSyntax&) = delete;
     DefaultCoverageBinInitializerSyntax& operator=(const DefaultCoverageBinInitializerSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return defaultKeyword;
-            case 1: return sequenceKeyword;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ExpressionCoverageBinInitializerSyntax : public CoverageBinInitializerSyntax {
@@ -6245,21 +4227,14 @@ struct ExpressionCoverageBinInitializerSyntax : public CoverageBinInitializerSyn
 
     ExpressionCoverageBinInitializerSyntax(ExpressionSyntax& expr, WithClauseSyntax* withClause) :
         CoverageBinInitializerSyntax(SyntaxKind::ExpressionCoverageBinInitializer), expr(expr), withClause(withClause)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ExpressionCoverageBinInitializerSyntax(const ExpressionCoverageBinInitializerSyntax&) = delete;
     ExpressionCoverageBinInitializerSyntax& operator=(const ExpressionCoverageBinInitializerSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &expr;
-            case 1: return withClause;
-            default: return nullptr;
-        }
-    }
 };
 
 struct RangeCoverageBinInitializerSyntax : public CoverageBinInitializerSyntax {
@@ -6268,21 +4243,14 @@ struct RangeCoverageBinInitializerSyntax : public CoverageBinInitializerSyntax {
 
     RangeCoverageBinInitializerSyntax(OpenRangeListSyntax& ranges, WithClauseSyntax* withClause) :
         CoverageBinInitializerSyntax(SyntaxKind::RangeCoverageBinInitializer), ranges(ranges), withClause(withClause)
-    {}
+    {
+        computeSourceRange();
+    }
 
     RangeCoverageBinInitializerSyntax(const RangeCoverageBinInitializerSyntax&) = delete;
     RangeCoverageBinInitializerSyntax& operator=(const RangeCoverageBinInitializerSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &ranges;
-            case 1: return withClause;
-            default: return nullptr;
-        }
-    }
 };
 
 struct TransRepeatRangeSyntax : public SyntaxNode {
@@ -6293,23 +4261,14 @@ struct TransRepeatRangeSyntax : public SyntaxNode {
 
     TransRepeatRangeSyntax(Token openBracket, Token specifier, SelectorSyntax* selector, Token closeBracket) :
         SyntaxNode(SyntaxKind::TransRepeatRange), openBracket(openBracket), specifier(specifier), selector(selector), closeBracket(closeBracket)
-    {}
+    {
+        computeSourceRange();
+    }
 
     TransRepeatRangeSyntax(const TransRepeatRangeSyntax&) = delete;
     TransRepeatRangeSyntax& operator=(const TransRepeatRangeSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openBracket;
-            case 1: return specifier;
-            case 2: return selector;
-            case 3: return closeBracket;
-            default: return nullptr;
-        }
-    }
 };
 
 struct TransRangeSyntax : public SyntaxNode {
@@ -6318,21 +4277,14 @@ struct TransRangeSyntax : public SyntaxNode {
 
     TransRangeSyntax(SeparatedSyntaxList<ExpressionSyntax> items, TransRepeatRangeSyntax* repeat) :
         SyntaxNode(SyntaxKind::TransRange), items(items), repeat(repeat)
-    {}
+    {
+        computeSourceRange();
+    }
 
     TransRangeSyntax(const TransRangeSyntax&) = delete;
     TransRangeSyntax& operator=(const TransRangeSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &items;
-            case 1: return repeat;
-            default: return nullptr;
-        }
-    }
 };
 
 struct TransSetSyntax : public SyntaxNode {
@@ -6342,22 +4294,14 @@ struct TransSetSyntax : public SyntaxNode {
 
     TransSetSyntax(Token openParen, SeparatedSyntaxList<TransRangeSyntax> ranges, Token closeParen) :
         SyntaxNode(SyntaxKind::TransSet), openParen(openParen), ranges(ranges), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     TransSetSyntax(const TransSetSyntax&) = delete;
     TransSetSyntax& operator=(const TransSetSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return &ranges;
-            case 2: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct TransListCoverageBinInitializerSyntax : public CoverageBinInitializerSyntax {
@@ -6366,21 +4310,14 @@ struct TransListCoverageBinInitializerSyntax : public CoverageBinInitializerSynt
 
     TransListCoverageBinInitializerSyntax(SeparatedSyntaxList<TransSetSyntax> sets, WithClauseSyntax* withClause) :
         CoverageBinInitializerSyntax(SyntaxKind::TransListCoverageBinInitializer), sets(sets), withClause(withClause)
-    {}
+    {
+        computeSourceRange();
+    }
 
     TransListCoverageBinInitializerSyntax(const TransListCoverageBinInitializerSyntax&) = delete;
     TransListCoverageBinInitializerSyntax& operator=(const TransListCoverageBinInitializerSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &sets;
-            case 1: return withClause;
-            default: return nullptr;
-        }
-    }
 };
 
 struct IffClauseSyntax : public SyntaxNode {
@@ -6391,23 +4328,14 @@ struct IffClauseSyntax : public SyntaxNode {
 
     IffClauseSyntax(Token iff, Token openParen, ExpressionSyntax& expr, Token closeParen) :
         SyntaxNode(SyntaxKind::IffClause), iff(iff), openParen(openParen), expr(expr), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     IffClauseSyntax(const IffClauseSyntax&) = delete;
     IffClauseSyntax& operator=(const IffClauseSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return iff;
-            case 1: return openParen;
-            case 2: return &expr;
-            case 3: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct CoverageBinsSyntax : public MemberSyntax {
@@ -6422,28 +4350,14 @@ struct CoverageBinsSyntax : public MemberSyntax {
 
     CoverageBinsSyntax(SyntaxList<AttributeInstanceSyntax> attributes, Token wildcard, Token keyword, Token name, ElementSelectSyntax* selector, Token equals, CoverageBinInitializerSyntax& initializer, IffClauseSyntax* iff, Token semi) :
         MemberSyntax(SyntaxKind::CoverageBins, attributes), wildcard(wildcard), keyword(keyword), name(name), selector(selector), equals(equals), initializer(initializer), iff(iff), semi(semi)
-    {}
+    {
+        computeSourceRange();
+    }
 
     CoverageBinsSyntax(const CoverageBinsSyntax&) = delete;
     CoverageBinsSyntax& operator=(const CoverageBinsSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &attributes;
-            case 1: return wildcard;
-            case 2: return keyword;
-            case 3: return name;
-            case 4: return selector;
-            case 5: return equals;
-            case 6: return &initializer;
-            case 7: return iff;
-            case 8: return semi;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- TOP LEVEL -----
@@ -6454,21 +4368,14 @@ struct CompilationUnitSyntax : public SyntaxNode {
 
     CompilationUnitSyntax(SyntaxList<MemberSyntax> members, Token endOfFile) :
         SyntaxNode(SyntaxKind::CompilationUnit), members(members), endOfFile(endOfFile)
-    {}
+    {
+        computeSourceRange();
+    }
 
     CompilationUnitSyntax(const CompilationUnitSyntax&) = delete;
     CompilationUnitSyntax& operator=(const CompilationUnitSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &members;
-            case 1: return endOfFile;
-            default: return nullptr;
-        }
-    }
 };
 
 // ----- DIRECTIVES -----
@@ -6484,14 +4391,6 @@ struct DirectiveSyntax : public SyntaxNode {
     DirectiveSyntax& operator=(const DirectiveSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override {
-        switch (index) {
-            case 0: return directive;
-            default: return nullptr;
-        }
-    }
 };
 
 struct SimpleDirectiveSyntax : public DirectiveSyntax {
@@ -6499,21 +4398,14 @@ struct SimpleDirectiveSyntax : public DirectiveSyntax {
 
     SimpleDirectiveSyntax(SyntaxKind kind, Token directive, Token endOfDirective) :
         DirectiveSyntax(kind, directive), endOfDirective(endOfDirective)
-    {}
+    {
+        computeSourceRange();
+    }
 
     SimpleDirectiveSyntax(const SimpleDirectiveSyntax&) = delete;
     SimpleDirectiveSyntax& operator=(const SimpleDirectiveSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return directive;
-            case 1: return endOfDirective;
-            default: return nullptr;
-        }
-    }
 };
 
 struct IncludeDirectiveSyntax : public DirectiveSyntax {
@@ -6522,22 +4414,14 @@ struct IncludeDirectiveSyntax : public DirectiveSyntax {
 
     IncludeDirectiveSyntax(Token directive, Token fileName, Token endOfDirective) :
         DirectiveSyntax(SyntaxKind::IncludeDirective, directive), fileName(fileName), endOfDirective(endOfDirective)
-    {}
+    {
+        computeSourceRange();
+    }
 
     IncludeDirectiveSyntax(const IncludeDirectiveSyntax&) = delete;
     IncludeDirectiveSyntax& operator=(const IncludeDirectiveSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return directive;
-            case 1: return fileName;
-            case 2: return endOfDirective;
-            default: return nullptr;
-        }
-    }
 };
 
 struct ConditionalBranchDirectiveSyntax : public DirectiveSyntax {
@@ -6547,23 +4431,14 @@ struct ConditionalBranchDirectiveSyntax : public DirectiveSyntax {
 
     ConditionalBranchDirectiveSyntax(SyntaxKind kind, Token directive, Token name, Token endOfDirective, TokenList disabledTokens) :
         DirectiveSyntax(kind, directive), name(name), endOfDirective(endOfDirective), disabledTokens(disabledTokens)
-    {}
+    {
+        computeSourceRange();
+    }
 
     ConditionalBranchDirectiveSyntax(const ConditionalBranchDirectiveSyntax&) = delete;
     ConditionalBranchDirectiveSyntax& operator=(const ConditionalBranchDirectiveSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return directive;
-            case 1: return name;
-            case 2: return endOfDirective;
-            case 3: return &disabledTokens;
-            default: return nullptr;
-        }
-    }
 };
 
 struct UnconditionalBranchDirectiveSyntax : public DirectiveSyntax {
@@ -6572,22 +4447,14 @@ struct UnconditionalBranchDirectiveSyntax : public DirectiveSyntax {
 
     UnconditionalBranchDirectiveSyntax(SyntaxKind kind, Token directive, Token endOfDirective, TokenList disabledTokens) :
         DirectiveSyntax(kind, directive), endOfDirective(endOfDirective), disabledTokens(disabledTokens)
-    {}
+    {
+        computeSourceRange();
+    }
 
     UnconditionalBranchDirectiveSyntax(const UnconditionalBranchDirectiveSyntax&) = delete;
     UnconditionalBranchDirectiveSyntax& operator=(const UnconditionalBranchDirectiveSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return directive;
-            case 1: return endOfDirective;
-            case 2: return &disabledTokens;
-            default: return nullptr;
-        }
-    }
 };
 
 struct MacroArgumentDefaultSyntax : public SyntaxNode {
@@ -6596,21 +4463,14 @@ struct MacroArgumentDefaultSyntax : public SyntaxNode {
 
     MacroArgumentDefaultSyntax(Token equals, TokenList tokens) :
         SyntaxNode(SyntaxKind::MacroArgumentDefault), equals(equals), tokens(tokens)
-    {}
+    {
+        computeSourceRange();
+    }
 
     MacroArgumentDefaultSyntax(const MacroArgumentDefaultSyntax&) = delete;
     MacroArgumentDefaultSyntax& operator=(const MacroArgumentDefaultSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return equals;
-            case 1: return &tokens;
-            default: return nullptr;
-        }
-    }
 };
 
 struct MacroFormalArgumentSyntax : public SyntaxNode {
@@ -6619,21 +4479,14 @@ struct MacroFormalArgumentSyntax : public SyntaxNode {
 
     MacroFormalArgumentSyntax(Token name, MacroArgumentDefaultSyntax* defaultValue) :
         SyntaxNode(SyntaxKind::MacroFormalArgument), name(name), defaultValue(defaultValue)
-    {}
+    {
+        computeSourceRange();
+    }
 
     MacroFormalArgumentSyntax(const MacroFormalArgumentSyntax&) = delete;
     MacroFormalArgumentSyntax& operator=(const MacroFormalArgumentSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return name;
-            case 1: return defaultValue;
-            default: return nullptr;
-        }
-    }
 };
 
 struct MacroFormalArgumentListSyntax : public SyntaxNode {
@@ -6643,22 +4496,14 @@ struct MacroFormalArgumentListSyntax : public SyntaxNode {
 
     MacroFormalArgumentListSyntax(Token openParen, SeparatedSyntaxList<MacroFormalArgumentSyntax> args, Token closeParen) :
         SyntaxNode(SyntaxKind::MacroFormalArgumentList), openParen(openParen), args(args), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     MacroFormalArgumentListSyntax(const MacroFormalArgumentListSyntax&) = delete;
     MacroFormalArgumentListSyntax& operator=(const MacroFormalArgumentListSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return &args;
-            case 2: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DefineDirectiveSyntax : public DirectiveSyntax {
@@ -6669,24 +4514,14 @@ struct DefineDirectiveSyntax : public DirectiveSyntax {
 
     DefineDirectiveSyntax(Token directive, Token name, MacroFormalArgumentListSyntax* formalArguments, TokenList body, Token endOfDirective) :
         DirectiveSyntax(SyntaxKind::DefineDirective, directive), name(name), formalArguments(formalArguments), body(body), endOfDirective(endOfDirective)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DefineDirectiveSyntax(const DefineDirectiveSyntax&) = delete;
     DefineDirectiveSyntax& operator=(const DefineDirectiveSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return directive;
-            case 1: return name;
-            case 2: return formalArguments;
-            case 3: return &body;
-            case 4: return endOfDirective;
-            default: return nullptr;
-        }
-    }
 };
 
 struct MacroActualArgumentSyntax : public SyntaxNode {
@@ -6694,20 +4529,14 @@ struct MacroActualArgumentSyntax : public SyntaxNode {
 
     MacroActualArgumentSyntax(TokenList tokens) :
         SyntaxNode(SyntaxKind::MacroActualArgument), tokens(tokens)
-    {}
+    {
+        computeSourceRange();
+    }
 
     MacroActualArgumentSyntax(const MacroActualArgumentSyntax&) = delete;
     MacroActualArgumentSyntax& operator=(const MacroActualArgumentSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return &tokens;
-            default: return nullptr;
-        }
-    }
 };
 
 struct MacroActualArgumentListSyntax : public SyntaxNode {
@@ -6717,22 +4546,14 @@ struct MacroActualArgumentListSyntax : public SyntaxNode {
 
     MacroActualArgumentListSyntax(Token openParen, SeparatedSyntaxList<MacroActualArgumentSyntax> args, Token closeParen) :
         SyntaxNode(SyntaxKind::MacroActualArgumentList), openParen(openParen), args(args), closeParen(closeParen)
-    {}
+    {
+        computeSourceRange();
+    }
 
     MacroActualArgumentListSyntax(const MacroActualArgumentListSyntax&) = delete;
     MacroActualArgumentListSyntax& operator=(const MacroActualArgumentListSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return openParen;
-            case 1: return &args;
-            case 2: return closeParen;
-            default: return nullptr;
-        }
-    }
 };
 
 struct MacroUsageSyntax : public DirectiveSyntax {
@@ -6740,21 +4561,14 @@ struct MacroUsageSyntax : public DirectiveSyntax {
 
     MacroUsageSyntax(Token directive, MacroActualArgumentListSyntax* args) :
         DirectiveSyntax(SyntaxKind::MacroUsage, directive), args(args)
-    {}
+    {
+        computeSourceRange();
+    }
 
     MacroUsageSyntax(const MacroUsageSyntax&) = delete;
     MacroUsageSyntax& operator=(const MacroUsageSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return directive;
-            case 1: return args;
-            default: return nullptr;
-        }
-    }
 };
 
 struct TimescaleDirectiveSyntax : public DirectiveSyntax {
@@ -6767,26 +4581,14 @@ struct TimescaleDirectiveSyntax : public DirectiveSyntax {
 
     TimescaleDirectiveSyntax(Token directive, Token timeUnit, Token timeUnitUnit, Token slash, Token timePrecision, Token timePrecisionUnit, Token endOfDirective) :
         DirectiveSyntax(SyntaxKind::TimescaleDirective, directive), timeUnit(timeUnit), timeUnitUnit(timeUnitUnit), slash(slash), timePrecision(timePrecision), timePrecisionUnit(timePrecisionUnit), endOfDirective(endOfDirective)
-    {}
+    {
+        computeSourceRange();
+    }
 
     TimescaleDirectiveSyntax(const TimescaleDirectiveSyntax&) = delete;
     TimescaleDirectiveSyntax& operator=(const TimescaleDirectiveSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return directive;
-            case 1: return timeUnit;
-            case 2: return timeUnitUnit;
-            case 3: return slash;
-            case 4: return timePrecision;
-            case 5: return timePrecisionUnit;
-            case 6: return endOfDirective;
-            default: return nullptr;
-        }
-    }
 };
 
 struct DefaultNetTypeDirectiveSyntax : public DirectiveSyntax {
@@ -6795,22 +4597,14 @@ struct DefaultNetTypeDirectiveSyntax : public DirectiveSyntax {
 
     DefaultNetTypeDirectiveSyntax(Token directive, Token netType, Token endOfDirective) :
         DirectiveSyntax(SyntaxKind::DefaultNetTypeDirective, directive), netType(netType), endOfDirective(endOfDirective)
-    {}
+    {
+        computeSourceRange();
+    }
 
     DefaultNetTypeDirectiveSyntax(const DefaultNetTypeDirectiveSyntax&) = delete;
     DefaultNetTypeDirectiveSyntax& operator=(const DefaultNetTypeDirectiveSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return directive;
-            case 1: return netType;
-            case 2: return endOfDirective;
-            default: return nullptr;
-        }
-    }
 };
 
 struct LineDirectiveSyntax : public DirectiveSyntax {
@@ -6821,24 +4615,14 @@ struct LineDirectiveSyntax : public DirectiveSyntax {
 
     LineDirectiveSyntax(Token directive, Token lineNumber, Token fileName, Token level, Token endOfDirective) :
         DirectiveSyntax(SyntaxKind::LineDirective, directive), lineNumber(lineNumber), fileName(fileName), level(level), endOfDirective(endOfDirective)
-    {}
+    {
+        computeSourceRange();
+    }
 
     LineDirectiveSyntax(const LineDirectiveSyntax&) = delete;
     LineDirectiveSyntax& operator=(const LineDirectiveSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return directive;
-            case 1: return lineNumber;
-            case 2: return fileName;
-            case 3: return level;
-            case 4: return endOfDirective;
-            default: return nullptr;
-        }
-    }
 };
 
 struct UndefDirectiveSyntax : public DirectiveSyntax {
@@ -6847,22 +4631,14 @@ struct UndefDirectiveSyntax : public DirectiveSyntax {
 
     UndefDirectiveSyntax(Token directive, Token name, Token endOfDirective) :
         DirectiveSyntax(SyntaxKind::UndefDirective, directive), name(name), endOfDirective(endOfDirective)
-    {}
+    {
+        computeSourceRange();
+    }
 
     UndefDirectiveSyntax(const UndefDirectiveSyntax&) = delete;
     UndefDirectiveSyntax& operator=(const UndefDirectiveSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return directive;
-            case 1: return name;
-            case 2: return endOfDirective;
-            default: return nullptr;
-        }
-    }
 };
 
 struct BeginKeywordsDirectiveSyntax : public DirectiveSyntax {
@@ -6871,22 +4647,14 @@ struct BeginKeywordsDirectiveSyntax : public DirectiveSyntax {
 
     BeginKeywordsDirectiveSyntax(Token directive, Token versionSpecifier, Token endOfDirective) :
         DirectiveSyntax(SyntaxKind::BeginKeywordsDirective, directive), versionSpecifier(versionSpecifier), endOfDirective(endOfDirective)
-    {}
+    {
+        computeSourceRange();
+    }
 
     BeginKeywordsDirectiveSyntax(const BeginKeywordsDirectiveSyntax&) = delete;
     BeginKeywordsDirectiveSyntax& operator=(const BeginKeywordsDirectiveSyntax&) = delete;
 
     static bool isKind(SyntaxKind kind);
-
-protected:
-    TokenOrSyntax getChild(uint32_t index) const override final {
-        switch (index) {
-            case 0: return directive;
-            case 1: return versionSpecifier;
-            case 2: return endOfDirective;
-            default: return nullptr;
-        }
-    }
 };
 
 class SyntaxFactory {
@@ -17,6 +17,13 @@ Parser::Parser(Preprocessor& preprocessor, const Bag&) :
 {
 }
 
+Parser::Parser(TokenPipeline& pipeline, BumpAllocator& alloc, Diagnostics& diagnostics, const Bag&) :
+    ParserBase::ParserBase(pipeline, alloc, diagnostics),
+    factory(alloc),
+    vectorBuilder(getDiagnostics())
+{
+}
+
 CompilationUnitSyntax& Parser::parseCompilationUnit() {
     Token eof;
     auto members = parseMemberList<MemberSyntax>(TokenKind::EndOfFile, eof, [this]() { return parseMember(); });
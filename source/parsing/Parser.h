@@ -17,6 +17,15 @@ namespace slang {
 
 class BumpAllocator;
 class Preprocessor;
+class TokenPipeline;
+
+/// Contains various options that can control parsing behavior.
+struct ParserOptions {
+    /// If set to true, SyntaxTree runs the preprocessor on a separate thread that feeds
+    /// tokens to the parser, so that lexing and macro expansion overlap with parsing.
+    /// This only pays off for large files on machines with a spare core.
+    bool pipelined = false;
+};
 
 /// Implements a full syntax parser for SystemVerilog.
 class Parser : ParserBase {
@@ -26,6 +35,12 @@ public:
 
     explicit Parser(Preprocessor& preprocessor, const Bag& options = {});
 
+    /// Creates a parser that gets its tokens from a preprocessor running on another
+    /// thread. Since the preprocessor's allocator and diagnostics belong to that thread,
+    /// the parser is given its own.
+    Parser(TokenPipeline& pipeline, BumpAllocator& alloc, Diagnostics& diagnostics,
+           const Bag& options = {});
+
     /// Parse a whole compilation unit.
     CompilationUnitSyntax& parseCompilationUnit();
 
@@ -7,13 +7,22 @@
 #include "ParserBase.h"
 
 #include "lexing/Preprocessor.h"
+#include "parsing/TokenPipeline.h"
 #include "util/BumpAllocator.h"
 
 namespace slang {
 
 ParserBase::ParserBase(Preprocessor& preprocessor) :
     alloc(preprocessor.getAllocator()),
-    window(preprocessor)
+    window(&preprocessor, nullptr),
+    diagnostics(preprocessor.getDiagnostics())
+{
+}
+
+ParserBase::ParserBase(TokenPipeline& pipeline, BumpAllocator& alloc, Diagnostics& diagnostics) :
+    alloc(alloc),
+    window(nullptr, &pipeline),
+    diagnostics(diagnostics)
 {
 }
 
@@ -27,7 +36,7 @@ void ParserBase::prependSkippedTokens(Token& token) {
 }
 
 Diagnostics& ParserBase::getDiagnostics() {
-    return window.tokenSource.getDiagnostics();
+    return diagnostics;
 }
 
 Diagnostic& ParserBase::addError(DiagCode code, SourceLocation location) {
@@ -111,7 +120,7 @@ void ParserBase::Window::addNew() {
             buffer = newBuffer;
         }
     }
-    buffer[count] = tokenSource.next();
+    buffer[count] = pipeline ? pipeline->next() : tokenSource->next();
     count++;
 }
 
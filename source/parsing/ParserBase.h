@@ -16,12 +16,14 @@
 namespace slang {
 
 class Preprocessor;
+class TokenPipeline;
 
 /// Base class for the Parser, which contains helpers and language-agnostic parsing routines.
 /// Mostly this helps keep the main Parser smaller and more focused.
 class ParserBase {
 protected:
     ParserBase(Preprocessor& preprocessor);
+    ParserBase(TokenPipeline& pipeline, BumpAllocator& alloc, Diagnostics& diagnostics);
 
     Diagnostics& getDiagnostics();
     Diagnostic& addError(DiagCode code, SourceLocation location);
@@ -38,8 +40,8 @@ protected:
     /// Helper class that maintains a sliding window of tokens, with lookahead.
     class Window {
     public:
-        explicit Window(Preprocessor& source) :
-            tokenSource(source)
+        Window(Preprocessor* source, TokenPipeline* pipeline) :
+            tokenSource(source), pipeline(pipeline)
         {
             capacity = 32;
             buffer = new Token[capacity];
@@ -51,8 +53,10 @@ protected:
         Window(const Window&) = delete;
         Window& operator=(const Window&) = delete;
 
-        // the source of all tokens
-        Preprocessor& tokenSource;
+        // the source of all tokens; when the preprocessor is running on another
+        // thread tokens come through the pipeline instead
+        Preprocessor* tokenSource;
+        TokenPipeline* pipeline;
 
         // a buffer of tokens for implementing lookahead
         Token* buffer = nullptr;
@@ -216,6 +220,7 @@ private:
     void prependSkippedTokens(Token& node);
 
     Window window;
+    Diagnostics& diagnostics;
     SmallVectorSized<Token, 4> skippedTokens;
 };
 
@@ -62,21 +62,57 @@ Token SyntaxNode::getLastToken() const {
     return Token();
 }
 
-SourceRange SyntaxNode::sourceRange() const {
-    Token firstToken = getFirstToken();
-    Token lastToken = getLastToken();
-    return SourceRange(firstToken.location(), lastToken.location() + lastToken.rawText().length());
+void SyntaxNode::computeSourceRange() {
+    // Children are always constructed before their parents, so their ranges are
+    // already known and we only need to look at the direct children here.
+    uint32_t childCount = getChildCount();
+    SourceLocation start;
+    uint32_t i = 0;
+    for (; i < childCount; i++) {
+        auto child = getChild(i);
+        if (child.isToken) {
+            if (child.token) {
+                start = child.token.location();
+                break;
+            }
+        }
+        else if (child.node && child.node->hasTokens) {
+            start = child.node->range.start();
+            break;
+        }
+    }
+
+    if (i == childCount)
+        return;
+
+    hasTokens = true;
+
+    for (uint32_t j = childCount; j > i; j--) {
+        auto child = getChild(j - 1);
+        if (child.isToken) {
+            if (child.token) {
+                range = SourceRange(start, child.token.location() + child.token.rawText().length());
+                return;
+            }
+        }
+        else if (child.node && child.node->hasTokens) {
+            range = SourceRange(start, child.node->range.end());
+            return;
+        }
+    }
+
+    THROW_UNREACHABLE;
 }
 
 const SyntaxNode* SyntaxNode::childNode(uint32_t index) const {
-    auto child = const_cast<SyntaxNode*>(this)->getChild(index);
+    auto child = getChild(index);
     if (child.isToken)
         return nullptr;
     return child.node;
 }
 
 Token SyntaxNode::childToken(uint32_t index) const {
-    auto child = const_cast<SyntaxNode*>(this)->getChild(index);
+    auto child = getChild(index);
     if (!child.isToken)
         return Token();
     return child.token;
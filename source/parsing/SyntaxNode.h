@@ -10,6 +10,7 @@
 #include <cstdint>
 #include <cstddef>
 #include <string>
+#include <type_traits>
 
 #include "lexing/Token.h"
 #include "util/Iterator.h"
@@ -550,6 +551,38 @@ struct TokenOrSyntax {
     TokenOrSyntax(nullptr_t) : token(), isToken(true) {}
 };
 
+/// Describes how a child is stored within its parent syntax node.
+enum class SyntaxChildKind : uint8_t {
+    /// A token stored by value.
+    Token,
+
+    /// A pointer to an optional child node, which can be null.
+    Node,
+
+    /// A reference to a required child node, which is never null. References
+    /// are stored the same way as pointers.
+    NodeReference,
+
+    /// A list object embedded directly within the parent node.
+    List
+};
+
+/// Locates a single child within a syntax node as an offset from the start of the node.
+struct SyntaxChildInfo {
+    uint16_t offset;
+    SyntaxChildKind kind;
+};
+
+/// The children of a particular kind of syntax node, in order.
+struct SyntaxChildTable {
+    const SyntaxChildInfo* children;
+    uint32_t count;
+};
+
+/// Child layout tables for every SyntaxKind, indexed by kind. Lists store their
+/// elements differently and have empty entries here. Note: generated in AllSyntax.cpp
+extern const SyntaxChildTable SyntaxChildTables[];
+
 /// Base class for all syntax nodes.
 class SyntaxNode {
 public:
@@ -571,15 +604,23 @@ public:
     /// Get the last leaf token in this subtree.
     Token getLastToken() const;
 
-    /// Get the source range of the node.
-    SourceRange sourceRange() const;
+    /// Get the source range of the node. This is computed from the node's children
+    /// when it is constructed, so it's cheap to call repeatedly. Nodes that contain
+    /// no tokens at all have an empty range.
+    SourceRange sourceRange() const { return range; }
 
     /// Gets the child syntax node at the specified index. If the child at
     /// the given index is not a node (probably a token) then this returns null.
     const SyntaxNode* childNode(uint32_t index) const;
     Token childToken(uint32_t index) const;
 
-    uint32_t getChildCount() const; // Note: implemented in AllSyntax.cpp
+    /// Gets the child at the specified index, which is either a token or a node.
+    /// Children are located via the generated SyntaxChildTables, so this is just
+    /// a table lookup and a load instead of a virtual call.
+    TokenOrSyntax getChild(uint32_t index) const;
+
+    /// Gets the number of children of this node.
+    uint32_t getChildCount() const;
 
     template<typename T>
     T& as() {
@@ -608,32 +649,105 @@ public:
     static bool isKind(SyntaxKind) { return true; }
 
 protected:
-    virtual TokenOrSyntax getChild(uint32_t) const = 0;
+    /// Computes the range covered by the node's children. This must be called by
+    /// the constructor of the most derived node type, once all children are set.
+    void computeSourceRange();
+
+private:
+    const SyntaxChildTable& getChildTable() const { return SyntaxChildTables[(size_t)kind]; }
+
+    bool hasTokens = false;
+    SourceRange range;
 };
 
 class SyntaxListBase : public SyntaxNode {
 public:
     uint32_t getChildCount() const { return childCount; }
 
+    /// Gets the element at the specified index.
+    TokenOrSyntax getElement(uint32_t index) const;
+
 protected:
-    SyntaxListBase(uint32_t childCount) :
-        SyntaxNode(SyntaxKind::List),
-        childCount(childCount) {}
+    // Node lists of any element type are viewed as lists of the SyntaxNode base.
+    explicit SyntaxListBase(span<SyntaxNode* const> elements) :
+        SyntaxNode(SyntaxKind::List), elementKind(ElementKind::Nodes),
+        childCount((uint32_t)elements.size())
+    {
+        items.nodes = elements.data();
+    }
+
+    explicit SyntaxListBase(span<Token const> elements) :
+        SyntaxNode(SyntaxKind::List), elementKind(ElementKind::Tokens),
+        childCount((uint32_t)elements.size())
+    {
+        items.tokens = elements.data();
+    }
+
+    explicit SyntaxListBase(span<TokenOrSyntax const> elements) :
+        SyntaxNode(SyntaxKind::List), elementKind(ElementKind::Separated),
+        childCount((uint32_t)elements.size())
+    {
+        items.separated = elements.data();
+    }
 
+private:
+    // All of the list types share SyntaxKind::List, so they record what kind of
+    // elements they hold to allow generic traversal without virtual calls.
+    enum class ElementKind : uint8_t {
+        Nodes,
+        Tokens,
+        Separated
+    };
+
+    ElementKind elementKind;
     uint32_t childCount;
+
+    // The elements owned by the derived list; which member is active
+    // depends on elementKind, and childCount is the number of them.
+    union {
+        SyntaxNode* const* nodes;
+        const Token* tokens;
+        const TokenOrSyntax* separated;
+    } items;
 };
 
+inline uint32_t SyntaxNode::getChildCount() const {
+    if (kind == SyntaxKind::List)
+        return static_cast<const SyntaxListBase*>(this)->getChildCount();
+    return getChildTable().count;
+}
+
+inline TokenOrSyntax SyntaxNode::getChild(uint32_t index) const {
+    if (kind == SyntaxKind::List)
+        return static_cast<const SyntaxListBase*>(this)->getElement(index);
+
+    const SyntaxChildTable& table = getChildTable();
+    if (index >= table.count)
+        return nullptr;
+
+    const SyntaxChildInfo& info = table.children[index];
+    const char* ptr = reinterpret_cast<const char*>(this) + info.offset;
+    switch (info.kind) {
+        case SyntaxChildKind::Token: return *reinterpret_cast<const Token*>(ptr);
+        case SyntaxChildKind::Node:
+        case SyntaxChildKind::NodeReference: return *reinterpret_cast<const SyntaxNode* const*>(ptr);
+        case SyntaxChildKind::List: return reinterpret_cast<const SyntaxNode*>(ptr);
+    }
+    THROW_UNREACHABLE;
+}
+
 template<typename T>
 class SyntaxList : public SyntaxListBase {
 public:
     SyntaxList(nullptr_t) : SyntaxList(span<T* const>()) {}
     SyntaxList(span<T* const> elements) :
-        SyntaxListBase((uint32_t)elements.size()),
-        elements(elements) {}
+        SyntaxListBase(asNodes(elements)),
+        elements(elements)
+    {
+        computeSourceRange();
+    }
 
-    SyntaxList(span<T*> elements) :
-        SyntaxListBase((uint32_t)elements.size()),
-        elements(elements) {}
+    SyntaxList(span<T*> elements) : SyntaxList(span<T* const>(elements)) {}
 
     uint32_t count() const { return (uint32_t)elements.size(); }
 
@@ -643,7 +757,10 @@ public:
     const T* operator[](uint32_t index) const { return elements[index]; }
 
 private:
-    TokenOrSyntax getChild(uint32_t index) const override final { return elements[index]; }
+    static span<SyntaxNode* const> asNodes(span<T* const> elements) {
+        static_assert(std::is_base_of_v<SyntaxNode, T>);
+        return { reinterpret_cast<SyntaxNode* const*>(elements.data()), elements.size() };
+    }
 
     span<T* const> elements;
 };
@@ -652,12 +769,13 @@ class TokenList : public SyntaxListBase {
 public:
     TokenList(nullptr_t) : TokenList(span<Token const>()) {}
     TokenList(span<Token const> elements) :
-        SyntaxListBase((uint32_t)elements.size()),
-        elements(elements) {}
+        SyntaxListBase(elements),
+        elements(elements)
+    {
+        computeSourceRange();
+    }
 
-    TokenList(span<Token> elements) :
-        SyntaxListBase((uint32_t)elements.size()),
-        elements(elements) {}
+    TokenList(span<Token> elements) : TokenList(span<Token const>(elements)) {}
 
     uint32_t count() const { return (uint32_t)elements.size(); }
 
@@ -667,8 +785,6 @@ public:
     Token operator[](uint32_t index) const { return elements[index]; }
 
 private:
-    TokenOrSyntax getChild(uint32_t index) const override final { return elements[index]; }
-
     span<Token const> elements;
 };
 
@@ -701,12 +817,14 @@ public:
 
     SeparatedSyntaxList(nullptr_t) : SeparatedSyntaxList(span<TokenOrSyntax const>()) {}
     SeparatedSyntaxList(span<TokenOrSyntax const> elements) :
-        SyntaxListBase((uint32_t)elements.size()),
-        elements(elements) {}
+        SyntaxListBase(elements),
+        elements(elements)
+    {
+        computeSourceRange();
+    }
 
     SeparatedSyntaxList(span<TokenOrSyntax> elements) :
-        SyntaxListBase((uint32_t)elements.size()),
-        elements(elements) {}
+        SeparatedSyntaxList(span<TokenOrSyntax const>(elements)) {}
 
     bool empty() const { return count() == 0; }
     uint32_t count() const { return (uint32_t)std::ceil(elements.size() / 2.0); }
@@ -721,9 +839,16 @@ public:
     const_iterator end() const { return const_iterator(*this, count()); }
 
 private:
-    TokenOrSyntax getChild(uint32_t index) const override final { return elements[index]; }
-
     span<TokenOrSyntax const> elements;
 };
 
+inline TokenOrSyntax SyntaxListBase::getElement(uint32_t index) const {
+    switch (elementKind) {
+        case ElementKind::Nodes: return items.nodes[index];
+        case ElementKind::Tokens: return items.tokens[index];
+        case ElementKind::Separated: return items.separated[index];
+    }
+    THROW_UNREACHABLE;
+}
+
 }
@@ -13,8 +13,10 @@
 #include "text/SourceManager.h"
 #include "util/Bag.h"
 #include "util/BumpAllocator.h"
+#include "util/TimeTrace.h"
 
 #include "Parser.h"
+#include "TokenPipeline.h"
 
 namespace slang {
 
@@ -73,6 +75,9 @@ public:
     /// Gets the allocator containing the memory for the parse tree.
     BumpAllocator& allocator() { return alloc; }
 
+    /// Gets statistics about the memory used to hold the parse tree.
+    AllocatorStats getMemoryStats() const { return alloc.getStats(); }
+
     /// Gets the source manager used to build the syntax tree.
     SourceManager& sourceManager() { return sourceMan; }
     const SourceManager& sourceManager() const { return sourceMan; }
@@ -105,15 +110,26 @@ private:
 
     static std::shared_ptr<SyntaxTree> create(SourceManager& sourceManager, SourceBuffer source,
                                               const Bag& options, bool guess) {
+        TIME_SCOPE("Parse", sourceManager.getRawFileName(source.id));
+
         BumpAllocator alloc;
         Diagnostics diagnostics;
-        Preprocessor preprocessor(sourceManager, alloc, diagnostics, options);
-        preprocessor.pushSource(source);
+        diagnostics.setFilter(options.getOrDefault<DiagnosticOptions>().filter);
+
+        const SyntaxNode* root;
+        if (options.getOrDefault<ParserOptions>().pipelined) {
+            root = parsePipelined(sourceManager, source, options, guess, alloc, diagnostics);
+        }
+        else {
+            Preprocessor preprocessor(sourceManager, alloc, diagnostics, options);
+            preprocessor.pushSource(source);
 
-        Parser parser(preprocessor, options);
+            Parser parser(preprocessor, options);
+            root = guess ? &parser.parseGuess() : &parser.parseCompilationUnit();
+        }
 
         return std::shared_ptr<SyntaxTree>(new SyntaxTree(
-            guess ? &parser.parseGuess() : &parser.parseCompilationUnit(),
+            root,
             sourceManager,
             std::move(alloc),
             std::move(diagnostics),
@@ -122,6 +138,39 @@ private:
         ));
     }
 
+    static const SyntaxNode* parsePipelined(SourceManager& sourceManager, SourceBuffer source,
+                                            const Bag& options, bool guess, BumpAllocator& alloc,
+                                            Diagnostics& diagnostics) {
+        // The preprocessor runs on another thread, so it gets its own allocator and
+        // diagnostics while the parser is using ours. The filter can be changed by
+        // `pragma directives as they're preprocessed, so the parser's diagnostics
+        // are only checked against it once both threads are done.
+        BumpAllocator preprocessorAlloc;
+        Diagnostics preprocessorDiagnostics;
+        preprocessorDiagnostics.setFilter(diagnostics.getFilter());
+
+        Diagnostics parserDiagnostics;
+        const SyntaxNode* root;
+        {
+            Preprocessor preprocessor(sourceManager, preprocessorAlloc, preprocessorDiagnostics, options);
+            preprocessor.pushSource(source);
+
+            TokenPipeline pipeline(preprocessor);
+            Parser parser(pipeline, alloc, parserDiagnostics, options);
+            root = guess ? &parser.parseGuess() : &parser.parseCompilationUnit();
+        }
+
+        alloc.absorb(std::move(preprocessorAlloc));
+        diagnostics.appendRange(preprocessorDiagnostics.begin(), preprocessorDiagnostics.end());
+
+        auto filter = diagnostics.getFilter();
+        for (auto& diag : parserDiagnostics) {
+            if (!filter || !filter->isSuppressed(diag.code, diag.location))
+                diagnostics.append(diag);
+        }
+        return root;
+    }
+
     const SyntaxNode* rootNode;
     SourceManager& sourceMan;
     BumpAllocator alloc;
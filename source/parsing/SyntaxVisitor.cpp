@@ -0,0 +1,37 @@
+//------------------------------------------------------------------------------
+// SyntaxVisitor.cpp
+// Syntax tree visitor support.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#include "SyntaxVisitor.h"
+
+#include <thread>
+
+namespace slang::detail {
+
+uint32_t getParallelChunkCount(uint32_t itemCount, uint32_t threadCount) {
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    return std::max(1u, std::min(threadCount, itemCount));
+}
+
+void runParallelChunks(uint32_t itemCount, uint32_t chunkCount,
+                       const std::function<void(uint32_t, uint32_t, uint32_t)>& work) {
+    auto runChunk = [&](uint32_t index) {
+        uint32_t begin = uint32_t(uint64_t(itemCount) * index / chunkCount);
+        uint32_t end = uint32_t(uint64_t(itemCount) * (index + 1) / chunkCount);
+        work(index, begin, end);
+    };
+
+    // The calling thread handles the first chunk itself.
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < chunkCount; i++)
+        threads.emplace_back(runChunk, i);
+    runChunk(0);
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+}
@@ -6,36 +6,177 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <functional>
+
 #include "AllSyntax.h"
+#include "util/SmallVector.h"
 
 namespace slang {
 
 /// Use this type as a base class for syntax tree visitors. It will default to
 /// traversing all children of each node. Add implementations for any specific
 /// node types you want to handle.
+///
+/// In addition to the recursive visitNode / visitDefault style, the visitor
+/// supports a non-recursive walk via @a traverse, which keeps its own explicit
+/// stack and so handles arbitrarily deep trees. The derived class can provide
+/// public preVisit and postVisit hooks for any node types it cares about:
+///
+///     VisitAction preVisit(const BinaryExpressionSyntax& node);
+///     void postVisit(const BinaryExpressionSyntax& node);
+///
+/// Overloads taking `const SyntaxNode&` catch every node type.
 template<typename TDerived>
 class SyntaxVisitor {
+    HAS_METHOD_TRAIT(preVisit);
+    HAS_METHOD_TRAIT(postVisit);
+
 public:
     void visitNode(const SyntaxNode* node) {
         dispatchVisitor(*static_cast<TDerived*>(this), node);
     }
 
     void visitDefault(const SyntaxNode& node) {
-        for (uint32_t i = 0; i < node.getChildCount(); i++) {
-            auto child = node.childNode(i);
-            if (child)
-                visitNode(node.childNode(i));
-            else {
-                auto token = node.childToken(i);
-                if (token)
-                    static_cast<TDerived*>(this)->visitToken(token);
+        uint32_t childCount = node.getChildCount();
+        for (uint32_t i = 0; i < childCount; i++) {
+            auto child = node.getChild(i);
+            if (!child.isToken) {
+                if (child.node)
+                    visitNode(child.node);
+            }
+            else if (child.token) {
+                static_cast<TDerived*>(this)->visitToken(child.token);
             }
         }
     }
 
+    /// Walks the tree rooted at @a root without recursion. preVisit is called for
+    /// each node on the way down, and its result controls whether the children are
+    /// visited. postVisit is called once all of a node's children have been visited,
+    /// for every node that was pre-visited (including ones whose children were skipped).
+    /// Tokens are passed to visitToken in source order.
+    /// @return false if a preVisit hook returned VisitAction::Stop, otherwise true.
+    bool traverse(const SyntaxNode& root) {
+        auto& derived = *static_cast<TDerived*>(this);
+
+        SmallVectorSized<TraversalEntry, 32> stack;
+        stack.emplace(TraversalEntry{ &root, false });
+
+        while (!stack.empty()) {
+            TraversalEntry entry = stack.back();
+            stack.pop();
+
+            if (entry.item.isToken) {
+                derived.visitToken(entry.item.token);
+                continue;
+            }
+
+            const SyntaxNode* node = entry.item.node;
+            if (entry.exiting) {
+                PostVisitor post{ derived };
+                dispatchVisitor(post, node);
+                continue;
+            }
+
+            PreVisitor pre{ derived };
+            dispatchVisitor(pre, node);
+            if (pre.result == VisitAction::Stop)
+                return false;
+
+            stack.emplace(TraversalEntry{ node, true });
+            if (pre.result == VisitAction::SkipChildren)
+                continue;
+
+            // Push in reverse so that children come off the stack in source order.
+            for (uint32_t i = node->getChildCount(); i > 0; i--) {
+                auto child = node->getChild(i - 1);
+                if (child.isToken ? bool(child.token) : child.node != nullptr)
+                    stack.emplace(TraversalEntry{ child, false });
+            }
+        }
+        return true;
+    }
+
 private:
     // This is to make things compile if the derived class doesn't provide an implementation.
     void visitToken(Token) {}
+
+    struct TraversalEntry {
+        TokenOrSyntax item;
+        bool exiting;
+    };
+
+    // Adapters that let dispatchVisitor resolve the concrete node type
+    // before forwarding to the derived class's hooks.
+    struct PreVisitor {
+        TDerived& derived;
+        VisitAction result = VisitAction::Continue;
+
+        template<typename T>
+        void visit(const T& node) {
+            if constexpr (has_preVisit_v<TDerived, VisitAction, const T&>)
+                result = derived.preVisit(node);
+        }
+
+        void visitDefault(const SyntaxNode& node) { visit(node); }
+    };
+
+    struct PostVisitor {
+        TDerived& derived;
+
+        template<typename T>
+        void visit(const T& node) {
+            if constexpr (has_postVisit_v<TDerived, void, const T&>)
+                derived.postVisit(node);
+        }
+
+        void visitDefault(const SyntaxNode& node) { visit(node); }
+    };
 };
 
+namespace detail {
+
+/// Gets the number of chunks to split @a itemCount items into when running on
+/// @a threadCount threads, where zero means the number of hardware threads.
+uint32_t getParallelChunkCount(uint32_t itemCount, uint32_t threadCount);
+
+/// Splits @a itemCount items into @a chunkCount contiguous chunks and calls @a work
+/// for each one on its own thread, passing the chunk index and its item range.
+void runParallelChunks(uint32_t itemCount, uint32_t chunkCount,
+                       const std::function<void(uint32_t, uint32_t, uint32_t)>& work);
+
+}
+
+/// Traverses the members of a compilation unit in parallel. The members are split
+/// into contiguous chunks, one per thread, and each thread walks its chunk with its
+/// own visitor created by calling @a factory. Syntax trees are immutable once built,
+/// so the visitors can safely run concurrently as long as they don't share state.
+/// A visitor that stops its traversal only ends the walk of its own chunk.
+/// @param threadCount the number of threads to use; zero means use the number of
+/// hardware threads available.
+/// @return the visitors used, in member order, so that their results can be merged.
+template<typename TFactory>
+auto traverseMembersParallel(const CompilationUnitSyntax& unit, TFactory&& factory,
+                             uint32_t threadCount = 0) {
+    using TVisitor = decltype(factory());
+
+    const auto& members = unit.members;
+    threadCount = detail::getParallelChunkCount(members.count(), threadCount);
+
+    std::vector<TVisitor> visitors;
+    visitors.reserve(threadCount);
+    for (uint32_t i = 0; i < threadCount; i++)
+        visitors.emplace_back(factory());
+
+    detail::runParallelChunks(members.count(), threadCount,
+                              [&](uint32_t index, uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; i++) {
+            if (!visitors[index].traverse(*members[i]))
+                break;
+        }
+    });
+
+    return visitors;
+}
+
 }
@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+// TokenPipeline.cpp
+// Runs the preprocessor on a separate thread from the parser.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#include "TokenPipeline.h"
+
+#include "lexing/Preprocessor.h"
+#include "util/TimeTrace.h"
+
+namespace {
+
+// The number of times a side checks for progress (yielding in between) before
+// it gives up and goes to sleep.
+constexpr int SpinLimit = 64;
+
+}
+
+namespace slang {
+
+TokenPipeline::TokenPipeline(Preprocessor& preprocessor) :
+    preprocessor(preprocessor), ring(new Token[Capacity])
+{
+    thread = std::thread([this] { produce(); });
+}
+
+TokenPipeline::~TokenPipeline() {
+    stopRequested.store(true);
+    wake(producerWaiting, producerReady);
+    thread.join();
+}
+
+Token TokenPipeline::next() {
+    if (endOfFile)
+        return endOfFile;
+
+    if (consumed == available) {
+        // Hand the slots we've read back to the producer before waiting for more.
+        readPosition.store(consumed);
+        wake(producerWaiting, producerReady);
+        wait(consumerWaiting, consumerReady, [this] {
+            available = writePosition.load();
+            return available != consumed || failed.load();
+        });
+
+        if (available == consumed)
+            std::rethrow_exception(error);
+    }
+
+    Token token = ring[consumed % Capacity];
+    consumed++;
+    if (consumed % BatchSize == 0) {
+        readPosition.store(consumed);
+        wake(producerWaiting, producerReady);
+    }
+
+    if (token.kind == TokenKind::EndOfFile)
+        endOfFile = token;
+    return token;
+}
+
+void TokenPipeline::produce() {
+    TIME_SCOPE("Preprocess", "");
+    try {
+        size_t written = 0;
+        size_t readLimit = 0;
+        while (true) {
+            // Fill up a batch before publishing it. The ring is much bigger than a
+            // batch, so whenever we have to wait for room the consumer has plenty
+            // of published tokens to work on.
+            bool done = false;
+            for (size_t i = 0; i < BatchSize && !done; i++) {
+                if (written - readLimit >= Capacity) {
+                    writePosition.store(written);
+                    wake(consumerWaiting, consumerReady);
+                    wait(producerWaiting, producerReady, [&] {
+                        readLimit = readPosition.load();
+                        return written - readLimit < Capacity || stopRequested.load();
+                    });
+
+                    if (stopRequested.load())
+                        return;
+                }
+
+                Token token = preprocessor.next();
+                ring[written % Capacity] = token;
+                written++;
+                done = token.kind == TokenKind::EndOfFile;
+            }
+
+            writePosition.store(written);
+            wake(consumerWaiting, consumerReady);
+            if (done || stopRequested.load())
+                return;
+        }
+    }
+    catch (...) {
+        error = std::current_exception();
+        failed.store(true);
+        wake(consumerWaiting, consumerReady);
+    }
+}
+
+template<typename TReady>
+void TokenPipeline::wait(std::atomic<bool>& waiting, std::condition_variable& cv, TReady ready) {
+    for (int i = 0; i < SpinLimit; i++) {
+        if (ready())
+            return;
+        std::this_thread::yield();
+    }
+
+    // The flag and the positions are all sequentially consistent, so either the
+    // other side sees that we're waiting after it publishes its progress, or we
+    // see that progress when checking again here. Waking up takes the mutex, so
+    // it can't slip in between the check and the sleep.
+    std::unique_lock<std::mutex> lock(mutex);
+    waiting.store(true);
+    cv.wait(lock, ready);
+    waiting.store(false);
+}
+
+void TokenPipeline::wake(std::atomic<bool>& waiting, std::condition_variable& cv) {
+    if (waiting.load()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        cv.notify_one();
+    }
+}
+
+}
@@ -0,0 +1,88 @@
+//------------------------------------------------------------------------------
+// TokenPipeline.h
+// Runs the preprocessor on a separate thread from the parser.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "lexing/Token.h"
+
+namespace slang {
+
+class Preprocessor;
+
+/// Pulls tokens out of a preprocessor on a background thread and hands them to a
+/// parser on the calling thread, so that lexing and macro expansion overlap with
+/// parsing. Tokens are passed through a fixed size lock-free ring buffer that has
+/// exactly one producer and one consumer; each side only publishes its position
+/// once per batch of tokens to keep the two threads from fighting over cache lines.
+/// A side that finds the ring empty (or full) spins briefly and then goes to sleep
+/// until the other side makes progress, so that waiting doesn't burn a whole core.
+///
+/// While the pipeline is running the preprocessor belongs to the background thread:
+/// nothing else may touch it, its allocator, its diagnostics, or its source manager
+/// until the pipeline is destroyed. In particular the parser needs its own allocator
+/// and diagnostics.
+class TokenPipeline {
+public:
+    /// Starts preprocessing on a new thread.
+    explicit TokenPipeline(Preprocessor& preprocessor);
+
+    /// Stops the background thread (if it hasn't already reached the end of the
+    /// input) and waits for it to exit.
+    ~TokenPipeline();
+
+    TokenPipeline(const TokenPipeline&) = delete;
+    TokenPipeline& operator=(const TokenPipeline&) = delete;
+
+    /// Gets the next token, waiting for the background thread to produce it if
+    /// necessary. Once the end of the input has been reached this keeps returning
+    /// the EndOfFile token. If the preprocessor threw an exception, it is rethrown here.
+    Token next();
+
+private:
+    static constexpr size_t Capacity = 4096;
+    static constexpr size_t BatchSize = 64;
+    static_assert((Capacity & (Capacity - 1)) == 0 && Capacity > BatchSize);
+
+    void produce();
+
+    template<typename TReady>
+    void wait(std::atomic<bool>& waiting, std::condition_variable& cv, TReady ready);
+    void wake(std::atomic<bool>& waiting, std::condition_variable& cv);
+
+    Preprocessor& preprocessor;
+    std::unique_ptr<Token[]> ring;
+
+    // Positions are free running counters; the slot is the position modulo Capacity.
+    // Each is written by only one side, and they live on separate cache lines.
+    alignas(64) std::atomic<size_t> writePosition = 0;
+    alignas(64) std::atomic<size_t> readPosition = 0;
+    alignas(64) std::atomic<bool> stopRequested = false;
+    std::atomic<bool> failed = false;
+    std::exception_ptr error;
+
+    // Used to sleep when there's nothing to do; only touched on the slow path.
+    std::mutex mutex;
+    std::condition_variable producerReady;
+    std::condition_variable consumerReady;
+    std::atomic<bool> producerWaiting = false;
+    std::atomic<bool> consumerWaiting = false;
+
+    // Consumer side state.
+    size_t consumed = 0;
+    size_t available = 0;
+    Token endOfFile;
+
+    std::thread thread;
+};
+
+}
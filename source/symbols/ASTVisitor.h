@@ -6,6 +6,8 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <algorithm>
+
 #include "binding/Expressions.h"
 #include "binding/Statements.h"
 
@@ -18,9 +20,21 @@ namespace slang {
 /// Use this type as a base class for AST visitors. It will default to
 /// traversing all children of each node. Add implementations for any specific
 /// node types you want to handle.
+///
+/// For very deep trees, @a traverse walks symbols, statements, and expressions
+/// with an explicit stack instead of recursion. The derived class can provide
+/// public preVisit and postVisit hooks for the node types it cares about:
+///
+///     VisitAction preVisit(const BinaryExpression& expr);
+///     void postVisit(const BinaryExpression& expr);
+///
+/// Overloads taking `const Symbol&`, `const Statement&`, or `const Expression&`
+/// catch everything in that category.
 template<typename TDerived>
 class ASTVisitor {
     HAS_METHOD_TRAIT(handle);
+    HAS_METHOD_TRAIT(preVisit);
+    HAS_METHOD_TRAIT(postVisit);
 
 public:
 #define DERIVED *static_cast<TDerived*>(this)
@@ -49,6 +63,210 @@ public:
     }
 
 #undef DERIVED
+
+    /// Walks the tree rooted at @a root without recursion. Scopes yield their members
+    /// followed by their body, statements yield their sub-statements and expressions,
+    /// and expressions yield their operands. preVisit controls whether a node's children
+    /// are visited, and postVisit is called after all of them have been handled.
+    /// @return false if a preVisit hook returned VisitAction::Stop, otherwise true.
+    bool traverse(const Symbol& root) {
+        auto& derived = *static_cast<TDerived*>(this);
+
+        Stack stack;
+        stack.emplace(makeEntry(root, false));
+
+        while (!stack.empty()) {
+            TraversalEntry entry = stack.back();
+            stack.pop();
+
+            if (entry.exiting) {
+                PostVisitor post{ derived };
+                dispatch(entry, post);
+                continue;
+            }
+
+            PreVisitor pre{ derived, stack };
+            dispatch(entry, pre);
+            if (pre.result == VisitAction::Stop)
+                return false;
+        }
+        return true;
+    }
+
+private:
+    enum class EntryKind : uint8_t { Symbol, Statement, Expression };
+
+    struct TraversalEntry {
+        const void* node;
+        EntryKind kind;
+        bool exiting;
+    };
+
+    using Stack = SmallVectorSized<TraversalEntry, 64>;
+
+    static TraversalEntry makeEntry(const Symbol& symbol, bool exiting) {
+        return { &symbol, EntryKind::Symbol, exiting };
+    }
+
+    static TraversalEntry makeEntry(const Statement& stmt, bool exiting) {
+        return { &stmt, EntryKind::Statement, exiting };
+    }
+
+    static TraversalEntry makeEntry(const Expression& expr, bool exiting) {
+        return { &expr, EntryKind::Expression, exiting };
+    }
+
+    template<typename TVisitor>
+    static void dispatch(const TraversalEntry& entry, TVisitor& visitor) {
+        switch (entry.kind) {
+            case EntryKind::Symbol: static_cast<const Symbol*>(entry.node)->visit(visitor); break;
+            case EntryKind::Statement: static_cast<const Statement*>(entry.node)->visit(visitor); break;
+            case EntryKind::Expression: static_cast<const Expression*>(entry.node)->visit(visitor); break;
+        }
+    }
+
+    template<typename T>
+    static void pushOptional(Stack& stack, const T* node) {
+        if (node)
+            stack.emplace(makeEntry(*node, false));
+    }
+
+    // Pushes the children of the given node in their natural order.
+    template<typename T>
+    static void pushChildren(Stack& stack, const T& node) {
+        if constexpr (std::is_base_of_v<Scope, T>) {
+            for (const auto& member : node.members())
+                stack.emplace(makeEntry(member, false));
+
+            if constexpr (std::is_base_of_v<StatementBodiedScope, T>)
+                pushOptional(stack, node.getBody());
+        }
+        else if constexpr (std::is_same_v<T, Statement>) {
+            // The only statement dispatched as its base type is the invalid one.
+            if (node.kind == StatementKind::Invalid)
+                pushOptional(stack, node.template as<InvalidStatement>().child);
+        }
+        else if constexpr (std::is_same_v<T, StatementList>) {
+            for (auto stmt : node.list)
+                pushOptional(stack, stmt);
+        }
+        else if constexpr (std::is_same_v<T, ExpressionStatement>) {
+            stack.emplace(makeEntry(node.expr, false));
+        }
+        else if constexpr (std::is_same_v<T, ReturnStatement>) {
+            pushOptional(stack, node.expr);
+        }
+        else if constexpr (std::is_same_v<T, ConditionalStatement>) {
+            stack.emplace(makeEntry(node.cond, false));
+            stack.emplace(makeEntry(node.ifTrue, false));
+            pushOptional(stack, node.ifFalse);
+        }
+        else if constexpr (std::is_same_v<T, ForLoopStatement>) {
+            stack.emplace(makeEntry(node.initializers, false));
+            pushOptional(stack, node.stopExpr);
+            for (auto step : node.steps)
+                pushOptional(stack, step);
+            stack.emplace(makeEntry(node.body, false));
+        }
+        else if constexpr (std::is_same_v<T, InvalidExpression>) {
+            pushOptional(stack, node.child);
+        }
+        else if constexpr (std::is_same_v<T, UnaryExpression> ||
+                           std::is_same_v<T, ConversionExpression>) {
+            stack.emplace(makeEntry(node.operand(), false));
+        }
+        else if constexpr (std::is_same_v<T, BinaryExpression> ||
+                           std::is_same_v<T, AssignmentExpression>) {
+            stack.emplace(makeEntry(node.left(), false));
+            stack.emplace(makeEntry(node.right(), false));
+        }
+        else if constexpr (std::is_same_v<T, ConditionalExpression>) {
+            stack.emplace(makeEntry(node.pred(), false));
+            stack.emplace(makeEntry(node.left(), false));
+            stack.emplace(makeEntry(node.right(), false));
+        }
+        else if constexpr (std::is_same_v<T, ConcatenationExpression>) {
+            for (auto operand : node.operands())
+                pushOptional(stack, operand);
+        }
+        else if constexpr (std::is_same_v<T, ReplicationExpression>) {
+            stack.emplace(makeEntry(node.count(), false));
+            stack.emplace(makeEntry(node.concat(), false));
+        }
+        else if constexpr (std::is_same_v<T, ElementSelectExpression>) {
+            stack.emplace(makeEntry(node.value(), false));
+            stack.emplace(makeEntry(node.selector(), false));
+        }
+        else if constexpr (std::is_same_v<T, RangeSelectExpression>) {
+            stack.emplace(makeEntry(node.value(), false));
+            stack.emplace(makeEntry(node.left(), false));
+            stack.emplace(makeEntry(node.right(), false));
+        }
+        else if constexpr (std::is_same_v<T, MemberAccessExpression>) {
+            stack.emplace(makeEntry(node.value(), false));
+        }
+        else if constexpr (std::is_same_v<T, CallExpression>) {
+            for (auto arg : node.arguments())
+                pushOptional(stack, arg);
+        }
+        else if constexpr (std::is_base_of_v<Statement, T> || std::is_base_of_v<Expression, T>) {
+            // Everything left has no children to walk. Block and variable declaration
+            // statements refer to symbols that are members of the enclosing scope,
+            // so those get reached from there instead. This list has to be kept in
+            // sync with the visit() dispatch; a new kind that isn't handled above
+            // fails to compile here.
+            static_assert(std::is_same_v<T, SequentialBlockStatement> ||
+                          std::is_same_v<T, VariableDeclStatement> ||
+                          std::is_same_v<T, IntegerLiteral> ||
+                          std::is_same_v<T, RealLiteral> ||
+                          std::is_same_v<T, UnbasedUnsizedIntegerLiteral> ||
+                          std::is_same_v<T, NullLiteral> ||
+                          std::is_same_v<T, StringLiteral> ||
+                          std::is_same_v<T, NamedValueExpression> ||
+                          std::is_same_v<T, DataTypeExpression>,
+                          "pushChildren doesn't know the children of this node type");
+        }
+    }
+
+    // Adapters that receive the concrete node type from the various visit
+    // dispatch functions and forward to the derived class's hooks.
+    struct PreVisitor {
+        TDerived& derived;
+        Stack& stack;
+        VisitAction result = VisitAction::Continue;
+
+        template<typename T>
+        void visit(const T& node) {
+            if constexpr (has_preVisit_v<TDerived, VisitAction, const T&>)
+                result = derived.preVisit(node);
+
+            if (result == VisitAction::Stop)
+                return;
+
+            stack.emplace(makeEntry(node, true));
+            if (result == VisitAction::SkipChildren)
+                return;
+
+            // Reverse the new entries so that children come off the stack in order.
+            uint32_t first = stack.size();
+            pushChildren(stack, node);
+            std::reverse(stack.begin() + first, stack.end());
+        }
+
+        void visitInvalid(const Expression& expr) { visit(expr.as<InvalidExpression>()); }
+    };
+
+    struct PostVisitor {
+        TDerived& derived;
+
+        template<typename T>
+        void visit(const T& node) {
+            if constexpr (has_postVisit_v<TDerived, void, const T&>)
+                derived.postVisit(node);
+        }
+
+        void visitInvalid(const Expression& expr) { visit(expr.as<InvalidExpression>()); }
+    };
 };
 
 template<typename TVisitor, typename... Args>
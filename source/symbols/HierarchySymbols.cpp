@@ -9,7 +9,9 @@
 #include <nlohmann/json.hpp>
 
 #include "compilation/Compilation.h"
+#include "util/PerfCounters.h"
 #include "util/StackContainer.h"
+#include "util/TimeTrace.h"
 
 namespace slang {
 
@@ -169,7 +171,11 @@ bool InstanceSymbol::isKind(SymbolKind kind) {
     }
 }
 
-void InstanceSymbol::populate(const Definition& definition, span<const ParameterMetadata> parameters) {
+void InstanceSymbol::populate(const Definition& def, span<const ParameterMetadata> parameters) {
+    TIME_SCOPE("Instantiate", def.name);
+    PerfCounters::increment(PerfCounter::Instances);
+    definition = &def;
+
     // Add all port parameters as members first.
     Compilation& comp = getCompilation();
     auto paramIt = parameters.begin();
@@ -188,7 +194,7 @@ void InstanceSymbol::populate(const Definition& definition, span<const Parameter
         paramIt++;
     }
 
-    const PortListSyntax* portSyntax = definition.syntax.header.ports;
+    const PortListSyntax* portSyntax = def.syntax.header.ports;
     if (portSyntax) {
         switch (portSyntax->kind) {
             case SyntaxKind::AnsiPortList:
@@ -202,7 +208,7 @@ void InstanceSymbol::populate(const Definition& definition, span<const Parameter
         }
     }
 
-    for (auto member : definition.syntax.members) {
+    for (auto member : def.syntax.members) {
         // If this is a parameter declaration, we should already have metadata for it in our parameters list.
         // The list is given in declaration order, so we should be be able to move through them incrementally.
         if (member->kind != SyntaxKind::ParameterDeclarationStatement)
@@ -516,12 +522,20 @@ GenerateBlockArraySymbol& GenerateBlockArraySymbol::fromSyntax(Compilation& comp
     const auto& iterExpr = Expression::bind(compilation, syntax.iterationExpr, BindContext(iterScope, LookupLocation::max));
 
     // Create storage for the iteration variable.
-    EvalContext context;
+    EvalContext context(compilation.getEvalOptions());
     auto genvar = context.createLocal(&local, *initial.constant);
 
     // Generate blocks!
+    uint32_t iterations = 0;
+    uint32_t maxIterations = compilation.getEvalOptions().maxGenerateIterations;
     SmallVectorSized<const Symbol*, 16> arrayEntries;
     for (; stopExpr.evalBool(context); iterExpr.eval(context)) {
+        if (iterations++ == maxIterations) {
+            compilation.addError(DiagCode::ExceededMaxGenerateIterations, syntax.stopExpr.sourceRange())
+                << maxIterations;
+            break;
+        }
+
         // Spec: each generate block gets their own scope, with an implicit
         // localparam of the same name as the genvar.
         // TODO: scope name
@@ -87,6 +87,9 @@ public:
     /// The set of ports exposed by the instance.
     span<const Port> ports;
 
+    /// The definition that the instance was created from.
+    const Definition* definition = nullptr;
+
 protected:
     InstanceSymbol(SymbolKind kind, Compilation& compilation, string_view name, SourceLocation loc) :
         Symbol(kind, name, loc),
@@ -106,7 +109,7 @@ protected:
         void add(const Port& port);
     };
 
-    void populate(const Definition& definition, span<const ParameterMetadata> parameters);
+    void populate(const Definition& def, span<const ParameterMetadata> parameters);
     void handleAnsiPorts(const AnsiPortListSyntax& syntax);
     void handleImplicitAnsiPort(const ImplicitAnsiPortSyntax& syntax, PortListBuilder& builder);
     void handleNonAnsiPorts(const NonAnsiPortListSyntax& syntax);
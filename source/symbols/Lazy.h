@@ -7,6 +7,7 @@
 #pragma once
 
 #include "symbols/Scope.h"
+#include "util/PerfCounters.h"
 #include "util/PointerUnion.h"
 
 namespace slang {
@@ -38,6 +39,7 @@ struct Lazy {
             return std::get<0>(cache);
 
         ASSERT(!evaluating);
+        PerfCounters::increment(PerfCounter::LazyEvaluations);
 
         evaluating = true;
         auto derived = static_cast<const TDerived*>(this);
@@ -75,16 +75,17 @@ std::tuple<const Type*, ConstantValue> ParameterSymbol::evaluate(const DataTypeS
 
     // If no type is given, infer the type from the initializer.
     Compilation& comp = scope.getCompilation();
+    EvalContext evalContext(comp.getEvalOptions());
     if (type.kind == SyntaxKind::ImplicitType) {
         const auto& bound = Expression::bind(comp, expr, BindContext(scope, location, BindFlags::Constant));
-        return std::make_tuple(bound.type, bound.eval());
+        return std::make_tuple(bound.type, bound.eval(evalContext));
     }
 
     const Type& t = comp.getType(type, location, scope);
     const Expression& assignment = Expression::bind(comp, t, expr, expr.getFirstToken().location(),
                                                     BindContext(scope, location, BindFlags::Constant));
 
-    return std::make_tuple(&t, assignment.eval());
+    return std::make_tuple(&t, assignment.eval(evalContext));
 }
 
 const Type& ParameterSymbol::getType() const {
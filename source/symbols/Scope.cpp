@@ -8,6 +8,7 @@
 
 #include "compilation/Compilation.h"
 #include "symbols/Symbol.h"
+#include "util/PerfCounters.h"
 #include "util/StackContainer.h"
 
 namespace {
@@ -78,6 +79,7 @@ Scope::Scope(Compilation& compilation_, const Symbol* thisSym_) :
     compilation(compilation_), thisSym(thisSym_),
     nameMap(compilation.allocSymbolMap())
 {
+    PerfCounters::increment(PerfCounter::Scopes);
 }
 
 Scope::iterator& Scope::iterator::operator++() {
@@ -252,6 +254,7 @@ const Symbol* Scope::find(string_view name) const {
 
 void Scope::lookupName(const NameSyntax& syntax, LookupLocation location, LookupNameKind nameKind,
                        bitmask<LookupFlags> flags, LookupResult& result) const {
+    PerfCounters::increment(PerfCounter::NameLookups);
     Token nameToken;
     const SyntaxList<ElementSelectSyntax>* selectors = nullptr;
     switch (syntax.kind) {
@@ -403,6 +406,19 @@ void Scope::insertMember(const Symbol* member, const Symbol* at) const {
     }
 }
 
+void Scope::clearMembers() {
+    const Symbol* member = firstMember;
+    while (member) {
+        member->parentScope = nullptr;
+        member->indexInScope = Symbol::Index{ 0 };
+        member = std::exchange(member->nextInScope, nullptr);
+    }
+
+    firstMember = nullptr;
+    lastMember = nullptr;
+    nameMap->clear();
+}
+
 void Scope::elaborate() const {
     ASSERT(deferredMemberIndex != DeferredMemberIndex::Invalid);
     auto deferredData = compilation.getOrAddDeferredData(deferredMemberIndex);
@@ -529,6 +545,8 @@ void Scope::lookupUnqualified(string_view name, LookupLocation location, LookupN
     if (name.empty())
         return;
 
+    PerfCounters::increment(PerfCounter::LookupScopesSearched);
+
     // Try a simple name lookup to see if we find anything.
     const Symbol* symbol = nullptr;
     if (auto it = nameMap->find(name); it != nameMap->end()) {
@@ -603,6 +621,7 @@ void Scope::lookupUnqualified(string_view name, LookupLocation location, LookupN
         if (!package)
             continue;
 
+        PerfCounters::increment(PerfCounter::WildcardImportProbes);
         const Symbol* imported = package->find(name);
         if (imported)
             imports.emplace(Import { imported, import });
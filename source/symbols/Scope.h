@@ -326,6 +326,10 @@ private:
     // the given symbol. If `at` is null, it will insert at the head of the list.
     void insertMember(const Symbol* member, const Symbol* at) const;
 
+    // Detaches all members from the scope, leaving it empty. The Compilation uses this
+    // to rebuild the root scope when a syntax tree gets replaced.
+    void clearMembers();
+
     // Gets or creates deferred member data in the Compilation object's sideband table.
     DeferredMemberData& getOrAddDeferredData();
 
@@ -8,6 +8,7 @@
 
 #include "diagnostics/Diagnostics.h"
 #include "text/SourceLocation.h"
+#include "util/PerfCounters.h"
 #include "util/Util.h"
 
 namespace slang {
@@ -129,7 +130,9 @@ public:
 
 protected:
     explicit Symbol(SymbolKind kind, string_view name, SourceLocation location) :
-        kind(kind), name(name), location(location) {}
+        kind(kind), name(name), location(location) {
+        PerfCounters::increment(PerfCounter::Symbols);
+    }
 
     Symbol(const Symbol&) = delete;
 
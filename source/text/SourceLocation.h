@@ -15,7 +15,8 @@ class SourceManager;
 /// Buffers can either be source code loaded from a file, assigned
 /// from text in memory, or they can represent a macro expansion.
 /// Each time a macro is expanded a new BufferID is allocated to track
-/// the expansion location and original definition location.
+/// the expansion location and original definition location. File buffers
+/// and macro expansions are numbered independently of each other.
 struct BufferID {
     bool valid() const { return id != 0; }
     bool operator==(const BufferID& rhs) const { return id == rhs.id; }
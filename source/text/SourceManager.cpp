@@ -6,8 +6,10 @@
 //------------------------------------------------------------------------------
 #include "SourceManager.h"
 
+#include <cstring>
 #include <fstream>
 
+#include "util/PerfCounters.h"
 #include "util/StackContainer.h"
 
 namespace slang {
@@ -15,7 +17,7 @@ namespace slang {
 SourceManager::SourceManager() {
     // add a dummy entry to the start of the directory list so that our file IDs line up
     FileInfo file;
-    bufferEntries.emplace_back(file);
+    fileEntries.emplace_back(file);
 }
 
 std::string SourceManager::makeAbsolutePath(string_view path) const {
@@ -50,13 +52,12 @@ uint32_t SourceManager::getColumnNumber(SourceLocation location) const {
     if (!fd)
         return 0;
 
-    // walk backward to find start of line
-    uint32_t lineStart = location.offset();
-    ASSERT(lineStart < fd->mem.size());
-    while (lineStart > 0 && fd->mem[lineStart - 1] != '\n' && fd->mem[lineStart - 1] != '\r')
-        lineStart--;
+    // find the start of the line from the line offset table
+    ASSERT(location.offset() < fd->mem.size());
+    fd->computeLineOffsets(location.offset());
+    auto it = std::upper_bound(fd->lineOffsets.begin(), fd->lineOffsets.end(), location.offset());
 
-    return location.offset() - lineStart + 1;
+    return location.offset() - *(it - 1) + 1;
 }
 
 string_view SourceManager::getFileName(SourceLocation location) const {
@@ -85,29 +86,20 @@ string_view SourceManager::getRawFileName(BufferID buffer) const {
 }
 
 SourceLocation SourceManager::getIncludedFrom(BufferID buffer) const {
-    if (!buffer)
+    if (!buffer || (buffer.id & MacroBufferBit))
         return SourceLocation();
 
-    ASSERT(buffer.id < bufferEntries.size());
-    return std::get<FileInfo>(bufferEntries[buffer.id]).includedFrom;
+    ASSERT(buffer.id < fileEntries.size());
+    return fileEntries[buffer.id].includedFrom;
 }
 
 bool SourceManager::isFileLoc(SourceLocation location) const {
     auto buffer = location.buffer();
-    if (!buffer)
-        return false;
-
-    ASSERT(buffer.id < bufferEntries.size());
-    return std::get_if<FileInfo>(&bufferEntries[buffer.id]) != nullptr;
+    return buffer && (buffer.id & MacroBufferBit) == 0;
 }
 
 bool SourceManager::isMacroLoc(SourceLocation location) const {
-    auto buffer = location.buffer();
-    if (!buffer)
-        return false;
-
-    ASSERT(buffer.id < bufferEntries.size());
-    return std::get_if<ExpansionInfo>(&bufferEntries[buffer.id]) != nullptr;
+    return (location.buffer().id & MacroBufferBit) != 0;
 }
 
 bool SourceManager::isIncludedFileLoc(SourceLocation location) const {
@@ -119,8 +111,15 @@ bool SourceManager::isBeforeInCompilationUnit(SourceLocation left, SourceLocatio
     if (left.buffer() == right.buffer())
         return left.offset() < right.offset();
 
-    // TODO: add a cache for this?
+    // If they resolve to different spots in the flattened compilation unit we
+    // can just compare their memoized positions.
+    uint64_t leftPos = getCompilationUnitPosition(left);
+    uint64_t rightPos = getCompilationUnitPosition(right);
+    if (leftPos != rightPos)
+        return leftPos < rightPos;
 
+    // Otherwise they come from the same top-level macro expansion, so walk
+    // up the expansion chain to find where they diverge.
     auto moveUp = [this](SourceLocation& sl) {
         if (sl && !isFileLoc(sl))
             sl = getExpansionLoc(sl);
@@ -133,7 +132,6 @@ bool SourceManager::isBeforeInCompilationUnit(SourceLocation left, SourceLocatio
         return false;
     };
 
-    // Otherwise we have to build the full include / expansion chain and compare.
     SmallMap<BufferID, uint32_t, 16> leftChain;
     do {
         leftChain.emplace(left.buffer(), left.offset());
@@ -149,19 +147,47 @@ bool SourceManager::isBeforeInCompilationUnit(SourceLocation left, SourceLocatio
     if (it != leftChain.end())
         left = SourceLocation(it->first, it->second);
 
-    // At this point, we either have a nearest common ancestor, or the two
-    // locations are simply in totally different compilation units.
+    // At this point we must have found a nearest common ancestor.
     ASSERT(left.buffer() == right.buffer());
     return left.offset() < right.offset();
 }
 
+uint64_t SourceManager::getCompilationUnitPosition(SourceLocation location) const {
+    SourceLocation fileLoc = getFullyExpandedLoc(location);
+    if (!fileLoc)
+        return 0;
+
+    if (bufferPositions.size() != fileEntries.size())
+        computeBufferPositions();
+
+    ASSERT(fileLoc.buffer().getId() < bufferPositions.size());
+    const BufferPosition& pos = bufferPositions[fileLoc.buffer().getId()];
+    uint64_t result = pos.start + fileLoc.offset();
+
+    // Skip over the text of anything included before this location.
+    auto begin = includePositions.begin() + pos.firstInclude;
+    auto end = begin + pos.includeCount;
+    auto it = std::lower_bound(begin, end, fileLoc.offset(),
+                               [](const IncludePosition& ip, uint32_t offset) { return ip.offset < offset; });
+    if (it != begin)
+        result += (it - 1)->shift;
+
+    return result;
+}
+
+uint32_t SourceManager::getExpansionDepth(SourceLocation location) const {
+    if (!isMacroLoc(location))
+        return 0;
+
+    return getExpansionInfo(location.buffer()).depth;
+}
+
 SourceLocation SourceManager::getExpansionLoc(SourceLocation location) const {
     auto buffer = location.buffer();
     if (!buffer)
         return SourceLocation();
 
-    ASSERT(buffer.id < bufferEntries.size());
-    return std::get<ExpansionInfo>(bufferEntries[buffer.id]).expansionStart;
+    return getExpansionInfo(buffer).expansionStart;
 }
 
 SourceRange SourceManager::getExpansionRange(SourceLocation location) const {
@@ -169,9 +195,8 @@ SourceRange SourceManager::getExpansionRange(SourceLocation location) const {
     if (!buffer)
         return SourceRange();
 
-    ASSERT(buffer.id < bufferEntries.size());
-    const ExpansionInfo& info = std::get<ExpansionInfo>(bufferEntries[buffer.id]);
-    return SourceRange(info.expansionStart, info.expansionEnd);
+    const ExpansionInfo& info = getExpansionInfo(buffer);
+    return SourceRange(info.expansionStart, info.expansionStart + (size_t)info.expansionLength);
 }
 
 SourceLocation SourceManager::getOriginalLoc(SourceLocation location) const {
@@ -179,14 +204,13 @@ SourceLocation SourceManager::getOriginalLoc(SourceLocation location) const {
     if (!buffer)
         return SourceLocation();
 
-    ASSERT(buffer.id < bufferEntries.size());
-    return std::get<ExpansionInfo>(bufferEntries[buffer.id]).originalLoc + (size_t)location.offset();
+    return getExpansionInfo(buffer).originalLoc + (size_t)location.offset();
 }
 
 SourceLocation SourceManager::getFullyExpandedLoc(SourceLocation location) const {
-    while (isMacroLoc(location))
-        location = getExpansionLoc(location);
-    return location;
+    if (!isMacroLoc(location))
+        return location;
+    return getExpansionInfo(location.buffer()).fileLoc;
 }
 
 string_view SourceManager::getSourceText(BufferID buffer) const {
@@ -199,8 +223,23 @@ string_view SourceManager::getSourceText(BufferID buffer) const {
 
 SourceLocation SourceManager::createExpansionLoc(SourceLocation originalLoc, SourceLocation expansionStart,
                                                  SourceLocation expansionEnd) {
-    bufferEntries.emplace_back(ExpansionInfo(originalLoc, expansionStart, expansionEnd));
-    return SourceLocation(BufferID::get((uint32_t)(bufferEntries.size() - 1)), 0);
+    ASSERT(expansionStart.buffer() == expansionEnd.buffer());
+    ASSERT(expansionStart.offset() <= expansionEnd.offset());
+    ASSERT(expansionEntries.size() < MacroBufferBit);
+
+    // Nested expansions just inherit the file location of the expansion they live in.
+    SourceLocation fileLoc = expansionStart;
+    uint32_t depth = 1;
+    if (isMacroLoc(expansionStart)) {
+        auto& parent = getExpansionInfo(expansionStart.buffer());
+        fileLoc = parent.fileLoc;
+        depth = parent.depth + 1;
+    }
+
+    PerfCounters::increment(PerfCounter::ExpansionLocations);
+    expansionEntries.emplace_back(originalLoc, expansionStart,
+                                  expansionEnd.offset() - expansionStart.offset(), fileLoc, depth);
+    return SourceLocation(BufferID::get((uint32_t)(expansionEntries.size() - 1) | MacroBufferBit), 0);
 }
 
 SourceBuffer SourceManager::assignText(string_view text, SourceLocation includedFrom) {
@@ -238,12 +277,12 @@ SourceBuffer SourceManager::readHeader(string_view path, SourceLocation included
     ASSERT(!path.empty());
     fs::path p = path;
     if (p.is_absolute())
-        return openCached(p, includedFrom);
+        return openHeader(p, includedFrom);
 
     // system path lookups only look in system directories
     if (isSystemPath) {
         for (auto& d : systemDirectories) {
-            SourceBuffer result = openCached(d / p, includedFrom);
+            SourceBuffer result = openHeader(d / p, includedFrom);
             if (result.id)
                 return result;
         }
@@ -253,14 +292,14 @@ SourceBuffer SourceManager::readHeader(string_view path, SourceLocation included
     // search relative to the current file
     FileData* fd = getFileData(includedFrom.buffer());
     if (fd && fd->directory) {
-        SourceBuffer result = openCached((*fd->directory) / p, includedFrom);
+        SourceBuffer result = openHeader((*fd->directory) / p, includedFrom);
         if (result.id)
             return result;
     }
 
     // search additional include directories
     for (auto& d : userDirectories) {
-        SourceBuffer result = openCached(d / p, includedFrom);
+        SourceBuffer result = openHeader(d / p, includedFrom);
         if (result.id)
             return result;
     }
@@ -286,23 +325,109 @@ void SourceManager::addLineDirective(SourceLocation location, uint32_t lineNum,
     fd->lineDirectives.emplace_back(full.string(), sourceLineNum, lineNum, level);
 }
 
+SourceManager::MemoryStats SourceManager::getMemoryStats() const {
+    MemoryStats stats;
+    auto addFile = [&stats](const FileData& fd) {
+        stats.fileCount++;
+        stats.textBytes += fd.mem.capacity();
+        stats.lineTableBytes += fd.lineOffsets.capacity() * sizeof(uint32_t);
+    };
+
+    for (auto& [name, fd] : lookupCache) {
+        (void)name;
+        if (fd)
+            addFile(*fd);
+    }
+    for (auto& fd : userFileBuffers)
+        addFile(fd);
+
+    stats.bufferCount = fileEntries.size();
+    stats.expansionCount = expansionEntries.size();
+    stats.bookkeepingBytes = fileEntries.size() * sizeof(FileInfo) +
+                             expansionEntries.capacity() * sizeof(ExpansionInfo) +
+                             bufferPositions.capacity() * sizeof(BufferPosition) +
+                             includePositions.capacity() * sizeof(IncludePosition);
+    return stats;
+}
+
 SourceManager::FileData* SourceManager::getFileData(BufferID buffer) const {
-    if (!buffer)
+    if (!buffer || (buffer.id & MacroBufferBit))
         return nullptr;
 
-    ASSERT(buffer.id < bufferEntries.size());
-    return std::get<FileInfo>(bufferEntries[buffer.id]).data;
+    ASSERT(buffer.id < fileEntries.size());
+    return fileEntries[buffer.id].data;
+}
+
+const SourceManager::ExpansionInfo& SourceManager::getExpansionInfo(BufferID buffer) const {
+    ASSERT(buffer.id & MacroBufferBit);
+    uint32_t index = buffer.id & ~MacroBufferBit;
+    ASSERT(index < expansionEntries.size());
+    return expansionEntries[index];
 }
 
 SourceBuffer SourceManager::createBufferEntry(FileData* fd, SourceLocation includedFrom) {
     ASSERT(fd);
-    bufferEntries.emplace_back(FileInfo(fd, includedFrom));
+    ASSERT(fileEntries.size() < MacroBufferBit);
+    fileEntries.emplace_back(fd, includedFrom);
     return SourceBuffer {
         string_view(fd->mem.data(), fd->mem.size()),
-        BufferID::get((uint32_t)(bufferEntries.size() - 1))
+        BufferID::get((uint32_t)(fileEntries.size() - 1))
     };
 }
 
+void SourceManager::computeBufferPositions() const {
+    bufferPositions.clear();
+    bufferPositions.resize(fileEntries.size());
+    includePositions.clear();
+
+    // Included buffers are always created after the buffer that includes them,
+    // so walking backward lets us accumulate flattened sizes bottom up. Each
+    // include also takes up one extra position so that its text sorts strictly
+    // after the include directive itself.
+    std::vector<std::pair<SourceLocation, uint32_t>> includes;
+    for (size_t i = fileEntries.size() - 1; i > 0; i--) {
+        BufferPosition& pos = bufferPositions[i];
+        pos.size += fileEntries[i].data->mem.size();
+
+        SourceLocation from = getFullyExpandedLoc(fileEntries[i].includedFrom);
+        if (from) {
+            ASSERT(from.buffer().getId() < i);
+            bufferPositions[from.buffer().getId()].size += pos.size + 1;
+            includes.emplace_back(from, (uint32_t)i);
+        }
+    }
+
+    std::sort(includes.begin(), includes.end());
+
+    uint64_t shift = 0;
+    BufferID current;
+    for (auto& [from, index] : includes) {
+        BufferPosition& parent = bufferPositions[from.buffer().getId()];
+        if (from.buffer() != current) {
+            current = from.buffer();
+            parent.firstInclude = (uint32_t)includePositions.size();
+            shift = 0;
+        }
+
+        shift += bufferPositions[index].size + 1;
+        includePositions.push_back({ from.offset(), shift });
+        parent.includeCount++;
+    }
+
+    // Now lay out starting positions top down. Root buffers follow each other in
+    // creation order; position zero is reserved for invalid locations.
+    uint64_t nextRoot = 1;
+    for (size_t i = 1; i < fileEntries.size(); i++) {
+        SourceLocation from = getFullyExpandedLoc(fileEntries[i].includedFrom);
+        if (from)
+            bufferPositions[i].start = getCompilationUnitPosition(from) + 1;
+        else {
+            bufferPositions[i].start = nextRoot;
+            nextRoot += bufferPositions[i].size + 1;
+        }
+    }
+}
+
 SourceBuffer SourceManager::openCached(const fs::path& fullPath, SourceLocation includedFrom) {
     std::error_code ec;
     fs::path absPath = fs::canonical(fullPath, ec);
@@ -328,6 +453,13 @@ SourceBuffer SourceManager::openCached(const fs::path& fullPath, SourceLocation
     return cacheBuffer(std::move(absPath), includedFrom, std::move(buffer));
 }
 
+SourceBuffer SourceManager::openHeader(const fs::path& fullPath, SourceLocation includedFrom) {
+    SourceBuffer result = openCached(fullPath, includedFrom);
+    if (!result.id && trackIncludeMisses)
+        includeMisses.push_back(fullPath.string());
+    return result;
+}
+
 SourceBuffer SourceManager::cacheBuffer(const fs::path& path, SourceLocation includedFrom, std::vector<char>&& buffer) {
     std::string name;
     std::error_code ec;
@@ -347,24 +479,60 @@ SourceBuffer SourceManager::cacheBuffer(const fs::path& path, SourceLocation inc
     return createBufferEntry(fdPtr, includedFrom);
 }
 
-void SourceManager::computeLineOffsets(const std::vector<char>& buffer, std::vector<uint32_t>& offsets) {
+// Finds the next '\n' or '\r' character in [ptr, end). Most of the text in a file
+// isn't newlines, so check eight bytes at a time using the usual bit tricks
+// to detect whether any byte in a word matches.
+static const char* findNewline(const char* ptr, const char* end) {
+    constexpr uint64_t ones = 0x0101010101010101ull;
+    constexpr uint64_t highs = 0x8080808080808080ull;
+    constexpr uint64_t lf = ones * '\n';
+    constexpr uint64_t cr = ones * '\r';
+
+    while (end - ptr >= 8) {
+        uint64_t word;
+        memcpy(&word, ptr, sizeof(word));
+
+        uint64_t a = word ^ lf;
+        uint64_t b = word ^ cr;
+        if (((a - ones) & ~a & highs) | ((b - ones) & ~b & highs))
+            break;
+        ptr += 8;
+    }
+
+    while (ptr != end && *ptr != '\n' && *ptr != '\r')
+        ptr++;
+    return ptr;
+}
+
+void SourceManager::FileData::computeLineOffsets(uint32_t offset) {
+    static constexpr uint32_t ChunkSize = 1 << 16;
+
     // first line always starts at offset 0
-    offsets.push_back(0);
-
-    const char* ptr = buffer.data();
-    const char* end = buffer.data() + buffer.size();
-    while (ptr != end) {
-        if (ptr[0] == '\n' || ptr[0] == '\r') {
-            // if we see \r\n or \n\r skip both chars
-            if ((ptr[1] == '\n' || ptr[1] == '\r') && ptr[0] != ptr[1])
-                ptr++;
-            ptr++;
-            offsets.push_back((uint32_t)(ptr - buffer.data()));
-        }
-        else {
+    if (lineOffsets.empty())
+        lineOffsets.push_back(0);
+
+    if (offset < lineScanEnd || lineScanEnd >= mem.size())
+        return;
+
+    // Scan up through the end of the chunk containing the requested offset.
+    size_t limit = std::min(mem.size(), ((size_t)offset / ChunkSize + 1) * ChunkSize);
+    const char* ptr = mem.data() + lineScanEnd;
+    const char* end = mem.data() + limit;
+    const char* bufferEnd = mem.data() + mem.size();
+
+    while ((ptr = findNewline(ptr, end)) != end) {
+        // if we see \r\n or \n\r skip both chars
+        if (ptr + 1 != bufferEnd && (ptr[1] == '\n' || ptr[1] == '\r') && ptr[0] != ptr[1])
             ptr++;
-        }
+        ptr++;
+        lineOffsets.push_back((uint32_t)(ptr - mem.data()));
+
+        // A skipped pair can carry us just past the end of the chunk.
+        if (ptr > end)
+            end = ptr;
     }
+
+    lineScanEnd = (uint32_t)(end - mem.data());
 }
 
 bool SourceManager::readFile(const fs::path& path, std::vector<char>& buffer) {
@@ -416,8 +584,7 @@ uint32_t SourceManager::getRawLineNumber(SourceLocation location) const {
         return 0;
 
     // compute line offsets if we haven't already
-    if (fd->lineOffsets.empty())
-        computeLineOffsets(fd->mem, fd->lineOffsets);
+    fd->computeLineOffsets(location.offset());
 
     // Find the first line offset that is greater than the given location offset. That iterator
     // then tells us how many lines away from the beginning we are.
@@ -84,6 +84,13 @@ public:
     /// all macros and include files have been expanded out into a flat file.
     bool isBeforeInCompilationUnit(SourceLocation left, SourceLocation right) const;
 
+    /// Gets the position of the given location within the "compilation unit space"
+    /// (see isBeforeInCompilationUnit). Comparing two positions gives the same result
+    /// as comparing the locations, except that all locations that expand to the same
+    /// spot in a file (such as the tokens of a single macro expansion) share a position.
+    /// Separate compilation units are ordered by the creation order of their root buffers.
+    uint64_t getCompilationUnitPosition(SourceLocation location) const;
+
     /// Gets the expansion location of a given macro location.
     SourceLocation getExpansionLoc(SourceLocation location) const;
 
@@ -97,6 +104,10 @@ public:
     /// file expansion location. Otherwise just returns the location itself.
     SourceLocation getFullyExpandedLoc(SourceLocation location) const;
 
+    /// Gets the number of nested macro expansions that the given location lives in,
+    /// which is zero for anything that isn't a macro location.
+    uint32_t getExpansionDepth(SourceLocation location) const;
+
     /// Gets the actual source text for a given file buffer.
     string_view getSourceText(BufferID buffer) const;
 
@@ -121,9 +132,33 @@ public:
     /// Read in a header file from disk.
     SourceBuffer readHeader(string_view path, SourceLocation includedFrom, bool isSystemPath);
 
+    /// Sets whether readHeader should remember every path it tried that didn't exist.
+    /// Tools that cache include resolution use these to notice when a newly created
+    /// file would cause an include to resolve somewhere else.
+    void setTrackIncludeMisses(bool enabled) { trackIncludeMisses = enabled; }
+
+    /// Gets the paths recorded while tracking include misses, in the order they were tried.
+    span<const std::string> getIncludeMisses() const { return includeMisses; }
+
     /// Adds a line directive at the given location.
     void addLineDirective(SourceLocation location, uint32_t lineNum, string_view name, uint8_t level);
 
+    /// A summary of the memory held by the source manager.
+    struct MemoryStats {
+        size_t fileCount = 0;           ///< Number of distinct files (or text buffers) loaded.
+        size_t textBytes = 0;           ///< Memory holding source text.
+        size_t lineTableBytes = 0;      ///< Memory holding cached line offsets.
+        size_t bufferCount = 0;         ///< Number of file buffer entries, one per include.
+        size_t expansionCount = 0;      ///< Number of macro expansion entries.
+        size_t bookkeepingBytes = 0;    ///< Memory holding buffer and expansion tables.
+
+        size_t totalBytes() const { return textBytes + lineTableBytes + bookkeepingBytes; }
+    };
+
+    /// Gets statistics about the memory used by the source manager. This
+    /// counts the capacity of its internal tables rather than just what is in use.
+    MemoryStats getMemoryStats() const;
+
 private:
     uint32_t unnamedBufferCount = 0;
 
@@ -144,9 +179,10 @@ private:
     public:
         std::string name;                               // name of the file
         std::vector<char> mem;                          // file contents
-        std::vector<uint32_t> lineOffsets;              // cache of compute line offsets
+        std::vector<uint32_t> lineOffsets;              // cache of computed line offsets
         std::vector<LineDirectiveInfo> lineDirectives;  // cache of line directives
         const fs::path* directory;                      // directory in which the file exists
+        uint32_t lineScanEnd = 0;                       // how much of mem lineOffsets covers
 
         FileData(const fs::path* directory, std::string name, std::vector<char>&& data) :
             name(std::move(name)),
@@ -156,6 +192,11 @@ private:
         // Returns a pointer to the LineDirectiveInfo for the nearest enclosing
         // line directive of the given raw line number, or nullptr if there is none
         const LineDirectiveInfo* getPreviousLineDirective(uint32_t rawLineNumber) const;
+
+        // Makes sure that lineOffsets contains every line start up to and including
+        // the given offset. The file is scanned lazily in chunks so that looking up
+        // a location near the start of a huge file doesn't require reading all of it.
+        void computeLineOffsets(uint32_t offset);
     };
 
     // Stores a pointer to file data along with information about where we included it.
@@ -176,18 +217,57 @@ private:
     // the expansion site. Alternatively, if this token came from an argument,
     // originalLocation will point to the argument at the expansion site and
     // expansionLocation will point to the parameter inside the macro body.
+    //
+    // A whole expansion occupies a single entry; token locations within it are
+    // just offsets. The end of the expansion range is always in the same buffer
+    // as the start so only its length is stored, and the fully expanded file
+    // location of the expansion site is computed once up front so that resolving
+    // a macro location never has to walk the chain of nested expansions. The
+    // nesting depth is likewise computed once, for enforcing expansion limits.
     struct ExpansionInfo {
         SourceLocation originalLoc;
         SourceLocation expansionStart;
-        SourceLocation expansionEnd;
+        SourceLocation fileLoc;
+        uint32_t expansionLength;
+        uint32_t depth;
+
+        ExpansionInfo(SourceLocation originalLoc, SourceLocation expansionStart,
+                      uint32_t expansionLength, SourceLocation fileLoc, uint32_t depth) :
+            originalLoc(originalLoc), expansionStart(expansionStart),
+            fileLoc(fileLoc), expansionLength(expansionLength), depth(depth) {}
+    };
 
-        ExpansionInfo() {}
-        ExpansionInfo(SourceLocation originalLoc, SourceLocation expansionStart, SourceLocation expansionEnd) :
-            originalLoc(originalLoc), expansionStart(expansionStart), expansionEnd(expansionEnd) {}
+    // BufferIDs with this bit set refer to an entry in the expansion table
+    // instead of a file buffer, which lets us tell macro locations apart
+    // without looking anything up.
+    static constexpr uint32_t MacroBufferBit = 1u << 31;
+
+    // index from BufferID to file buffer metadata
+    std::deque<FileInfo> fileEntries;
+
+    // index from (macro) BufferID to expansion metadata
+    std::vector<ExpansionInfo> expansionEntries;
+
+    // Memoized layout of file buffers within the compilation unit space. Each buffer
+    // gets a starting position and its flattened size, which includes the text of
+    // everything included from it. Include points within each buffer are kept sorted
+    // by offset, along with the running total of flattened text they insert, so that
+    // mapping a file location to a position is just a binary search. This is rebuilt
+    // lazily whenever new file buffers have been created since it was last computed.
+    struct IncludePosition {
+        uint32_t offset;    // offset of the include directive in the parent buffer
+        uint64_t shift;     // flattened size of all includes up to and including this one
     };
 
-    // index from BufferID to buffer metadata
-    std::deque<std::variant<FileInfo, ExpansionInfo>> bufferEntries;
+    struct BufferPosition {
+        uint64_t start = 0;
+        uint64_t size = 0;
+        uint32_t firstInclude = 0;
+        uint32_t includeCount = 0;
+    };
+
+    mutable std::vector<BufferPosition> bufferPositions;
+    mutable std::vector<IncludePosition> includePositions;
 
     // cache for file lookups; this holds on to the actual file data
     std::unordered_map<std::string, std::unique_ptr<FileData>> lookupCache;
@@ -202,17 +282,22 @@ private:
     // uniquified backing memory for directories
     std::set<fs::path> directories;
 
+    // paths that failed to resolve in readHeader, if we've been asked to track them
+    std::vector<std::string> includeMisses;
+    bool trackIncludeMisses = false;
+
     FileData* getFileData(BufferID buffer) const;
+    const ExpansionInfo& getExpansionInfo(BufferID buffer) const;
     SourceBuffer createBufferEntry(FileData* fd, SourceLocation includedFrom);
+    void computeBufferPositions() const;
 
     SourceBuffer openCached(const fs::path& fullPath, SourceLocation includedFrom);
+    SourceBuffer openHeader(const fs::path& fullPath, SourceLocation includedFrom);
     SourceBuffer cacheBuffer(const fs::path& path, SourceLocation includedFrom, std::vector<char>&& buffer);
 
     // Get raw line number of a file location, ignoring any line directives
     uint32_t getRawLineNumber(SourceLocation location) const;
 
-    static void computeLineOffsets(const std::vector<char>& buffer, std::vector<uint32_t>& offsets);
-
     static bool readFile(const fs::path& path, std::vector<char>& buffer);
 };
 
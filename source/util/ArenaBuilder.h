@@ -0,0 +1,121 @@
+//------------------------------------------------------------------------------
+// ArenaBuilder.h
+// Growable array that is built directly in a BumpAllocator.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+
+#include "BumpAllocator.h"
+
+namespace slang {
+
+/// ArenaBuilder<T> - A growable array that lives in a BumpAllocator.
+///
+/// Collecting items in a SmallVector and then copying them into an allocator writes
+/// every item twice, and large lists also get copied to the heap along the way. This
+/// builder instead keeps its items in the allocator from the start, so finishing
+/// the list doesn't copy anything. As long as the array is the most recent allocation
+/// it grows in place; if something else got allocated after it, the items get moved
+/// to a new block twice as large and the old one is abandoned.
+///
+/// Only one builder should be working at the head of a given allocator at a time; nested
+/// builders are fine, but the outer one will have to relocate when it next grows.
+template<typename T>
+class ArenaBuilder {
+    static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>);
+
+public:
+    explicit ArenaBuilder(BumpAllocator& alloc) : alloc(alloc) {}
+
+    ArenaBuilder(const ArenaBuilder&) = delete;
+    ArenaBuilder& operator=(const ArenaBuilder&) = delete;
+
+    T* begin() { return data_; }
+    T* end() { return data_ + len; }
+    const T* begin() const { return data_; }
+    const T* end() const { return data_ + len; }
+
+    T& operator[](size_t index) { return data_[index]; }
+    const T& operator[](size_t index) const { return data_[index]; }
+
+    const T& back() const {
+        ASSERT(len);
+        return data_[len - 1];
+    }
+
+    size_t size() const { return len; }
+    bool empty() const { return len == 0; }
+
+    /// Adds an element to the end of the array.
+    void append(const T& item) {
+        if (len == capacity)
+            grow();
+        data_[len++] = item;
+    }
+
+    /// Adds a range of elements to the end of the array.
+    template<typename Container>
+    void appendRange(const Container& container) {
+        for (auto& item : container)
+            append(item);
+    }
+
+    /// Adds an element to the end of the array.
+    template<typename... Args>
+    void emplace(Args&&... args) { append(T(std::forward<Args>(args)...)); }
+
+    /// Removes the last element of the array.
+    void pop() {
+        ASSERT(len);
+        len--;
+    }
+
+    /// Finishes building and returns the array, which stays valid for the lifetime of
+    /// the allocator. If the array is still the most recent allocation, any unused
+    /// capacity is given back. The builder is left empty and can be used again.
+    span<T> finish() {
+        span<T> result;
+        if (len) {
+            alloc.tryResize(reinterpret_cast<byte*>(data_), capacity * sizeof(T), len * sizeof(T));
+            result = span<T>(data_, len);
+        }
+        else if (data_) {
+            alloc.tryResize(reinterpret_cast<byte*>(data_), capacity * sizeof(T), 0);
+        }
+
+        data_ = nullptr;
+        len = 0;
+        capacity = 0;
+        return result;
+    }
+
+private:
+    BumpAllocator& alloc;
+    T* data_ = nullptr;
+    uint32_t len = 0;
+    uint32_t capacity = 0;
+
+    static constexpr uint32_t InitialCapacity = 4;
+
+    void grow() {
+        uint32_t newCapacity = capacity ? capacity * 2 : InitialCapacity;
+        if (data_ && alloc.tryResize(reinterpret_cast<byte*>(data_), capacity * sizeof(T),
+                                     newCapacity * sizeof(T))) {
+            capacity = newCapacity;
+            return;
+        }
+
+        T* newData = reinterpret_cast<T*>(alloc.allocate(newCapacity * sizeof(T), alignof(T)));
+        if (len)
+            memcpy(newData, data_, len * sizeof(T));
+
+        data_ = newData;
+        capacity = newCapacity;
+    }
+};
+
+}
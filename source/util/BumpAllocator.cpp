@@ -6,26 +6,53 @@
 //------------------------------------------------------------------------------
 #include "BumpAllocator.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <new>
+
+#if defined(__linux__)
+#  include <sys/mman.h>
+#endif
 
 namespace slang {
 
-BumpAllocator::BumpAllocator() {
+AllocatorStats& AllocatorStats::operator+=(const AllocatorStats& rhs) {
+    bytesUsed += rhs.bytesUsed;
+    bytesRequested += rhs.bytesRequested;
+    alignmentWaste += rhs.alignmentWaste;
+    bytesReserved += rhs.bytesReserved;
+    segmentWaste += rhs.segmentWaste;
+    segmentCount += rhs.segmentCount;
+    largeAllocationCount += rhs.largeAllocationCount;
+    return *this;
+}
+
+BumpAllocator::BumpAllocator(size_t segmentSize, size_t maxSegmentSize) :
+    nextSegmentSize(segmentSize), maxSegmentSize(std::max(segmentSize, maxSegmentSize))
+{
+    // Items are placed directly after the segment header, so it must not throw off their alignment.
+    static_assert(sizeof(Segment) % alignof(std::max_align_t) == 0);
+
     head = allocSegment(nullptr, INITIAL_SIZE);
-    endPtr = (byte*)head + INITIAL_SIZE;
+    endPtr = head->end;
 }
 
 BumpAllocator::~BumpAllocator() {
-    Segment* seg = head;
-    while (seg) {
-        Segment* prev = seg->prev;
-        free(seg);
-        seg = prev;
+    for (Segment* list : { head, freeList }) {
+        Segment* seg = list;
+        while (seg) {
+            Segment* prev = seg->prev;
+            freeSegment(seg);
+            seg = prev;
+        }
     }
 }
 
 BumpAllocator::BumpAllocator(BumpAllocator&& other) noexcept :
-    head(std::exchange(other.head, nullptr)), endPtr(other.endPtr)
+    head(std::exchange(other.head, nullptr)), endPtr(other.endPtr),
+    freeList(std::exchange(other.freeList, nullptr)),
+    nextSegmentSize(other.nextSegmentSize), maxSegmentSize(other.maxSegmentSize),
+    alignmentWaste(other.alignmentWaste)
 {
 }
 
@@ -37,25 +64,169 @@ BumpAllocator& BumpAllocator::operator=(BumpAllocator&& other) noexcept {
     return *this;
 }
 
+void BumpAllocator::reset() {
+    // Keep all of the regular segments, including any still unused from a previous reset,
+    // sorted from largest to smallest so that allocateSlow only has to look at the front
+    // of the free list. Dedicated segments for large allocations are sized for one
+    // specific request, so release them.
+    auto capacity = [](Segment* seg) { return size_t(seg->end - (byte*)(seg + 1)); };
+
+    Segment* kept = nullptr;
+    for (Segment* list : { head, freeList }) {
+        Segment* seg = list;
+        while (seg) {
+            Segment* prev = seg->prev;
+            if (seg->dedicated)
+                freeSegment(seg);
+            else {
+                seg->current = (byte*)(seg + 1);
+                Segment** pos = &kept;
+                while (*pos && capacity(*pos) >= capacity(seg))
+                    pos = &(*pos)->prev;
+                seg->prev = *pos;
+                *pos = seg;
+            }
+            seg = prev;
+        }
+    }
+
+    head = kept;
+    freeList = std::exchange(head->prev, nullptr);
+    endPtr = head->end;
+    alignmentWaste = 0;
+}
+
+void BumpAllocator::absorb(BumpAllocator&& other) {
+    // Splice the other allocator's segments in behind our current one, the same way
+    // dedicated segments are, so that we keep allocating from our own head. Anything
+    // it was holding on to for reuse is left for its destructor to free.
+    if (!other.head || &other == this)
+        return;
+
+    Segment* last = other.head;
+    while (last->prev)
+        last = last->prev;
+
+    last->prev = head->prev;
+    head->prev = std::exchange(other.head, nullptr);
+    alignmentWaste += std::exchange(other.alignmentWaste, 0);
+}
+
+AllocatorStats BumpAllocator::getStats() const {
+    AllocatorStats stats;
+    for (Segment* seg = head; seg; seg = seg->prev) {
+        stats.segmentCount++;
+        stats.bytesReserved += size_t(seg->end - (byte*)seg);
+        stats.segmentWaste += sizeof(Segment);
+        stats.bytesUsed += size_t(seg->current - (byte*)(seg + 1));
+
+        // Whatever is left in the current segment is still available.
+        if (seg != head)
+            stats.segmentWaste += size_t(seg->end - seg->current);
+        if (seg->dedicated)
+            stats.largeAllocationCount++;
+    }
+
+    for (Segment* seg = freeList; seg; seg = seg->prev) {
+        stats.segmentCount++;
+        stats.bytesReserved += size_t(seg->end - (byte*)seg);
+        stats.segmentWaste += sizeof(Segment);
+    }
+
+    // Everything used beyond what was asked for went to alignment padding.
+    stats.alignmentWaste = alignmentWaste;
+    stats.bytesRequested = stats.bytesUsed - alignmentWaste;
+    return stats;
+}
+
 byte* BumpAllocator::allocateSlow(size_t size, size_t alignment) {
+    // the fast path doesn't handle anything that needs padding, so it might still fit
+    byte* base = alignPtr(head->current, alignment);
+    if (base <= endPtr && size <= size_t(endPtr - base)) {
+        alignmentWaste += size_t(base - head->current);
+        head->current = base + size;
+        return base;
+    }
+
     // for really large allocations, give them their own segment
-    if (size > (SEGMENT_SIZE >> 1)) {
-        size = (size + alignment - 1) & ~(alignment - 1);
-        head->prev = allocSegment(head->prev, size + sizeof(Segment));
-        return alignPtr(head->prev->current, alignment);
+    if (size > (nextSegmentSize >> 1)) {
+        size_t alignedSize = (size + alignment - 1) & ~(alignment - 1);
+        Segment* seg = allocSegment(head->prev, alignedSize + alignment + sizeof(Segment));
+        seg->dedicated = true;
+        head->prev = seg;
+
+        base = alignPtr(seg->current, alignment);
+        alignmentWaste += size_t(base - seg->current) + (alignedSize - size);
+        seg->current = base + alignedSize;
+        return base;
+    }
+
+    // otherwise, start a new segment, reusing one kept by a reset if it's big enough
+    if (freeList && size_t(freeList->end - (byte*)(freeList + 1)) >= size + alignment) {
+        Segment* seg = std::exchange(freeList, freeList->prev);
+        seg->prev = head;
+        head = seg;
+    }
+    else {
+        head = allocSegment(head, nextSegmentSize);
+        nextSegmentSize = std::min(nextSegmentSize * 2, maxSegmentSize);
     }
 
-    // otherwise, start a new block
-    head = allocSegment(head, SEGMENT_SIZE);
-    endPtr = (byte*)head + SEGMENT_SIZE;
+    endPtr = head->end;
     return allocate(size, alignment);
 }
 
 BumpAllocator::Segment* BumpAllocator::allocSegment(Segment* prev, size_t size) {
-    auto seg = (Segment*)malloc(size);
+    Segment* seg = nullptr;
+    bool mapped = false;
+
+#if defined(__linux__)
+    // Big segments come straight from the OS, aligned so that the kernel can back them
+    // with huge pages. That cuts down on TLB misses when walking large syntax trees and
+    // symbol tables. To get the alignment, map an extra huge page and trim the excess.
+    if (size >= HUGE_PAGE_SIZE) {
+        size = (size + HUGE_PAGE_SIZE - 1) & ~size_t(HUGE_PAGE_SIZE - 1);
+        void* mem = mmap(nullptr, size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mem != MAP_FAILED) {
+            auto start = reinterpret_cast<uintptr_t>(mem);
+            auto aligned = (start + HUGE_PAGE_SIZE - 1) & ~uintptr_t(HUGE_PAGE_SIZE - 1);
+            if (aligned != start)
+                munmap(mem, aligned - start);
+            if (size_t tail = (start + HUGE_PAGE_SIZE) - aligned)
+                munmap(reinterpret_cast<void*>(aligned + size), tail);
+
+#  if defined(MADV_HUGEPAGE)
+            madvise(reinterpret_cast<void*>(aligned), size, MADV_HUGEPAGE);
+#  endif
+            seg = reinterpret_cast<Segment*>(aligned);
+            mapped = true;
+        }
+    }
+#endif
+
+    if (!seg) {
+        seg = (Segment*)malloc(size);
+        if (!seg)
+            throw std::bad_alloc();
+    }
+
     seg->prev = prev;
     seg->current = (byte*)seg + sizeof(Segment);
+    seg->end = (byte*)seg + size;
+    seg->mapped = mapped;
+    seg->dedicated = false;
     return seg;
 }
 
+void BumpAllocator::freeSegment(Segment* segment) {
+#if defined(__linux__)
+    if (segment->mapped) {
+        munmap(segment, size_t(segment->end - (byte*)segment));
+        return;
+    }
+#endif
+    free(segment);
+}
+
 }
@@ -10,14 +10,51 @@
 
 namespace slang {
 
+/// Statistics about the memory held by one or more BumpAllocators.
+struct AllocatorStats {
+    /// The total size of the memory handed out, including padding inserted between
+    /// items to satisfy their alignment requirements.
+    size_t bytesUsed = 0;
+
+    /// The total size of all allocations that have been requested.
+    size_t bytesRequested = 0;
+
+    /// Bytes skipped over to satisfy alignment requirements.
+    size_t alignmentWaste = 0;
+
+    /// The total size of all segments obtained from the system, including
+    /// segments that are being kept for reuse after a reset.
+    size_t bytesReserved = 0;
+
+    /// Bytes lost to segment headers and to the unused tails of segments that
+    /// filled up before the next allocation would fit.
+    size_t segmentWaste = 0;
+
+    /// The number of segments obtained from the system.
+    size_t segmentCount = 0;
+
+    /// The number of allocations too large for a regular segment, which got
+    /// a dedicated segment of their own.
+    size_t largeAllocationCount = 0;
+
+    AllocatorStats& operator+=(const AllocatorStats& rhs);
+};
+
 /// BumpAllocator - Fast O(1) allocator.
 ///
 /// Allocates items sequentially in memory, with underlying memory allocated in
-/// blocks of a configurable size. Individual items cannot be deallocated;
-/// the entire thing must be destroyed to release the memory.
+/// segments that grow geometrically, up to a configurable limit. Individual items
+/// cannot be deallocated; the entire thing must be destroyed (or reset) to release
+/// the memory.
+///
+/// Segments of at least HUGE_PAGE_SIZE bytes are mapped directly from the OS and,
+/// where supported, marked as eligible for transparent huge pages.
 class BumpAllocator {
 public:
-    BumpAllocator();
+    /// Creates a new allocator. After a small initial segment, segments start out at
+    /// @a segmentSize bytes and double in size each time a new one is needed, until
+    /// they reach @a maxSegmentSize.
+    explicit BumpAllocator(size_t segmentSize = SEGMENT_SIZE, size_t maxSegmentSize = MAX_SEGMENT_SIZE);
     ~BumpAllocator();
 
     BumpAllocator(BumpAllocator&& other) noexcept;
@@ -35,28 +72,69 @@ public:
 
     /// Allocate @a size bytes of memory with the given @a alignment.
     byte* allocate(size_t size, size_t alignment) {
-        byte* base = alignPtr(head->current, alignment);
-        byte* next = base + size;
-        if (next > endPtr)
+        // Allocations that would need padding go through the slow path, which is
+        // where alignment waste gets counted; most don't, since items tend to
+        // have the same alignment as whatever was allocated before them.
+        byte* base = head->current;
+        if ((reinterpret_cast<uintptr_t>(base) & (alignment - 1)) || size > size_t(endPtr - base))
             return allocateSlow(size, alignment);
 
-        head->current = next;
+        head->current = base + size;
         return base;
     }
 
+    /// Tries to change the size of the block at @a ptr, which currently holds @a oldSize
+    /// bytes, to @a newSize bytes without moving it. That only works if it's the most
+    /// recent allocation and the current segment has room; otherwise returns false.
+    bool tryResize(byte* ptr, size_t oldSize, size_t newSize) {
+        if (ptr + oldSize != head->current || newSize > size_t(endPtr - ptr))
+            return false;
+
+        head->current = ptr + newSize;
+        return true;
+    }
+
+    /// Takes ownership of all of the memory held by @a other, so that everything allocated
+    /// from it stays valid for as long as this allocator lives. @a other is left empty,
+    /// like a moved-from allocator, and must not be used for further allocations.
+    void absorb(BumpAllocator&& other);
+
+    /// Discards everything that has been allocated, invalidating all previously returned
+    /// pointers. The memory is kept and reused by later allocations, which makes it cheap
+    /// to use the same allocator for a series of similarly sized jobs.
+    void reset();
+
+    /// Gets statistics about the memory used by the allocator. This walks the list
+    /// of segments, so it isn't meant to be called in performance critical code.
+    AllocatorStats getStats() const;
+
 protected:
     // Allocations are tracked as a linked list of segments.
     struct Segment {
         Segment* prev;
         byte* current;
+        byte* end;
+        bool mapped;
+        bool dedicated;
     };
 
     Segment* head;
     byte* endPtr;
 
-    enum {
+    // Segments kept by reset() that haven't been reused yet, largest first.
+    Segment* freeList = nullptr;
+
+    size_t nextSegmentSize;
+    size_t maxSegmentSize;
+
+    // Padding inserted for alignment, counted in allocateSlow.
+    size_t alignmentWaste = 0;
+
+    enum : size_t {
         INITIAL_SIZE = 512,
-        SEGMENT_SIZE = 4096
+        SEGMENT_SIZE = 4096,
+        MAX_SEGMENT_SIZE = 2 * 1024 * 1024,
+        HUGE_PAGE_SIZE = 2 * 1024 * 1024
     };
 
     // Slow path handling of allocation.
@@ -68,6 +146,7 @@ protected:
     }
 
     static Segment* allocSegment(Segment* prev, size_t size);
+    static void freeSegment(Segment* segment);
 };
 
 template<typename T>
@@ -75,13 +154,12 @@ class TypedBumpAllocator : public BumpAllocator {
 public:
     TypedBumpAllocator() = default;
     TypedBumpAllocator(TypedBumpAllocator&& other) noexcept : BumpAllocator(std::move(other)) {}
-    ~TypedBumpAllocator() {
-        Segment* seg = head;
-        while (seg) {
-            for (T* cur = (T*)(seg + 1); cur != (T*)seg->current; cur++)
-                cur->~T();
-            seg = seg->prev;
-        }
+    ~TypedBumpAllocator() { destroyAll(); }
+
+    /// Destroys all items and keeps the memory for reuse.
+    void reset() {
+        destroyAll();
+        BumpAllocator::reset();
     }
 
     /// Construct a new item using the allocator.
@@ -89,6 +167,16 @@ public:
     T* emplace(Args&&... args) {
         return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
     }
+
+private:
+    void destroyAll() {
+        Segment* seg = head;
+        while (seg) {
+            for (T* cur = (T*)(seg + 1); cur != (T*)seg->current; cur++)
+                cur->~T();
+            seg = seg->prev;
+        }
+    }
 };
 
 }
@@ -0,0 +1,93 @@
+//------------------------------------------------------------------------------
+// PerfCounters.cpp
+// Cheap event counters for reasoning about how a compilation scales.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#include "PerfCounters.h"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+using namespace slang;
+
+// Keeps track of the counters of every live thread, along with the final
+// values from threads that have already exited.
+struct Registry {
+    std::mutex mutex;
+    std::vector<const std::atomic<uint64_t>*> live;
+    PerfCounterValues retired{};
+};
+
+Registry& getRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+}
+
+namespace slang {
+
+thread_local PerfCounters::ThreadCounters PerfCounters::threadCounters;
+
+string_view toString(PerfCounter counter) {
+    switch (counter) {
+        case PerfCounter::TokensLexed: return "tokens lexed";
+        case PerfCounter::MacroExpansions: return "macro expansions";
+        case PerfCounter::MacroExpansionsReplayed: return "macro expansions replayed";
+        case PerfCounter::ExpansionLocations: return "expansion locations";
+        case PerfCounter::Scopes: return "scopes";
+        case PerfCounter::Symbols: return "symbols";
+        case PerfCounter::NameLookups: return "name lookups";
+        case PerfCounter::LookupScopesSearched: return "lookup scopes searched";
+        case PerfCounter::WildcardImportProbes: return "wildcard import probes";
+        case PerfCounter::LazyEvaluations: return "lazy evaluations";
+        case PerfCounter::ConstantEvalSteps: return "constant eval steps";
+        case PerfCounter::Instances: return "instances";
+    }
+    THROW_UNREACHABLE;
+}
+
+void PerfCounters::registerThread() {
+    // Moves the thread's counts over to the retired totals when the thread exits.
+    struct Retirer {
+        const std::atomic<uint64_t>* values;
+
+        ~Retirer() {
+            auto& registry = getRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (size_t i = 0; i < PerfCounterCount; i++)
+                registry.retired[i] += values[i].load(std::memory_order_relaxed);
+
+            auto it = std::find(registry.live.begin(), registry.live.end(), values);
+            if (it != registry.live.end())
+                registry.live.erase(it);
+        }
+    };
+
+    {
+        auto& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.live.push_back(threadCounters.values);
+    }
+
+    static thread_local Retirer retirer { threadCounters.values };
+    threadCounters.registered = true;
+}
+
+PerfCounterValues PerfCounters::getTotals() {
+    auto& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    PerfCounterValues totals = registry.retired;
+    for (auto values : registry.live) {
+        for (size_t i = 0; i < PerfCounterCount; i++)
+            totals[i] += values[i].load(std::memory_order_relaxed);
+    }
+    return totals;
+}
+
+}
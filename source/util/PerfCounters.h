@@ -0,0 +1,103 @@
+//------------------------------------------------------------------------------
+// PerfCounters.h
+// Cheap event counters for reasoning about how a compilation scales.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <type_traits>
+
+#include "util/Util.h"
+
+namespace slang {
+
+/// The kinds of events counted by PerfCounters.
+enum class PerfCounter : uint32_t {
+    /// Tokens produced by lexers.
+    TokensLexed,
+
+    /// Macro usages expanded by preprocessors, including nested usages.
+    MacroExpansions,
+
+    /// Top level macro usages whose expansion was replayed from the cache
+    /// instead of being expanded again.
+    MacroExpansionsReplayed,
+
+    /// Entries created by SourceManager::createExpansionLoc.
+    ExpansionLocations,
+
+    /// Scopes created.
+    Scopes,
+
+    /// Symbols created.
+    Symbols,
+
+    /// Calls to Scope::lookupName.
+    NameLookups,
+
+    /// Scopes searched by unqualified lookups. Divided by the number of lookups this
+    /// gives the average distance walked up the scope tree.
+    LookupScopesSearched,
+
+    /// Packages searched for a name via a wildcard import.
+    WildcardImportProbes,
+
+    /// Lazy types and initializers that got evaluated.
+    LazyEvaluations,
+
+    /// Statements executed during constant evaluation.
+    ConstantEvalSteps,
+
+    /// Module and interface instances created.
+    Instances
+};
+
+constexpr size_t PerfCounterCount = size_t(PerfCounter::Instances) + 1;
+
+/// A set of values for every counter, indexed by PerfCounter.
+using PerfCounterValues = std::array<uint64_t, PerfCounterCount>;
+
+string_view toString(PerfCounter counter);
+
+/// Counts events in a way that is cheap enough to leave on all the time. Each thread
+/// increments its own set of counters without any synchronization, and the sets get
+/// summed up when someone asks for the values.
+class PerfCounters {
+public:
+    /// Adds @a amount to the given counter for the calling thread.
+    static void increment(PerfCounter counter, uint64_t amount = 1) {
+        // The per-thread set is trivially constructible so that getting at it is just
+        // a TLS access; the first increment on each thread registers it with the
+        // list of sets that get summed up.
+        auto& counters = threadCounters;
+        if (!counters.registered)
+            registerThread();
+
+        // Only the owning thread ever writes to the counter, so there's no need for
+        // an atomic read-modify-write; the atomic is just so that it can be read
+        // safely while other threads are collecting the totals.
+        auto& value = counters.values[size_t(counter)];
+        value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    /// Gets the totals of all counters, across all threads, since the process started.
+    static PerfCounterValues getTotals();
+
+private:
+    // Must stay trivially constructible and destructible; thread_locals start out zeroed.
+    struct ThreadCounters {
+        std::atomic<uint64_t> values[PerfCounterCount];
+        bool registered;
+    };
+    static_assert(std::is_trivially_default_constructible_v<ThreadCounters>);
+    static_assert(std::is_trivially_destructible_v<ThreadCounters>);
+
+    static void registerThread();
+
+    static thread_local ThreadCounters threadCounters;
+};
+
+}
@@ -255,6 +255,10 @@ public:
     SmallVectorSized(const SmallVectorSized&) = delete;
     SmallVectorSized& operator=(const SmallVectorSized&) = delete;
 
+    SmallVectorSized& operator=(SmallVectorSized<T, N>&& other) noexcept {
+        return *this = static_cast<SmallVector<T>&&>(other);
+    }
+
     SmallVectorSized& operator=(SmallVector<T>&& other) noexcept {
         if (this != &other) {
             this->cleanup();
@@ -0,0 +1,95 @@
+//------------------------------------------------------------------------------
+// TimeTrace.cpp
+// Lightweight scoped timers for profiling the phases of a compilation.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#include "TimeTrace.h"
+
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <ostream>
+#include <vector>
+
+namespace {
+
+using namespace slang;
+
+struct Event {
+    const char* name;
+    std::string detail;
+    TimeTrace::Clock::time_point start;
+    TimeTrace::Clock::duration duration;
+    uint32_t threadId;
+};
+
+struct TraceData {
+    std::mutex mutex;
+    std::vector<Event> events;
+    TimeTrace::Clock::time_point startTime;
+};
+
+TraceData& getData() {
+    static TraceData data;
+    return data;
+}
+
+// Small sequential IDs read better in trace viewers than OS thread IDs.
+uint32_t getThreadId() {
+    static std::atomic<uint32_t> nextId = 1;
+    thread_local uint32_t id = nextId++;
+    return id;
+}
+
+}
+
+namespace slang {
+
+std::atomic<bool> TimeTrace::enabled = false;
+
+void TimeTrace::initialize() {
+    auto& data = getData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    data.events.clear();
+    data.startTime = Clock::now();
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+void TimeTrace::stop() {
+    enabled.store(false, std::memory_order_relaxed);
+}
+
+void TimeTrace::addEvent(const char* name, std::string detail, Clock::time_point start,
+                         Clock::time_point end) {
+    uint32_t threadId = getThreadId();
+    auto& data = getData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    data.events.push_back({ name, std::move(detail), start, end - start, threadId });
+}
+
+void TimeTrace::write(std::ostream& stream) {
+    auto& data = getData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+
+    using Micros = std::chrono::duration<double, std::micro>;
+    json events = json::array();
+    for (auto& event : data.events) {
+        json j;
+        j["name"] = event.name;
+        j["ph"] = "X";
+        j["pid"] = 1;
+        j["tid"] = event.threadId;
+        j["ts"] = Micros(event.start - data.startTime).count();
+        j["dur"] = Micros(event.duration).count();
+        if (!event.detail.empty())
+            j["args"]["detail"] = event.detail;
+        events.push_back(std::move(j));
+    }
+
+    json output;
+    output["traceEvents"] = std::move(events);
+    output["displayTimeUnit"] = "ms";
+    stream << output.dump() << '\n';
+}
+
+}
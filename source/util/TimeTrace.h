@@ -0,0 +1,94 @@
+//------------------------------------------------------------------------------
+// TimeTrace.h
+// Lightweight scoped timers for profiling the phases of a compilation.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+#include <string>
+
+#include "util/Util.h"
+
+// Time trace scopes can be compiled out entirely by defining this to 0. When they're
+// compiled in but tracing hasn't been started, each scope costs one relaxed load.
+#if !defined(TIME_TRACE_ENABLED)
+  #define TIME_TRACE_ENABLED 1
+#endif
+
+#define TIME_TRACE_CONCAT_(a, b) a##b
+#define TIME_TRACE_CONCAT(a, b) TIME_TRACE_CONCAT_(a, b)
+
+#if TIME_TRACE_ENABLED
+  /// Records the time spent in the enclosing scope under the given name. The detail
+  /// expression is only evaluated when tracing is active.
+  #define TIME_SCOPE(name, detail) \
+    slang::TimeTraceScope TIME_TRACE_CONCAT(timeTraceScope_, __LINE__)( \
+        name, [&]() -> std::string { return std::string(detail); })
+#else
+  #define TIME_SCOPE(name, detail) do {} while (false)
+#endif
+
+namespace slang {
+
+/// Collects timed events from any number of threads and writes them out in the
+/// Chrome trace event format, which can be loaded by chrome://tracing, Perfetto,
+/// and similar viewers.
+class TimeTrace {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Starts collecting events, discarding any that were collected before.
+    /// Event times are reported relative to this call.
+    static void initialize();
+
+    /// Stops collecting events. Those already collected are kept until the
+    /// next call to initialize().
+    static void stop();
+
+    /// Returns true if events are currently being collected.
+    static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    /// Records a completed event on the calling thread.
+    static void addEvent(const char* name, std::string detail,
+                         Clock::time_point start, Clock::time_point end);
+
+    /// Writes all collected events as a Chrome trace JSON document.
+    static void write(std::ostream& stream);
+
+private:
+    static std::atomic<bool> enabled;
+};
+
+/// Times the scope it lives in and reports it to TimeTrace when destroyed.
+/// Usually created through the TIME_SCOPE macro.
+class TimeTraceScope {
+public:
+    template<typename TDetail>
+    TimeTraceScope(const char* name, TDetail&& getDetail) : name(name) {
+        if (TimeTrace::isEnabled()) {
+            active = true;
+            detail = getDetail();
+            start = TimeTrace::Clock::now();
+        }
+    }
+
+    ~TimeTraceScope() {
+        if (active)
+            TimeTrace::addEvent(name, std::move(detail), start, TimeTrace::Clock::now());
+    }
+
+    TimeTraceScope(const TimeTraceScope&) = delete;
+    TimeTraceScope& operator=(const TimeTraceScope&) = delete;
+
+private:
+    const char* name;
+    std::string detail;
+    TimeTrace::Clock::time_point start;
+    bool active = false;
+};
+
+}
@@ -107,6 +107,19 @@ namespace slang {
 
 template<typename T> struct always_false : std::false_type {};
 
+/// Returned from the pre-visit hooks of the iterative tree traversals to control
+/// how the walk proceeds after the current node.
+enum class VisitAction {
+    /// Descend into the children of the current node.
+    Continue,
+
+    /// Don't visit the children of the current node, but keep walking its siblings.
+    SkipChildren,
+
+    /// Abort the traversal entirely; no further hooks are called.
+    Stop
+};
+
 /// Converts a span of characters into a string_view.
 inline string_view to_string_view(span<char> text) {
     return string_view(text.data(), (size_t)text.size());
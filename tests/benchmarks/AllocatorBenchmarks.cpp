@@ -0,0 +1,126 @@
+#include "Benchmark.h"
+
+#include "compilation/Compilation.h"
+#include "parsing/SyntaxTree.h"
+#include "util/BumpAllocator.h"
+
+using namespace slang;
+using namespace slang::bench;
+
+namespace {
+
+const size_t NumNodes = 1000000;
+
+// Mimics the allocation pattern of building a syntax tree: lots of small
+// objects of varying size, with an occasional larger array mixed in.
+void allocateNodes(BumpAllocator& allocator) {
+    for (size_t i = 0; i < NumNodes; i++) {
+        size_t size = i % 1000 == 0 ? 4096 : 24 + (i % 9) * 8;
+        byte* node = allocator.allocate(size, 8);
+        node[0] = byte(i);
+    }
+}
+
+// Records how much the process's resident memory has grown since @a before.
+void recordMemory(Benchmark& bench, size_t before) {
+    size_t after = getResidentMemory();
+    bench.setCounter("rss growth (KB)", double(after > before ? after - before : 0) / 1024);
+}
+
+std::string generateDesign(int numModules) {
+    std::string text;
+    for (int i = 0; i < numModules; i++) {
+        auto n = std::to_string(i);
+        text += "module leaf" + n + " #(parameter int W = 8);\n";
+        text += "    localparam int X = W * 2 + " + n + ";\n";
+        text += "    logic [X-1:0] a, b;\n";
+        text += "    int values[4];\n";
+        text += "    function automatic int f(int v);\n";
+        text += "        if (v > X) return v - X;\n";
+        text += "        return v + X * 2;\n";
+        text += "    endfunction\n";
+        text += "endmodule\n";
+    }
+
+    text += "module top;\n";
+    for (int i = 0; i < numModules; i++) {
+        auto n = std::to_string(i);
+        text += "    leaf" + n + " #(.W(" + std::to_string(i % 16 + 1) + ")) l" + n + "();\n";
+    }
+    text += "endmodule\n";
+    return text;
+}
+
+}
+
+BENCHMARK_CASE("BumpAllocator (fixed 4K segments)") {
+    size_t before = getResidentMemory();
+    {
+        BumpAllocator allocator(4096, 4096);
+        allocateNodes(allocator);
+        recordMemory(bench, before);
+    }
+
+    bench.setItemsPerIteration(NumNodes);
+    bench.run([] {
+        BumpAllocator allocator(4096, 4096);
+        allocateNodes(allocator);
+    });
+}
+
+BENCHMARK_CASE("BumpAllocator (geometric growth)") {
+    size_t before = getResidentMemory();
+    {
+        BumpAllocator allocator;
+        allocateNodes(allocator);
+        recordMemory(bench, before);
+    }
+
+    bench.setItemsPerIteration(NumNodes);
+    bench.run([] {
+        BumpAllocator allocator;
+        allocateNodes(allocator);
+    });
+}
+
+BENCHMARK_CASE("BumpAllocator (reset and reuse)") {
+    size_t before = getResidentMemory();
+    BumpAllocator allocator;
+    allocateNodes(allocator);
+    recordMemory(bench, before);
+
+    bench.setItemsPerIteration(NumNodes);
+    bench.run([&] {
+        allocator.reset();
+        allocateNodes(allocator);
+    });
+}
+
+BENCHMARK_CASE("Parse design (memory)") {
+    std::string text = generateDesign(2000);
+    size_t before = getResidentMemory();
+    {
+        auto tree = SyntaxTree::fromText(text);
+        recordMemory(bench, before);
+    }
+
+    bench.setBytesPerIteration(text.size());
+    bench.run([&] { SyntaxTree::fromText(text); });
+}
+
+BENCHMARK_CASE("Elaborate design (memory)") {
+    auto tree = SyntaxTree::fromText(generateDesign(2000));
+    size_t before = getResidentMemory();
+    {
+        Compilation compilation;
+        compilation.addSyntaxTree(tree);
+        compilation.getSemanticDiagnostics();
+        recordMemory(bench, before);
+    }
+
+    bench.run([&] {
+        Compilation compilation;
+        compilation.addSyntaxTree(tree);
+        compilation.getSemanticDiagnostics();
+    });
+}
@@ -0,0 +1,122 @@
+//------------------------------------------------------------------------------
+// Benchmark.h
+// Minimal harness for timing slang components.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace slang::bench {
+
+/// Keeps the compiler from optimizing away the computation of @a value,
+/// without costing anything more than making sure it gets materialized.
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+/// Tracks timing for a single benchmark case. The case body calls run() with the
+/// operation to measure, which is repeated until enough time has passed to get
+/// a stable per-iteration figure.
+class Benchmark {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    std::string name;
+    uint64_t iterations = 0;
+    uint64_t itemsPerIteration = 0;
+    uint64_t bytesPerIteration = 0;
+    std::string itemName = "items";
+    Clock::duration elapsed {};
+    std::vector<std::pair<std::string, double>> counters;
+
+    explicit Benchmark(std::string name) : name(std::move(name)) {}
+
+    /// Times repeated invocations of @a func.
+    template<typename TFunc>
+    void run(TFunc&& func) {
+        run([] {}, std::forward<TFunc>(func));
+    }
+
+    /// Times repeated invocations of @a func, calling @a setup before each
+    /// one without counting it towards the measured time. If @a func returns
+    /// a value, it's passed to doNotOptimize so that the work isn't elided.
+    template<typename TSetup, typename TFunc>
+    void run(TSetup&& setup, TFunc&& func) {
+        iterations = 0;
+        elapsed = {};
+        do {
+            setup();
+            auto start = Clock::now();
+            if constexpr (std::is_void_v<decltype(func())>)
+                func();
+            else
+                doNotOptimize(func());
+            elapsed += Clock::now() - start;
+            iterations++;
+        } while (iterations < MinIterations || elapsed < MinTime);
+    }
+
+    /// Sets the number of items (tokens, diagnostics, etc) processed by each
+    /// iteration, which is used to report throughput. @a unit names the kind
+    /// of item in the JSON results.
+    void setItemsPerIteration(uint64_t items, std::string unit = "items") {
+        itemsPerIteration = items;
+        itemName = std::move(unit);
+    }
+
+    /// Sets the amount of source text processed by each iteration, which is
+    /// used to report throughput in MB/s.
+    void setBytesPerIteration(uint64_t bytes) { bytesPerIteration = bytes; }
+
+    /// Records an extra named figure (such as memory usage) to report with the results.
+    void setCounter(std::string counterName, double value) { counters.emplace_back(std::move(counterName), value); }
+
+private:
+    static constexpr uint64_t MinIterations = 3;
+    static constexpr std::chrono::milliseconds MinTime { 500 };
+};
+
+using BenchmarkFunc = void(*)(Benchmark&);
+
+struct BenchmarkCase {
+    const char* name;
+    BenchmarkFunc func;
+};
+
+/// Gets the list of all registered benchmark cases.
+std::vector<BenchmarkCase>& getBenchmarks();
+
+/// Gets the resident set size of the process in bytes, or zero if it can't be determined.
+size_t getResidentMemory();
+
+struct BenchmarkRegistrar {
+    BenchmarkRegistrar(const char* name, BenchmarkFunc func) {
+        getBenchmarks().push_back({ name, func });
+    }
+};
+
+}
+
+#define BENCH_CONCAT_(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_(a, b)
+
+#define BENCHMARK_CASE_(name, func) \
+    static void func(slang::bench::Benchmark&); \
+    static slang::bench::BenchmarkRegistrar BENCH_CONCAT(func, Registrar)(name, &func); \
+    static void func(slang::bench::Benchmark& bench)
+
+/// Defines and registers a new benchmark case. The body has access to
+/// a `bench` variable of type Benchmark.
+#define BENCHMARK_CASE(name) BENCHMARK_CASE_(name, BENCH_CONCAT(benchmarkCase, __LINE__))
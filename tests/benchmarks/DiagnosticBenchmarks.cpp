@@ -0,0 +1,100 @@
+#include <random>
+
+#include "Benchmark.h"
+
+#include "diagnostics/Diagnostics.h"
+#include "text/SourceManager.h"
+
+using namespace slang;
+
+BENCHMARK_CASE("Sort diagnostics (deep includes)") {
+    // Build a handful of compilation units, each with several chains of
+    // nested includes, and sprinkle macro expansions throughout.
+    const int NumRoots = 4;
+    const int ChainsPerRoot = 8;
+    const int ChainDepth = 32;
+    const uint32_t FileSize = 1024;
+    const uint32_t NumDiags = 100000;
+
+    SourceManager sourceManager;
+    std::string text(FileSize, ' ');
+    std::vector<SourceLocation> fileStarts;
+
+    for (int r = 0; r < NumRoots; r++) {
+        SourceBuffer root = sourceManager.assignText(text);
+        fileStarts.push_back(SourceLocation(root.id, 0));
+        for (int c = 0; c < ChainsPerRoot; c++) {
+            SourceLocation includedFrom(root.id, (c + 1) * FileSize / (ChainsPerRoot + 1));
+            for (int d = 0; d < ChainDepth; d++) {
+                SourceBuffer buffer = sourceManager.assignText(text, includedFrom);
+                fileStarts.push_back(SourceLocation(buffer.id, 0));
+                includedFrom = SourceLocation(buffer.id, FileSize / 2);
+            }
+        }
+    }
+
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<size_t> fileDist(0, fileStarts.size() - 1);
+    std::uniform_int_distribution<uint32_t> offsetDist(0, FileSize - 8);
+
+    std::vector<SourceLocation> locations;
+    for (uint32_t i = 0; i < NumDiags; i++) {
+        SourceLocation loc = fileStarts[fileDist(rng)] + (size_t)offsetDist(rng);
+        if (i % 8 == 0)
+            loc = sourceManager.createExpansionLoc(loc, loc, loc + 4) + 1;
+        locations.push_back(loc);
+    }
+
+    Diagnostics diagnostics;
+    bench.setItemsPerIteration(NumDiags);
+    bench.run(
+        [&] {
+            diagnostics.clear();
+            for (auto loc : locations)
+                diagnostics.add(DiagCode::ExpectedIdentifier, loc);
+        },
+        [&] { diagnostics.sort(sourceManager); });
+}
+
+BENCHMARK_CASE("Render diagnostics") {
+    const uint32_t NumDiags = 100000;
+
+    SourceManager sourceManager;
+    std::string text;
+    for (int i = 0; i < 2000; i++)
+        text += "    assign w" + std::to_string(i) + " = a & b | c;\n";
+
+    SourceBuffer buffer = sourceManager.assignText(text);
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<uint32_t> offsetDist(0, (uint32_t)text.size() - 8);
+
+    Diagnostics diagnostics;
+    for (uint32_t i = 0; i < NumDiags; i++) {
+        SourceLocation loc(buffer.id, offsetDist(rng));
+        diagnostics.add(DiagCode::ExpectedToken, SourceRange(loc, loc + 3)) << "foo";
+    }
+    diagnostics.sort(sourceManager);
+
+    DiagnosticWriter writer(sourceManager);
+    bench.setItemsPerIteration(NumDiags);
+    bench.run([&] { writer.report(diagnostics); });
+}
+
+BENCHMARK_CASE("Add and copy diagnostics") {
+    const uint32_t NumDiags = 100000;
+
+    SourceManager sourceManager;
+    SourceBuffer buffer = sourceManager.assignText(std::string(4096, ' '));
+
+    bench.setItemsPerIteration(NumDiags);
+    bench.run([&] {
+        Diagnostics diagnostics;
+        for (uint32_t i = 0; i < NumDiags; i++) {
+            SourceLocation loc(buffer.id, i % 4000);
+            diagnostics.add(DiagCode::DuplicateDefinition, SourceRange(loc, loc + 3)) << "module" << i;
+        }
+
+        Diagnostics copy;
+        copy.appendRange(diagnostics);
+    });
+}
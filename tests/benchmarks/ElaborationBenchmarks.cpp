@@ -0,0 +1,135 @@
+#include "Benchmark.h"
+
+#include "compilation/Compilation.h"
+#include "parsing/SyntaxTree.h"
+
+using namespace slang;
+
+namespace {
+
+// A three level hierarchy: the top module instantiates @a numMids copies of a middle
+// module, each of which instantiates @a leavesPerMid parameterized leaf modules.
+std::string generateHierarchy(int numMids, int leavesPerMid) {
+    std::string text = R"(
+module leaf #(parameter int W = 8, parameter int D = 2);
+    localparam int Depth = D * 2 + 1;
+    logic [W-1:0] state, next;
+    function automatic int scale(int v);
+        if (v > Depth) return v - Depth;
+        return v * W;
+    endfunction
+    initial begin
+        for (int i = 0; i < Depth; i += 1)
+            next = state + scale(i);
+    end
+endmodule
+)";
+
+    text += "module mid #(parameter int W = 8);\n";
+    text += "    logic [W-1:0] data;\n";
+    for (int i = 0; i < leavesPerMid; i++) {
+        auto n = std::to_string(i);
+        text += "    leaf #(.W(W), .D(" + std::to_string(i % 4) + ")) l" + n + "();\n";
+    }
+    text += "endmodule\n";
+
+    text += "module top;\n";
+    for (int i = 0; i < numMids; i++) {
+        auto n = std::to_string(i);
+        text += "    mid #(.W(" + std::to_string(i % 8 + 8) + ")) m" + n + "();\n";
+    }
+    text += "endmodule\n";
+    return text;
+}
+
+// Walks the whole instance hierarchy, which forces each instance's members to be
+// elaborated, and returns how many instances there are.
+uint64_t countInstances(const Scope& scope) {
+    uint64_t count = 0;
+    for (auto& instance : scope.membersOfType<ModuleInstanceSymbol>())
+        count += 1 + countInstances(instance);
+    return count;
+}
+
+}
+
+BENCHMARK_CASE("Elaborate hierarchy (getRoot)") {
+    auto tree = SyntaxTree::fromText(generateHierarchy(100, 20));
+    auto elaborate = [&] {
+        Compilation compilation;
+        compilation.addSyntaxTree(tree);
+        return countInstances(compilation.getRoot());
+    };
+
+    bench.setItemsPerIteration(elaborate(), "instances");
+    bench.run(elaborate);
+}
+
+BENCHMARK_CASE("Compilation diagnostics (getAllDiagnostics)") {
+    // Sprinkle in some errors so that diagnostics actually get issued and sorted.
+    std::string text = generateHierarchy(50, 20);
+    for (int i = 0; i < 200; i++) {
+        auto n = std::to_string(i);
+        text += "module bad" + n + "; int a = undeclared" + n + "; logic [3:0] b = 5'd" + n + "; endmodule\n";
+    }
+
+    // The compilation caches its diagnostics, so each iteration needs a new one. Building
+    // and elaborating it happens in the untimed setup step, leaving just the forcing,
+    // collection, and sorting of diagnostics to be measured.
+    auto tree = SyntaxTree::fromText(text);
+    std::unique_ptr<Compilation> compilation;
+    auto setup = [&] {
+        compilation = std::make_unique<Compilation>();
+        compilation->addSyntaxTree(tree);
+        compilation->getRoot();
+    };
+
+    setup();
+    bench.setItemsPerIteration(compilation->getAllDiagnostics().size(), "diagnostics");
+    bench.run(setup, [&] { return compilation->getAllDiagnostics().size(); });
+}
+
+BENCHMARK_CASE("Constant function evaluation") {
+    const int LoopCount = 20;
+    auto tree = SyntaxTree::fromText(R"(
+function automatic int collatz_steps(int n);
+    int steps = 0;
+    for (int i = 0; i < 200; i += 1) begin
+        if (n != 1) begin
+            if (n % 2 == 0) n = n / 2;
+            else n = 3 * n + 1;
+            steps += 1;
+        end
+    end
+    return steps;
+endfunction
+)");
+    auto seedDecl = SyntaxTree::fromText("int seed;");
+
+    // The argument depends on a variable so that binding can't fold the calls away
+    // into a constant; every evaluation has to run the function bodies.
+    auto call = SyntaxTree::fromText("collatz_steps(seed) + collatz_steps(seed + 70) + collatz_steps(seed * 32 + 7)");
+
+    Compilation compilation;
+    auto& scope = compilation.createScriptScope();
+    scope.addMembers(tree->root());
+    scope.addMembers(seedDecl->root());
+    auto& seed = scope.find("seed")->as<VariableSymbol>();
+    auto& expr = Expression::bind(compilation, call->root().as<ExpressionSyntax>(),
+                                  BindContext(scope, LookupLocation::max));
+
+    auto evaluate = [&] {
+        EvalContext context;
+        context.createLocal(&seed, SVInt(32, 27, true));
+        return expr.eval(context);
+    };
+
+    if (expr.constant || evaluate().integer() != 407)
+        throw std::logic_error("unexpected result from constant function");
+
+    bench.setItemsPerIteration(LoopCount, "evaluations");
+    bench.run([&] {
+        for (int i = 0; i < LoopCount; i++)
+            evaluate();
+    });
+}
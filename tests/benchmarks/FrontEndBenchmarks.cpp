@@ -0,0 +1,158 @@
+#include "Benchmark.h"
+
+#include "lexing/Lexer.h"
+#include "lexing/Preprocessor.h"
+#include "parsing/SyntaxTree.h"
+
+using namespace slang;
+
+namespace {
+
+// A mix of declarations, expressions, literals, and comments that is
+// representative of ordinary RTL.
+std::string generateSource(int numModules) {
+    std::string text;
+    for (int i = 0; i < numModules; i++) {
+        auto n = std::to_string(i);
+        text += "// Module number " + n + "\n";
+        text += "module gen" + n + " #(parameter int WIDTH = 32)(\n";
+        text += "    input logic clk, rst_n,\n";
+        text += "    input logic [WIDTH-1:0] data_in,\n";
+        text += "    output logic [WIDTH-1:0] data_out\n";
+        text += ");\n";
+        text += "    /* registered state */\n";
+        text += "    logic [WIDTH-1:0] state, next_state;\n";
+        text += "    always_comb next_state = (data_in ^ state) + 32'h" + n + "a5 - 'd17;\n";
+        text += "    always_ff @(posedge clk or negedge rst_n) begin\n";
+        text += "        if (!rst_n) state <= '0;\n";
+        text += "        else state <= {next_state[WIDTH-2:0], next_state[WIDTH-1]};\n";
+        text += "    end\n";
+        text += "    assign data_out = state;\n";
+        text += "endmodule\n\n";
+    }
+    return text;
+}
+
+// Lots of nested macro expansions with arguments, which exercises the
+// preprocessor much more heavily than ordinary source does.
+std::string generateMacroSource(int numUses) {
+    std::string text = R"(
+`define WIDTH 32
+`define MAX(a, b) ((a) > (b) ? (a) : (b))
+`define MIN(a, b) ((a) < (b) ? (a) : (b))
+`define CLAMP(x, lo, hi) `MIN(`MAX(x, lo), hi)
+`define REG(name, w) logic [(w)-1:0] name``_q, name``_d;
+`define FF(name) always_ff @(posedge clk) name``_q <= name``_d;
+module macros;
+)";
+    for (int i = 0; i < numUses; i++) {
+        auto n = std::to_string(i);
+        text += "    `REG(r" + n + ", `WIDTH)\n";
+        text += "    `FF(r" + n + ")\n";
+        text += "    assign r" + n + "_d = `CLAMP(r" + n + "_q + " + n + ", 4, `WIDTH * 2);\n";
+    }
+    text += "endmodule\n";
+    return text;
+}
+
+// Logging style macro usages whose arguments are different every time, so
+// none of the expansions can be replayed from an earlier one.
+std::string generateLoggingSource(int numUses) {
+    std::string text = R"(
+`define LOG(id, msg) if (verbosity >= id) $display("%0t [%s] %s", $time, `"id`", msg);
+module logging;
+    int verbosity;
+    initial begin
+)";
+    for (int i = 0; i < numUses; i++) {
+        auto n = std::to_string(i);
+        text += "        `LOG(" + n + ", \"message number " + n + "\")\n";
+    }
+    text += "    end\nendmodule\n";
+    return text;
+}
+
+}
+
+BENCHMARK_CASE("Lexer (large file)") {
+    SourceManager sourceManager;
+    std::string text = generateSource(4000);
+    SourceBuffer buffer = sourceManager.assignText(text);
+
+    auto lexAll = [&] {
+        BumpAllocator alloc;
+        Diagnostics diagnostics;
+        Lexer lexer(buffer, alloc, diagnostics);
+
+        uint64_t count = 1;
+        while (lexer.lex().kind != TokenKind::EndOfFile)
+            count++;
+        return count;
+    };
+
+    bench.setItemsPerIteration(lexAll(), "tokens");
+    bench.setBytesPerIteration(text.size());
+    bench.run(lexAll);
+}
+
+BENCHMARK_CASE("Preprocessor (macro heavy)") {
+    SourceManager sourceManager;
+    std::string text = generateMacroSource(3000);
+    SourceBuffer buffer = sourceManager.assignText(text);
+
+    auto preprocessAll = [&] {
+        BumpAllocator alloc;
+        Diagnostics diagnostics;
+        Preprocessor preprocessor(sourceManager, alloc, diagnostics);
+        preprocessor.pushSource(buffer);
+
+        uint64_t count = 1;
+        while (preprocessor.next().kind != TokenKind::EndOfFile)
+            count++;
+        return count;
+    };
+
+    bench.setItemsPerIteration(preprocessAll(), "tokens");
+    bench.setBytesPerIteration(text.size());
+    bench.run(preprocessAll);
+}
+
+BENCHMARK_CASE("Preprocessor (distinct macro arguments)") {
+    SourceManager sourceManager;
+    std::string text = generateLoggingSource(20000);
+    SourceBuffer buffer = sourceManager.assignText(text);
+
+    auto preprocessAll = [&] {
+        BumpAllocator alloc;
+        Diagnostics diagnostics;
+        Preprocessor preprocessor(sourceManager, alloc, diagnostics);
+        preprocessor.pushSource(buffer);
+
+        uint64_t count = 1;
+        while (preprocessor.next().kind != TokenKind::EndOfFile)
+            count++;
+        return count;
+    };
+
+    bench.setItemsPerIteration(preprocessAll(), "tokens");
+    bench.setBytesPerIteration(text.size());
+    bench.run(preprocessAll);
+}
+
+BENCHMARK_CASE("Parser (compilation unit)") {
+    SourceManager sourceManager;
+    std::string text = generateSource(4000);
+    SourceBuffer buffer = sourceManager.assignText(text);
+
+    bench.setItemsPerIteration(4000, "modules");
+    bench.setBytesPerIteration(text.size());
+    bench.run([&] {
+        BumpAllocator alloc;
+        Diagnostics diagnostics;
+        Preprocessor preprocessor(sourceManager, alloc, diagnostics);
+        preprocessor.pushSource(buffer);
+
+        Parser parser(preprocessor);
+        parser.parseCompilationUnit();
+    });
+}
@@ -0,0 +1,56 @@
+#include <random>
+
+#include "Benchmark.h"
+
+#include "numeric/SVInt.h"
+
+using namespace slang;
+
+namespace {
+
+const int NumValues = 256;
+
+std::vector<SVInt> generateValues(bitwidth_t width, uint32_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<SVInt> values;
+    for (int i = 0; i < NumValues; i++) {
+        // Fill every word so that wide values don't degenerate into small ones.
+        std::vector<byte> bytes((width + 7) / 8);
+        for (auto& b : bytes)
+            b = byte(rng());
+        SVInt value(width, bytes, false);
+
+        // Avoid division by zero.
+        if (value == 0)
+            value = SVInt(width, 1, false);
+        values.push_back(std::move(value));
+    }
+    return values;
+}
+
+// Runs a mix of the common arithmetic operations on values of the given width.
+void benchArithmetic(bench::Benchmark& bench, bitwidth_t width) {
+    auto lhs = generateValues(width, 1);
+    auto rhs = generateValues(width, 2);
+
+    bench.setItemsPerIteration(NumValues * 5, "operations");
+    bench.run([&] {
+        for (int i = 0; i < NumValues; i++) {
+            SVInt sum = lhs[i] + rhs[i];
+            SVInt product = lhs[i] * rhs[i];
+            SVInt quotient = product / rhs[i];
+            SVInt shifted = sum.shl(width / 3);
+            SVInt mixed = shifted ^ quotient;
+            if (mixed.getBitWidth() != width)
+                throw std::logic_error("unexpected width");
+        }
+    });
+}
+
+}
+
+BENCHMARK_CASE("SVInt arithmetic (32 bits)") { benchArithmetic(bench, 32); }
+BENCHMARK_CASE("SVInt arithmetic (64 bits)") { benchArithmetic(bench, 64); }
+BENCHMARK_CASE("SVInt arithmetic (128 bits)") { benchArithmetic(bench, 128); }
+BENCHMARK_CASE("SVInt arithmetic (1024 bits)") { benchArithmetic(bench, 1024); }
+BENCHMARK_CASE("SVInt arithmetic (4096 bits)") { benchArithmetic(bench, 4096); }
@@ -0,0 +1,61 @@
+#include "Benchmark.h"
+
+#include "compilation/Compilation.h"
+#include "parsing/SyntaxTree.h"
+
+#include "DesignGenerator.h"
+
+using namespace slang;
+
+// These run the same generated design at a few different sizes. If the front end
+// scales linearly, throughput stays roughly flat as the design grows.
+
+namespace {
+
+DesignOptions getOptions(int fanout) {
+    DesignOptions options;
+    options.fileCount = 8;
+    options.depth = 3;
+    options.fanout = fanout;
+    options.modulesPerLevel = 16;
+    options.headerCount = 0;
+    return options;
+}
+
+void benchParse(bench::Benchmark& bench, int fanout) {
+    auto files = generateDesign(getOptions(fanout));
+    uint64_t bytes = 0;
+    for (auto& file : files)
+        bytes += file.text.size();
+
+    bench.setBytesPerIteration(bytes);
+    bench.run([&] {
+        for (auto& file : files)
+            SyntaxTree::fromText(file.text, file.name);
+    });
+}
+
+void benchElaborate(bench::Benchmark& bench, int fanout) {
+    auto options = getOptions(fanout);
+    std::vector<std::shared_ptr<SyntaxTree>> trees;
+    for (auto& file : generateDesign(options))
+        trees.push_back(SyntaxTree::fromText(file.text, file.name));
+
+    bench.setItemsPerIteration(countDesignInstances(options), "instances");
+    bench.run([&] {
+        Compilation compilation;
+        for (auto& tree : trees)
+            compilation.addSyntaxTree(tree);
+        if (!compilation.getAllDiagnostics().empty())
+            throw std::logic_error("generated design has errors");
+    });
+}
+
+}
+
+BENCHMARK_CASE("Scaling: parse (fanout 8)") { benchParse(bench, 8); }
+BENCHMARK_CASE("Scaling: parse (fanout 16)") { benchParse(bench, 16); }
+BENCHMARK_CASE("Scaling: parse (fanout 32)") { benchParse(bench, 32); }
+BENCHMARK_CASE("Scaling: elaborate (fanout 8)") { benchElaborate(bench, 8); }
+BENCHMARK_CASE("Scaling: elaborate (fanout 16)") { benchElaborate(bench, 16); }
+BENCHMARK_CASE("Scaling: elaborate (fanout 32)") { benchElaborate(bench, 32); }
@@ -0,0 +1,28 @@
+#include <memory>
+
+#include "Benchmark.h"
+
+#include "text/SourceManager.h"
+
+using namespace slang;
+
+BENCHMARK_CASE("Line numbers (large file)") {
+    std::string text;
+    while (text.size() < (32 << 20))
+        text += "assign some_generated_net_name = other_generated_net_name & 1'b1;\n";
+
+    std::unique_ptr<SourceManager> sourceManager;
+    SourceBuffer buffer;
+    bench.setItemsPerIteration(text.size());
+    bench.run(
+        [&] {
+            sourceManager = std::make_unique<SourceManager>();
+            buffer = sourceManager->assignText(text);
+        },
+        [&] {
+            // The first lookup has to scan the whole file.
+            uint32_t offset = (uint32_t)text.size() - 2;
+            sourceManager->getLineNumber(SourceLocation(buffer.id, offset));
+            sourceManager->getColumnNumber(SourceLocation(buffer.id, offset));
+        });
+}
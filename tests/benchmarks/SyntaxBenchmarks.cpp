@@ -0,0 +1,85 @@
+#include "Benchmark.h"
+
+#include "parsing/SyntaxTree.h"
+#include "parsing/SyntaxVisitor.h"
+
+using namespace slang;
+
+namespace {
+
+std::string generateModule(int numItems) {
+    std::string text = "module m(input logic clk, input logic [31:0] a, b, output logic [31:0] out);\n";
+    for (int i = 0; i < numItems; i++) {
+        auto n = std::to_string(i);
+        text += "    logic [31:0] w" + n + ";\n";
+        text += "    assign w" + n + " = (a + b * " + n + ") ^ {a[15:0], b[31:16]} | (a >> 2);\n";
+        text += "    always_ff @(posedge clk) begin\n";
+        text += "        if (w" + n + " != 0) out <= w" + n + " - 1;\n";
+        text += "        else out <= a & ~b;\n";
+        text += "    end\n";
+    }
+    text += "endmodule\n";
+    return text;
+}
+
+struct TokenCounter : public SyntaxVisitor<TokenCounter> {
+    size_t count = 0;
+    void visitToken(Token) { count++; }
+};
+
+}
+
+BENCHMARK_CASE("Syntax traversal (large tree)") {
+    auto tree = SyntaxTree::fromText(generateModule(5000));
+
+    TokenCounter counter;
+    counter.visitNode(&tree->root());
+    bench.setItemsPerIteration(counter.count);
+
+    bench.run([&] {
+        TokenCounter visitor;
+        visitor.visitNode(&tree->root());
+    });
+}
+
+BENCHMARK_CASE("Syntax node ranges (large tree)") {
+    auto tree = SyntaxTree::fromText(generateModule(5000));
+
+    std::vector<const SyntaxNode*> nodes;
+    std::vector<const SyntaxNode*> stack { &tree->root() };
+    while (!stack.empty()) {
+        const SyntaxNode* node = stack.back();
+        stack.pop_back();
+        if (node->getFirstToken())
+            nodes.push_back(node);
+        for (uint32_t i = 0; i < node->getChildCount(); i++) {
+            if (auto child = node->childNode(i))
+                stack.push_back(child);
+        }
+    }
+
+    bench.setItemsPerIteration(nodes.size());
+    bench.run([&] {
+        uint64_t total = 0;
+        for (auto node : nodes)
+            total += node->sourceRange().end().offset();
+        return total;
+    });
+}
+
+BENCHMARK_CASE("Parse large file") {
+    std::string text = generateModule(5000);
+    bench.setBytesPerIteration(text.size());
+    bench.run([&] { SyntaxTree::fromText(text); });
+}
+
+BENCHMARK_CASE("Parse large file (pipelined)") {
+    std::string text = generateModule(5000);
+    ParserOptions parserOptions;
+    parserOptions.pipelined = true;
+    Bag options;
+    options.add(parserOptions);
+
+    bench.setBytesPerIteration(text.size());
+    bench.run([&] { SyntaxTree::fromText(text, SyntaxTree::getDefaultSourceManager(), "", options); });
+}
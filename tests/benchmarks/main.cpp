@@ -0,0 +1,146 @@
+//------------------------------------------------------------------------------
+// main.cpp
+// Entry point for the benchmark runner.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#include <cstdio>
+#include <string_view>
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#if defined(__linux__)
+#  include <unistd.h>
+#endif
+
+#include "Benchmark.h"
+
+namespace slang::bench {
+
+std::vector<BenchmarkCase>& getBenchmarks() {
+    static std::vector<BenchmarkCase> benchmarks;
+    return benchmarks;
+}
+
+size_t getResidentMemory() {
+#if defined(__linux__)
+    // The second field of statm is the number of resident pages.
+    size_t pages = 0;
+    if (FILE* file = fopen("/proc/self/statm", "r")) {
+        if (fscanf(file, "%*s %zu", &pages) != 1)
+            pages = 0;
+        fclose(file);
+    }
+    return pages * (size_t)sysconf(_SC_PAGESIZE);
+#else
+    return 0;
+#endif
+}
+
+}
+
+using namespace slang::bench;
+
+namespace {
+
+struct Result {
+    const Benchmark* bench;
+    double nsPerIteration;
+    double itemsPerSecond;
+    double megabytesPerSecond;
+};
+
+Result getResult(const Benchmark& bench) {
+    double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(bench.elapsed).count();
+    double perIter = ns / (double)bench.iterations;
+    double itemsPerSec = bench.itemsPerIteration ? (double)bench.itemsPerIteration * 1e9 / perIter : 0.0;
+    double mbPerSec = bench.bytesPerIteration ? (double)bench.bytesPerIteration * 1e9 / perIter / (1024 * 1024) : 0.0;
+    return { &bench, perIter, itemsPerSec, mbPerSec };
+}
+
+void printResult(const Result& result) {
+    auto& bench = *result.bench;
+    fmt::print("{:<40} {:>12} {:>16.0f} {:>16.0f} {:>10.1f}\n", bench.name, bench.iterations,
+               result.nsPerIteration, result.itemsPerSecond, result.megabytesPerSecond);
+    for (auto& [name, value] : bench.counters)
+        fmt::print("    {:<36} {:>12.0f}\n", name, value);
+    std::fflush(stdout);
+}
+
+nlohmann::json toJson(const Result& result) {
+    auto& bench = *result.bench;
+    nlohmann::json j;
+    j["name"] = bench.name;
+    j["iterations"] = bench.iterations;
+    j["ns_per_iteration"] = result.nsPerIteration;
+    if (bench.itemsPerIteration) {
+        j["unit"] = bench.itemName;
+        j["items_per_iteration"] = bench.itemsPerIteration;
+        j["items_per_second"] = result.itemsPerSecond;
+    }
+    if (bench.bytesPerIteration) {
+        j["bytes_per_iteration"] = bench.bytesPerIteration;
+        j["mb_per_second"] = result.megabytesPerSecond;
+    }
+
+    auto& counters = j["counters"] = nlohmann::json::object();
+    for (auto& [name, value] : bench.counters)
+        counters[name] = value;
+    return j;
+}
+
+}
+
+// Runs every registered benchmark whose name contains one of the strings given on
+// the command line, or all of them if none are given. With --json the results are
+// written to stdout as a single JSON document instead of a table, so that they can
+// be collected and compared across runs.
+int main(int argc, char** argv) {
+    bool json = false;
+    std::vector<std::string_view> filters;
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        if (arg == "--json")
+            json = true;
+        else
+            filters.push_back(arg);
+    }
+
+    auto matches = [&](std::string_view name) {
+        if (filters.empty())
+            return true;
+        for (auto filter : filters) {
+            if (name.find(filter) != std::string_view::npos)
+                return true;
+        }
+        return false;
+    };
+
+    if (!json) {
+        fmt::print("{:<40} {:>12} {:>16} {:>16} {:>10}\n", "benchmark", "iterations", "ns/iter",
+                   "items/s", "MB/s");
+    }
+
+    auto results = nlohmann::json::array();
+    for (auto& benchCase : getBenchmarks()) {
+        if (!matches(benchCase.name))
+            continue;
+
+        Benchmark bench(benchCase.name);
+        benchCase.func(bench);
+
+        auto result = getResult(bench);
+        if (json)
+            results.push_back(toJson(result));
+        else
+            printResult(result);
+    }
+
+    if (json) {
+        nlohmann::json output;
+        output["benchmarks"] = std::move(results);
+        fmt::print("{}\n", output.dump(2));
+    }
+
+    return 0;
+}
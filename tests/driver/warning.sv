@@ -0,0 +1,4 @@
+// Compiles cleanly apart from a single warning (the literal gets truncated).
+module m;
+    logic [3:0] a = 4'hFF;
+endmodule
@@ -0,0 +1,180 @@
+#include "Test.h"
+
+#include "DependencyDatabase.h"
+#include "DependencyScanner.h"
+
+namespace {
+
+FileDependencies scanText(const std::string& text) {
+    TempDir dir("scan");
+    DependencyScanner scanner;
+    return scanner.scanFile(dir.write("test.sv", text));
+}
+
+using Names = std::vector<std::string>;
+
+}
+
+TEST_CASE("Dependency scanner declarations and instances", "[depmap]") {
+    auto deps = scanText(R"(
+package pkg;
+    typedef int T;
+endpackage
+
+module top;
+    import pkg::*;
+    leaf #(.W(4)) l1(.a(1));
+    leaf l2[3:0] ();
+    other::thing x;
+endmodule
+
+interface iface; endinterface
+)");
+
+    CHECK(deps.diagnostics.empty());
+    CHECK(deps.declarations == Names{ "pkg", "top", "iface" });
+    CHECK(deps.references == Names{ "pkg", "leaf" });
+    CHECK(deps.scopeReferences == Names{ "other" });
+}
+
+TEST_CASE("Dependency scanner instances after subroutines", "[depmap]") {
+    auto deps = scanText(R"(
+module top;
+    function int f(int a);
+        return a;
+    endfunction
+    after_function u1();
+
+    task t;
+    endtask : t
+    after_task u2();
+
+    property p; 1; endproperty
+    after_property u3();
+
+    sequence s; 1; endsequence
+    after_sequence u4();
+endmodule
+
+class C;
+endclass
+module after_class_decl; endmodule
+)");
+
+    CHECK(deps.declarations == Names{ "top", "after_class_decl" });
+    CHECK(deps.references == Names{ "after_function", "after_task", "after_property", "after_sequence" });
+}
+
+TEST_CASE("Dependency scanner labeled blocks and generates", "[depmap]") {
+    auto deps = scanText(R"(
+module top;
+    begin : blk
+        inner i1();
+    end : blk
+    after_label a1();
+
+    generate
+        genmod g1();
+        if (1) begin
+            cond c1();
+        end
+        else
+            other o1();
+    endgenerate
+    after_generate a2();
+
+    for (genvar i = 0; i < 4; i++) begin : loop
+        looped l1();
+    end
+endmodule : top
+next_item n1();
+)");
+
+    CHECK(deps.references == Names{ "inner", "after_label", "genmod", "cond", "other",
+                                    "after_generate", "looped", "next_item" });
+}
+
+TEST_CASE("Dependency scanner includes and macros", "[depmap]") {
+    TempDir dir("includes");
+    std::string header = dir.write("defs.svh", "`define INST(t, n) t n();\n");
+    std::string file = dir.write("test.sv", R"(
+`include "defs.svh"
+module top;
+    `INST(from_macro, m1)
+`ifdef UNDEFINED
+    hidden h1();
+`endif
+endmodule
+)");
+
+    DependencyScanner scanner;
+    scanner.addUserDirectory(dir.path.string());
+    auto deps = scanner.scanFile(file);
+
+    CHECK(deps.diagnostics.empty());
+    CHECK(deps.references == Names{ "from_macro" });
+    REQUIRE(deps.includes.size() == 1);
+    CHECK(fs::equivalent(deps.includes[0], header));
+
+    CHECK(!scanner.scanFile((dir.path / "missing.sv").string()).diagnostics.empty());
+}
+
+TEST_CASE("Dependency database revalidation", "[depmap]") {
+    TempDir dir("database");
+    std::string header = dir.write("defs.svh", "`define W 4\n");
+    std::string file = dir.write("test.sv", "`include \"defs.svh\"\nmodule top; leaf l(); endmodule\n");
+
+    DependencyScanner scanner;
+    auto entry = DatabaseEntry::scan(scanner, file);
+    CHECK(entry.stamp.size == fs::file_size(file));
+    REQUIRE(entry.includeStamps.size() == 1);
+    CHECK(entry.includeStamps[0].second.size == fs::file_size(header));
+
+    std::string dbPath = (dir.path / "deps.db").string();
+    DependencyDatabase db(1);
+    CHECK(db.assign({ file }, { entry }));
+    REQUIRE(db.save(dbPath));
+
+    // Only the database itself should be left behind.
+    CHECK(std::distance(fs::directory_iterator(dir.path), fs::directory_iterator()) == 3);
+
+    DependencyDatabase loaded(1);
+    REQUIRE(loaded.load(dbPath));
+    CHECK(loaded.size() == 1);
+    CHECK(!DependencyDatabase(2).load(dbPath));
+
+    auto valid = loaded.revalidate(file);
+    REQUIRE(valid);
+    CHECK(valid->dependencies.references == Names{ "leaf" });
+
+    // Touching a file without changing it keeps the entry valid.
+    fs::last_write_time(header, fs::last_write_time(header) - std::chrono::hours(1));
+    CHECK(loaded.revalidate(file));
+
+    dir.write("defs.svh", "`define W 8\n");
+    CHECK(!loaded.revalidate(file));
+}
+
+TEST_CASE("Dependency database include search misses", "[depmap]") {
+    TempDir dir("database");
+    fs::create_directories(dir.path / "first");
+    fs::create_directories(dir.path / "second");
+    dir.write("second/defs.svh", "`define W 4\n");
+    std::string file = dir.write("test.sv", "`include \"defs.svh\"\nmodule top; endmodule\n");
+
+    DependencyScanner scanner;
+    scanner.addUserDirectory((dir.path / "first").string());
+    scanner.addUserDirectory((dir.path / "second").string());
+
+    auto entry = DatabaseEntry::scan(scanner, file);
+    CHECK(entry.dependencies.diagnostics.empty());
+    CHECK(entry.dependencies.missingIncludes.size() == 2);
+
+    DependencyDatabase db(1);
+    db.assign({ file }, { entry });
+    CHECK(db.revalidate(file));
+
+    // A header earlier in the search path now wins, so the file has to be rescanned.
+    dir.write("first/defs.svh", "`define W 8\n");
+    CHECK(!db.revalidate(file));
+}
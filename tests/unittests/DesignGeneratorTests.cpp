@@ -0,0 +1,66 @@
+#include "Test.h"
+
+#include "DesignGenerator.h"
+
+namespace {
+
+uint64_t countInstances(const Scope& scope) {
+    uint64_t count = 0;
+    for (auto& instance : scope.membersOfType<ModuleInstanceSymbol>())
+        count += 1 + countInstances(instance);
+    return count;
+}
+
+}
+
+TEST_CASE("Generated designs compile cleanly", "[gendesign]") {
+    DesignOptions options;
+    options.fileCount = 3;
+    options.depth = 3;
+    options.fanout = 3;
+    options.modulesPerLevel = 2;
+    options.headerCount = 2;
+
+    // Headers get found by their include directives, so the design has to be on disk.
+    TempDir dir("gendesign");
+    SourceManager sourceManager;
+    sourceManager.addUserDirectory(dir.path.string());
+
+    std::vector<std::string> sources;
+    for (auto& file : generateDesign(options)) {
+        std::string path = dir.write(file.name, file.text);
+        if (fs::path(path).extension() != ".svh")
+            sources.push_back(path);
+    }
+
+    Compilation compilation;
+    for (auto& path : sources)
+        compilation.addSyntaxTree(SyntaxTree::fromFile(path, sourceManager));
+
+    auto& diags = compilation.getAllDiagnostics();
+    if (!diags.empty())
+        FAIL_CHECK(DiagnosticWriter(sourceManager).report(diags));
+
+    auto& root = compilation.getRoot();
+    REQUIRE(root.topInstances.size() == 1);
+    CHECK(root.topInstances[0]->name == "top");
+    CHECK(countInstances(root) == countDesignInstances(options));
+}
+
+TEST_CASE("Generated designs compile cleanly (inline macros)", "[gendesign]") {
+    DesignOptions options;
+    options.depth = 2;
+    options.fanout = 8;
+    options.headerCount = 0;
+    options.packageCount = 1;
+    options.importsPerModule = 1;
+
+    Compilation compilation;
+    for (auto& file : generateDesign(options))
+        compilation.addSyntaxTree(SyntaxTree::fromText(file.text, file.name));
+    NO_COMPILATION_ERRORS;
+
+    auto& root = compilation.getRoot();
+    REQUIRE(root.topInstances.size() == 1);
+    CHECK(countInstances(root) == countDesignInstances(options));
+}
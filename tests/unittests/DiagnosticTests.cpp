@@ -1,5 +1,8 @@
 #include "Test.h"
 
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
 std::string getDiagnostic(size_t i) {
     return DiagnosticWriter(getSourceManager()).report(diagnostics[i]);
 }
@@ -81,3 +84,275 @@ TEST_CASE("keywords_errors", "[diagnostic]") {
     REQUIRE(diagnostics.size() == 1);
     CHECK(diagnostics[0].code == DiagCode::MismatchedEndKeywordsDirective);
 }
+
+TEST_CASE("Diagnostic batch reporting", "[diagnostic]") {
+    auto& sourceManager = getSourceManager();
+    SourceBuffer header = sourceManager.assignText("foo bar\nbaz");
+    SourceBuffer root = sourceManager.assignText("module m;\n  int i = `FOO;\nendmodule\n");
+    SourceBuffer include = sourceManager.assignText("wire w;\n  logic l;\n", SourceLocation(root.id, 1));
+
+    SourceLocation fooLoc(root.id, 20);
+    SourceLocation expansion = sourceManager.createExpansionLoc(SourceLocation(header.id, 4),
+                                                                fooLoc, fooLoc + 4);
+
+    // Build up enough diagnostics to get split across threads.
+    Diagnostics diags;
+    for (uint32_t i = 0; i < 5000; i++) {
+        switch (i % 4) {
+            case 0: diags.add(DiagCode::ExpectedIdentifier, SourceLocation(root.id, i % 30)); break;
+            case 1: diags.add(DiagCode::ExpectedToken, expansion + 1) << "foo"; break;
+            case 2:
+                diags.add(DiagCode::ExpectedIdentifier, SourceRange(SourceLocation(include.id, 2),
+                                                                    SourceLocation(include.id, 6)))
+                    .addNote(DiagCode::NotePreviousDefinition, SourceLocation(root.id, 3));
+                break;
+            default: diags.add(DiagCode::ExpectedMember, SourceLocation(include.id, 12)); break;
+        }
+    }
+    diags.sort(sourceManager);
+
+    DiagnosticWriter serial(sourceManager);
+    serial.setThreadCount(1);
+
+    std::string expected;
+    for (auto& diag : diags)
+        expected += serial.report(diag);
+
+    DiagnosticWriter parallel(sourceManager);
+    parallel.setThreadCount(4);
+    std::string result = parallel.report(diags);
+
+    // Apart from include stack headers, batch output should be the same as
+    // reporting each diagnostic separately.
+    CHECK(result.size() > expected.size());
+    CHECK(result.find("In file included from") != std::string::npos);
+    CHECK(result.find("note: expanded from here") != std::string::npos);
+    CHECK(result.find("note: previous definition here") != std::string::npos);
+    CHECK(result == serial.report(diags));
+}
+
+TEST_CASE("Diagnostic batch reporting errors", "[diagnostic]") {
+    auto& sourceManager = getSourceManager();
+    SourceBuffer root = sourceManager.assignText("module m;\nendmodule\n");
+
+    // A bad format string makes fmt throw while formatting, either on the
+    // calling thread (first batch) or on a worker thread (last batch).
+    for (bool badFirst : { true, false }) {
+        Diagnostics diags;
+        if (badFirst)
+            diags.add(DiagCode::ExpectedToken, SourceLocation(root.id, 0)) << "foo";
+        for (uint32_t i = 0; i < 5000; i++)
+            diags.add(DiagCode::ExpectedIdentifier, SourceLocation(root.id, i % 10));
+        if (!badFirst)
+            diags.add(DiagCode::ExpectedToken, SourceLocation(root.id, 0)) << "foo";
+
+        DiagnosticWriter writer(sourceManager);
+        writer.setThreadCount(4);
+        writer.setMessage(DiagCode::ExpectedToken, "{} {}");
+        CHECK_THROWS_AS(writer.report(diags), fmt::format_error);
+    }
+}
+
+TEST_CASE("Diagnostic JSON output", "[diagnostic]") {
+    auto& sourceManager = getSourceManager();
+    SourceBuffer root = sourceManager.assignText("source.sv", "module m;\n  int i = `FOO;\nendmodule\n");
+    SourceBuffer include = sourceManager.assignText("header.svh", "wire w;\n", SourceLocation(root.id, 1));
+
+    SourceLocation fooLoc(root.id, 20);
+    SourceLocation expansion = sourceManager.createExpansionLoc(SourceLocation(include.id, 5),
+                                                                fooLoc, fooLoc + 4);
+
+    Diagnostics diags;
+    diags.add(DiagCode::ExpectedToken, SourceRange(expansion, expansion + 1)) << "foo";
+    diags.add(DiagCode::DuplicateDefinition, SourceLocation(include.id, 5)) << "module" << "w"
+        << SourceRange(SourceLocation(include.id, 5), SourceLocation(include.id, 6));
+    diags.back().addNote(DiagCode::NotePreviousDefinition, SourceLocation(root.id, 7));
+
+    std::ostringstream stream;
+    DiagnosticWriter(sourceManager).reportJson(diags, stream);
+
+    std::string line;
+    std::vector<json> objects;
+    std::istringstream input(stream.str());
+    while (std::getline(input, line))
+        objects.push_back(json::parse(line));
+
+    REQUIRE(objects.size() == 2);
+    json& first = objects[0];
+    CHECK(first["code"] == "ExpectedToken");
+    CHECK(first["severity"] == "error");
+    CHECK(first["message"] == "expected 'foo'");
+    CHECK(first["location"]["file"] == "source.sv");
+    CHECK(first["location"]["line"] == 2);
+    CHECK(first["location"]["column"] == 11);
+    CHECK(first["args"][0] == "foo");
+    CHECK(first["expansions"][0]["file"] == "header.svh");
+    CHECK(first["ranges"][0]["start"]["column"] == 11);
+    CHECK(first.count("notes") == 0);
+
+    json& second = objects[1];
+    CHECK(second["code"] == "DuplicateDefinition");
+    CHECK(second["location"]["file"] == "header.svh");
+    CHECK(second["includeStack"][0]["file"] == "source.sv");
+    CHECK(second["includeStack"][0]["line"] == 1);
+    CHECK(second["notes"][0]["code"] == "NotePreviousDefinition");
+    CHECK(second["notes"][0]["severity"] == "note");
+    CHECK(second["notes"][0]["location"]["column"] == 8);
+}
+
+TEST_CASE("Diagnostic filtering", "[diagnostic]") {
+    auto& sourceManager = getSourceManager();
+    SourceBuffer file1 = sourceManager.assignText("filtered1.sv", "module m; endmodule");
+    SourceBuffer file2 = sourceManager.assignText("filtered2.sv", "module n; endmodule");
+    SourceLocation loc1(file1.id, 4);
+    SourceLocation loc2(file2.id, 4);
+
+    DiagnosticFilter filter(sourceManager);
+    CHECK(DiagnosticFilter::getWarningLevel(DiagCode::VectorLiteralOverflow) == 1);
+    CHECK(DiagnosticFilter::getWarningLevel(DiagCode::IgnoredMacroPaste) == 2);
+    CHECK(DiagnosticFilter::getWarningLevel(DiagCode::ExpectedIdentifier) == 0);
+
+    // Errors are never suppressed; warnings depend on the current level.
+    CHECK(!filter.isSuppressed(DiagCode::ExpectedIdentifier, loc1));
+    CHECK(!filter.isSuppressed(DiagCode::VectorLiteralOverflow, loc1));
+    CHECK(filter.isSuppressed(DiagCode::IgnoredMacroPaste, loc1));
+
+    filter.setWarningLevel(0);
+    CHECK(filter.isSuppressed(DiagCode::VectorLiteralOverflow, loc1));
+    CHECK(!filter.isSuppressed(DiagCode::ExpectedIdentifier, loc1));
+
+    filter.setEnabled(DiagCode::VectorLiteralOverflow, true);
+    CHECK(!filter.isSuppressed(DiagCode::VectorLiteralOverflow, loc1));
+
+    filter.setWarningLevel(2);
+    filter.setEnabled(DiagCode::IgnoredMacroPaste, false);
+    CHECK(filter.isSuppressed(DiagCode::IgnoredMacroPaste, loc1));
+
+    filter.suppressFile("filtered2.sv");
+    CHECK(!filter.isSuppressed(DiagCode::VectorLiteralOverflow, loc1));
+    CHECK(filter.isSuppressed(DiagCode::VectorLiteralOverflow, loc2));
+    CHECK(!filter.isSuppressed(DiagCode::ExpectedIdentifier, loc2));
+
+    // Pragma state applies from its location onward and overrides everything else.
+    filter.setPragmaState(DiagCode::VectorLiteralOverflow, SourceLocation(file1.id, 10), false);
+    filter.setPragmaState(DiagCode::VectorLiteralOverflow, SourceLocation(file1.id, 15), true);
+    CHECK(!filter.isSuppressed(DiagCode::VectorLiteralOverflow, SourceLocation(file1.id, 9)));
+    CHECK(filter.isSuppressed(DiagCode::VectorLiteralOverflow, SourceLocation(file1.id, 12)));
+    CHECK(!filter.isSuppressed(DiagCode::VectorLiteralOverflow, SourceLocation(file1.id, 16)));
+
+    CHECK(filter.getSeverity(DiagnosticSeverity::Warning) == DiagnosticSeverity::Warning);
+    filter.setWarningsAsErrors(true);
+    CHECK(filter.getSeverity(DiagnosticSeverity::Warning) == DiagnosticSeverity::Error);
+    CHECK(filter.getSeverity(DiagnosticSeverity::Note) == DiagnosticSeverity::Note);
+
+    Diagnostics diags;
+    diags.setFilter(&filter);
+    diags.add(DiagCode::VectorLiteralOverflow, loc2) << "ignored";
+    diags.add(DiagCode::VectorLiteralOverflow, loc1);
+    diags.add(DiagCode::ExpectedIdentifier, loc2);
+    REQUIRE(diags.size() == 2);
+    CHECK(diags[0].code == DiagCode::VectorLiteralOverflow);
+    CHECK(diags[1].code == DiagCode::ExpectedIdentifier);
+
+    DiagnosticWriter writer(sourceManager);
+    writer.setFilter(&filter);
+    CHECK(writer.report(diags[0]).find("error: ") != std::string::npos);
+
+    CHECK(diagCodeFromString("VectorLiteralOverflow") == DiagCode::VectorLiteralOverflow);
+    CHECK(!diagCodeFromString("NotARealDiagnostic"));
+}
+
+TEST_CASE("Diagnostic code names", "[diagnostic]") {
+    std::set<string_view> names;
+    for (int i = 0; i < (int)DiagCode::MaxValue; i++) {
+        string_view name = toString(DiagCode(i));
+        CHECK(!name.empty());
+        CHECK(names.insert(name).second);
+        CHECK(diagCodeFromString(name) == DiagCode(i));
+    }
+
+    CHECK(toString(DiagCode::NonPrintableChar) == "NonPrintableChar");
+    CHECK(toString(DiagCode::ExceededMaxGenerateIterations) == "ExceededMaxGenerateIterations");
+}
+
+TEST_CASE("Diagnostic pragmas", "[diagnostic]") {
+    auto& text = R"(
+module m;
+    int i = 4'hfff;
+`pragma diagnostic ignore="VectorLiteralOverflow"
+    int j = 4'hfff;
+`pragma diagnostic warn="VectorLiteralOverflow"
+    int k = 4'hfff;
+`pragma diagnostic ignore="Bogus"
+`pragma diagnostic frobnicate
+`pragma once_upon_a_time
+endmodule
+)";
+
+    DiagnosticFilter filter(getSourceManager());
+    DiagnosticOptions diagOptions;
+    diagOptions.filter = &filter;
+
+    Bag options;
+    options.add(diagOptions);
+
+    auto tree = SyntaxTree::fromText(text, getSourceManager(), "source", options);
+    auto& diags = tree->diagnostics();
+    REQUIRE(diags.size() == 4);
+    CHECK(diags[0].code == DiagCode::VectorLiteralOverflow);
+    CHECK(getSourceManager().getLineNumber(diags[0].location) == 3);
+    CHECK(diags[1].code == DiagCode::VectorLiteralOverflow);
+    CHECK(getSourceManager().getLineNumber(diags[1].location) == 7);
+    CHECK(diags[2].code == DiagCode::UnknownDiagnosticName);
+    CHECK(diags[3].code == DiagCode::ExpectedEndOfDirective);
+}
+
+TEST_CASE("Compilation diagnostic caching", "[diagnostic]") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    int i = 4'hfff;
+    int k = undeclared;
+    int j = 3'b1111;
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    auto& parse = compilation.getParseDiagnostics();
+    auto& semantic = compilation.getSemanticDiagnostics();
+    auto& all = compilation.getAllDiagnostics();
+    REQUIRE(parse.size() == 2);
+    REQUIRE(semantic.size() == 1);
+    REQUIRE(all.size() == 3);
+    CHECK(all[0].code == DiagCode::VectorLiteralOverflow);
+    CHECK(all[1].code == semantic[0].code);
+    CHECK(all[2].code == DiagCode::VectorLiteralOverflow);
+    CHECK(&all == &compilation.getAllDiagnostics());
+
+    // Adding more diagnostics later updates the cached results in place.
+    compilation.addError(DiagCode::ExpectedIdentifier, parse[0].location);
+    CHECK(compilation.getAllDiagnostics().size() == 4);
+    CHECK(all[1].code == DiagCode::ExpectedIdentifier);
+    CHECK(semantic.size() == 2);
+
+    // Copies of diagnostics are deep, and moves leave the arguments behind.
+    Diagnostic diag(DiagCode::DuplicateDefinition, parse[0].location);
+    diag << "module" << "foo" << "bar" << SourceRange(parse[0].location, parse[0].location + 1);
+    diag.addNote(DiagCode::NotePreviousDefinition, parse[1].location) << "baz";
+
+    Diagnostic copy = diag;
+    CHECK(copy.args.size() == 3);
+    CHECK(copy.ranges.size() == 1);
+    CHECK(copy.notes[0].args.size() == 1);
+    CHECK(std::get<std::string>(copy.args[2]) == "bar");
+
+    Diagnostic moved = std::move(copy);
+    CHECK(moved.args.size() == 3);
+    CHECK(std::get<std::string>(moved.args[0]) == "module");
+
+    moved = all[0];
+    CHECK(moved.code == DiagCode::VectorLiteralOverflow);
+    CHECK(moved.args.empty());
+    CHECK(moved.notes.empty());
+}
@@ -329,3 +329,166 @@ logic f = 1;
       ^
 )");
 }
+
+TEST_CASE("Constant eval limits", "[eval]") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    function int spin(int n);
+        for (int i = 0; i < n; i += 0)
+            n += 0;
+        return n;
+    endfunction
+
+    function int ping(int n);
+        return pong(n + 1);
+    endfunction
+
+    function int pong(int n);
+        return ping(n + 1);
+    endfunction
+
+    localparam int a = spin(1);
+    localparam int b = ping(0);
+
+    for (genvar i = 0; i < 10; i += 0) begin end
+endmodule
+)");
+
+    EvalOptions evalOptions;
+    evalOptions.maxSteps = 1000;
+    evalOptions.maxCallDepth = 32;
+    evalOptions.maxGenerateIterations = 100;
+
+    Bag options;
+    options.add(evalOptions);
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 3);
+
+    CHECK(diags[0].code == DiagCode::ExpressionNotConstant);
+    REQUIRE(diags[0].notes.size() == 2);
+    CHECK(diags[0].notes[0].code == DiagCode::NoteExceededMaxEvalSteps);
+    CHECK(diags[0].notes[1].code == DiagCode::NoteInCallTo);
+
+    // Only the innermost and outermost calls of the runaway recursion get reported.
+    CHECK(diags[1].code == DiagCode::ExpressionNotConstant);
+    REQUIRE(diags[1].notes.size() == 12);
+    CHECK(diags[1].notes[0].code == DiagCode::NoteExceededMaxCallDepth);
+    CHECK(diags[1].notes[6].code == DiagCode::NoteSkippedCallFrames);
+    CHECK(std::get<uint64_t>(diags[1].notes[6].args[0]) == 22);
+
+    CHECK(diags[2].code == DiagCode::ExceededMaxGenerateIterations);
+}
+
+TEST_CASE("Constant eval limits (branching recursion)", "[eval]") {
+    // Each call recurses twice, so after hitting the depth limit the unwinding
+    // callers keep trying to go deeper; the limit should only be reported once.
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    function int ping(int n);
+        return pong(n + 1) + pong(n + 1);
+    endfunction
+
+    function int pong(int n);
+        return ping(n + 1) + ping(n + 1);
+    endfunction
+
+    localparam int p = ping(0);
+endmodule
+)");
+
+    EvalOptions evalOptions;
+    evalOptions.maxCallDepth = 32;
+
+    Bag options;
+    options.add(evalOptions);
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == DiagCode::ExpressionNotConstant);
+    REQUIRE(diags[0].notes.size() == 12);
+    CHECK(diags[0].notes[0].code == DiagCode::NoteExceededMaxCallDepth);
+
+    auto depthNotes = std::count_if(diags[0].notes.begin(), diags[0].notes.end(),
+        [](auto& note) { return note.code == DiagCode::NoteExceededMaxCallDepth; });
+    CHECK(depthNotes == 1);
+}
+
+TEST_CASE("Constant eval limits (parameter values)", "[eval]") {
+    // Parameter values that fail to evaluate must not get re-evaluated with
+    // the default limits, which would take far longer than the configured ones.
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    function int spin(int n);
+        for (int i = 0; i < n; i += 0)
+            n += 0;
+        return n;
+    endfunction
+
+    localparam a = spin(1);
+    localparam int b = spin(2);
+endmodule
+)");
+
+    EvalOptions evalOptions;
+    evalOptions.maxSteps = 1000;
+
+    Bag options;
+    options.add(evalOptions);
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 2);
+    CHECK(diags[0].code == DiagCode::ExpressionNotConstant);
+    CHECK(diags[1].code == DiagCode::ExpressionNotConstant);
+
+    auto steps = compilation.getStatistics().counters[size_t(PerfCounter::ConstantEvalSteps)];
+    CHECK(steps < 10 * evalOptions.maxSteps);
+}
+
+TEST_CASE("Constant eval limits (range select bounds)", "[eval]") {
+    // A range select bound that runs into a limit gets reported instead of
+    // being used as if it had evaluated to an integer.
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    function int spin(int n);
+        for (int i = 0; i < n; i += 0)
+            n += 0;
+        return n;
+    endfunction
+
+    logic [7:0] a;
+    logic [3:0] b;
+    initial begin
+        b = a[spin(1):0];
+        b = a[0+:spin(2)];
+    end
+endmodule
+)");
+
+    EvalOptions evalOptions;
+    evalOptions.maxSteps = 1000;
+
+    Bag options;
+    options.add(evalOptions);
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 2);
+    for (auto& diag : diags) {
+        CHECK(diag.code == DiagCode::ExpressionNotConstant);
+        REQUIRE(diag.notes.size() == 2);
+        CHECK(diag.notes[0].code == DiagCode::NoteExceededMaxEvalSteps);
+        CHECK(diag.notes[1].code == DiagCode::NoteInCallTo);
+    }
+}
@@ -235,7 +235,7 @@ TEST_CASE("Expression types") {
     declare("struct packed { logic [13:0] a; bit b; } foo;");
     CHECK(typeof("foo.a") == "logic[13:0]");
 
-    Diagnostics diags = compilation.getAllDiagnostics();
+    auto& diags = compilation.getAllDiagnostics();
     REQUIRE(diags.size() == 2);
     CHECK(diags[0].code == DiagCode::BadUnaryExpression);
     CHECK(diags[1].code == DiagCode::BadBinaryExpression);
@@ -255,7 +255,7 @@ endmodule
     Compilation compilation;
     compilation.addSyntaxTree(tree);
 
-    Diagnostics diags = compilation.getAllDiagnostics();
+    auto& diags = compilation.getAllDiagnostics();
     REQUIRE(diags.size() == 3);
     CHECK(diags[0].code == DiagCode::NotAValue);
     CHECK(diags[1].code == DiagCode::ExpressionNotCallable);
@@ -279,7 +279,7 @@ endmodule
     Compilation compilation;
     compilation.addSyntaxTree(tree);
 
-    Diagnostics diags = compilation.getAllDiagnostics();
+    auto& diags = compilation.getAllDiagnostics();
     REQUIRE(diags.size() == 4);
     CHECK(diags[0].code == DiagCode::ExpectedExpression);
     CHECK(diags[1].code == DiagCode::ExpectedExpression);
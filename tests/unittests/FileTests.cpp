@@ -65,3 +65,120 @@ TEST_CASE("Read header (include dirs)", "[files]") {
     buffer = manager.readHeader("../infinite_chain.svh", SourceLocation(buffer.id, 0), false);
     CHECK(buffer);
 }
+
+TEST_CASE("Macro expansion locations", "[files]") {
+    SourceManager manager;
+    SourceBuffer buffer = manager.assignText("`FOO `BAR");
+    REQUIRE(buffer);
+
+    SourceLocation fileLoc(buffer.id, 5);
+    SourceLocation defLoc(buffer.id, 1);
+    CHECK(manager.isFileLoc(fileLoc));
+    CHECK(!manager.isMacroLoc(fileLoc));
+    CHECK(!manager.isFileLoc(SourceLocation()));
+    CHECK(!manager.isMacroLoc(SourceLocation()));
+
+    // Nest a few levels of expansions; each one should resolve straight
+    // back to the original file location.
+    SourceLocation outer = manager.createExpansionLoc(defLoc, fileLoc, fileLoc + 4);
+    SourceLocation middle = manager.createExpansionLoc(defLoc, outer + 2, outer + 6);
+    SourceLocation inner = manager.createExpansionLoc(defLoc, middle + 1, middle + 1);
+
+    for (SourceLocation loc : { outer, middle, inner }) {
+        CHECK(manager.isMacroLoc(loc));
+        CHECK(!manager.isFileLoc(loc));
+        CHECK(manager.getFullyExpandedLoc(loc + 3) == fileLoc);
+        CHECK(manager.getLineNumber(loc) == 1);
+        CHECK(manager.getFileName(loc) == manager.getRawFileName(buffer.id));
+    }
+
+    CHECK(manager.getExpansionLoc(middle) == outer + 2);
+    CHECK(manager.getExpansionRange(middle).end() == outer + 6);
+    CHECK(manager.getExpansionRange(outer).start() == fileLoc);
+    CHECK(manager.getExpansionRange(outer).end() == fileLoc + 4);
+    CHECK(manager.getOriginalLoc(inner + 2) == defLoc + 2);
+    CHECK(!manager.getIncludedFrom(inner.buffer()));
+
+    // Expansions are numbered separately from file buffers.
+    SourceBuffer buffer2 = manager.assignText("foo");
+    CHECK(buffer2.id.getId() == buffer.id.getId() + 1);
+}
+
+TEST_CASE("Compilation unit ordering", "[files]") {
+    SourceManager manager;
+    SourceBuffer root = manager.assignText("0123456789abcdefghij");
+    SourceBuffer child = manager.assignText("0123456789", SourceLocation(root.id, 10));
+    SourceBuffer grandchild = manager.assignText("01234", SourceLocation(child.id, 3));
+    SourceBuffer sibling = manager.assignText("01234", SourceLocation(root.id, 15));
+    SourceBuffer root2 = manager.assignText("0123");
+
+    SourceLocation before(root.id, 9);
+    SourceLocation directive(root.id, 10);
+    SourceLocation after(root.id, 11);
+    SourceLocation inChild(child.id, 5);
+    SourceLocation inGrandchild(grandchild.id, 4);
+    SourceLocation inSibling(sibling.id, 0);
+    SourceLocation end(root.id, 19);
+    SourceLocation other(root2.id, 0);
+
+    std::vector<SourceLocation> ordered = { before, directive, SourceLocation(child.id, 0),
+                                            inGrandchild, inChild, after, inSibling, end, other };
+    for (size_t i = 0; i < ordered.size(); i++) {
+        for (size_t j = 0; j < ordered.size(); j++) {
+            CHECK(manager.isBeforeInCompilationUnit(ordered[i], ordered[j]) == (i < j));
+            CHECK((manager.getCompilationUnitPosition(ordered[i]) <
+                   manager.getCompilationUnitPosition(ordered[j])) == (i < j));
+        }
+    }
+
+    // Tokens within a single expansion still get ordered correctly.
+    SourceLocation expansion = manager.createExpansionLoc(before, after, after + 2);
+    CHECK(manager.isBeforeInCompilationUnit(expansion, expansion + 1));
+    CHECK(!manager.isBeforeInCompilationUnit(expansion + 1, expansion));
+    CHECK(manager.isBeforeInCompilationUnit(inChild, expansion + 1));
+    CHECK(manager.isBeforeInCompilationUnit(expansion, inSibling));
+
+    // Adding new buffers after positions have been computed should be picked up.
+    SourceBuffer late = manager.assignText("01", SourceLocation(grandchild.id, 1));
+    CHECK(manager.isBeforeInCompilationUnit(SourceLocation(late.id, 1), inGrandchild));
+    CHECK(manager.isBeforeInCompilationUnit(SourceLocation(grandchild.id, 0), SourceLocation(late.id, 0)));
+
+    Diagnostics diags;
+    diags.add(DiagCode::ExpectedIdentifier, end);
+    diags.add(DiagCode::ExpectedIdentifier, inChild);
+    diags.add(DiagCode::ExpectedIdentifier, before);
+    diags.add(DiagCode::ExpectedIdentifier, inSibling);
+    diags.sort(manager);
+
+    REQUIRE(diags.size() == 4);
+    CHECK(diags[0].location == before);
+    CHECK(diags[1].location == inChild);
+    CHECK(diags[2].location == inSibling);
+    CHECK(diags[3].location == end);
+}
+
+TEST_CASE("Line and column numbers", "[files]") {
+    // Build a file big enough to span several scanning chunks, mixing all
+    // of the supported newline styles.
+    const char* newlines[] = { "\n", "\r\n", "\n\r", "\r" };
+    std::string text;
+    std::vector<std::pair<uint32_t, uint32_t>> lines;
+    for (uint32_t i = 0; text.size() < 300000; i++) {
+        lines.emplace_back((uint32_t)text.size(), i % 97 + 1);
+        text.append(i % 97 + 1, 'x');
+        text += newlines[i % 4];
+    }
+
+    SourceManager manager;
+    SourceBuffer buffer = manager.assignText(text);
+
+    // Look things up out of order so that the lazy scanning has to
+    // pick up where it left off.
+    for (uint32_t i : { 2500u, 17u, 0u, 4999u, 2501u, (uint32_t)lines.size() - 1 }) {
+        auto [start, length] = lines[i];
+        CHECK(manager.getLineNumber(SourceLocation(buffer.id, start)) == i + 1);
+        CHECK(manager.getColumnNumber(SourceLocation(buffer.id, start)) == 1);
+        CHECK(manager.getLineNumber(SourceLocation(buffer.id, start + length - 1)) == i + 1);
+        CHECK(manager.getColumnNumber(SourceLocation(buffer.id, start + length - 1)) == length);
+    }
+}
@@ -1,5 +1,7 @@
 #include "Test.h"
 
+#include "symbols/ASTVisitor.h"
+
 TEST_CASE("Finding top level", "[binding:decls]") {
     auto file1 = SyntaxTree::fromText("module A; A a(); endmodule\nmodule B; endmodule\nmodule C; endmodule");
     auto file2 = SyntaxTree::fromText("module D; B b(); E e(); endmodule\nmodule E; module C; endmodule C c(); endmodule");
@@ -55,7 +57,7 @@ endmodule
     CHECK(it->name == "l8"); it++;
     CHECK(it->name == "l9"); it++;
 
-    Diagnostics diags = compilation.getSemanticDiagnostics();
+    auto& diags = compilation.getSemanticDiagnostics();
     REQUIRE(diags.size() == 10);
     CHECK(diags[0].code == DiagCode::ParamHasNoValue);
     CHECK(diags[1].code == DiagCode::TooManyParamAssignments);
@@ -322,7 +324,7 @@ endmodule
     Compilation compilation;
     compilation.addSyntaxTree(tree);
 
-    Diagnostics diags = compilation.getAllDiagnostics();
+    auto& diags = compilation.getAllDiagnostics();
     std::string str = DiagnosticWriter{ SyntaxTree::getDefaultSourceManager() }.report(diags);
     // TODO: $bits() function should check argument even though it's not evaluated
     //REQUIRE(diags.size() == 5);
@@ -332,4 +334,290 @@ endmodule
     CHECK(diags[2].code == DiagCode::ExpressionNotConstant);
     CHECK(diags[3].code == DiagCode::RecursiveDefinition);
     //CHECK(diags[4].code == DiagCode::ExpressionNotConstant);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Iterative AST traversal", "[binding:modules]") {
+    auto tree = SyntaxTree::fromText(R"(
+module Top;
+    function int foo(int a);
+        int b;
+        b = a + 1;
+        if (b > 2) return b * (a - 1);
+        else return -a;
+    endfunction
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    struct Visitor : public ASTVisitor<Visitor> {
+        std::vector<StatementKind> statements;
+        std::vector<BinaryOperator> binaryOps;
+        size_t symbols = 0;
+        size_t exits = 0;
+        bool skipSubroutines = false;
+        bool stopAtReturn = false;
+
+        VisitAction preVisit(const Symbol&) {
+            symbols++;
+            return VisitAction::Continue;
+        }
+
+        VisitAction preVisit(const SubroutineSymbol&) {
+            return skipSubroutines ? VisitAction::SkipChildren : VisitAction::Continue;
+        }
+
+        VisitAction preVisit(const Statement& stmt) {
+            statements.push_back(stmt.kind);
+            if (stopAtReturn && stmt.kind == StatementKind::Return)
+                return VisitAction::Stop;
+            return VisitAction::Continue;
+        }
+
+        VisitAction preVisit(const BinaryExpression& expr) {
+            binaryOps.push_back(expr.op);
+            return VisitAction::Continue;
+        }
+
+        void postVisit(const BinaryExpression&) { exits++; }
+    };
+
+    Visitor visitor;
+    CHECK(visitor.traverse(compilation.getRoot()));
+    CHECK(visitor.symbols > 0);
+    CHECK(visitor.statements == std::vector<StatementKind>{
+        StatementKind::List, StatementKind::VariableDeclaration, StatementKind::ExpressionStatement,
+        StatementKind::Conditional, StatementKind::Return, StatementKind::Return });
+    CHECK(visitor.binaryOps == std::vector<BinaryOperator>{
+        BinaryOperator::Add, BinaryOperator::GreaterThan,
+        BinaryOperator::Multiply, BinaryOperator::Subtract });
+    CHECK(visitor.exits == 4);
+
+    Visitor skipper;
+    skipper.skipSubroutines = true;
+    CHECK(skipper.traverse(compilation.getRoot()));
+    CHECK(skipper.statements.empty());
+    CHECK(skipper.binaryOps.empty());
+
+    Visitor stopper;
+    stopper.stopAtReturn = true;
+    CHECK(!stopper.traverse(compilation.getRoot()));
+    CHECK(stopper.statements.back() == StatementKind::Return);
+    CHECK(stopper.binaryOps == std::vector<BinaryOperator>{ BinaryOperator::Add, BinaryOperator::GreaterThan });
+    CHECK(stopper.exits == 2);
+}
+
+TEST_CASE("Replace syntax tree", "[binding:modules]") {
+    auto file1 = SyntaxTree::fromText(R"(
+package P;
+    parameter int x = 4;
+endpackage
+
+module Leaf;
+    parameter int w = P::x;
+endmodule
+)");
+    auto file2 = SyntaxTree::fromText("module Top1; Leaf l(); endmodule");
+    auto file3 = SyntaxTree::fromText("module Top2; parameter int p = 1; endmodule");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(file1);
+    compilation.addSyntaxTree(file2);
+    compilation.addSyntaxTree(file3);
+
+    const RootSymbol& root = compilation.getRoot();
+    REQUIRE(root.topInstances.size() == 2);
+    const ModuleInstanceSymbol* top1 = root.topInstances[0];
+    NO_COMPILATION_ERRORS;
+
+    auto leafWidth = [&] {
+        auto& leaf = root.topInstances[0]->memberAt<ModuleInstanceSymbol>(0);
+        return leaf.memberAt<ParameterSymbol>(0).getValue().integer();
+    };
+    CHECK(leafWidth() == 4);
+
+    // Breaking Top2 only rebuilds Top2.
+    auto brokenFile3 = SyntaxTree::fromText("module Top2; parameter int p = foo; endmodule");
+    compilation.replaceSyntaxTree(file3, brokenFile3);
+    REQUIRE(root.topInstances.size() == 2);
+    CHECK(root.topInstances[0] == top1);
+    CHECK(root.topInstances[1]->name == "Top2");
+    const ModuleInstanceSymbol* top2 = root.topInstances[1];
+
+    auto& diags = compilation.getSemanticDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == DiagCode::UndeclaredIdentifier);
+
+    // Changing the package rebuilds everything that uses it, but Top2 and its
+    // diagnostic are reused as-is.
+    auto newFile1 = SyntaxTree::fromText(R"(
+package P;
+    parameter int x = 8;
+endpackage
+
+module Leaf;
+    parameter int w = P::x;
+endmodule
+)");
+    compilation.replaceSyntaxTree(file1, newFile1);
+    REQUIRE(root.topInstances.size() == 2);
+    CHECK(root.topInstances[0] != top1);
+    CHECK(root.topInstances[1] == top2);
+    CHECK(leafWidth() == 8);
+    CHECK(compilation.getSemanticDiagnostics().size() == 1);
+
+    // Instantiating Top1 from Top2 makes Top2 the only top level instance.
+    auto fixedFile3 = SyntaxTree::fromText("module Top2; Top1 t(); endmodule");
+    compilation.replaceSyntaxTree(brokenFile3, fixedFile3);
+    REQUIRE(root.topInstances.size() == 1);
+    CHECK(root.topInstances[0]->name == "Top2");
+    CHECK(compilation.getSyntaxTrees()[2] == fixedFile3);
+    NO_COMPILATION_ERRORS;
+
+    CHECK_THROWS(compilation.replaceSyntaxTree(file3, fixedFile3));
+}
+
+TEST_CASE("Replace syntax tree with duplicate definitions", "[binding:modules]") {
+    auto file1 = SyntaxTree::fromText("module foo; endmodule");
+    auto file2 = SyntaxTree::fromText("module foo; logic a; endmodule");
+    auto file3 = SyntaxTree::fromText("module top; foo f(); endmodule");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(file1);
+    compilation.addSyntaxTree(file2);
+    compilation.addSyntaxTree(file3);
+
+    const RootSymbol& root = compilation.getRoot();
+    REQUIRE(root.topInstances.size() == 1);
+    CHECK(!root.topInstances[0]->memberAt<ModuleInstanceSymbol>(0).find("a"));
+
+    // The first foo won out; once it's gone the second one has to take its place,
+    // the same as in a fresh compilation of the remaining trees.
+    auto newFile1 = SyntaxTree::fromText("module bar; endmodule");
+    compilation.replaceSyntaxTree(file1, newFile1);
+    REQUIRE(root.topInstances.size() == 2);
+    CHECK(root.topInstances[0]->name == "bar");
+    CHECK(root.topInstances[1]->name == "top");
+
+    auto& f = root.topInstances[1]->memberAt<ModuleInstanceSymbol>(0);
+    CHECK(f.name == "f");
+    CHECK(f.find("a"));
+    NO_COMPILATION_ERRORS;
+
+    // Bringing the first foo back makes it win again.
+    compilation.replaceSyntaxTree(newFile1, file1);
+    REQUIRE(root.topInstances.size() == 1);
+    CHECK(!root.topInstances[0]->memberAt<ModuleInstanceSymbol>(0).find("a"));
+}
+
+TEST_CASE("Replace syntax tree repeatedly", "[binding:modules]") {
+    // Simulates re-linting a file every time it's saved: once the compilation has
+    // used up its replacements it gets recreated, which keeps memory bounded.
+    CompilationOptions compOptions;
+    compOptions.maxSyntaxTreeReplacements = 8;
+
+    Bag options;
+    options.add(compOptions);
+
+    auto makeTree = [](int i) {
+        return SyntaxTree::fromText("module Top; parameter int p = " + std::to_string(i) + "; Leaf l(); endmodule");
+    };
+    auto leaf = SyntaxTree::fromText("module Leaf; logic [3:0] a, b, c; endmodule");
+
+    std::shared_ptr<SyntaxTree> tree = makeTree(0);
+    auto compilation = std::make_unique<Compilation>(options);
+    compilation->addSyntaxTree(leaf);
+    compilation->addSyntaxTree(tree);
+    compilation->getRoot();
+
+    size_t firstCycleBytes = 0;
+    size_t maxBytes = 0;
+    int recreated = 0;
+
+    for (int i = 1; i <= 100; i++) {
+        auto newTree = makeTree(i);
+        if (!compilation->replaceSyntaxTree(tree, newTree)) {
+            compilation = std::make_unique<Compilation>(options);
+            compilation->addSyntaxTree(leaf);
+            compilation->addSyntaxTree(newTree);
+            recreated++;
+        }
+        tree = newTree;
+
+        auto& root = compilation->getRoot();
+        REQUIRE(root.topInstances.size() == 1);
+        CHECK(root.topInstances[0]->memberAt<ParameterSymbol>(0).getValue().integer() == i);
+        maxBytes = std::max(maxBytes, compilation->getStats().bytesUsed);
+        if (!recreated)
+            firstCycleBytes = maxBytes;
+    }
+
+    // Every later compilation goes through the same cycle as the first one,
+    // so none of them should end up any bigger.
+    CHECK(recreated == 100 / 9);
+    CHECK(maxBytes < firstCycleBytes + firstCycleBytes / 4);
+}
+
+TEST_CASE("Compilation statistics", "[binding:modules]") {
+    Compilation compilation;
+    auto tree = SyntaxTree::fromText(R"(
+package p;
+    parameter int Width = 4;
+endpackage
+
+module Top;
+    Mid m1();
+    Mid m2();
+endmodule
+
+module Mid;
+    import p::*;
+    Leaf #(Width) l1();
+    Leaf #(Width * 2) l2();
+endmodule
+
+module Leaf #(parameter int W = 1);
+    logic [W-1:0] value;
+endmodule
+)");
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto stats = compilation.getStatistics();
+    CHECK(stats.counters[size_t(PerfCounter::Instances)] == 7);
+    // The tree was parsed after the compilation was created, so its tokens count too.
+    CHECK(stats.counters[size_t(PerfCounter::TokensLexed)] > 50);
+    CHECK(stats.counters[size_t(PerfCounter::WildcardImportProbes)] >= 2);
+    CHECK(stats.counters[size_t(PerfCounter::LookupScopesSearched)] >=
+          stats.counters[size_t(PerfCounter::NameLookups)]);
+
+    REQUIRE(stats.instancesPerDefinition.size() == 3);
+    CHECK(stats.instancesPerDefinition[0] == std::make_pair("Leaf"sv, size_t(4)));
+    CHECK(stats.instancesPerDefinition[1] == std::make_pair("Mid"sv, size_t(2)));
+    CHECK(stats.instancesPerDefinition[2] == std::make_pair("Top"sv, size_t(1)));
+
+    // Replacing the tree rebuilds every instance; the counts describe the new design only.
+    auto newTree = SyntaxTree::fromText(R"(
+module Top;
+    Mid m1();
+endmodule
+
+module Mid;
+    Leaf #(3) l1();
+endmodule
+
+module Leaf #(parameter int W = 1);
+    logic [W-1:0] value;
+endmodule
+)");
+    compilation.replaceSyntaxTree(tree, newTree);
+    NO_COMPILATION_ERRORS;
+
+    stats = compilation.getStatistics();
+    REQUIRE(stats.instancesPerDefinition.size() == 3);
+    CHECK(stats.instancesPerDefinition[0] == std::make_pair("Leaf"sv, size_t(1)));
+    CHECK(stats.instancesPerDefinition[1] == std::make_pair("Mid"sv, size_t(1)));
+    CHECK(stats.instancesPerDefinition[2] == std::make_pair("Top"sv, size_t(1)));
+}
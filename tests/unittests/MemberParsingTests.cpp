@@ -1,5 +1,7 @@
 #include "Test.h"
 
+#include "parsing/TokenPipeline.h"
+
 TEST_CASE("Simple module", "[parser:modules]") {
     auto& text = "module foo(); endmodule";
     const auto& module = parseModule(text);
@@ -137,4 +139,69 @@ a1: assert property (@(posedge clk) a |-> p3);
     REQUIRE(coverStatement);
     REQUIRE(assertStatement);
     CHECK_DIAGNOSTICS_EMPTY;
-}
\ No newline at end of file
+}
+
+TEST_CASE("Pipelined parsing", "[parser]") {
+    // Enough text to wrap around the pipeline's ring buffer a few times, with
+    // macros, a preprocessor error, and a parse error mixed in.
+    std::string text = "`define ADD(a, b) ((a) + (b))\n";
+    for (int i = 0; i < 500; i++) {
+        auto n = std::to_string(i);
+        text += "module m" + n + "(input logic [7:0] a, b, output logic [8:0] c);\n";
+        text += "    assign c = `ADD(a, b) + " + n + ";\n";
+        if (i == 250)
+            text += "    `undefined_macro\n    int x = ;\n";
+        text += "endmodule\n";
+    }
+
+    ParserOptions parserOptions;
+    parserOptions.pipelined = true;
+    Bag options;
+    options.add(parserOptions);
+
+    auto sequential = SyntaxTree::fromText(text, getSourceManager(), "source");
+    auto pipelined = SyntaxTree::fromText(text, getSourceManager(), "source", options);
+    CHECK(pipelined->root().toString() == sequential->root().toString());
+
+    auto& expected = sequential->diagnostics();
+    auto& actual = pipelined->diagnostics();
+    expected.sort(getSourceManager());
+    actual.sort(getSourceManager());
+    REQUIRE(actual.size() == expected.size());
+    REQUIRE(actual.size() == 2);
+    for (size_t i = 0; i < actual.size(); i++) {
+        CHECK(actual[i].code == expected[i].code);
+        CHECK(getSourceManager().getLineNumber(actual[i].location) ==
+              getSourceManager().getLineNumber(expected[i].location));
+    }
+}
+
+TEST_CASE("Pipelined parsing stops early", "[parser]") {
+    // The guess only takes the leading expression, leaving thousands of tokens behind
+    // it; the preprocessor thread is still running (blocked on a full ring buffer)
+    // when the pipeline is destroyed, and has to be shut down cleanly.
+    std::string text = "a + b;\n";
+    for (int i = 0; i < 2000; i++)
+        text += "logic [7:0] v" + std::to_string(i) + " = 8'd" + std::to_string(i % 256) + ";\n";
+    text += "`undefined_macro\n";
+
+    BumpAllocator preprocessorAlloc;
+    Diagnostics preprocessorDiagnostics;
+    BumpAllocator parserAlloc;
+    Diagnostics parserDiagnostics;
+    {
+        Preprocessor preprocessor(getSourceManager(), preprocessorAlloc, preprocessorDiagnostics);
+        preprocessor.pushSource(string_view(text));
+
+        TokenPipeline pipeline(preprocessor);
+        Parser parser(pipeline, parserAlloc, parserDiagnostics);
+
+        auto& node = parser.parseGuess();
+        REQUIRE(node.kind == SyntaxKind::AddExpression);
+        CHECK(node.toString(SyntaxToStringFlags::IncludeTrivia) == "a + b");
+    }
+
+    // The error at the very end of the input was never reached.
+    CHECK(parserDiagnostics.empty());
+    CHECK(preprocessorDiagnostics.empty());
+}
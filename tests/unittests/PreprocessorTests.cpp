@@ -1,9 +1,9 @@
 #include "Test.h"
 
-std::string preprocess(string_view text) {
+std::string preprocess(string_view text, const Bag& options = {}) {
     diagnostics.clear();
 
-    Preprocessor preprocessor(getSourceManager(), alloc, diagnostics);
+    Preprocessor preprocessor(getSourceManager(), alloc, diagnostics, options);
     preprocessor.pushSource(text);
 
     std::string result;
@@ -523,6 +523,114 @@ TEST_CASE("Macro nested implicit concatenate", "[preprocessor]") {
     CHECK_DIAGNOSTICS_EMPTY;
 }
 
+TEST_CASE("Macro repeated expansion", "[preprocessor]") {
+    auto& text = R"(
+`define INNER(x) (x + 1)
+`define OUTER(a, b) `INNER(a) * b
+
+`OUTER(foo, 2) `OUTER(foo, 2)
+`OUTER(foo, 2)
+)";
+
+    auto& expected = R"(
+(foo + 1) * 2 (foo + 1) * 2
+(foo + 1) * 2
+)";
+
+    diagnostics.clear();
+    Preprocessor preprocessor(getSourceManager(), alloc, diagnostics);
+    preprocessor.pushSource(text);
+
+    // Each expansion should map back to its own usage site, even when it
+    // was replayed from a previous identical usage.
+    auto& sm = getSourceManager();
+    std::string result;
+    std::vector<uint32_t> argOffsets;
+    std::vector<uint32_t> bodyOffsets;
+    while (true) {
+        Token token = preprocessor.next();
+        result += token.toString(SyntaxToStringFlags::IncludePreprocessed | SyntaxToStringFlags::IncludeTrivia);
+        if (token.kind == TokenKind::EndOfFile)
+            break;
+
+        if (token.kind == TokenKind::Identifier) {
+            CHECK(sm.isFileLoc(token.location()));
+            argOffsets.push_back(token.location().offset());
+        }
+        else if (token.kind == TokenKind::Star) {
+            CHECK(sm.isMacroLoc(token.location()));
+            bodyOffsets.push_back(sm.getFullyExpandedLoc(token.location()).offset());
+        }
+    }
+
+    CHECK(result == expected);
+    CHECK_DIAGNOSTICS_EMPTY;
+
+    std::string str = text;
+    size_t first = str.find("`OUTER(foo, 2) ");
+    size_t second = str.find("`OUTER(foo, 2)", first + 1);
+    size_t third = str.find("`OUTER(foo, 2)", second + 1);
+
+    CHECK(argOffsets == std::vector<uint32_t>{ uint32_t(first + 7), uint32_t(second + 7), uint32_t(third + 7) });
+    CHECK(bodyOffsets == std::vector<uint32_t>{ uint32_t(first), uint32_t(second), uint32_t(third) });
+}
+
+TEST_CASE("Macro repeated expansion with distinct arguments", "[preprocessor]") {
+    // Usages whose arguments are all different never get replayed, and
+    // only get cached once the same usage has been seen twice.
+    std::string text = "`define LOG(msg, id) $display(msg, id);\n";
+    for (int i = 0; i < 100; i++)
+        text += "`LOG(\"message " + std::to_string(i) + "\", " + std::to_string(i) + ")\n";
+    text += "`LOG(\"again\", 0)\n`LOG(\"again\", 0)\n`LOG(\"again\", 0)\n";
+
+    auto replayed = [] { return PerfCounters::getTotals()[size_t(PerfCounter::MacroExpansionsReplayed)]; };
+    auto before = replayed();
+
+    std::string result = preprocess(text);
+    CHECK_DIAGNOSTICS_EMPTY;
+    CHECK(result.find("$display(\"message 99\", 99);") != std::string::npos);
+    CHECK(replayed() - before == 1);
+}
+
+TEST_CASE("Macro repeated expansion after redefinition", "[preprocessor]") {
+    auto& text = R"(
+`define A 1
+`define B `A
+
+`B
+`undef A
+`define A 2
+
+`B
+)";
+
+    auto& expected = R"(
+1
+2
+)";
+
+    std::string result = preprocess(text);
+    CHECK(result == expected);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
+TEST_CASE("Macro repeated expansion with intrinsic", "[preprocessor]") {
+    auto& text = "`define L `__LINE__\n`L\n`L";
+
+    diagnostics.clear();
+    Preprocessor preprocessor(getSourceManager(), alloc, diagnostics);
+    preprocessor.pushSource(text);
+
+    Token token = preprocessor.next();
+    REQUIRE(token.kind == TokenKind::IntegerLiteral);
+    CHECK(token.intValue() == 2);
+
+    token = preprocessor.next();
+    REQUIRE(token.kind == TokenKind::IntegerLiteral);
+    CHECK(token.intValue() == 3);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
 TEST_CASE("IfDef branch (taken)", "[preprocessor]") {
     auto& text = "`define FOO\n`ifdef FOO\n42\n`endif";
     Token token = lexToken(text);
@@ -695,6 +803,28 @@ TEST_CASE("FILE Directive (include+nesting)", "[preprocessor]") {
     CHECK_DIAGNOSTICS_EMPTY;
 }
 
+TEST_CASE("Included files are recorded", "[preprocessor]") {
+    auto& text =
+"`include \"file_uses_defn.svh\"\n"
+"`include \"nonexistent.svh\"\n"
+"`include \"local.svh\"\n";
+
+    diagnostics.clear();
+    Preprocessor preprocessor(getSourceManager(), alloc, diagnostics);
+    preprocessor.pushSource(text);
+    while (preprocessor.next().kind != TokenKind::EndOfFile) {}
+
+    auto& sm = getSourceManager();
+    auto included = preprocessor.getIncludedFiles();
+    REQUIRE(included.size() == 3);
+    CHECK(fs::path(sm.getRawFileName(included[0])).filename() == "file_uses_defn.svh");
+    CHECK(fs::path(sm.getRawFileName(included[1])).filename() == "file_defn.svh");
+    CHECK(fs::path(sm.getRawFileName(included[2])).filename() == "local.svh");
+
+    REQUIRE(diagnostics.size() == 1);
+    CHECK(diagnostics[0].code == DiagCode::CouldNotOpenIncludeFile);
+}
+
 TEST_CASE("`line + FILE + LINE Directive", "[preprocessor]") {
     auto& text =
 "`line 6 \"other.sv\" 0\n"
@@ -897,6 +1027,88 @@ TEST_CASE("macro-defined include file", "[preprocessor]") {
     CHECK(!diagnostics.empty());
 }
 
+TEST_CASE("Macro expansion depth limit", "[preprocessor]") {
+    auto& text =
+"`define FOO `BAR\n"
+"`define BAR `FOO\n"
+"`FOO";
+
+    PreprocessorOptions ppOptions;
+    ppOptions.maxMacroExpansionDepth = 16;
+
+    Bag options;
+    options.add(ppOptions);
+
+    preprocess(text, options);
+    REQUIRE(diagnostics.size() == 1);
+    CHECK(diagnostics[0].code == DiagCode::ExceededMaxMacroExpansionDepth);
+
+    // The chain of expansions is reported, minus the middle of it.
+    std::string report = DiagnosticWriter(getSourceManager()).report(diagnostics[0]);
+    CHECK(report.find("exceeded max macro expansion depth of 16") != std::string::npos);
+    CHECK(report.find("note: (skipping 6 expansions)") != std::string::npos);
+}
+
+TEST_CASE("Macro expansion depth limit (many usages)", "[preprocessor]") {
+    // Lots of usages at the same level of nesting don't count toward the depth.
+    std::string text = "`define E(x) x\n`define LIST ";
+    std::string expected;
+    for (int i = 0; i < 300; i++) {
+        if (i) {
+            text += ",";
+            expected += ",";
+        }
+        text += "`E(" + std::to_string(i) + ")";
+        expected += std::to_string(i);
+    }
+    text += "\n'{`LIST}";
+
+    std::string result = preprocess(text);
+    CHECK(result == "'{" + expected + "}");
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
+TEST_CASE("Macro expansion token limit", "[preprocessor]") {
+    auto& text =
+"`define A0 x\n"
+"`define A1 `A0 `A0\n"
+"`define A2 `A1 `A1\n"
+"`define A3 `A2 `A2\n"
+"`define A4 `A3 `A3\n"
+"`define A5 `A4 `A4\n"
+"`define A6 `A5 `A5\n"
+"`A6 `A6 `A6 `A6 `A0";
+
+    PreprocessorOptions ppOptions;
+    ppOptions.maxExpandedTokens = 200;
+
+    Bag options;
+    options.add(ppOptions);
+
+    // Once the limit is hit, no further macros get expanded or reported.
+    std::string result = preprocess(text, options);
+    CHECK(result.find("`A0") == std::string::npos);
+    REQUIRE(diagnostics.size() == 1);
+    CHECK(diagnostics[0].code == DiagCode::ExceededMaxExpandedTokens);
+}
+
+TEST_CASE("Macro expansion entry limit", "[preprocessor]") {
+    auto& text =
+"`define FOO(a) a + a\n"
+"`FOO(1) `FOO(1) `FOO(2) `FOO(3)";
+
+    PreprocessorOptions ppOptions;
+    ppOptions.maxExpansionEntries = 3;
+
+    Bag options;
+    options.add(ppOptions);
+
+    std::string result = preprocess(text, options);
+    CHECK(result == "1 + 1 1 + 1 2 + 2");
+    REQUIRE(diagnostics.size() == 1);
+    CHECK(diagnostics[0].code == DiagCode::ExceededMaxExpansionEntries);
+}
+
 TEST_CASE("Preprocessor API", "[preprocessor]") {
     Preprocessor pp(getSourceManager(), alloc, diagnostics);
     CHECK(!pp.isDefined("FOO"));
@@ -1,5 +1,7 @@
 #include "Test.h"
 
+#include "parsing/SyntaxVisitor.h"
+
 TEST_CASE("If statement", "[parser:statements]") {
     auto& text = "if (foo && bar &&& baz) ; else ;";
     auto& stmt = parseStatement(text);
@@ -183,3 +185,224 @@ TEST_CASE("Nonblocking Event Trigger", "[parser:statements]") {
     REQUIRE(stmt.kind == SyntaxKind::NonblockingEventTriggerStatement);
     CHECK(stmt.toString(SyntaxToStringFlags::IncludeTrivia) == text);
 }
+
+TEST_CASE("Syntax node children", "[parser:statements]") {
+    auto& text = "lbl: if (a + b) x = 1; else ;";
+    auto& stmt = parseStatement(text);
+
+    REQUIRE(stmt.kind == SyntaxKind::ConditionalStatement);
+    auto& cond = stmt.as<ConditionalStatementSyntax>();
+    REQUIRE(cond.getChildCount() == 9);
+
+    // Members inherited from StatementSyntax come first.
+    CHECK(cond.childNode(0) == cond.label);
+    CHECK(cond.childNode(1) == &cond.attributes);
+    CHECK(cond.getChild(1).node->getChildCount() == 0);
+    CHECK(!cond.childToken(2));
+    CHECK(cond.childToken(3).kind == TokenKind::IfKeyword);
+    CHECK(cond.childToken(4).kind == TokenKind::OpenParenthesis);
+    CHECK(cond.childNode(5) == &cond.predicate);
+    CHECK(cond.childToken(6).kind == TokenKind::CloseParenthesis);
+    CHECK(cond.childNode(7) == &cond.statement);
+    CHECK(cond.childNode(8) == cond.elseClause);
+    CHECK(!cond.childNode(9));
+    CHECK(!cond.childToken(9));
+
+    // Separated lists interleave nodes and tokens.
+    auto& conditions = *cond.predicate.childNode(0);
+    REQUIRE(conditions.kind == SyntaxKind::List);
+    REQUIRE(conditions.getChildCount() == 1);
+
+    auto& expr = conditions.childNode(0)->as<ConditionalPatternSyntax>().expr;
+    REQUIRE(expr.kind == SyntaxKind::AddExpression);
+    auto& binary = expr.as<BinaryExpressionSyntax>();
+    CHECK(binary.childNode(0) == &binary.left);
+    CHECK(binary.childToken(1).kind == TokenKind::Plus);
+    CHECK(binary.childNode(3) == &binary.right);
+
+    CHECK(stmt.toString(SyntaxToStringFlags::IncludeTrivia) == text);
+    CHECK(stmt.getFirstToken().kind == TokenKind::Identifier);
+    CHECK(stmt.getLastToken().kind == TokenKind::Semicolon);
+}
+
+TEST_CASE("Syntax node source ranges", "[parser:statements]") {
+    auto& text = R"(
+begin : blk
+    logic [3:0] a, b;
+    if (a + (b * 2) != 1) a = {b[1:0], 2'b01};
+    else begin end
+    foo #(1) f(.a(a), .*);
+end
+)";
+    auto& stmt = parseStatement(text);
+
+    // Every node's cached range should match what walking its tokens produces.
+    size_t count = 0;
+    SmallVectorSized<const SyntaxNode*, 32> stack;
+    stack.append(&stmt);
+    while (!stack.empty()) {
+        const SyntaxNode* node = stack.back();
+        stack.pop();
+
+        Token first = node->getFirstToken();
+        Token last = node->getLastToken();
+        if (first) {
+            CHECK(node->sourceRange().start() == first.location());
+            CHECK(node->sourceRange().end() == last.location() + last.rawText().length());
+            count++;
+        }
+        else {
+            CHECK(node->sourceRange().start() == SourceLocation());
+            CHECK(node->sourceRange().end() == SourceLocation());
+        }
+
+        for (uint32_t i = 0; i < node->getChildCount(); i++) {
+            if (auto child = node->childNode(i))
+                stack.append(child);
+        }
+    }
+
+    CHECK(count > 50);
+}
+
+namespace {
+
+struct TraversalRecorder : public SyntaxVisitor<TraversalRecorder> {
+    // Each event is the node kind, paired with true on entry and false on exit.
+    std::vector<std::pair<SyntaxKind, bool>> events;
+    SyntaxKind skipKind = SyntaxKind::Unknown;
+    SyntaxKind stopKind = SyntaxKind::Unknown;
+    size_t tokens = 0;
+
+    VisitAction preVisit(const SyntaxNode& node) {
+        events.emplace_back(node.kind, true);
+        if (node.kind == stopKind)
+            return VisitAction::Stop;
+        if (node.kind == skipKind)
+            return VisitAction::SkipChildren;
+        return VisitAction::Continue;
+    }
+
+    void postVisit(const SyntaxNode& node) { events.emplace_back(node.kind, false); }
+    void visitToken(Token) { tokens++; }
+};
+
+}
+
+TEST_CASE("Iterative syntax traversal", "[parser:statements]") {
+    auto& stmt = parseStatement("x = a + b;");
+
+    TraversalRecorder recorder;
+    CHECK(recorder.traverse(stmt));
+    CHECK(recorder.tokens == 6);
+
+    std::vector<std::pair<SyntaxKind, bool>> expected = {
+        { SyntaxKind::ExpressionStatement, true },
+        { SyntaxKind::List, true },
+        { SyntaxKind::List, false },
+        { SyntaxKind::AssignmentExpression, true },
+        { SyntaxKind::IdentifierName, true },
+        { SyntaxKind::IdentifierName, false },
+        { SyntaxKind::List, true },
+        { SyntaxKind::List, false },
+        { SyntaxKind::AddExpression, true },
+        { SyntaxKind::IdentifierName, true },
+        { SyntaxKind::IdentifierName, false },
+        { SyntaxKind::List, true },
+        { SyntaxKind::List, false },
+        { SyntaxKind::IdentifierName, true },
+        { SyntaxKind::IdentifierName, false },
+        { SyntaxKind::AddExpression, false },
+        { SyntaxKind::AssignmentExpression, false },
+        { SyntaxKind::ExpressionStatement, false }
+    };
+    CHECK(recorder.events == expected);
+
+    TraversalRecorder skipper;
+    skipper.skipKind = SyntaxKind::AddExpression;
+    CHECK(skipper.traverse(stmt));
+    CHECK(skipper.tokens == 3);
+    CHECK(skipper.events.size() == expected.size() - 6);
+    CHECK(skipper.events[8] == std::make_pair(SyntaxKind::AddExpression, true));
+    CHECK(skipper.events[9] == std::make_pair(SyntaxKind::AddExpression, false));
+
+    TraversalRecorder stopper;
+    stopper.stopKind = SyntaxKind::AddExpression;
+    CHECK(!stopper.traverse(stmt));
+    CHECK(stopper.events.size() == 9);
+    CHECK(stopper.tokens == 2);
+}
+
+TEST_CASE("Iterative syntax traversal (deep tree)", "[parser:statements]") {
+    // A long left-associative chain nests far deeper than a recursive walk could handle.
+    const int NumTerms = 100000;
+    std::string text = "x = a";
+    for (int i = 0; i < NumTerms; i++)
+        text += " + a";
+    text += ";";
+
+    auto& stmt = parseStatement(text);
+    CHECK_DIAGNOSTICS_EMPTY;
+
+    struct Counter : public SyntaxVisitor<Counter> {
+        size_t adds = 0;
+        size_t exits = 0;
+        size_t tokens = 0;
+
+        VisitAction preVisit(const BinaryExpressionSyntax&) {
+            adds++;
+            return VisitAction::Continue;
+        }
+
+        void postVisit(const BinaryExpressionSyntax&) { exits++; }
+        void visitToken(Token) { tokens++; }
+    };
+
+    // The assignment is a binary expression too.
+    Counter counter;
+    CHECK(counter.traverse(stmt));
+    CHECK(counter.adds == NumTerms + 1);
+    CHECK(counter.exits == NumTerms + 1);
+    CHECK(counter.tokens == NumTerms * 2 + 4);
+}
+
+TEST_CASE("Parallel member traversal", "[parser:statements]") {
+    std::string text;
+    for (int i = 0; i < 37; i++)
+        text += "module m" + std::to_string(i) + "; assign a = b + c; endmodule\n";
+
+    auto tree = SyntaxTree::fromText(text);
+    auto& unit = tree->root().as<CompilationUnitSyntax>();
+
+    struct NameCollector : public SyntaxVisitor<NameCollector> {
+        std::vector<std::string> modules;
+        size_t adds = 0;
+
+        VisitAction preVisit(const ModuleHeaderSyntax& header) {
+            modules.emplace_back(header.name.valueText());
+            return VisitAction::Continue;
+        }
+
+        VisitAction preVisit(const BinaryExpressionSyntax&) {
+            adds++;
+            return VisitAction::SkipChildren;
+        }
+    };
+
+    for (uint32_t threads : { 0u, 1u, 4u, 64u }) {
+        auto visitors = traverseMembersParallel(unit, [] { return NameCollector(); }, threads);
+        REQUIRE(!visitors.empty());
+
+        std::vector<std::string> names;
+        size_t adds = 0;
+        for (auto& visitor : visitors) {
+            names.insert(names.end(), visitor.modules.begin(), visitor.modules.end());
+            adds += visitor.adds;
+        }
+
+        REQUIRE(names.size() == 37);
+        for (int i = 0; i < 37; i++)
+            CHECK(names[i] == "m" + std::to_string(i));
+        CHECK(adds == 37);
+    }
+}
@@ -106,7 +106,7 @@ endmodule
     CHECK(gen_b.find<ParameterSymbol>("foo").getValue().integer() == 4);
     CHECK(gen_b.find<ParameterSymbol>("bar").getValue().integer() == 12);
 
-    auto diags = compilation.getAllDiagnostics();
+    auto& diags = compilation.getAllDiagnostics();
     REQUIRE(diags.size() == 1);
     CHECK(diags[0].code == DiagCode::ImportNameCollision);
     REQUIRE(diags[0].notes.size() == 3);
@@ -227,7 +227,7 @@ endmodule
     Compilation compilation;
     compilation.addSyntaxTree(tree);
 
-    Diagnostics diags = compilation.getAllDiagnostics();
+    auto& diags = compilation.getAllDiagnostics();
     REQUIRE(diags.size() == 2);
     CHECK(diags[0].code == DiagCode::UndeclaredIdentifier);
     CHECK(diags[1].code == DiagCode::UndeclaredIdentifier);
@@ -279,7 +279,7 @@ endmodule
     Compilation compilation;
     compilation.addSyntaxTree(tree);
 
-    Diagnostics diags = compilation.getAllDiagnostics();
+    auto& diags = compilation.getAllDiagnostics();
     REQUIRE(diags.size() == 4);
     CHECK(diags[0].code == DiagCode::AmbiguousWildcardImport);
     CHECK(diags[1].code == DiagCode::RedefinitionDifferentSymbolKind);
@@ -333,7 +333,7 @@ endmodule
     Compilation compilation;
     compilation.addSyntaxTree(tree);
 
-    Diagnostics diags = compilation.getAllDiagnostics();
+    auto& diags = compilation.getAllDiagnostics();
     REQUIRE(diags.size() == 4);
     CHECK(diags[0].code == DiagCode::HierarchicalNotAllowedInConstant);
     CHECK(diags[1].code == DiagCode::HierarchicalNotAllowedInConstant);
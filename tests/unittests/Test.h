@@ -5,6 +5,8 @@
 #pragma warning(disable:4459)   // annoying warning about global "alloc" being shadowed by locals
 #endif
 
+#include <fstream>
+#include <random>
 #include <sstream>
 
 #include <catch.hpp>
@@ -34,7 +36,7 @@ using namespace slang;
 } while (0)
 
 #define NO_COMPILATION_ERRORS do {\
-    Diagnostics diags = compilation.getAllDiagnostics(); \
+    auto& diags = compilation.getAllDiagnostics(); \
     if (!diags.empty()) FAIL_CHECK(DiagnosticWriter(SyntaxTree::getDefaultSourceManager()).report(diags)); \
 } while (0)
 
@@ -175,6 +177,32 @@ inline LogicExactlyEqualMatcher exactlyEquals(logic_t v) {
     return LogicExactlyEqualMatcher(v);
 }
 
+// A scratch directory on disk, for tests of things that read files by path.
+// The directory and everything written to it is removed at the end of the test.
+struct TempDir {
+    fs::path path;
+
+    // Other test binaries might be running at the same time, so pick a random name
+    // and never touch a directory that already exists.
+    explicit TempDir(const std::string& name) {
+        std::random_device device;
+        do {
+            path = fs::temp_directory_path() / ("slang_" + name + "_" + std::to_string(device()));
+        } while (!fs::create_directory(path));
+    }
+
+    ~TempDir() {
+        std::error_code ec;
+        fs::remove_all(path, ec);
+    }
+
+    std::string write(const std::string& name, const std::string& text) const {
+        std::string file = (path / name).string();
+        std::ofstream(file, std::ios::binary) << text;
+        return file;
+    }
+};
+
 class SVIntExactlyEqualMatcher : public Catch::MatcherBase<SVInt> {
 public:
     explicit SVIntExactlyEqualMatcher(SVInt v) : value(v) {}
@@ -196,7 +196,7 @@ endmodule
     CHECK(instance.find("e1_t") == nullptr);
     CHECK(instance.find("e2") == nullptr);
 
-    Diagnostics diags = compilation.getAllDiagnostics();
+    auto& diags = compilation.getAllDiagnostics();
     REQUIRE(diags.size() == 3);
     CHECK(diags[0].code == DiagCode::UnresolvedForwardTypedef);
     CHECK(diags[1].code == DiagCode::UnresolvedForwardTypedef);
@@ -0,0 +1,216 @@
+#include "Test.h"
+
+#include <cstring>
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <thread>
+
+#include "util/ArenaBuilder.h"
+#include "util/PerfCounters.h"
+#include "util/TimeTrace.h"
+
+TEST_CASE("BumpAllocator growth and reset", "[util]") {
+    BumpAllocator allocator(256, 4096);
+
+    // Fill up several segments, with some large allocations mixed in, and make
+    // sure nothing overlaps.
+    std::vector<std::pair<byte*, size_t>> blocks;
+    size_t misaligned = 0;
+    for (size_t i = 0; i < 2000; i++) {
+        size_t size = i % 100 == 0 ? 3000 : (i % 7) * 8 + 8;
+        byte* block = allocator.allocate(size, 16);
+        misaligned += reinterpret_cast<uintptr_t>(block) % 16 != 0;
+        memset(block, int(i & 0xff), size);
+        blocks.emplace_back(block, size);
+    }
+    CHECK(misaligned == 0);
+
+    size_t corrupted = 0;
+    for (size_t i = 0; i < blocks.size(); i++) {
+        auto [block, size] = blocks[i];
+        for (size_t j = 0; j < size; j++)
+            corrupted += block[j] != byte(i & 0xff);
+    }
+    CHECK(corrupted == 0);
+
+    // After a reset the same memory gets handed out again.
+    std::sort(blocks.begin(), blocks.end());
+    allocator.reset();
+
+    int reused = 0;
+    for (int i = 0; i < 100; i++) {
+        byte* block = allocator.allocate(64, 8);
+        auto it = std::upper_bound(blocks.begin(), blocks.end(), std::make_pair(block, SIZE_MAX));
+        if (it != blocks.begin() && block < std::prev(it)->first + std::prev(it)->second)
+            reused++;
+        memset(block, 0, 64);
+    }
+    CHECK(reused > 0);
+
+    // Allocations larger than a huge page still work and can be reset.
+    byte* big = allocator.allocate(3 * 1024 * 1024, 64);
+    REQUIRE(reinterpret_cast<uintptr_t>(big) % 64 == 0);
+    memset(big, 1, 3 * 1024 * 1024);
+    allocator.reset();
+
+    BumpAllocator moved = std::move(allocator);
+    CHECK(moved.allocate(8, 8) != nullptr);
+}
+
+TEST_CASE("BumpAllocator reuses segments across resets", "[util]") {
+    BumpAllocator allocator(4096, 4096);
+    auto run = [&](size_t count) {
+        for (size_t i = 0; i < count; i++)
+            allocator.allocate(8 + (i * 37) % 1500, 8);
+    };
+
+    // Each job is a bit bigger than the last, so it uses up everything kept by the
+    // reset (including the small initial segment) and then needs a few new segments.
+    // After another reset, a slightly smaller job must fit in what is kept.
+    for (size_t count : { 100, 150, 200, 250 }) {
+        allocator.reset();
+        run(count);
+        size_t segments = allocator.getStats().segmentCount;
+
+        allocator.reset();
+        run(count - 10);
+        CHECK(allocator.getStats().segmentCount == segments);
+    }
+}
+
+TEST_CASE("TypedBumpAllocator reset", "[util]") {
+    static int liveCount = 0;
+    struct Tracked {
+        Tracked() { liveCount++; }
+        ~Tracked() { liveCount--; }
+        char padding[48];
+    };
+
+    {
+        TypedBumpAllocator<Tracked> allocator;
+        for (int i = 0; i < 1000; i++)
+            allocator.emplace();
+        CHECK(liveCount == 1000);
+
+        allocator.reset();
+        CHECK(liveCount == 0);
+
+        for (int i = 0; i < 10; i++)
+            allocator.emplace();
+        CHECK(liveCount == 10);
+    }
+    CHECK(liveCount == 0);
+}
+
+TEST_CASE("BumpAllocator stats", "[util]") {
+    BumpAllocator allocator(256, 4096);
+    for (int i = 0; i < 100; i++)
+        allocator.allocate(12, 8);
+    allocator.allocate(3000, 8);
+
+    auto stats = allocator.getStats();
+    CHECK(stats.bytesRequested == 100 * 12 + 3000);
+    CHECK(stats.bytesUsed == stats.bytesRequested + stats.alignmentWaste);
+    CHECK(stats.bytesUsed >= 100 * 12 + 3000);
+    CHECK(stats.bytesUsed <= 100 * 16 + 3000 + 8);
+    CHECK(stats.alignmentWaste > 0);
+    CHECK(stats.largeAllocationCount == 1);
+    CHECK(stats.segmentCount > 2);
+    CHECK(stats.bytesReserved >= stats.bytesUsed + stats.segmentWaste);
+
+    allocator.reset();
+    stats = allocator.getStats();
+    CHECK(stats.bytesUsed == 0);
+    CHECK(stats.alignmentWaste == 0);
+    CHECK(stats.largeAllocationCount == 0);
+
+    auto tree = SyntaxTree::fromText("module m; int i = 4; endmodule");
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto memory = compilation.getMemoryStats();
+    CHECK(memory.syntaxTrees.bytesUsed == tree->getMemoryStats().bytesUsed);
+    CHECK(memory.symbols.bytesUsed > 0);
+    CHECK(memory.total().bytesReserved > memory.symbols.bytesReserved);
+}
+
+TEST_CASE("ArenaBuilder", "[util]") {
+    BumpAllocator allocator;
+    ArenaBuilder<int> builder(allocator);
+    CHECK(builder.finish().empty());
+
+    // With nothing else allocated in between, the list grows in place and
+    // finishing gives back the unused capacity.
+    for (int i = 0; i < 100; i++)
+        builder.append(i);
+    int* first = &builder[0];
+    auto list = builder.finish();
+    REQUIRE(list.size() == 100);
+    CHECK(list.data() == first);
+    CHECK(list[99] == 99);
+    CHECK(allocator.allocate(sizeof(int), alignof(int)) == (byte*)(first + 100));
+
+    // Interleaved allocations force the list to move, but the items survive.
+    for (int i = 0; i < 20; i++) {
+        builder.append(i);
+        allocator.allocate(16, 8);
+    }
+    builder.pop();
+    list = builder.finish();
+    REQUIRE(list.size() == 19);
+    int mismatched = 0;
+    for (int i = 0; i < 19; i++)
+        mismatched += list[i] != i;
+    CHECK(mismatched == 0);
+}
+
+TEST_CASE("TimeTrace", "[util]") {
+    // Nothing gets recorded, and details aren't computed, until tracing starts.
+    int detailCalls = 0;
+    auto getDetail = [&] { detailCalls++; return "detail"; };
+    { TIME_SCOPE("Before", getDetail()); }
+    CHECK(detailCalls == 0);
+
+    TimeTrace::initialize();
+    {
+        TIME_SCOPE("Outer", "");
+        TIME_SCOPE("Inner", getDetail());
+    }
+    TimeTrace::stop();
+    { TIME_SCOPE("After", getDetail()); }
+    CHECK(detailCalls == 1);
+
+    std::ostringstream stream;
+    TimeTrace::write(stream);
+    auto trace = json::parse(stream.str());
+
+    auto& events = trace["traceEvents"];
+    REQUIRE(events.size() == 2);
+
+    // The inner scope ends first, so it gets recorded first.
+    CHECK(events[0]["name"] == "Inner");
+    CHECK(events[0]["args"]["detail"] == "detail");
+    CHECK(events[1]["name"] == "Outer");
+    CHECK(events[1]["ph"] == "X");
+    CHECK(events[1].count("args") == 0);
+    CHECK(events[1]["ts"].get<double>() <= events[0]["ts"].get<double>());
+    CHECK(events[1]["dur"].get<double>() >= events[0]["dur"].get<double>());
+}
+
+TEST_CASE("PerfCounters", "[util]") {
+    auto before = PerfCounters::getTotals();
+    PerfCounters::increment(PerfCounter::ConstantEvalSteps, 5);
+
+    // Counts from other threads are included, even after the threads are gone.
+    std::thread thread([] {
+        for (int i = 0; i < 10; i++)
+            PerfCounters::increment(PerfCounter::ConstantEvalSteps);
+    });
+    thread.join();
+
+    auto after = PerfCounters::getTotals();
+    size_t index = size_t(PerfCounter::ConstantEvalSteps);
+    CHECK(after[index] - before[index] == 15);
+    CHECK(toString(PerfCounter::ConstantEvalSteps) == "constant eval steps");
+}
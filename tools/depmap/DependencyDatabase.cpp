@@ -0,0 +1,374 @@
+//------------------------------------------------------------------------------
+// DependencyDatabase.cpp
+// Persistent storage of scanned file dependencies.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#include "DependencyDatabase.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+
+#ifdef _WIN32
+#    include <process.h>
+#else
+#    include <unistd.h>
+#endif
+
+#include "text/SourceManager.h"
+
+namespace {
+
+using namespace slang;
+
+// Bump the version whenever the layout of the file changes.
+constexpr uint32_t DatabaseMagic = 0x4d444c53; // "SLDM"
+constexpr uint32_t DatabaseVersion = 2;
+
+bool readFile(const std::string& path, std::string& buffer) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+
+    buffer.clear();
+    char chunk[65536];
+    size_t count;
+    while ((count = fread(chunk, 1, sizeof(chunk), file)) > 0)
+        buffer.append(chunk, count);
+
+    bool ok = !ferror(file);
+    fclose(file);
+    return ok;
+}
+
+// Gets the modification time of a file whose content was read starting at the given
+// time. A file modified around then could have changed after it was read without
+// its time moving (file systems can record times as coarsely as every two seconds),
+// so it gets a time of zero instead, which makes the next check hash the content.
+bool getModifiedTime(const std::string& path, fs::file_time_type readStart, int64_t& result) {
+    std::error_code ec;
+    auto time = fs::last_write_time(path, ec);
+    if (ec)
+        return false;
+
+    if (time >= readStart - std::chrono::seconds(2))
+        result = 0;
+    else
+        result = (int64_t)time.time_since_epoch().count();
+    return true;
+}
+
+// Checks whether the file still has the content recorded in the stamp, and if so
+// updates the stamp's modification time to match the file.
+bool refreshStamp(const std::string& path, FileStamp& stamp) {
+    std::error_code ec;
+    uint64_t size = fs::file_size(path, ec);
+    if (ec || size != stamp.size)
+        return false;
+
+    auto time = fs::last_write_time(path, ec);
+    if (ec)
+        return false;
+
+    if (stamp.modifiedTime != 0 && (int64_t)time.time_since_epoch().count() == stamp.modifiedTime)
+        return true;
+
+    // The file was touched; it's only changed if the content is different.
+    auto readStart = fs::file_time_type::clock::now();
+    std::string content;
+    if (!readFile(path, content) || hashBytes(content.data(), content.size()) != stamp.contentHash)
+        return false;
+
+    return getModifiedTime(path, readStart, stamp.modifiedTime);
+}
+
+int getProcessId() {
+#ifdef _WIN32
+    return _getpid();
+#else
+    return getpid();
+#endif
+}
+
+class Writer {
+public:
+    template<typename T>
+    void write(T value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void write(const std::string& str) {
+        write((uint32_t)str.size());
+        buffer.append(str);
+    }
+
+    void write(const FileStamp& stamp) {
+        write(stamp.modifiedTime);
+        write(stamp.size);
+        write(stamp.contentHash);
+    }
+
+    void write(const std::vector<std::string>& list) {
+        write((uint32_t)list.size());
+        for (auto& str : list)
+            write(str);
+    }
+
+    const std::string& data() const { return buffer; }
+
+private:
+    std::string buffer;
+};
+
+// Reads back what Writer wrote. Any attempt to read past the end of the
+// data puts the reader in a failed state instead of crashing.
+class Reader {
+public:
+    explicit Reader(const std::string& buffer) : ptr(buffer.data()), end(buffer.data() + buffer.size()) {}
+
+    template<typename T>
+    void read(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (!check(sizeof(T)))
+            return;
+
+        memcpy(&value, ptr, sizeof(T));
+        ptr += sizeof(T);
+    }
+
+    void read(std::string& str) {
+        uint32_t size = 0;
+        read(size);
+        if (!check(size))
+            return;
+
+        str.assign(ptr, size);
+        ptr += size;
+    }
+
+    void read(FileStamp& stamp) {
+        read(stamp.modifiedTime);
+        read(stamp.size);
+        read(stamp.contentHash);
+    }
+
+    void read(std::vector<std::string>& list) {
+        uint32_t count = 0;
+        read(count);
+        for (uint32_t i = 0; i < count && !failed; i++)
+            read(list.emplace_back());
+    }
+
+    bool ok() const { return !failed; }
+    bool atEnd() const { return ptr == end; }
+
+private:
+    const char* ptr;
+    const char* end;
+    bool failed = false;
+
+    bool check(size_t size) {
+        if (failed || size_t(end - ptr) < size)
+            failed = true;
+        return !failed;
+    }
+};
+
+}
+
+namespace slang {
+
+uint64_t hashBytes(const void* data, size_t size, uint64_t seed) {
+    auto bytes = static_cast<const unsigned char*>(data);
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::optional<FileStamp> FileStamp::fromText(const std::string& path, string_view text,
+                                             fs::file_time_type readStart) {
+    FileStamp stamp;
+    if (!getModifiedTime(path, readStart, stamp.modifiedTime))
+        return std::nullopt;
+
+    stamp.size = text.size();
+    stamp.contentHash = hashBytes(text.data(), text.size());
+    return stamp;
+}
+
+DatabaseEntry DatabaseEntry::scan(const DependencyScanner& scanner, const std::string& path) {
+    // Stamp files from the text the scanner read instead of reading them again.
+    auto readStart = fs::file_time_type::clock::now();
+    std::unordered_map<std::string, FileStamp> stamps;
+    auto onFileRead = [&](const std::string& file, string_view text) {
+        if (!stamps.count(file)) {
+            if (auto stamp = FileStamp::fromText(file, text, readStart))
+                stamps.emplace(file, *stamp);
+        }
+    };
+
+    DatabaseEntry entry;
+    entry.dependencies = scanner.scanFile(path, onFileRead);
+    if (auto it = stamps.find(path); it != stamps.end())
+        entry.stamp = it->second;
+
+    for (auto& include : entry.dependencies.includes) {
+        if (auto it = stamps.find(include); it != stamps.end())
+            entry.includeStamps.emplace_back(include, it->second);
+    }
+
+    return entry;
+}
+
+bool DependencyDatabase::load(const std::string& path) {
+    entries.clear();
+
+    std::string buffer;
+    if (!readFile(path, buffer))
+        return false;
+
+    Reader reader(buffer);
+    uint32_t magic = 0, version = 0, count = 0;
+    uint64_t storedOptions = 0;
+    reader.read(magic);
+    reader.read(version);
+    reader.read(storedOptions);
+    reader.read(count);
+    if (!reader.ok() || magic != DatabaseMagic || version != DatabaseVersion ||
+        storedOptions != optionsHash) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < count && reader.ok(); i++) {
+        std::string file;
+        DatabaseEntry entry;
+        reader.read(file);
+        reader.read(entry.stamp);
+
+        uint32_t includeCount = 0;
+        reader.read(includeCount);
+        for (uint32_t j = 0; j < includeCount && reader.ok(); j++) {
+            auto& [includePath, stamp] = entry.includeStamps.emplace_back();
+            reader.read(includePath);
+            reader.read(stamp);
+        }
+
+        auto& deps = entry.dependencies;
+        reader.read(deps.declarations);
+        reader.read(deps.references);
+        reader.read(deps.scopeReferences);
+        reader.read(deps.includes);
+        reader.read(deps.missingIncludes);
+        reader.read(deps.diagnostics);
+        entries.emplace(std::move(file), std::move(entry));
+    }
+
+    if (!reader.ok() || !reader.atEnd()) {
+        entries.clear();
+        return false;
+    }
+    return true;
+}
+
+bool DependencyDatabase::save(const std::string& path) const {
+    Writer writer;
+    writer.write(DatabaseMagic);
+    writer.write(DatabaseVersion);
+    writer.write(optionsHash);
+    writer.write((uint32_t)entries.size());
+
+    for (auto& [file, entry] : entries) {
+        writer.write(file);
+        writer.write(entry.stamp);
+        writer.write((uint32_t)entry.includeStamps.size());
+        for (auto& [includePath, stamp] : entry.includeStamps) {
+            writer.write(includePath);
+            writer.write(stamp);
+        }
+
+        auto& deps = entry.dependencies;
+        writer.write(deps.declarations);
+        writer.write(deps.references);
+        writer.write(deps.scopeReferences);
+        writer.write(deps.includes);
+        writer.write(deps.missingIncludes);
+        writer.write(deps.diagnostics);
+    }
+
+    // Write to a temporary file and then move it into place so that an
+    // interrupted run never leaves a truncated database behind. The name is
+    // unique to this process so that concurrent runs don't clobber each other.
+    std::string tempPath = path + "." + std::to_string(getProcessId()) + ".tmp";
+    FILE* file = fopen(tempPath.c_str(), "wb");
+    if (!file)
+        return false;
+
+    auto& data = writer.data();
+    bool ok = fwrite(data.data(), 1, data.size(), file) == data.size();
+    ok &= fclose(file) == 0;
+
+    std::error_code ec;
+    if (ok)
+        fs::rename(tempPath, path, ec);
+    if (!ok || ec) {
+        fs::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
+
+std::optional<DatabaseEntry> DependencyDatabase::revalidate(const std::string& path) const {
+    auto it = entries.find(path);
+    if (it == entries.end())
+        return std::nullopt;
+
+    // Files that had errors are always rescanned, since the problem (such
+    // as a missing include file) may have been fixed without touching them.
+    if (!it->second.dependencies.diagnostics.empty())
+        return std::nullopt;
+
+    DatabaseEntry entry = it->second;
+    if (!refreshStamp(path, entry.stamp))
+        return std::nullopt;
+
+    for (auto& [includePath, stamp] : entry.includeStamps) {
+        if (!refreshStamp(includePath, stamp))
+            return std::nullopt;
+    }
+
+    // A new file along the include search path can change what gets included.
+    std::error_code ec;
+    for (auto& missing : entry.dependencies.missingIncludes) {
+        if (fs::exists(missing, ec))
+            return std::nullopt;
+    }
+
+    return entry;
+}
+
+bool DependencyDatabase::assign(const std::vector<std::string>& files,
+                                std::vector<DatabaseEntry> newEntries) {
+    ASSERT(files.size() == newEntries.size());
+    bool changed = files.size() != entries.size();
+
+    std::unordered_map<std::string, DatabaseEntry> updated;
+    for (size_t i = 0; i < files.size(); i++) {
+        if (!changed) {
+            auto it = entries.find(files[i]);
+            changed = it == entries.end() || it->second.stamp != newEntries[i].stamp ||
+                      it->second.includeStamps != newEntries[i].includeStamps;
+        }
+        updated.emplace(files[i], std::move(newEntries[i]));
+    }
+
+    entries = std::move(updated);
+    return changed;
+}
+
+}
@@ -0,0 +1,90 @@
+//------------------------------------------------------------------------------
+// DependencyDatabase.h
+// Persistent storage of scanned file dependencies.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DependencyScanner.h"
+#include "text/SourceManager.h"
+
+namespace slang {
+
+/// Computes a 64-bit FNV-1a hash of the given bytes. Unlike std::hash, the result
+/// is stable across runs and builds, so it can be persisted.
+uint64_t hashBytes(const void* data, size_t size, uint64_t seed = 14695981039346656037ull);
+
+/// Identifies a particular version of a file on disk.
+struct FileStamp {
+    int64_t modifiedTime = 0;
+    uint64_t size = 0;
+    uint64_t contentHash = 0;
+
+    /// Gets the stamp for the file at the given path, given the content that was read
+    /// from it starting at @a readStart. Returns nullopt if the file no longer exists.
+    static std::optional<FileStamp> fromText(const std::string& path, string_view text,
+                                             fs::file_time_type readStart);
+
+    bool operator==(const FileStamp& rhs) const {
+        return modifiedTime == rhs.modifiedTime && size == rhs.size &&
+               contentHash == rhs.contentHash;
+    }
+    bool operator!=(const FileStamp& rhs) const { return !(*this == rhs); }
+};
+
+/// The scan results for a single file, along with the stamps of it and every file
+/// it includes at the time it was scanned.
+struct DatabaseEntry {
+    FileStamp stamp;
+    std::vector<std::pair<std::string, FileStamp>> includeStamps;
+    FileDependencies dependencies;
+
+    /// Scans the given file and records the stamps needed to check it later.
+    static DatabaseEntry scan(const DependencyScanner& scanner, const std::string& path);
+};
+
+/// A compact binary store of scan results, keyed by file path, that lets depmap
+/// rescan only the files that have changed since the last run.
+///
+/// Checking an entry normally only needs to stat the file, its includes, and the
+/// places its includes were searched for without success; the content is hashed
+/// only when the modification time changed but the size didn't, so that touching
+/// a file doesn't force a rescan.
+class DependencyDatabase {
+public:
+    /// @param optionsHash identifies the options that affect scanning (include paths,
+    /// macro definitions). A stored database made with different options is discarded.
+    explicit DependencyDatabase(uint64_t optionsHash) : optionsHash(optionsHash) {}
+
+    /// Loads the database from the given file. If the file doesn't exist or is
+    /// unusable (corrupt, from another version, or made with different options)
+    /// the database is left empty and false is returned.
+    bool load(const std::string& path);
+
+    /// Writes the database to the given file, replacing it atomically.
+    bool save(const std::string& path) const;
+
+    /// If the stored entry for the given file is still valid, returns a copy of it
+    /// with its stamps brought up to date. Returns nullopt if the file needs to be
+    /// rescanned. This is safe to call from multiple threads at once.
+    std::optional<DatabaseEntry> revalidate(const std::string& path) const;
+
+    /// Replaces the contents of the database with the given entries, one per file.
+    /// @return true if anything is different from what was stored before.
+    bool assign(const std::vector<std::string>& files, std::vector<DatabaseEntry> newEntries);
+
+    size_t size() const { return entries.size(); }
+
+private:
+    uint64_t optionsHash;
+    std::unordered_map<std::string, DatabaseEntry> entries;
+};
+
+}
@@ -0,0 +1,263 @@
+//------------------------------------------------------------------------------
+// DependencyScanner.cpp
+// Token based scanning of source files for build dependencies.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#include "DependencyScanner.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "diagnostics/Diagnostics.h"
+#include "text/SourceManager.h"
+#include "util/BumpAllocator.h"
+
+namespace {
+
+using namespace slang;
+
+using ScannedTokens = std::vector<Token>;
+
+// Block keywords that can be followed by a ": label". Whatever comes after
+// one of them (and its label) starts a new item.
+bool isLabeledBlockKeyword(TokenKind kind) {
+    switch (kind) {
+        case TokenKind::BeginKeyword:
+        case TokenKind::EndKeyword:
+        case TokenKind::EndModuleKeyword:
+        case TokenKind::EndInterfaceKeyword:
+        case TokenKind::EndProgramKeyword:
+        case TokenKind::EndPackageKeyword:
+        case TokenKind::EndGenerateKeyword:
+        case TokenKind::EndPrimitiveKeyword:
+        case TokenKind::EndCheckerKeyword:
+        case TokenKind::EndFunctionKeyword:
+        case TokenKind::EndTaskKeyword:
+        case TokenKind::EndClassKeyword:
+        case TokenKind::EndPropertyKeyword:
+        case TokenKind::EndSequenceKeyword:
+        case TokenKind::EndClockingKeyword:
+        case TokenKind::EndGroupKeyword:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Determines whether the token at the given index begins a new item (a declaration,
+// instantiation, or statement) based on the tokens that come before it.
+bool startsItem(const ScannedTokens& tokens, size_t index) {
+    if (index == 0)
+        return true;
+
+    TokenKind prev = tokens[index - 1].kind;
+    switch (prev) {
+        case TokenKind::Semicolon:
+        case TokenKind::Colon:
+        case TokenKind::CloseParenthesis:
+        case TokenKind::StarCloseParenthesis:
+        case TokenKind::GenerateKeyword:
+        case TokenKind::ElseKeyword:
+            return true;
+        case TokenKind::Identifier:
+            // Skip over a block label, as in "end : name".
+            return index >= 3 && tokens[index - 2].kind == TokenKind::Colon &&
+                   isLabeledBlockKeyword(tokens[index - 3].kind);
+        default:
+            return isLabeledBlockKeyword(prev);
+    }
+}
+
+// Skips a balanced group of tokens starting at the given open delimiter,
+// returning the index just past the matching close delimiter.
+size_t skipGroup(const ScannedTokens& tokens, size_t index, TokenKind open, TokenKind close) {
+    int depth = 0;
+    for (; index < tokens.size(); index++) {
+        if (tokens[index].kind == open)
+            depth++;
+        else if (tokens[index].kind == close && --depth == 0)
+            return index + 1;
+    }
+    return index;
+}
+
+// Checks whether the identifier at the given index names the type in a hierarchical
+// instantiation, of the form: type [#(params)] name [dimensions] (...
+bool isInstantiation(const ScannedTokens& tokens, size_t index) {
+    size_t i = index + 1;
+    if (i < tokens.size() && tokens[i].kind == TokenKind::Hash) {
+        i++;
+        if (i < tokens.size() && tokens[i].kind == TokenKind::OpenParenthesis)
+            i = skipGroup(tokens, i, TokenKind::OpenParenthesis, TokenKind::CloseParenthesis);
+        else
+            i++;
+    }
+
+    if (i >= tokens.size() || tokens[i].kind != TokenKind::Identifier)
+        return false;
+
+    i++;
+    while (i < tokens.size() && tokens[i].kind == TokenKind::OpenBracket)
+        i = skipGroup(tokens, i, TokenKind::OpenBracket, TokenKind::CloseBracket);
+
+    return i < tokens.size() && tokens[i].kind == TokenKind::OpenParenthesis;
+}
+
+void scanTokens(const ScannedTokens& tokens, FileDependencies& result) {
+    auto add = [](std::vector<std::string>& list, Token token) {
+        string_view name = token.valueText();
+        if (!name.empty())
+            list.emplace_back(name);
+    };
+
+    for (size_t i = 0; i < tokens.size(); i++) {
+        auto next = [&](size_t offset) {
+            return i + offset < tokens.size() ? tokens[i + offset].kind : TokenKind::EndOfFile;
+        };
+
+        switch (tokens[i].kind) {
+            case TokenKind::ModuleKeyword:
+            case TokenKind::MacromoduleKeyword:
+            case TokenKind::InterfaceKeyword:
+            case TokenKind::ProgramKeyword:
+            case TokenKind::PackageKeyword: {
+                if (!startsItem(tokens, i) || next(1) == TokenKind::ClassKeyword)
+                    break;
+
+                size_t j = i + 1;
+                if (next(1) == TokenKind::StaticKeyword || next(1) == TokenKind::AutomaticKeyword)
+                    j++;
+                if (j < tokens.size() && tokens[j].kind == TokenKind::Identifier)
+                    add(result.declarations, tokens[j]);
+                break;
+            }
+            case TokenKind::ImportKeyword:
+            case TokenKind::ExportKeyword: {
+                // import a::*, b::c;
+                size_t j = i + 1;
+                while (j + 1 < tokens.size() && tokens[j].kind == TokenKind::Identifier &&
+                       tokens[j + 1].kind == TokenKind::DoubleColon) {
+                    add(result.references, tokens[j]);
+                    j += 3;
+                    if (j >= tokens.size() || tokens[j].kind != TokenKind::Comma)
+                        break;
+                    j++;
+                }
+                break;
+            }
+            case TokenKind::BindKeyword: {
+                // bind target [: instances] type [#(params)] name (...);
+                // The target is a module name unless it's a hierarchical path.
+                if (next(1) == TokenKind::Identifier && next(2) != TokenKind::Dot)
+                    add(result.references, tokens[i + 1]);
+
+                for (size_t j = i + 2; j < tokens.size() && tokens[j].kind != TokenKind::Semicolon; j++) {
+                    if (tokens[j].kind == TokenKind::Identifier && isInstantiation(tokens, j)) {
+                        add(result.references, tokens[j]);
+                        break;
+                    }
+                }
+                break;
+            }
+            case TokenKind::Identifier:
+                if (next(1) == TokenKind::DoubleColon)
+                    add(result.scopeReferences, tokens[i]);
+                else if (startsItem(tokens, i) && isInstantiation(tokens, i))
+                    add(result.references, tokens[i]);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+// Removes duplicates while keeping the first occurrence of each entry in place.
+void removeDuplicates(std::vector<std::string>& list) {
+    std::unordered_set<string_view> seen;
+    std::vector<std::string> unique;
+    for (auto& entry : list) {
+        if (seen.insert(entry).second)
+            unique.push_back(entry);
+    }
+    list = std::move(unique);
+}
+
+}
+
+namespace slang {
+
+FileDependencies DependencyScanner::scanFile(const std::string& path,
+                                             const FileCallback& onFileRead) const {
+    FileDependencies result;
+
+    SourceManager sourceManager;
+    sourceManager.setTrackIncludeMisses(true);
+    for (auto& dir : userDirs)
+        sourceManager.addUserDirectory(string_view(dir));
+    for (auto& dir : systemDirs)
+        sourceManager.addSystemDirectory(string_view(dir));
+
+    SourceBuffer buffer = sourceManager.readSource(path);
+    if (!buffer) {
+        result.diagnostics = "error: no such file or directory: '" + path + "'\n";
+        return result;
+    }
+
+    Bag options;
+    options.add(ppOptions);
+
+    BumpAllocator alloc;
+    Diagnostics diagnostics;
+    Preprocessor preprocessor(sourceManager, alloc, diagnostics, options);
+    preprocessor.pushSource(buffer);
+
+    ScannedTokens tokens;
+    while (true) {
+        Token token = preprocessor.next();
+        if (token.kind == TokenKind::EndOfFile)
+            break;
+        tokens.push_back(token);
+    }
+
+    scanTokens(tokens, result);
+
+    // Buffers read from disk carry a null terminator that isn't part of the file.
+    auto fileText = [&](BufferID id) {
+        string_view text = sourceManager.getSourceText(id);
+        return text.substr(0, text.empty() ? 0 : text.size() - 1);
+    };
+
+    if (onFileRead)
+        onFileRead(path, fileText(buffer.id));
+
+    for (BufferID included : preprocessor.getIncludedFiles()) {
+        auto& includePath = result.includes.emplace_back(sourceManager.getRawFileName(included));
+        if (onFileRead)
+            onFileRead(includePath, fileText(included));
+    }
+
+    for (auto& miss : sourceManager.getIncludeMisses())
+        result.missingIncludes.push_back(miss);
+
+    removeDuplicates(result.references);
+    removeDuplicates(result.includes);
+    removeDuplicates(result.missingIncludes);
+    removeDuplicates(result.scopeReferences);
+
+    // Scoped names that are also imported are already hard dependencies.
+    std::unordered_set<string_view> references(result.references.begin(), result.references.end());
+    result.scopeReferences.erase(
+        std::remove_if(result.scopeReferences.begin(), result.scopeReferences.end(),
+                       [&](const std::string& name) { return references.count(name) != 0; }),
+        result.scopeReferences.end());
+
+    if (!diagnostics.empty()) {
+        diagnostics.sort(sourceManager);
+        result.diagnostics = DiagnosticWriter(sourceManager).report(diagnostics);
+    }
+
+    return result;
+}
+
+}
@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+// DependencyScanner.h
+// Token based scanning of source files for build dependencies.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "lexing/Preprocessor.h"
+
+namespace slang {
+
+/// The dependency information extracted from a single source file.
+struct FileDependencies {
+    /// Names of the modules, interfaces, programs, and packages declared in the file.
+    std::vector<std::string> declarations;
+
+    /// Names of the design elements instantiated and packages imported by the file.
+    std::vector<std::string> references;
+
+    /// Names used as the prefix of a scoped name (foo::bar). These usually refer to
+    /// packages but can also be classes, so they only count as dependencies when a
+    /// matching declaration exists somewhere.
+    std::vector<std::string> scopeReferences;
+
+    /// Full paths of all files included by the file, directly or indirectly.
+    std::vector<std::string> includes;
+
+    /// Paths that were searched for an include file and didn't exist. If any of
+    /// these shows up later, an include could resolve to a different file.
+    std::vector<std::string> missingIncludes;
+
+    /// Rendered diagnostics issued while scanning, if there were any.
+    std::string diagnostics;
+};
+
+/// Pulls declarations, instantiations, package imports, and includes out of source
+/// files without building syntax trees. Files are run through the preprocessor, so
+/// macros and conditional directives are honored, and the resulting token stream is
+/// matched against the common forms of each construct.
+///
+/// Each scan uses its own source manager and allocator, so a single scanner can be
+/// shared by any number of threads.
+class DependencyScanner {
+public:
+    void addUserDirectory(const std::string& dir) { userDirs.push_back(dir); }
+    void addSystemDirectory(const std::string& dir) { systemDirs.push_back(dir); }
+    void setPreprocessorOptions(const PreprocessorOptions& options) { ppOptions = options; }
+
+    /// Called with the path and text of the scanned file and of each file it includes,
+    /// so that callers can fingerprint them without reading them a second time.
+    using FileCallback = std::function<void(const std::string& path, string_view text)>;
+
+    /// Scans the file at the given path. If the file can't be read, the returned
+    /// diagnostics say so and everything else is empty.
+    FileDependencies scanFile(const std::string& path, const FileCallback& onFileRead = {}) const;
+
+private:
+    std::vector<std::string> userDirs;
+    std::vector<std::string> systemDirs;
+    PreprocessorOptions ppOptions;
+};
+
+}
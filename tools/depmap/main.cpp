@@ -2,112 +2,292 @@
 // This tool takes a list of directories, finds all SystemVerilog files within those directories,
 // and produces a map of dependencies for use with build systems.
 
-#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <set>
 #include <string>
+#include <thread>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
-#include "parsing/SyntaxTree.h"
-#include "parsing/SyntaxVisitor.h"
+#include <CLI/CLI.hpp>
+
+#include "text/SourceManager.h"
+
+#include "DependencyDatabase.h"
+#include "DependencyScanner.h"
 
 using namespace slang;
 
-class DependencyMapper : public SyntaxVisitor<DependencyMapper> {
-public:
-    void addIncludeDir(const std::string& dir) {
-        sourceManager.addUserDirectory(string_view(dir));
-    }
+// Gets the dependencies of all of the given files, spreading the work across threads.
+// Files with a still valid entry in the database (if there is one) aren't rescanned.
+// The results are in the same order as the files.
+std::vector<DatabaseEntry> scanFiles(const DependencyScanner& scanner,
+                                     const DependencyDatabase* database,
+                                     const std::vector<std::string>& files,
+                                     uint32_t threadCount, size_t& rescanned) {
+    std::vector<DatabaseEntry> results(files.size());
+    std::atomic<size_t> nextIndex = 0;
+    std::atomic<size_t> scanCount = 0;
+    auto work = [&] {
+        for (size_t i = nextIndex++; i < files.size(); i = nextIndex++) {
+            if (!database) {
+                results[i].dependencies = scanner.scanFile(files[i]);
+                continue;
+            }
+
+            if (auto entry = database->revalidate(files[i]))
+                results[i] = std::move(*entry);
+            else {
+                results[i] = DatabaseEntry::scan(scanner, files[i]);
+                scanCount++;
+            }
+        }
+    };
 
-    void parseFile(const std::string& path) {
-        currentFile = path;
-        auto tree = SyntaxTree::fromFile(currentFile, sourceManager);
-        //visitNode(&tree->root());
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    threadCount = (uint32_t)std::max<size_t>(1, std::min<size_t>(threadCount, files.size()));
 
-        printf("%s", tree->reportDiagnostics().c_str());
-        //printf("%s", tree->root().toString(SyntaxToStringFlags::IncludePreprocessed | SyntaxToStringFlags::IncludeTrivia).c_str());
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < threadCount; i++)
+        threads.emplace_back(work);
+    work();
+
+    for (auto& thread : threads)
+        thread.join();
+
+    rescanned = database ? scanCount.load() : files.size();
+    return results;
+}
+
+// Hashes all of the options that can change scan results, so that a database
+// created with different options isn't used.
+uint64_t hashOptions(std::initializer_list<const std::vector<std::string>*> lists) {
+    uint64_t hash = hashBytes(nullptr, 0);
+    for (auto list : lists) {
+        uint64_t count = list->size();
+        hash = hashBytes(&count, sizeof(count), hash);
+        for (auto& str : *list) {
+            uint64_t length = str.size();
+            hash = hashBytes(&length, sizeof(length), hash);
+            hash = hashBytes(str.data(), str.size(), hash);
+        }
     }
+    return hash;
+}
 
-    void visit(const ModuleHeaderSyntax& header) {
-        std::string name { header.name.valueText() };
-        if (!name.empty()) {
-            auto pair = declToFile.try_emplace(name, currentFile);
+// Resolves the names referenced by each file to the files that declare them. The
+// result holds, for each file, the set of other files it depends on, including
+// anything it includes.
+std::vector<std::set<std::string>> resolveDependencies(const std::vector<std::string>& files,
+                                                       const std::vector<DatabaseEntry>& results) {
+    // Map from source element (module declaration, package declaration) to file.
+    std::unordered_map<std::string, const std::string*> declToFile;
+    for (size_t i = 0; i < files.size(); i++) {
+        for (auto& name : results[i].dependencies.declarations) {
+            auto pair = declToFile.try_emplace(name, &files[i]);
             if (!pair.second) {
-                printf("Duplicate declaration: %s (%s, %s)\n",
-                       name.c_str(), currentFile.c_str(),
-                       pair.first->second.c_str());
+                fprintf(stderr, "Duplicate declaration: %s (%s, %s)\n",
+                        name.c_str(), files[i].c_str(), pair.first->second->c_str());
             }
         }
     }
 
-    void visit(const HierarchyInstantiationSyntax& instantiation) {
-        std::string name { instantiation.type.valueText() };
-        if (!name.empty())
-            fileToDeps[currentFile].insert(name);
+    std::vector<std::set<std::string>> fileToDeps(files.size());
+    for (size_t i = 0; i < files.size(); i++) {
+        auto& deps = fileToDeps[i];
+        deps.insert(results[i].dependencies.includes.begin(),
+                    results[i].dependencies.includes.end());
+
+        for (auto& name : results[i].dependencies.references) {
+            auto it = declToFile.find(name);
+            if (it == declToFile.end())
+                fprintf(stderr, "Couldn't find decl: %s\n", name.c_str());
+            else
+                deps.insert(*it->second);
+        }
+
+        // Scoped names might refer to classes, so they're only dependencies if they resolve.
+        for (auto& name : results[i].dependencies.scopeReferences) {
+            auto it = declToFile.find(name);
+            if (it != declToFile.end())
+                deps.insert(*it->second);
+        }
+
+        deps.erase(files[i]);
     }
 
-    void visit(const PackageImportItemSyntax& packageImport) {
-        std::string name { packageImport.package.valueText() };
-        if (!name.empty())
-            fileToDeps[currentFile].insert(name);
+    return fileToDeps;
+}
+
+// Escapes a path for use in a depfile. Make and Ninja both accept backslash-escaped
+// spaces and doubled dollar signs; Make also treats '#' as the start of a comment.
+std::string escapeDepfilePath(const std::string& path, bool forMake) {
+    std::string result;
+    for (char c : path) {
+        if (c == ' ' || (c == '#' && forMake))
+            result += '\\';
+        else if (c == '$')
+            result += '$';
+        result += c;
     }
+    return result;
+}
 
-    void printDeps() {
-        for (const auto& fileAndSet : fileToDeps) {
-            const std::string& file = fileAndSet.first;
-            for (const auto& dep : fileAndSet.second) {
-                auto it = declToFile.find(dep);
-                if (it == declToFile.end())
-                    printf("Couldn't find decl: %s\n", dep.c_str());
-                else if (it->second != file)
-                    printf("%s: %s\n", file.c_str(), it->second.c_str());
-            }
+// Writes a rule for each file listing everything it depends on. The list of files
+// must be sorted. For Make, an empty
+// rule is added for each dependency as well (like gcc's -MP) so that the build doesn't
+// break when one of them is deleted; Ninja doesn't need them.
+void writeDepfile(FILE* file, const std::vector<std::string>& files,
+                  const std::vector<std::set<std::string>>& fileToDeps,
+                  const std::string& targetSuffix, bool forMake) {
+    std::set<std::string> allDeps;
+    for (size_t i = 0; i < files.size(); i++) {
+        fprintf(file, "%s:", escapeDepfilePath(files[i] + targetSuffix, forMake).c_str());
+        for (auto& dep : fileToDeps[i]) {
+            fprintf(file, " \\\n  %s", escapeDepfilePath(dep, forMake).c_str());
+            // Sources that are themselves targets already have a rule.
+            bool isTarget = targetSuffix.empty() &&
+                            std::binary_search(files.begin(), files.end(), dep);
+            if (forMake && !isTarget)
+                allDeps.insert(dep);
         }
+        fprintf(file, "\n");
     }
 
-private:
-    SourceManager sourceManager;
-    std::string currentFile;
+    for (auto& dep : allDeps)
+        fprintf(file, "\n%s:\n", escapeDepfilePath(dep, true).c_str());
+}
 
-    // Map from source element (module declaration, package declaration) to file.
-    std::unordered_map<std::string, std::string> declToFile;
+int main(int argc, char** argv)
+try {
+    std::vector<std::string> paths;
+    std::vector<std::string> includeDirs;
+    std::vector<std::string> includeSystemDirs;
+    std::vector<std::string> defines;
+    std::vector<std::string> undefines;
+    std::vector<std::string> extensions;
+    std::string depfile;
+    std::string depfileFormat = "make";
+    std::string targetSuffix;
+    std::string databasePath;
+    uint32_t threadCount = 0;
+    bool verbose = false;
 
-    // Map from file to a dependency (via a module instantiation or package reference).
-    std::unordered_map<std::string, std::unordered_set<std::string>> fileToDeps;
-};
+    CLI::App cmd("SystemVerilog dependency mapper");
+    cmd.add_option("paths", paths, "Source files to scan, or directories to search for source files");
+    cmd.add_option("-I,--include-directory", includeDirs, "Additional include search paths");
+    cmd.add_option("--include-system-directory", includeSystemDirs, "Additional system include search paths");
+    cmd.add_option("-D,--define-macro", defines, "Define <macro>=<value> (or 1 if <value> ommitted) in all source files");
+    cmd.add_option("-U,--undefine-macro", undefines, "Undefine macro name at the start of all source files");
+    cmd.add_option("--ext", extensions, "File extensions to look for when searching directories (default: .sv)");
+    cmd.add_option("-j,--threads", threadCount, "Number of threads to scan with (default: one per hardware thread)");
+    cmd.add_option("-M,--depfile", depfile, "Write a dependency file for the build system instead of printing the map");
+    cmd.add_option("--depfile-format", depfileFormat, "Format of the dependency file: 'make' or 'ninja'");
+    cmd.add_option("--depfile-target-suffix", targetSuffix, "Suffix added to each source file name to form its target in the dependency file");
+    cmd.add_option("--database", databasePath, "Dependency database used to skip rescanning files that haven't changed; created if it doesn't exist");
+    cmd.add_flag("-v,--verbose", verbose, "Report how many files had to be scanned");
 
-int main(int argc, char* argv[]) {
-    if (argc < 2) {
-        fprintf(stderr, "Usage: slang-depmap [directories...]\n");
+    try {
+        cmd.parse(argc, argv);
+    }
+    catch (const CLI::ParseError& e) {
+        return cmd.exit(e);
+    }
+
+    if (depfileFormat != "make" && depfileFormat != "ninja") {
+        fprintf(stderr, "error: unknown depfile format '%s'\n", depfileFormat.c_str());
         return 1;
     }
 
+    if (extensions.empty())
+        extensions.push_back(".sv");
+
     // Find all Verilog files in the given directories.
-    DependencyMapper mapper;
-    std::vector<fs::path> verilogFiles;
-    for (int i = 1; i < argc; i++) {
-        if (argv[i][0] == '-') {
-            switch (argv[i][1]) {
-                case 'I':
-                    mapper.addIncludeDir(argv[i] + 2);
-                    break;
-                default:
-                    fprintf(stderr, "Unknown option: %s\n", argv[i]);
-                    break;
+    std::vector<std::string> files;
+    for (const std::string& path : paths) {
+        if (fs::is_directory(path)) {
+            for (auto& entry : fs::recursive_directory_iterator(path)) {
+                auto ext = entry.path().extension().string();
+                if (entry.is_regular_file() &&
+                    std::find(extensions.begin(), extensions.end(), ext) != extensions.end()) {
+                    files.push_back(entry.path().string());
+                }
             }
         }
+        else if (fs::exists(path)) {
+            files.push_back(path);
+        }
         else {
-            for (auto& entry : fs::recursive_directory_iterator(argv[i])) {
-                if (entry.is_regular_file() && entry.path().filename().extension() == ".sv")
-                    verilogFiles.push_back(entry.path());
-            }
+            fprintf(stderr, "error: no such file or directory: '%s'\n", path.c_str());
+            return 1;
+        }
+    }
+
+    if (files.empty()) {
+        fprintf(stderr, "error: no input files\n");
+        return 1;
+    }
+
+    // Sort so that output (and the choice of which duplicate declaration wins)
+    // doesn't depend on the order the file system returns entries.
+    std::sort(files.begin(), files.end());
+    files.erase(std::unique(files.begin(), files.end()), files.end());
+
+    PreprocessorOptions ppoptions;
+    ppoptions.predefines = defines;
+    ppoptions.undefines = undefines;
+    ppoptions.predefineSource = "<command-line>";
+
+    DependencyScanner scanner;
+    scanner.setPreprocessorOptions(ppoptions);
+    for (const std::string& dir : includeDirs)
+        scanner.addUserDirectory(dir);
+    for (const std::string& dir : includeSystemDirs)
+        scanner.addSystemDirectory(dir);
+
+    std::optional<DependencyDatabase> database;
+    if (!databasePath.empty()) {
+        database.emplace(hashOptions({ &includeDirs, &includeSystemDirs, &defines, &undefines }));
+        database->load(databasePath);
+    }
+
+    size_t rescanned;
+    auto results = scanFiles(scanner, database ? &*database : nullptr, files, threadCount, rescanned);
+    for (auto& result : results)
+        fprintf(stderr, "%s", result.dependencies.diagnostics.c_str());
+
+    if (verbose)
+        fprintf(stderr, "Scanned %zu of %zu files\n", rescanned, files.size());
+
+    auto fileToDeps = resolveDependencies(files, results);
+
+    // Only write the database back out if something actually changed.
+    if (database && (database->assign(files, std::move(results)) || rescanned)) {
+        if (!database->save(databasePath))
+            fprintf(stderr, "warning: could not write dependency database '%s'\n", databasePath.c_str());
+    }
+    if (depfile.empty()) {
+        for (size_t i = 0; i < files.size(); i++) {
+            for (auto& dep : fileToDeps[i])
+                printf("%s: %s\n", files[i].c_str(), dep.c_str());
         }
+        return 0;
     }
 
-    // Parse each file, build a map of top-level module, interface, and
-    // package definitions.
-    for (const fs::path& path : verilogFiles)
-        mapper.parseFile(path.string());
+    FILE* output = fopen(depfile.c_str(), "wb");
+    if (!output) {
+        fprintf(stderr, "error: could not open '%s' for writing\n", depfile.c_str());
+        return 1;
+    }
 
-    mapper.printDeps();
+    writeDepfile(output, files, fileToDeps, targetSuffix, depfileFormat == "make");
+    fclose(output);
+    return 0;
+}
+catch (const std::exception& e) {
+    fprintf(stderr, "internal error (exception): %s\n", e.what());
+    return 2;
 }
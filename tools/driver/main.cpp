@@ -7,55 +7,265 @@
 
 #include "compilation/Compilation.h"
 #include "parsing/SyntaxTree.h"
+#include "util/TimeTrace.h"
 
+#include <algorithm>
 #include <CLI/CLI.hpp>
+#include <fmt/format.h>
+#include <fstream>
+#include <iostream>
 #include <nlohmann/json.hpp>
 
 using namespace slang;
 
+// Accumulates preprocessed text and writes it out in fixed size chunks so that
+// preprocessing huge files doesn't need to hold the entire result in memory.
+class ChunkedWriter {
+public:
+    explicit ChunkedWriter(FILE* file) : file(file), buffer(ChunkSize + 1024) {}
+    ~ChunkedWriter() { flush(); }
+
+    SmallVector<char>& getBuffer() { return buffer; }
+
+    void flushIfFull() {
+        if (buffer.size() >= ChunkSize)
+            flush();
+    }
+
+    void flush() {
+        if (buffer.empty())
+            return;
+
+        atLineStart = buffer.back() == '\n';
+        if (fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size())
+            failed = true;
+        buffer.clear();
+    }
+
+    // Returns true if any chunk couldn't be written out (e.g. because the disk is full).
+    bool hasFailed() const { return failed; }
+
+    // Makes sure the output is at the start of a new line.
+    void ensureNewline() {
+        if (buffer.empty() ? !atLineStart : buffer.back() != '\n')
+            buffer.append('\n');
+    }
+
+private:
+    static constexpr uint32_t ChunkSize = 1 << 16;
+
+    FILE* file;
+    SmallVectorSized<char, 64> buffer;
+    bool atLineStart = true;
+    bool failed = false;
+};
+
+// Writes a `line directive ahead of the given token if it comes from a different
+// file than the previous one, so that downstream tools can map back to the original
+// source. Level 1 marks entering an include file and level 2 marks returning to one.
+void writeLineMarker(const SourceManager& sourceManager, Token token,
+                     BufferID& currentBuffer, ChunkedWriter& writer) {
+    SourceLocation loc = sourceManager.getFullyExpandedLoc(token.location());
+    if (!loc.buffer() || loc.buffer() == currentBuffer)
+        return;
+
+    int level = 0;
+    if (currentBuffer) {
+        if (sourceManager.getIncludedFrom(loc.buffer()).buffer() == currentBuffer)
+            level = 1;
+        else {
+            for (BufferID b = currentBuffer; b; b = sourceManager.getIncludedFrom(b).buffer()) {
+                if (b == loc.buffer()) {
+                    level = 2;
+                    break;
+                }
+            }
+        }
+    }
+    currentBuffer = loc.buffer();
+
+    // The marker goes right before the token text, on its own line, and the
+    // token is indented to its original column.
+    writer.ensureNewline();
+    std::string marker = fmt::format("`line {} \"{}\" {}\n{}", sourceManager.getLineNumber(loc),
+                                     sourceManager.getFileName(loc), level,
+                                     std::string(sourceManager.getColumnNumber(loc) - 1, ' '));
+    writer.getBuffer().appendRange(marker);
+}
+
+// Prints diagnostics either as human readable text or as one JSON object per line.
+void printDiagnostics(DiagnosticWriter& writer, const Diagnostics& diagnostics, bool jsonDiagnostics,
+                      std::ostream& os) {
+    TIME_SCOPE("Render diagnostics", "");
+    if (jsonDiagnostics)
+        writer.reportJson(diagnostics, os);
+    else
+        os << writer.report(diagnostics);
+}
+
+// Only errors cause the driver to fail, which includes warnings that have been
+// promoted to errors by --Werror.
+bool hasErrors(const DiagnosticWriter& writer, const Diagnostics& diagnostics) {
+    return std::any_of(diagnostics.begin(), diagnostics.end(), [&](const Diagnostic& diag) {
+        return writer.getSeverity(diag.code) == DiagnosticSeverity::Error;
+    });
+}
+
+using ArenaStats = std::vector<std::pair<const char*, AllocatorStats>>;
+
+// Prints a breakdown of where memory went. This goes to stderr so that it doesn't get
+// mixed in with diagnostics, which might be getting parsed by another tool.
+void printMemoryStats(const SourceManager& sourceManager, const ArenaStats& arenas) {
+    auto kb = [](size_t bytes) { return fmt::format("{:.1f}", double(bytes) / 1024); };
+
+    auto sm = sourceManager.getMemoryStats();
+    fmt::print(stderr, "Source manager: {} files, {} buffers, {} expansions\n",
+               sm.fileCount, sm.bufferCount, sm.expansionCount);
+    fmt::print(stderr, "  text {} KB, line tables {} KB, bookkeeping {} KB, total {} KB\n\n",
+               kb(sm.textBytes), kb(sm.lineTableBytes), kb(sm.bookkeepingBytes), kb(sm.totalBytes()));
+
+    fmt::print(stderr, "{:<14}{:>14}{:>14}{:>14}{:>14}{:>10}{:>8}\n", "Arena", "Requested KB",
+               "Alignment KB", "Reserved KB", "Overhead KB", "Segments", "Large");
+    for (auto& [name, stats] : arenas) {
+        fmt::print(stderr, "{:<14}{:>14}{:>14}{:>14}{:>14}{:>10}{:>8}\n", name,
+                   kb(stats.bytesRequested), kb(stats.alignmentWaste), kb(stats.bytesReserved),
+                   kb(stats.segmentWaste), stats.segmentCount, stats.largeAllocationCount);
+    }
+}
+
 bool runPreprocessor(SourceManager& sourceManager, const Bag& options,
-                    const std::vector<SourceBuffer>& buffers) {
+                     const std::vector<SourceBuffer>& buffers, FILE* outputFile,
+                     bool lineMarkers, bool jsonDiagnostics, std::ostream& diagOutput,
+                     bool memStats) {
     BumpAllocator alloc;
     DiagnosticWriter writer(sourceManager);
+    writer.setFilter(options.getOrDefault<DiagnosticOptions>().filter);
 
     bool success = true;
     for (const SourceBuffer& buffer : buffers) {
         Diagnostics diagnostics;
+        diagnostics.setFilter(options.getOrDefault<DiagnosticOptions>().filter);
+
         Preprocessor preprocessor(sourceManager, alloc, diagnostics, options);
         preprocessor.pushSource(buffer);
 
-        SmallVectorSized<char, 32> output;
-        while (true) {
-            Token token = preprocessor.next();
-            token.writeTo(output, SyntaxToStringFlags::IncludePreprocessed | SyntaxToStringFlags::IncludeTrivia);
-            if (token.kind == TokenKind::EndOfFile)
-                break;
+        if (outputFile == stdout) {
+            printf("%s:\n==============================\n",
+                   std::string(sourceManager.getRawFileName(buffer.id)).c_str());
         }
 
-        if (diagnostics.empty())
-            printf("%s:\n", std::string(sourceManager.getRawFileName(buffer.id)).c_str());
-        else {
-            printf("%s", writer.report(diagnostics).c_str());
-            success = false;
+        {
+            ChunkedWriter output(outputFile);
+            BufferID currentBuffer;
+            size_t reported = 0;
+            auto flags = SyntaxToStringFlags::IncludePreprocessed | SyntaxToStringFlags::IncludeTrivia;
+
+            while (true) {
+                Token token = preprocessor.next();
+                if (lineMarkers && token.kind != TokenKind::EndOfFile) {
+                    for (const auto& trivia : token.trivia())
+                        trivia.writeTo(output.getBuffer(), flags);
+                    writeLineMarker(sourceManager, token, currentBuffer, output);
+                    token.writeTo(output.getBuffer(), SyntaxToStringFlags::IncludePreprocessed);
+                }
+                else {
+                    token.writeTo(output.getBuffer(), flags);
+                }
+
+                output.flushIfFull();
+
+                // JSON diagnostics go out as soon as the preprocessor issues them,
+                // so that consumers don't have to wait for the whole file.
+                if (jsonDiagnostics) {
+                    while (reported < diagnostics.size())
+                        writer.reportJson(diagnostics[reported++], diagOutput);
+                }
+
+                if (token.kind == TokenKind::EndOfFile)
+                    break;
+            }
+            output.getBuffer().append('\n');
+            output.flush();
+
+            // There's no point in carrying on if the output is going nowhere.
+            if (output.hasFailed() || fflush(outputFile) != 0) {
+                fprintf(stderr, "error: failed to write preprocessed output\n");
+                return false;
+            }
         }
 
-        printf("==============================\n%s\n", std::string(output.begin(), output.size()).c_str());
+        if (!diagnostics.empty()) {
+            if (!jsonDiagnostics)
+                printDiagnostics(writer, diagnostics, false, diagOutput);
+            if (hasErrors(writer, diagnostics))
+                success = false;
+        }
+    }
+
+    if (memStats) {
+        fflush(outputFile);
+        printMemoryStats(sourceManager, { { "preprocessor", alloc.getStats() } });
     }
     return success;
 }
 
+// Prints event counts and how often each definition got instantiated, also to stderr.
+void printStatistics(const Compilation& compilation) {
+    auto stats = compilation.getStatistics();
+    fmt::print(stderr, "{:<30}{:>14}\n", "Counter", "Count");
+    for (size_t i = 0; i < PerfCounterCount; i++)
+        fmt::print(stderr, "{:<30}{:>14}\n", toString(PerfCounter(i)), stats.counters[i]);
+
+    auto lookups = stats.counters[size_t(PerfCounter::NameLookups)];
+    if (lookups) {
+        auto searched = stats.counters[size_t(PerfCounter::LookupScopesSearched)];
+        fmt::print(stderr, "{:<30}{:>14.2f}\n", "scopes searched per lookup", double(searched) / double(lookups));
+    }
+
+    // Only show the most instantiated definitions; large designs can have thousands.
+    const size_t MaxDefinitions = 20;
+    auto& definitions = stats.instancesPerDefinition;
+    fmt::print(stderr, "\n{:<30}{:>14}\n", "Definition", "Instances");
+    for (size_t i = 0; i < definitions.size() && i < MaxDefinitions; i++)
+        fmt::print(stderr, "{:<30}{:>14}\n", definitions[i].first, definitions[i].second);
+    if (definitions.size() > MaxDefinitions)
+        fmt::print(stderr, "({} more definitions)\n", definitions.size() - MaxDefinitions);
+}
+
 bool runCompiler(SourceManager& sourceManager, const Bag& options,
-                 const std::vector<SourceBuffer>& buffers) {
+                 const std::vector<SourceBuffer>& buffers, bool jsonDiagnostics,
+                 std::ostream& diagOutput, bool memStats, bool stats) {
+    TIME_SCOPE("Compile", "");
 
     Compilation compilation;
+    compilation.setDiagnosticFilter(options.getOrDefault<DiagnosticOptions>().filter);
     for (const SourceBuffer& buffer : buffers)
         compilation.addSyntaxTree(SyntaxTree::fromBuffer(buffer, sourceManager, options));
 
-    Diagnostics diagnostics = compilation.getAllDiagnostics();
+    auto& diagnostics = compilation.getAllDiagnostics();
     DiagnosticWriter writer(sourceManager);
-    printf("%s\n", writer.report(diagnostics).c_str());
+    writer.setFilter(options.getOrDefault<DiagnosticOptions>().filter);
+    writer.setThreadCount(0);
+    printDiagnostics(writer, diagnostics, jsonDiagnostics, diagOutput);
+    if (!jsonDiagnostics)
+        diagOutput << '\n';
+
+    if (memStats) {
+        diagOutput.flush();
+        auto stats = compilation.getMemoryStats();
+        printMemoryStats(sourceManager, { { "syntax trees", stats.syntaxTrees },
+                                          { "symbols", stats.symbols },
+                                          { "symbol maps", stats.symbolMaps },
+                                          { "constants", stats.constants },
+                                          { "total", stats.total() } });
+    }
+
+    if (stats) {
+        diagOutput.flush();
+        printStatistics(compilation);
+    }
 
-    return diagnostics.empty();
+    return !hasErrors(writer, diagnostics);
 }
 
 int main(int argc, char** argv)
@@ -66,7 +276,20 @@ try {
     std::vector<std::string> defines;
     std::vector<std::string> undefines;
 
+    std::string outputFile;
+    std::string timeTraceFile;
+    std::string diagFormat = "text";
+    std::string diagOutputFile;
+    std::vector<std::string> enabledWarnings;
+    std::vector<std::string> disabledWarnings;
+    std::vector<std::string> suppressedFiles;
+    uint32_t warningLevel = 1;
+    bool warningsAsErrors = false;
+    bool memStats = false;
+    bool stats = false;
+
     bool onlyPreprocess;
+    bool lineMarkers;
 
     CLI::App cmd("SystemVerilog compiler");
     cmd.add_option("files", sourceFiles, "Source files to compile");
@@ -75,6 +298,18 @@ try {
     cmd.add_option("-D,--define-macro", defines, "Define <macro>=<value> (or 1 if <value> ommitted) in all source files");
     cmd.add_option("-U,--undefine-macro", undefines, "Undefine macro name at the start of all source files");
     cmd.add_flag("-E,--preprocess", onlyPreprocess, "Only run the preprocessor (and print preprocessed files to stdout)");
+    cmd.add_flag("--line-markers", lineMarkers, "Emit `line directives in preprocessed output to map back to the original source");
+    cmd.add_option("-o,--output", outputFile, "Write preprocessed output to the given file instead of stdout");
+    cmd.add_option("--diag-format", diagFormat, "Format to use when printing diagnostics: 'text' or 'json' (one object per line)");
+    cmd.add_option("--diag-output", diagOutputFile, "Write diagnostics to the given file instead of stdout (text) or stderr (json)");
+    cmd.add_option("--warning-level", warningLevel, "Warning level (0 disables all warnings, higher levels enable more)");
+    cmd.add_option("--enable-warning", enabledWarnings, "Enable the named warning regardless of warning level");
+    cmd.add_option("--disable-warning", disabledWarnings, "Disable the named warning");
+    cmd.add_option("--suppress-warnings-in", suppressedFiles, "Suppress all warnings in the given file");
+    cmd.add_flag("--Werror", warningsAsErrors, "Treat warnings as errors");
+    cmd.add_flag("--mem-stats", memStats, "Print a report of memory used by each part of the compiler");
+    cmd.add_flag("--stats", stats, "Print counts of the work done while compiling and of the instances of each definition");
+    cmd.add_option("--time-trace", timeTraceFile, "Write a Chrome trace of where time went during compilation to the given file");
 
     try {
         cmd.parse(argc, argv);
@@ -83,6 +318,27 @@ try {
         return cmd.exit(e);
     }
 
+    if (diagFormat != "text" && diagFormat != "json") {
+        printf("error: unknown diagnostic format '%s'\n", diagFormat.c_str());
+        return 1;
+    }
+    bool jsonDiagnostics = diagFormat == "json";
+
+    // JSON diagnostics never share a stream with preprocessed output, so that
+    // whatever is consuming them can parse the whole thing.
+    std::ofstream diagFile;
+    if (!diagOutputFile.empty()) {
+        diagFile.open(diagOutputFile);
+        if (!diagFile) {
+            printf("error: could not open '%s' for writing\n", diagOutputFile.c_str());
+            return 1;
+        }
+    }
+    std::ostream& diagOutput = diagFile.is_open() ? diagFile : jsonDiagnostics ? std::cerr : std::cout;
+
+    if (!timeTraceFile.empty())
+        TimeTrace::initialize();
+
     SourceManager sourceManager;
     for (const std::string& dir : includeDirs)
         sourceManager.addUserDirectory(string_view(dir));
@@ -95,12 +351,35 @@ try {
     ppoptions.undefines = undefines;
     ppoptions.predefineSource = "<command-line>";
 
+    DiagnosticFilter diagFilter(sourceManager);
+    diagFilter.setWarningLevel(warningLevel);
+    diagFilter.setWarningsAsErrors(warningsAsErrors);
+    for (const std::string& file : suppressedFiles)
+        diagFilter.suppressFile(file);
+
+    for (auto [names, enable] : { std::make_pair(&enabledWarnings, true),
+                                  std::make_pair(&disabledWarnings, false) }) {
+        for (const std::string& name : *names) {
+            auto code = diagCodeFromString(name);
+            if (!code) {
+                printf("error: unknown diagnostic '%s'\n", name.c_str());
+                return 1;
+            }
+            diagFilter.setEnabled(*code, enable);
+        }
+    }
+
+    DiagnosticOptions diagOptions;
+    diagOptions.filter = &diagFilter;
+
     Bag options;
     options.add(ppoptions);
+    options.add(diagOptions);
 
     bool anyErrors = false;
     std::vector<SourceBuffer> buffers;
     for (const std::string& file : sourceFiles) {
+        TIME_SCOPE("Read file", file);
         SourceBuffer buffer = sourceManager.readSource(file);
         if (!buffer) {
             printf("error: no such file or directory: '%s'\n", file.c_str());
@@ -116,10 +395,36 @@ try {
         return 1;
     }
 
-    if (onlyPreprocess)
-        anyErrors |= !runPreprocessor(sourceManager, options, buffers);
+    if (onlyPreprocess) {
+        FILE* output = stdout;
+        if (!outputFile.empty()) {
+            output = fopen(outputFile.c_str(), "wb");
+            if (!output) {
+                printf("error: could not open '%s' for writing\n", outputFile.c_str());
+                return 1;
+            }
+        }
+
+        anyErrors |= !runPreprocessor(sourceManager, options, buffers, output, lineMarkers,
+                                      jsonDiagnostics, diagOutput, memStats);
+        if (output != stdout && fclose(output) != 0) {
+            fprintf(stderr, "error: failed to write '%s'\n", outputFile.c_str());
+            anyErrors = true;
+        }
+    }
     else
-        anyErrors |= !runCompiler(sourceManager, options, buffers);
+        anyErrors |= !runCompiler(sourceManager, options, buffers, jsonDiagnostics, diagOutput,
+                                  memStats, stats);
+
+    if (!timeTraceFile.empty()) {
+        TimeTrace::stop();
+        std::ofstream traceFile(timeTraceFile);
+        if (!traceFile) {
+            printf("error: could not open '%s' for writing\n", timeTraceFile.c_str());
+            return 1;
+        }
+        TimeTrace::write(traceFile);
+    }
 
     return anyErrors ? 1 : 0;
 }
@@ -0,0 +1,187 @@
+//------------------------------------------------------------------------------
+// DesignGenerator.cpp
+// Generation of synthetic designs for stress testing.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#include "DesignGenerator.h"
+
+#include <algorithm>
+
+namespace {
+
+using namespace slang;
+
+std::string moduleName(int level, int index) {
+    if (level == 0)
+        return "top";
+    return "l" + std::to_string(level) + "_m" + std::to_string(index);
+}
+
+std::string headerName(int index) {
+    return "gen_macros" + std::to_string(index) + ".svh";
+}
+
+// Number of distinct definitions at the given level. This never exceeds the number
+// of instances at that level, so that every definition ends up instantiated and none
+// of them turn into extra top level modules.
+int definitionCount(const DesignOptions& options, int level) {
+    uint64_t instances = 1;
+    for (int i = 0; i < level && instances < (uint64_t)options.modulesPerLevel; i++)
+        instances *= (uint64_t)options.fanout;
+    return (int)std::min<uint64_t>(instances, (uint64_t)options.modulesPerLevel);
+}
+
+std::string generateMacros(int header) {
+    auto h = std::to_string(header);
+    std::string text;
+    text += "`define GEN" + h + "_DECLARE(name, width) logic [(width)-1:0] name;\n";
+    text += "`define GEN" + h + "_MAX(a, b) ((a) > (b) ? (a) : (b))\n";
+    return text;
+}
+
+std::string generateHeader(int header) {
+    auto guard = "GEN_MACROS" + std::to_string(header) + "_SVH";
+    std::string text;
+    text += "`ifndef " + guard + "\n";
+    text += "`define " + guard + "\n";
+    text += generateMacros(header);
+    text += "`endif\n";
+    return text;
+}
+
+std::string generatePackage(const DesignOptions& options, int index) {
+    auto p = std::to_string(index);
+    auto loops = std::to_string(options.functionComplexity);
+    std::string text;
+    text += "package pkg" + p + ";\n";
+    text += "    typedef logic [" + std::to_string(7 + index % 8) + ":0] word" + p + "_t;\n";
+    text += "    parameter int Base" + p + " = " + std::to_string(index * 3 + 1) + ";\n";
+    text += "    localparam int Limit" + p + " = Base" + p + " + " + loops + ";\n";
+    text += "    function automatic int scramble(int w, int salt);\n";
+    text += "        int acc = w + salt;\n";
+    text += "        for (int i = 0; i < " + loops + "; i += 1)\n";
+    text += "            acc = (acc * 31 + i + Base" + p + ") % 65521;\n";
+    text += "        return acc;\n";
+    text += "    endfunction\n";
+    text += "endpackage\n\n";
+    return text;
+}
+
+std::string generateModule(const DesignOptions& options, int level, int index) {
+    bool isLeaf = level == options.depth - 1;
+    std::string text;
+    text += "module " + moduleName(level, index) + " #(parameter int W = 8)(\n";
+    text += "    input logic clk,\n";
+    text += "    input logic [W-1:0] data_in,\n";
+    text += "    output logic [W-1:0] data_out\n";
+    text += ");\n";
+
+    // Imports, and parameters computed by calling into the packages. The unqualified
+    // reference to the first package's parameter goes through the wildcard import.
+    std::string seed = "W";
+    if (options.packageCount > 0) {
+        for (int i = 0; i < options.importsPerModule; i++)
+            text += "    import pkg" + std::to_string((index + level + i) % options.packageCount) + "::*;\n";
+
+        auto p = std::to_string((index + level) % options.packageCount);
+        text += "    localparam int Seed = pkg" + p + "::scramble(W, " + std::to_string(index) + ");\n";
+        if (options.importsPerModule > 0)
+            text += "    localparam int Offset = Base" + p + " + 1;\n";
+        text += "    pkg" + p + "::word" + p + "_t word;\n";
+        seed = "Seed";
+    }
+
+    text += "    logic [W-1:0] state;\n";
+    int headers = std::max(options.headerCount, 1);
+    for (int i = 0; i < options.macroUses; i++) {
+        auto h = std::to_string(i % headers);
+        text += "    `GEN" + h + "_DECLARE(sig" + std::to_string(i) + ", `GEN" + h + "_MAX(W, " +
+                std::to_string(i + 1) + "))\n";
+    }
+
+    if (isLeaf) {
+        text += "    for (genvar i = 0; i < " + std::to_string(options.generateSize) + "; i += 1) begin : gen\n";
+        text += "        localparam int Tap = i + " + seed + ";\n";
+        text += "        logic [W-1:0] stage;\n";
+        text += "    end\n";
+    }
+    else {
+        int childDefinitions = definitionCount(options, level + 1);
+        for (int i = 0; i < options.fanout; i++) {
+            int child = (index * options.fanout + i) % childDefinitions;
+            text += "    " + moduleName(level + 1, child) + " #(.W(W + " + std::to_string(i % 2) +
+                    ")) u" + std::to_string(i) + "(.clk(clk), .data_in(data_in), .data_out());\n";
+        }
+    }
+
+    text += "endmodule\n\n";
+    return text;
+}
+
+}
+
+namespace slang {
+
+std::vector<GeneratedFile> generateDesign(const DesignOptions& rawOptions) {
+    DesignOptions options = rawOptions;
+    options.fileCount = std::max(options.fileCount, 1);
+    options.depth = std::max(options.depth, 1);
+    options.fanout = std::max(options.fanout, 1);
+    options.modulesPerLevel = std::max(options.modulesPerLevel, 1);
+    options.packageCount = std::max(options.packageCount, 0);
+    options.importsPerModule = std::clamp(options.importsPerModule, 0, options.packageCount);
+    options.headerCount = std::max(options.headerCount, 0);
+    options.macroUses = std::max(options.macroUses, 0);
+
+    std::vector<GeneratedFile> files;
+    for (int i = 0; i < options.headerCount; i++)
+        files.push_back({ headerName(i), generateHeader(i) });
+
+    // Every module file starts out with the macro definitions it needs, either by
+    // including the headers or by defining them directly.
+    std::string prologue;
+    if (options.headerCount > 0) {
+        for (int i = 0; i < options.headerCount; i++)
+            prologue += "`include \"" + headerName(i) + "\"\n";
+    }
+    else if (options.macroUses > 0) {
+        prologue = generateMacros(0);
+    }
+    prologue += "\n";
+
+    if (options.packageCount > 0) {
+        GeneratedFile& packages = files.emplace_back(GeneratedFile{ "gen_pkgs.sv", "" });
+        for (int i = 0; i < options.packageCount; i++)
+            packages.text += generatePackage(options, i);
+    }
+
+    size_t firstModuleFile = files.size();
+    for (int i = 0; i < options.fileCount; i++)
+        files.push_back({ "gen" + std::to_string(i) + ".sv", prologue });
+
+    // Deal the modules out to the files round robin, starting with the top.
+    size_t moduleCount = 0;
+    for (int level = 0; level < options.depth; level++) {
+        int definitions = definitionCount(options, level);
+        for (int i = 0; i < definitions; i++) {
+            auto& file = files[firstModuleFile + moduleCount % (size_t)options.fileCount];
+            file.text += generateModule(options, level, i);
+            moduleCount++;
+        }
+    }
+
+    return files;
+}
+
+uint64_t countDesignInstances(const DesignOptions& options) {
+    uint64_t total = 0;
+    uint64_t atLevel = 1;
+    for (int level = 0; level < std::max(options.depth, 1); level++) {
+        total += atLevel;
+        atLevel *= (uint64_t)std::max(options.fanout, 1);
+    }
+    return total;
+}
+
+}
@@ -0,0 +1,69 @@
+//------------------------------------------------------------------------------
+// DesignGenerator.h
+// Generation of synthetic designs for stress testing.
+//
+// File is under the MIT license; see LICENSE for details.
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace slang {
+
+/// Knobs that control the shape and size of a generated design.
+struct DesignOptions {
+    /// Number of source files to spread the modules across. Packages and headers
+    /// get files of their own in addition to these.
+    int fileCount = 1;
+
+    /// Number of levels in the module hierarchy, including the top module.
+    int depth = 4;
+
+    /// Number of child instances in each non-leaf module.
+    int fanout = 4;
+
+    /// Number of distinct module definitions at each level below the top. Instances
+    /// cycle through them, so this controls how much definition reuse there is.
+    int modulesPerLevel = 4;
+
+    /// Number of iterations of the generate loop in each leaf module.
+    int generateSize = 8;
+
+    /// Number of packages; each one declares a constant function, a typedef, and
+    /// a handful of parameters.
+    int packageCount = 4;
+
+    /// Number of packages wildcard imported into each module.
+    int importsPerModule = 2;
+
+    /// Number of header files holding macro definitions, included by every source
+    /// file. If zero, the macros are defined at the top of each file instead.
+    int headerCount = 1;
+
+    /// Number of macro uses in each module.
+    int macroUses = 4;
+
+    /// Number of loop iterations in each package's constant function, which gets
+    /// called to compute a parameter of every module.
+    int functionComplexity = 16;
+};
+
+/// A single file of a generated design.
+struct GeneratedFile {
+    std::string name;
+    std::string text;
+};
+
+/// Generates a design according to the given options. Headers come first, then
+/// packages, then modules, which is the order the files should be compiled in.
+/// The top module is named "top". The result is deterministic, so the same options
+/// always produce the same design.
+std::vector<GeneratedFile> generateDesign(const DesignOptions& options);
+
+/// Gets the number of module instances in a design generated with the given options,
+/// including the top module.
+uint64_t countDesignInstances(const DesignOptions& options);
+
+}
@@ -0,0 +1,82 @@
+// Synthetic SystemVerilog design generator
+// This tool writes out designs of configurable size and shape, for stress testing and
+// for checking how the compiler scales as various aspects of a design grow.
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include <CLI/CLI.hpp>
+
+#include "DesignGenerator.h"
+
+using namespace slang;
+namespace fs = std::filesystem;
+
+int main(int argc, char** argv)
+try {
+    DesignOptions options;
+    std::string outputDir = ".";
+    bool verbose = false;
+
+    CLI::App cmd("SystemVerilog design generator");
+    cmd.add_option("-o,--output-dir", outputDir, "Directory to write the generated files to; created if it doesn't exist");
+    cmd.add_option("--files", options.fileCount, "Number of files to spread the modules across");
+    cmd.add_option("--depth", options.depth, "Number of levels in the module hierarchy, including the top");
+    cmd.add_option("--fanout", options.fanout, "Number of child instances in each non-leaf module");
+    cmd.add_option("--modules-per-level", options.modulesPerLevel, "Number of distinct module definitions at each level");
+    cmd.add_option("--generate-size", options.generateSize, "Number of iterations of the generate loop in each leaf module");
+    cmd.add_option("--packages", options.packageCount, "Number of packages");
+    cmd.add_option("--imports", options.importsPerModule, "Number of packages imported into each module");
+    cmd.add_option("--headers", options.headerCount, "Number of macro headers included by each file (0 defines the macros inline)");
+    cmd.add_option("--macro-uses", options.macroUses, "Number of macro uses in each module");
+    cmd.add_option("--function-complexity", options.functionComplexity, "Number of loop iterations in each package's constant function");
+    cmd.add_flag("-v,--verbose", verbose, "Print a summary of the generated design to stderr");
+
+    try {
+        cmd.parse(argc, argv);
+    }
+    catch (const CLI::ParseError& e) {
+        return cmd.exit(e);
+    }
+
+    if (options.fileCount < 1 || options.depth < 1 || options.fanout < 1 || options.modulesPerLevel < 1) {
+        fprintf(stderr, "error: file count, depth, fanout, and modules per level must be at least 1\n");
+        return 1;
+    }
+
+    fs::path dir(outputDir);
+    fs::create_directories(dir);
+
+    // Print the paths of the files in compilation order, so that the output
+    // can be passed straight to the driver.
+    auto files = generateDesign(options);
+    size_t totalBytes = 0;
+    for (auto& file : files) {
+        fs::path path = dir / file.name;
+        FILE* output = fopen(path.string().c_str(), "wb");
+        if (!output) {
+            fprintf(stderr, "error: could not open '%s' for writing\n", path.string().c_str());
+            return 1;
+        }
+
+        fwrite(file.text.data(), 1, file.text.size(), output);
+        fclose(output);
+
+        // Headers get pulled in by include directives rather than listed.
+        if (path.extension() != ".svh")
+            printf("%s\n", path.string().c_str());
+        totalBytes += file.text.size();
+    }
+
+    if (verbose) {
+        fprintf(stderr, "Generated %zu files (%zu bytes) with %llu instances\n", files.size(),
+                totalBytes, (unsigned long long)countDesignInstances(options));
+    }
+
+    return 0;
+}
+catch (const std::exception& e) {
+    fprintf(stderr, "error: %s\n", e.what());
+    return 2;
+}